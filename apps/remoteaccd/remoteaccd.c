@@ -0,0 +1,657 @@
+/*
+
+  remoteaccd.c
+
+  Author: Pekka Riikonen <priikone@silcnet.org>
+
+  Copyright (C) 2008 Pekka Riikonen
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; version 2 of the License.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+*/
+
+#include "silcruntime.h"
+#include "silccrypto.h"
+#include "remoteacc_i.h"
+#include <sys/un.h>
+
+/* The remote accelerator daemon.  Holds the private keys and executes the
+   signature and decryption requests of the remote accelerator clients.
+   The private keys are accelerated with the software accelerator, which
+   runs the operations in threads and batches queued operations of the
+   same key.  Replies completed in the same scheduler round are written
+   to the client together. */
+
+/* Private key */
+typedef struct RemoteaccdKeyStruct {
+  struct RemoteaccdKeyStruct *next;
+  unsigned char key_id[SILC_REMOTEACC_KEY_ID_LEN];
+  SilcPublicKey public_key;
+  SilcPrivateKey private_key;		 /* Accelerated private key */
+} *RemoteaccdKey;
+
+/* Client connection */
+typedef struct RemoteaccdConnStruct {
+  struct RemoteaccdConnStruct *next;
+  SilcStream stream;			 /* Connection */
+  SilcBuffer inbuf;			 /* Partially read requests */
+  SilcBuffer outbuf;			 /* Replies not yet written */
+  SilcUInt32 pending;			 /* Running requests and reads */
+  unsigned int closed : 1;		 /* Client has disconnected */
+  unsigned int flush : 1;		 /* Flush is scheduled */
+} *RemoteaccdConn;
+
+/* Request */
+typedef struct {
+  RemoteaccdConn conn;
+  SilcUInt32 id;			 /* Request ID */
+  SilcHash hash;			 /* Hash function, may be NULL */
+} *RemoteaccdReq;
+
+static SilcSchedule schedule;
+static SilcList keys;
+static SilcList conns;
+static char *socket_path = SILC_REMOTEACC_SOCKET;
+static int listener = -1;
+static SilcBool calling = FALSE;
+static SilcBool stopping = FALSE;
+
+static void remoteaccd_write(RemoteaccdConn conn);
+
+/* Closes connection and frees it when no requests are running.  When
+   stopping, the daemon stops after the last connection is freed. */
+
+static void remoteaccd_conn_free(RemoteaccdConn conn)
+{
+  if (conn->stream) {
+    silc_stream_set_notifier(conn->stream, schedule, NULL, NULL);
+    silc_stream_destroy(conn->stream);
+    conn->stream = NULL;
+  }
+  conn->closed = TRUE;
+
+  if (conn->pending)
+    return;
+
+  SILC_LOG_DEBUG(("Free connection %p", conn));
+
+  silc_schedule_task_del_by_context(schedule, conn);
+  silc_buffer_free(conn->inbuf);
+  silc_buffer_free(conn->outbuf);
+  silc_list_del(conns, conn);
+  silc_free(conn);
+
+  if (stopping && !silc_list_count(conns))
+    silc_schedule_stop(schedule);
+}
+
+/* Flushes replies completed since last flush */
+
+SILC_TASK_CALLBACK(remoteaccd_flush)
+{
+  RemoteaccdConn conn = context;
+  conn->flush = FALSE;
+  remoteaccd_write(conn);
+}
+
+/* Encodes reply to the output buffer */
+
+static SilcBool remoteaccd_reply_add(RemoteaccdConn conn, SilcUInt32 id,
+				     SilcUInt8 status,
+				     const unsigned char *data,
+				     SilcUInt32 data_len)
+{
+  SilcBufferStruct buf;
+  SilcUInt32 len = 4 + 1 + 4 + data_len;
+
+  if (silc_buffer_taillen(conn->outbuf) < 4 + len &&
+      !silc_buffer_realloc(conn->outbuf, silc_buffer_truelen(conn->outbuf) +
+			   4 + len))
+    return FALSE;
+
+  silc_buffer_set(&buf, conn->outbuf->tail, 4 + len);
+  if (silc_buffer_format(&buf,
+			 SILC_STR_UINT32(len),
+			 SILC_STR_UINT32(id),
+			 SILC_STR_UINT8(status),
+			 SILC_STR_UI32_NSTRING(data, data_len),
+			 SILC_STR_END) < 0)
+    return FALSE;
+  silc_buffer_pull_tail(conn->outbuf, 4 + len);
+
+  return TRUE;
+}
+
+/* Adds reply to the output buffer.  If the reply cannot be added, error
+   reply is sent instead.  If even that fails the client is disconnected,
+   since it would wait for the reply forever. */
+
+static void remoteaccd_reply(RemoteaccdConn conn, SilcUInt32 id,
+			     SilcUInt8 status, const unsigned char *data,
+			     SilcUInt32 data_len)
+{
+  if (conn->closed)
+    return;
+
+  if (!remoteaccd_reply_add(conn, id, status, data, data_len) &&
+      (!data_len ||
+       !remoteaccd_reply_add(conn, id, SILC_REMOTEACC_FAILED, NULL, 0))) {
+    SILC_LOG_ERROR(("Cannot send reply %u, disconnecting client", id));
+    remoteaccd_conn_free(conn);
+    return;
+  }
+
+  if (!conn->flush) {
+    conn->flush = TRUE;
+    silc_schedule_task_add_timeout(schedule, remoteaccd_flush, conn, 0, 0);
+  }
+}
+
+/* Signature and decryption callback */
+
+static void remoteaccd_done(SilcBool success, const unsigned char *data,
+			    SilcUInt32 data_len, void *context)
+{
+  RemoteaccdReq req = context;
+  RemoteaccdConn conn = req->conn;
+  SilcUInt8 status = SILC_REMOTEACC_OK;
+
+  if (!success) {
+    /* If the softacc queue is full the callback is called immediately */
+    status = SILC_REMOTEACC_FAILED;
+    if (calling && silc_errno == SILC_ERR_WOULD_BLOCK)
+      status = SILC_REMOTEACC_BUSY;
+  }
+
+  remoteaccd_reply(conn, req->id, status, data, data_len);
+
+  if (req->hash)
+    silc_hash_free(req->hash);
+  silc_free(req);
+
+  conn->pending--;
+  if (conn->closed)
+    remoteaccd_conn_free(conn);
+}
+
+/* Executes one request */
+
+static SilcBool remoteaccd_request(RemoteaccdConn conn,
+				   unsigned char *request,
+				   SilcUInt32 request_len)
+{
+  SilcBufferStruct buf;
+  RemoteaccdKey key;
+  RemoteaccdReq req;
+  unsigned char *key_id, *hash_name, *data;
+  SilcUInt16 hash_len;
+  SilcUInt32 id, data_len;
+  SilcUInt8 type, flags;
+  char name[64];
+
+  silc_buffer_set(&buf, request, request_len);
+  if (silc_buffer_unformat(&buf,
+			   SILC_STR_UINT32(&id),
+			   SILC_STR_UINT8(&type),
+			   SILC_STR_UINT8(&flags),
+			   SILC_STR_UI16_NSTRING(&hash_name, &hash_len),
+			   SILC_STR_DATA(&key_id, SILC_REMOTEACC_KEY_ID_LEN),
+			   SILC_STR_UI32_NSTRING(&data, &data_len),
+			   SILC_STR_END) < 0) {
+    SILC_LOG_ERROR(("Malformed request"));
+    return FALSE;
+  }
+
+  SILC_LOG_DEBUG(("Request %u, type %d", id, type));
+
+  silc_list_start(keys);
+  while ((key = silc_list_get(keys)))
+    if (!memcmp(key->key_id, key_id, SILC_REMOTEACC_KEY_ID_LEN))
+      break;
+  if (!key) {
+    SILC_LOG_DEBUG(("Unknown key"));
+    remoteaccd_reply(conn, id, SILC_REMOTEACC_NO_KEY, NULL, 0);
+    return TRUE;
+  }
+
+  req = silc_calloc(1, sizeof(*req));
+  if (!req) {
+    remoteaccd_reply(conn, id, SILC_REMOTEACC_BUSY, NULL, 0);
+    return TRUE;
+  }
+  req->conn = conn;
+  req->id = id;
+
+  if (hash_len) {
+    if (hash_len >= sizeof(name)) {
+      silc_free(req);
+      remoteaccd_reply(conn, id, SILC_REMOTEACC_FAILED, NULL, 0);
+      return TRUE;
+    }
+    memcpy(name, hash_name, hash_len);
+    name[hash_len] = '\0';
+    if (!silc_hash_alloc(name, &req->hash)) {
+      silc_free(req);
+      remoteaccd_reply(conn, id, SILC_REMOTEACC_FAILED, NULL, 0);
+      return TRUE;
+    }
+  }
+
+  conn->pending++;
+  calling = TRUE;
+
+  switch (type) {
+  case SILC_REMOTEACC_SIGN:
+    silc_pkcs_sign_async(key->private_key, data, data_len,
+			 (flags & SILC_REMOTEACC_F_HASH) != 0, req->hash,
+			 NULL, remoteaccd_done, req);
+    break;
+
+  case SILC_REMOTEACC_DECRYPT:
+    silc_pkcs_decrypt_async(key->private_key, data, data_len,
+			    remoteaccd_done, req);
+    break;
+
+  default:
+    remoteaccd_done(FALSE, NULL, 0, req);
+    break;
+  }
+
+  calling = FALSE;
+
+  return TRUE;
+}
+
+/* Reads requests from client */
+
+static void remoteaccd_read(RemoteaccdConn conn)
+{
+  SilcUInt32 len;
+  int ret;
+
+  /* Replying may close the connection, keep it until we return */
+  conn->pending++;
+
+  while (!conn->closed) {
+    if (silc_buffer_taillen(conn->inbuf) < 4096 &&
+	!silc_buffer_realloc(conn->inbuf, silc_buffer_truelen(conn->inbuf) +
+			     8192)) {
+      remoteaccd_conn_free(conn);
+      break;
+    }
+
+    ret = silc_stream_read(conn->stream, conn->inbuf->tail,
+			   silc_buffer_taillen(conn->inbuf));
+    if (ret == -1)
+      break;
+    if (ret <= 0) {
+      remoteaccd_conn_free(conn);
+      break;
+    }
+    silc_buffer_pull_tail(conn->inbuf, ret);
+
+    /* Execute all complete requests */
+    while (!conn->closed && silc_buffer_len(conn->inbuf) >= 4) {
+      SILC_GET32_MSB(len, conn->inbuf->data);
+      if (len > SILC_REMOTEACC_MAX_LEN) {
+	SILC_LOG_ERROR(("Too long request"));
+	remoteaccd_conn_free(conn);
+	break;
+      }
+      if (silc_buffer_len(conn->inbuf) < 4 + len)
+	break;
+
+      if (!remoteaccd_request(conn, conn->inbuf->data + 4, len)) {
+	remoteaccd_conn_free(conn);
+	break;
+      }
+      silc_buffer_pull(conn->inbuf, 4 + len);
+    }
+
+    /* Move partial request to the start of the buffer */
+    len = silc_buffer_len(conn->inbuf);
+    memmove(conn->inbuf->head, conn->inbuf->data, len);
+    silc_buffer_reset(conn->inbuf);
+    silc_buffer_pull_tail(conn->inbuf, len);
+  }
+
+  conn->pending--;
+  if (conn->closed)
+    remoteaccd_conn_free(conn);
+}
+
+/* Writes replies to client */
+
+static void remoteaccd_write(RemoteaccdConn conn)
+{
+  int ret;
+
+  while (!conn->closed && silc_buffer_len(conn->outbuf) > 0) {
+    ret = silc_stream_write(conn->stream, conn->outbuf->data,
+			    silc_buffer_len(conn->outbuf));
+    if (ret == -1)
+      return;
+    if (ret <= 0) {
+      remoteaccd_conn_free(conn);
+      return;
+    }
+    silc_buffer_pull(conn->outbuf, ret);
+  }
+
+  silc_buffer_reset(conn->outbuf);
+}
+
+/* Stream notifier */
+
+static void remoteaccd_io(SilcStream stream, SilcStreamStatus status,
+			  void *context)
+{
+  RemoteaccdConn conn = context;
+
+  switch (status) {
+  case SILC_STREAM_CAN_READ:
+    remoteaccd_read(conn);
+    break;
+
+  case SILC_STREAM_CAN_WRITE:
+    remoteaccd_write(conn);
+    break;
+
+  default:
+    remoteaccd_conn_free(conn);
+    break;
+  }
+}
+
+/* New client connection */
+
+static void remoteaccd_connected(SilcResult status, SilcStream stream,
+				 void *context)
+{
+  RemoteaccdConn conn;
+
+  if (status != SILC_OK) {
+    SILC_LOG_ERROR(("Cannot create stream: %s", silc_errno_string(status)));
+    return;
+  }
+
+  conn = silc_calloc(1, sizeof(*conn));
+  if (!conn) {
+    silc_stream_destroy(stream);
+    return;
+  }
+  silc_list_add(conns, conn);
+  conn->stream = stream;
+  conn->inbuf = silc_buffer_alloc(0);
+  conn->outbuf = silc_buffer_alloc(0);
+  if (!conn->inbuf || !conn->outbuf || stopping) {
+    remoteaccd_conn_free(conn);
+    return;
+  }
+
+  SILC_LOG_DEBUG(("New connection %p", conn));
+
+  silc_stream_set_notifier(stream, schedule, remoteaccd_io, conn);
+}
+
+/* Accepts new connection */
+
+SILC_TASK_CALLBACK(remoteaccd_accept)
+{
+  int sock;
+
+  sock = accept(listener, NULL, NULL);
+  if (sock < 0)
+    return;
+
+  silc_net_set_socket_nonblock(sock);
+  silc_socket_tcp_stream_create(sock, FALSE, FALSE, schedule,
+				remoteaccd_connected, NULL);
+}
+
+/* Stops the daemon.  New connections are not accepted, the connections
+   are closed and the daemon stops when the running requests have been
+   completed. */
+
+SILC_TASK_CALLBACK(remoteaccd_stop)
+{
+  RemoteaccdConn conn;
+
+  if (stopping)
+    return;
+
+  SILC_LOG_DEBUG(("Stopping, %d connections", silc_list_count(conns)));
+
+  stopping = TRUE;
+  silc_schedule_task_del_by_fd(schedule, listener);
+
+  silc_list_start(conns);
+  while ((conn = silc_list_get(conns)))
+    remoteaccd_conn_free(conn);
+
+  if (!silc_list_count(conns))
+    silc_schedule_stop(schedule);
+}
+
+/* Creates the listener socket.  Only the owner of the daemon and its
+   group may connect. */
+
+static int remoteaccd_listen(const char *path)
+{
+  struct sockaddr_un addr;
+  mode_t mask;
+  int sock;
+
+  if (strlen(path) >= sizeof(addr.sun_path)) {
+    fprintf(stderr, "Error: Socket path '%s' is too long\n", path);
+    return -1;
+  }
+
+  memset(&addr, 0, sizeof(addr));
+  addr.sun_family = AF_UNIX;
+  memcpy(addr.sun_path, path, strlen(path));
+
+  sock = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (sock < 0) {
+    fprintf(stderr, "Error: Cannot create socket: %s\n", strerror(errno));
+    return -1;
+  }
+
+  unlink(path);
+  mask = umask(0117);
+  if (bind(sock, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+    fprintf(stderr, "Error: Cannot bind to '%s': %s\n", path,
+	    strerror(errno));
+    umask(mask);
+    close(sock);
+    return -1;
+  }
+  umask(mask);
+
+  if (listen(sock, 64) < 0) {
+    fprintf(stderr, "Error: Cannot listen '%s': %s\n", path,
+	    strerror(errno));
+    close(sock);
+    return -1;
+  }
+
+  silc_net_set_socket_nonblock(sock);
+
+  return sock;
+}
+
+/* Loads key pair and accelerates the private key */
+
+static SilcBool remoteaccd_load_key(const char *pub_file,
+				    const char *prv_file)
+{
+  RemoteaccdKey key;
+  SilcPrivateKey private_key;
+
+  key = silc_calloc(1, sizeof(*key));
+  if (!key)
+    return FALSE;
+
+  if (!silc_pkcs_load_public_key(pub_file, SILC_PKCS_ANY,
+				 &key->public_key)) {
+    fprintf(stderr, "Error: Cannot load public key '%s'\n", pub_file);
+    silc_free(key);
+    return FALSE;
+  }
+
+  if (!silc_pkcs_load_private_key(prv_file, "", 0, SILC_PKCS_ANY,
+				  &private_key)) {
+    fprintf(stderr, "Error: Cannot load private key '%s'\n", prv_file);
+    silc_pkcs_public_key_free(key->public_key);
+    silc_free(key);
+    return FALSE;
+  }
+
+  key->private_key = silc_acc_private_key(SILC_SOFTACC, private_key);
+  if (!key->private_key ||
+      !silc_remoteacc_key_id(key->public_key, key->key_id)) {
+    fprintf(stderr, "Error: Cannot accelerate private key '%s'\n",
+	    prv_file);
+    if (key->private_key)
+      silc_pkcs_private_key_free(key->private_key);
+    silc_pkcs_private_key_free(private_key);
+    silc_pkcs_public_key_free(key->public_key);
+    silc_free(key);
+    return FALSE;
+  }
+
+  silc_list_add(keys, key);
+
+  return TRUE;
+}
+
+static void usage(void)
+{
+    fprintf(stdout, ""
+"Usage: remoteaccd [OPTIONS] PUBKEY PRIVKEY [PUBKEY PRIVKEY ...]\n"
+"\n"
+"Executes the private key operations of remote accelerator clients.\n"
+"The private keys must not be encrypted with passphrase.\n"
+"\n"
+"Options:\n"
+"  -h        Print this help, then exit\n"
+"  -s PATH   Unix domain socket (default " SILC_REMOTEACC_SOCKET ")\n"
+"  -t NUM    Number of threads running private key operations (default 4)\n"
+"  -b NUM    Max operations of same key run as one batch (default 8)\n"
+"  -q NUM    Max number of queued operations (default 1024)\n"
+"  -d STRING Enable debugging with debug string\n"
+"\n"
+	    );
+}
+
+int main(int argc, char **argv)
+{
+  RemoteaccdKey key;
+  int opt, i;
+  SilcUInt32 threads = 4, batch = 8, queue_max = 1024;
+
+  while ((opt = getopt(argc, argv, "hs:t:b:q:d:")) != EOF) {
+    switch (opt) {
+    case 'h':
+      usage();
+      return 1;
+      break;
+
+    case 's':
+      socket_path = optarg;
+      break;
+
+    case 't':
+      threads = atoi(optarg);
+      break;
+
+    case 'b':
+      batch = atoi(optarg);
+      break;
+
+    case 'q':
+      queue_max = atoi(optarg);
+      break;
+
+    case 'd':
+      silc_log_debug(TRUE);
+      silc_log_quick(TRUE);
+      silc_log_set_debug_string(optarg);
+      break;
+
+    default:
+      usage();
+      return 1;
+    }
+  }
+
+  if (optind >= argc || (argc - optind) % 2) {
+    usage();
+    return 1;
+  }
+
+  signal(SIGPIPE, SIG_IGN);
+
+  silc_crypto_init(NULL);
+  silc_rng_global_init(NULL);
+  schedule = silc_schedule_init(0, NULL, NULL);
+  if (!schedule) {
+    fprintf(stderr, "Error: Cannot allocate scheduler\n");
+    return 1;
+  }
+
+  if (!silc_acc_init(SILC_SOFTACC, schedule, "max_threads", threads,
+		     "pkcs_threads", threads, "pkcs_batch", batch,
+		     "pkcs_queue_max", queue_max, NULL)) {
+    fprintf(stderr, "Error: Cannot initialize software accelerator\n");
+    return 1;
+  }
+
+  silc_list_init(keys, struct RemoteaccdKeyStruct, next);
+  silc_list_init(conns, struct RemoteaccdConnStruct, next);
+  for (i = optind; i < argc; i += 2)
+    if (!remoteaccd_load_key(argv[i], argv[i + 1]))
+      return 1;
+
+  listener = remoteaccd_listen(socket_path);
+  if (listener < 0)
+    return 1;
+
+  silc_schedule_task_add_fd(schedule, listener, remoteaccd_accept, NULL);
+  silc_schedule_task_add_signal(schedule, SIGINT, remoteaccd_stop, NULL);
+  silc_schedule_task_add_signal(schedule, SIGTERM, remoteaccd_stop, NULL);
+
+  SILC_LOG_DEBUG(("Listening %s with %d keys", socket_path,
+		  silc_list_count(keys)));
+
+  silc_schedule(schedule);
+
+  close(listener);
+  unlink(socket_path);
+
+  /* The requests have been completed.  Uninitialize the accelerator
+     before freeing the keys it uses. */
+  silc_acc_uninit(SILC_SOFTACC);
+
+  silc_list_start(keys);
+  while ((key = silc_list_get(keys))) {
+    silc_pkcs_private_key_free(silc_acc_get_private_key(SILC_SOFTACC,
+							key->private_key));
+    silc_pkcs_private_key_free(key->private_key);
+    silc_pkcs_public_key_free(key->public_key);
+    silc_free(key);
+  }
+
+  silc_schedule_uninit(schedule);
+  silc_rng_global_uninit();
+  silc_crypto_uninit();
+
+  return 0;
+}
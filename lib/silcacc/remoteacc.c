@@ -0,0 +1,923 @@
+/*
+
+  remoteacc.c
+
+  Author: Pekka Riikonen <priikone@silcnet.org>
+
+  Copyright (C) 2008 Pekka Riikonen
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; version 2 of the License.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+*/
+
+#include "silccrypto.h"
+#include "remoteacc.h"
+#include "remoteacc_i.h"
+#include <sys/un.h>
+
+/* Remote accelerator forwards the private key operations to the
+   remoteaccd daemon over a Unix domain socket.  The daemon holds the
+   private keys.  The requests are pipelined: each request has an ID and
+   the replies may arrive in any order.  Requests made before the control
+   returns to the scheduler are written to the socket together as one
+   batch.  The replies are delivered in the scheduler given to
+   silc_acc_init.  Public key operations are done locally. */
+
+/************************** Types and definitions ***************************/
+
+SILC_PKCS_ALG_IMPORT_PUBLIC_KEY(silc_remoteacc_acc_public_key);
+SILC_PKCS_ALG_PUBLIC_KEY_FREE(silc_remoteacc_free_public_key);
+SILC_PKCS_ALG_IMPORT_PRIVATE_KEY(silc_remoteacc_acc_private_key);
+SILC_PKCS_ALG_PRIVATE_KEY_FREE(silc_remoteacc_free_private_key);
+SILC_PKCS_ALG_ENCRYPT(silc_remoteacc_encrypt);
+SILC_PKCS_ALG_DECRYPT(silc_remoteacc_decrypt);
+SILC_PKCS_ALG_SIGN(silc_remoteacc_sign);
+SILC_PKCS_ALG_VERIFY(silc_remoteacc_verify);
+
+SILC_PKCS_EXPORT_PRIVATE_KEY_FILE(silc_remoteacc_key_export_file);
+SILC_PKCS_EXPORT_PRIVATE_KEY(silc_remoteacc_key_export);
+SILC_PKCS_PRIVATE_KEY_BITLEN(silc_remoteacc_key_bitlen);
+SILC_PKCS_PRIVATE_KEY_FREE(silc_remoteacc_key_free);
+SILC_PKCS_DECRYPT(silc_remoteacc_key_decrypt);
+SILC_PKCS_SIGN(silc_remoteacc_key_sign);
+
+SilcBool silc_remoteacc_init(SilcSchedule schedule, va_list va);
+SilcBool silc_remoteacc_uninit(void);
+SilcBool silc_remoteacc_get_stats(SilcAccStats stats);
+void silc_remoteacc_abort(SilcAsyncOperation op, void *context);
+
+/* Remote accelerator PKCS algorithm operations */
+const SilcPKCSAlgorithm remoteacc_pkcs[] =
+{
+  {
+    "any", "any", NULL, NULL,
+    silc_remoteacc_acc_public_key,
+    NULL, NULL, NULL, NULL,
+    silc_remoteacc_free_public_key,
+    silc_remoteacc_acc_private_key,
+    NULL, NULL,
+    silc_remoteacc_free_private_key,
+    silc_remoteacc_encrypt,
+    silc_remoteacc_decrypt,
+    silc_remoteacc_sign,
+    silc_remoteacc_verify,
+  },
+
+  {
+    NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL,
+    NULL, NULL
+  }
+};
+
+/* Remote accelerator operations */
+const SilcAcceleratorStruct silc_remoteacc =
+{
+  "remoteacc", silc_remoteacc_init, silc_remoteacc_uninit,
+  remoteacc_pkcs,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  silc_remoteacc_get_stats,
+};
+
+/* PKCS operations of the remote private key.  The key material is in the
+   daemon, so the key cannot be exported. */
+static const SilcPKCSObject silc_remoteacc_key_pkcs =
+{
+  SILC_PKCS_SILC,
+  NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+  NULL, NULL,
+  silc_remoteacc_key_export_file,
+  silc_remoteacc_key_export,
+  silc_remoteacc_key_bitlen,
+  silc_remoteacc_key_free,
+  NULL,
+  silc_remoteacc_key_decrypt,
+  silc_remoteacc_key_sign,
+  NULL
+};
+
+/* Remote private key */
+typedef struct {
+  SilcPublicKey public_key;		 /* Public key of the private key */
+  unsigned char key_id[SILC_REMOTEACC_KEY_ID_LEN]; /* Key ID in daemon */
+} *SilcRemoteaccKey;
+
+/* Remote accelerator public key */
+typedef struct {
+  SilcPublicKey key;			 /* Accelerated public key */
+} *SilcRemoteaccPublicKey;
+
+/* Request context */
+typedef struct SilcRemoteaccExecStruct {
+  struct SilcRemoteaccExecStruct *next;
+  SilcAsyncOperationStruct op;		 /* Operation for aborting */
+  SilcUInt32 id;			 /* Request ID */
+  SilcUInt8 type;			 /* Request type */
+  SilcUInt32 src_len;
+  SilcInt64 start;			 /* Request time */
+
+  union {
+    SilcPKCSDecryptCb decrypt_cb;
+    SilcPKCSSignCb sign_cb;
+  } cb;
+  void *context;			 /* Callback context */
+
+  unsigned int aborted : 1;
+} *SilcRemoteaccExec;
+
+/* Remote accelerator context */
+typedef struct {
+  SilcSchedule schedule;		 /* Scheduler */
+  char *socket_path;			 /* Daemon socket */
+  SilcUInt32 queue_max;			 /* Max pending requests */
+
+  SilcStream stream;			 /* Connection, NULL if not connected */
+  SilcAsyncOperation connect_op;	 /* Connecting */
+  SilcBuffer outbuf;			 /* Requests not yet written */
+  SilcBuffer inbuf;			 /* Partially read replies */
+  SilcList pending;			 /* Requests waiting for reply */
+  SilcUInt32 next_id;			 /* Next request ID */
+
+  SilcAccStatsStruct stats;		 /* Statistics */
+  SilcUInt32 busy;			 /* Callbacks may be running */
+
+  unsigned int flush : 1;		 /* Flush is scheduled */
+  unsigned int closing : 1;		 /* Uninitialized while busy */
+} *SilcRemoteacc;
+
+/***************************** Key identifier *******************************/
+
+/* Computes the key ID of the public key */
+
+SilcBool silc_remoteacc_key_id(SilcPublicKey public_key,
+			       unsigned char *key_id)
+{
+  unsigned char *pk;
+  SilcUInt32 pk_len;
+  SilcHash sha1;
+
+  if (!silc_hash_alloc("sha1", &sha1))
+    return FALSE;
+
+  pk = silc_pkcs_public_key_encode(NULL, public_key, &pk_len);
+  if (!pk) {
+    silc_hash_free(sha1);
+    return FALSE;
+  }
+
+  silc_hash_make(sha1, pk, pk_len, key_id);
+
+  silc_free(pk);
+  silc_hash_free(sha1);
+
+  return TRUE;
+}
+
+/****************************** Connection **********************************/
+
+static void silc_remoteacc_write(SilcRemoteacc ra);
+static void silc_remoteacc_free(SilcRemoteacc ra);
+
+/* Marks that reply callbacks may be called.  A callback may uninitialize
+   the accelerator, in which case the context is freed only in
+   silc_remoteacc_unbusy. */
+
+static void silc_remoteacc_busy(SilcRemoteacc ra)
+{
+  ra->busy++;
+}
+
+/* Ends silc_remoteacc_busy.  Returns FALSE if `ra' was freed. */
+
+static SilcBool silc_remoteacc_unbusy(SilcRemoteacc ra)
+{
+  if (--ra->busy || !ra->closing)
+    return TRUE;
+  silc_remoteacc_free(ra);
+  return FALSE;
+}
+
+/* Delivers the reply to the caller */
+
+static void silc_remoteacc_deliver(SilcRemoteacc ra, SilcRemoteaccExec e,
+				   SilcUInt8 status, unsigned char *data,
+				   SilcUInt32 data_len)
+{
+  SilcAccOpStats st;
+  SilcBool success = status == SILC_REMOTEACC_OK;
+
+  st = &ra->stats.op[e->type == SILC_REMOTEACC_SIGN ?
+		     SILC_ACC_STATS_SIGN : SILC_ACC_STATS_DECRYPT];
+
+  if (e->aborted) {
+    st->aborted++;
+    silc_free(e);
+    return;
+  }
+
+  silc_acc_stats_add(st, success, e->src_len, silc_time_usec() - e->start);
+
+  SILC_LOG_DEBUG(("Call completion, result=%s", success ? "Ok" : "failed"));
+
+  if (status == SILC_REMOTEACC_BUSY)
+    silc_set_errno(SILC_ERR_WOULD_BLOCK);
+
+  if (e->type == SILC_REMOTEACC_SIGN)
+    e->cb.sign_cb(success, data, data_len, e->context);
+  else
+    e->cb.decrypt_cb(success, data, data_len, e->context);
+
+  silc_free(e);
+}
+
+/* Closes connection and fails all pending requests */
+
+static void silc_remoteacc_disconnect(SilcRemoteacc ra)
+{
+  SilcRemoteaccExec e;
+  SilcList pending;
+
+  SILC_LOG_DEBUG(("Disconnect from %s, %d requests pending",
+		  ra->socket_path, silc_list_count(ra->pending)));
+
+  if (ra->connect_op)
+    silc_async_abort(ra->connect_op, NULL, NULL);
+  ra->connect_op = NULL;
+
+  if (ra->stream) {
+    silc_stream_set_notifier(ra->stream, ra->schedule, NULL, NULL);
+    silc_stream_destroy(ra->stream);
+    ra->stream = NULL;
+  }
+
+  silc_buffer_reset(ra->outbuf);
+  silc_buffer_reset(ra->inbuf);
+
+  /* The callbacks may make new requests */
+  pending = ra->pending;
+  silc_list_init(ra->pending, struct SilcRemoteaccExecStruct, next);
+
+  silc_list_start(pending);
+  while ((e = silc_list_get(pending)))
+    silc_remoteacc_deliver(ra, e, SILC_REMOTEACC_FAILED, NULL, 0);
+}
+
+/* Parses one reply */
+
+static SilcBool silc_remoteacc_reply(SilcRemoteacc ra, unsigned char *reply,
+				     SilcUInt32 reply_len)
+{
+  SilcBufferStruct buf;
+  SilcRemoteaccExec e;
+  unsigned char *data;
+  SilcUInt32 id, data_len;
+  SilcUInt8 status;
+
+  silc_buffer_set(&buf, reply, reply_len);
+  if (silc_buffer_unformat(&buf,
+			   SILC_STR_UINT32(&id),
+			   SILC_STR_UINT8(&status),
+			   SILC_STR_UI32_NSTRING(&data, &data_len),
+			   SILC_STR_END) < 0) {
+    SILC_LOG_ERROR(("Malformed reply from remote accelerator"));
+    return FALSE;
+  }
+
+  silc_list_start(ra->pending);
+  while ((e = silc_list_get(ra->pending)))
+    if (e->id == id)
+      break;
+  if (!e) {
+    SILC_LOG_DEBUG(("Unknown reply %u", id));
+    return TRUE;
+  }
+
+  silc_list_del(ra->pending, e);
+  silc_remoteacc_deliver(ra, e, status, data, data_len);
+
+  return TRUE;
+}
+
+/* Reads replies from the daemon */
+
+static void silc_remoteacc_read(SilcRemoteacc ra)
+{
+  SilcUInt32 len;
+  int ret;
+
+  while (ra->stream) {
+    if (silc_buffer_taillen(ra->inbuf) < 4096 &&
+	!silc_buffer_realloc(ra->inbuf, silc_buffer_truelen(ra->inbuf) +
+			     8192)) {
+      silc_remoteacc_disconnect(ra);
+      return;
+    }
+
+    ret = silc_stream_read(ra->stream, ra->inbuf->tail,
+			   silc_buffer_taillen(ra->inbuf));
+    if (ret == -1)
+      break;
+    if (ret <= 0) {
+      silc_remoteacc_disconnect(ra);
+      return;
+    }
+    silc_buffer_pull_tail(ra->inbuf, ret);
+
+    /* Parse all complete replies */
+    while (silc_buffer_len(ra->inbuf) >= 4) {
+      SILC_GET32_MSB(len, ra->inbuf->data);
+      if (len > SILC_REMOTEACC_MAX_LEN) {
+	SILC_LOG_ERROR(("Too long reply from remote accelerator"));
+	silc_remoteacc_disconnect(ra);
+	return;
+      }
+      if (silc_buffer_len(ra->inbuf) < 4 + len)
+	break;
+
+      if (!silc_remoteacc_reply(ra, ra->inbuf->data + 4, len)) {
+	silc_remoteacc_disconnect(ra);
+	return;
+      }
+
+      /* The callback may have disconnected or uninitialized, which also
+	 resets the input buffer */
+      if (!ra->stream || ra->closing)
+	return;
+      silc_buffer_pull(ra->inbuf, 4 + len);
+    }
+
+    /* Move partial reply to the start of the buffer */
+    len = silc_buffer_len(ra->inbuf);
+    memmove(ra->inbuf->head, ra->inbuf->data, len);
+    silc_buffer_reset(ra->inbuf);
+    silc_buffer_pull_tail(ra->inbuf, len);
+  }
+}
+
+/* Stream notifier */
+
+static void silc_remoteacc_io(SilcStream stream, SilcStreamStatus status,
+			      void *context)
+{
+  SilcRemoteacc ra = context;
+
+  silc_remoteacc_busy(ra);
+
+  switch (status) {
+  case SILC_STREAM_CAN_READ:
+    silc_remoteacc_read(ra);
+    break;
+
+  case SILC_STREAM_CAN_WRITE:
+    silc_remoteacc_write(ra);
+    break;
+
+  default:
+    silc_remoteacc_disconnect(ra);
+    break;
+  }
+
+  silc_remoteacc_unbusy(ra);
+}
+
+/* Writes queued requests to the daemon.  If the socket would block we are
+   called again from the stream notifier when it is writable. */
+
+static void silc_remoteacc_write(SilcRemoteacc ra)
+{
+  int ret;
+
+  if (!ra->stream)
+    return;
+
+  while (silc_buffer_len(ra->outbuf) > 0) {
+    ret = silc_stream_write(ra->stream, ra->outbuf->data,
+			    silc_buffer_len(ra->outbuf));
+    if (ret == -1)
+      return;
+    if (ret <= 0) {
+      silc_remoteacc_disconnect(ra);
+      return;
+    }
+    silc_buffer_pull(ra->outbuf, ret);
+  }
+
+  silc_buffer_reset(ra->outbuf);
+}
+
+/* Flushes all requests made since last flush as one batch */
+
+SILC_TASK_CALLBACK(silc_remoteacc_flush)
+{
+  SilcRemoteacc ra = context;
+
+  ra->flush = FALSE;
+
+  SILC_LOG_DEBUG(("Flush %d bytes of requests",
+		  silc_buffer_len(ra->outbuf)));
+
+  silc_remoteacc_busy(ra);
+  silc_remoteacc_write(ra);
+  silc_remoteacc_unbusy(ra);
+}
+
+/* Socket stream creation callback */
+
+static void silc_remoteacc_connected(SilcResult status, SilcStream stream,
+				     void *context)
+{
+  SilcRemoteacc ra = context;
+
+  ra->connect_op = NULL;
+  silc_remoteacc_busy(ra);
+
+  if (status != SILC_OK) {
+    SILC_LOG_ERROR(("Cannot connect to remote accelerator: %s",
+		    silc_errno_string(status)));
+    silc_remoteacc_disconnect(ra);
+    silc_remoteacc_unbusy(ra);
+    return;
+  }
+
+  SILC_LOG_DEBUG(("Connected to %s", ra->socket_path));
+
+  ra->stream = stream;
+  silc_stream_set_notifier(ra->stream, ra->schedule, silc_remoteacc_io, ra);
+
+  /* Send requests made while connecting */
+  silc_remoteacc_write(ra);
+  silc_remoteacc_unbusy(ra);
+}
+
+/* Connects to the daemon, if not already connected */
+
+static SilcBool silc_remoteacc_connect(SilcRemoteacc ra)
+{
+  struct sockaddr_un addr;
+  SilcAsyncOperation op;
+  int sock;
+
+  if (ra->stream || ra->connect_op)
+    return TRUE;
+
+  SILC_LOG_DEBUG(("Connecting to %s", ra->socket_path));
+
+  if (strlen(ra->socket_path) >= sizeof(addr.sun_path)) {
+    SILC_LOG_ERROR(("Socket path %s is too long", ra->socket_path));
+    return FALSE;
+  }
+
+  memset(&addr, 0, sizeof(addr));
+  addr.sun_family = AF_UNIX;
+  memcpy(addr.sun_path, ra->socket_path, strlen(ra->socket_path));
+
+  sock = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (sock < 0) {
+    SILC_LOG_ERROR(("Cannot create socket: %s", strerror(errno)));
+    return FALSE;
+  }
+
+  if (connect(sock, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+    SILC_LOG_ERROR(("Cannot connect to remote accelerator %s: %s",
+		    ra->socket_path, strerror(errno)));
+    close(sock);
+    return FALSE;
+  }
+
+  silc_net_set_socket_nonblock(sock);
+
+  /* The callback may be called before this returns */
+  op = silc_socket_tcp_stream_create(sock, FALSE, FALSE, ra->schedule,
+				     silc_remoteacc_connected, ra);
+  if (!ra->stream)
+    ra->connect_op = op;
+
+  return ra->stream || ra->connect_op;
+}
+
+/* Sends request to the daemon */
+
+static SilcAsyncOperation
+silc_remoteacc_request(SilcRemoteaccKey key, SilcUInt8 type,
+		       unsigned char *src, SilcUInt32 src_len,
+		       SilcBool compute_hash, SilcHash hash,
+		       void *cb, void *context)
+{
+  SilcBufferStruct buf;
+  SilcRemoteaccExec e;
+  SilcRemoteacc ra;
+  const char *hash_name = hash ? silc_hash_get_name(hash) : "";
+  SilcUInt32 len;
+
+  ra = silc_global_get_var("remoteacc", FALSE);
+  if (!ra || !ra->schedule || ra->closing) {
+    SILC_LOG_ERROR(("Remote accelerator not initialized"));
+    goto err;
+  }
+
+  if (silc_list_count(ra->pending) >= ra->queue_max) {
+    SILC_LOG_DEBUG(("Queue is full, %d requests pending",
+		    silc_list_count(ra->pending)));
+    silc_set_errno(SILC_ERR_WOULD_BLOCK);
+    goto err;
+  }
+
+  len = 4 + 1 + 1 + 2 + strlen(hash_name) + SILC_REMOTEACC_KEY_ID_LEN +
+    4 + src_len;
+  if (len > SILC_REMOTEACC_MAX_LEN) {
+    silc_set_errno(SILC_ERR_OVERFLOW);
+    goto err;
+  }
+
+  if (!silc_remoteacc_connect(ra))
+    goto err;
+
+  e = silc_calloc(1, sizeof(*e));
+  if (!e)
+    goto err;
+
+  /* Add request to the output buffer */
+  if (silc_buffer_taillen(ra->outbuf) < 4 + len &&
+      !silc_buffer_realloc(ra->outbuf, silc_buffer_truelen(ra->outbuf) +
+			   4 + len)) {
+    silc_free(e);
+    goto err;
+  }
+  silc_buffer_set(&buf, ra->outbuf->tail, 4 + len);
+  if (silc_buffer_format(&buf,
+			 SILC_STR_UINT32(len),
+			 SILC_STR_UINT32(ra->next_id),
+			 SILC_STR_UINT8(type),
+			 SILC_STR_UINT8(compute_hash ?
+					SILC_REMOTEACC_F_HASH : 0),
+			 SILC_STR_UI16_STRING(hash_name),
+			 SILC_STR_DATA(key->key_id,
+				       SILC_REMOTEACC_KEY_ID_LEN),
+			 SILC_STR_UI32_NSTRING(src, src_len),
+			 SILC_STR_END) < 0) {
+    silc_free(e);
+    goto err;
+  }
+  silc_buffer_pull_tail(ra->outbuf, 4 + len);
+
+  e->id = ra->next_id++;
+  e->type = type;
+  e->src_len = src_len;
+  e->start = silc_time_usec();
+  e->cb.sign_cb = cb;
+  e->context = context;
+  silc_list_add(ra->pending, e);
+  silc_async_init(&e->op, silc_remoteacc_abort, NULL, e);
+
+  /* Requests made before returning to scheduler are written together */
+  if (!ra->flush) {
+    ra->flush = TRUE;
+    silc_schedule_task_add_timeout(ra->schedule, silc_remoteacc_flush,
+				   ra, 0, 0);
+  }
+
+  return &e->op;
+
+ err:
+  if (type == SILC_REMOTEACC_SIGN)
+    ((SilcPKCSSignCb)cb)(FALSE, NULL, 0, context);
+  else
+    ((SilcPKCSDecryptCb)cb)(FALSE, NULL, 0, context);
+  return NULL;
+}
+
+/***************************** Accelerator API ******************************/
+
+/* Initialize remote accelerator */
+
+SilcBool silc_remoteacc_init(SilcSchedule schedule, va_list va)
+{
+  SilcRemoteacc ra;
+  char *opt, *socket_path = SILC_REMOTEACC_SOCKET;
+
+  if (!schedule) {
+    SILC_LOG_ERROR(("Remote accelerator requires scheduler"));
+    return FALSE;
+  }
+
+  /* If already initialized, uninitialize first.  It is freed only after
+     its callbacks return if we were called from one. */
+  ra = silc_global_get_var("remoteacc", FALSE);
+  if (ra)
+    silc_remoteacc_uninit();
+  if (silc_global_get_var("remoteacc", FALSE)) {
+    SILC_LOG_ERROR(("Remote accelerator cannot be initialized again from "
+		    "its callback"));
+    return FALSE;
+  }
+
+  ra = silc_global_set_var("remoteacc", sizeof(*ra), NULL, FALSE);
+  if (!ra)
+    return FALSE;
+  memset(ra, 0, sizeof(*ra));
+
+  ra->schedule = schedule;
+  ra->queue_max = SILC_REMOTEACC_QUEUE_MAX;
+  silc_list_init(ra->pending, struct SilcRemoteaccExecStruct, next);
+
+  /* Get options */
+  while ((opt = va_arg(va, char *))) {
+    if (!strcmp(opt, "socket"))
+      socket_path = va_arg(va, char *);
+    else if (!strcmp(opt, "queue_max"))
+      ra->queue_max = va_arg(va, SilcUInt32);
+  }
+
+  SILC_LOG_DEBUG(("Initialize remote accelerator, socket %s", socket_path));
+
+  ra->socket_path = silc_strdup(socket_path);
+  ra->outbuf = silc_buffer_alloc(0);
+  ra->inbuf = silc_buffer_alloc(0);
+  if (!ra->socket_path || !ra->outbuf || !ra->inbuf || !ra->queue_max) {
+    silc_free(ra->socket_path);
+    silc_buffer_free(ra->outbuf);
+    silc_buffer_free(ra->inbuf);
+    silc_global_del_var("remoteacc", FALSE);
+    return FALSE;
+  }
+
+  /* Connect now so that misconfiguration is noticed early.  If the daemon
+     is not yet running we try again when the first request is made. */
+  silc_remoteacc_connect(ra);
+
+  return TRUE;
+}
+
+/* Frees the accelerator context */
+
+static void silc_remoteacc_free(SilcRemoteacc ra)
+{
+  silc_schedule_task_del_by_all(ra->schedule, 0, silc_remoteacc_flush, ra);
+
+  silc_free(ra->socket_path);
+  silc_buffer_free(ra->outbuf);
+  silc_buffer_free(ra->inbuf);
+
+  silc_global_del_var("remoteacc", FALSE);
+}
+
+/* Uninitialize */
+
+SilcBool silc_remoteacc_uninit(void)
+{
+  SilcRemoteacc ra;
+
+  ra = silc_global_get_var("remoteacc", FALSE);
+  if (!ra || ra->closing)
+    return FALSE;
+
+  SILC_LOG_DEBUG(("Uninitialize remote accelerator"));
+
+  /* The pending requests fail, and their callbacks may uninitialize */
+  silc_remoteacc_busy(ra);
+  silc_remoteacc_disconnect(ra);
+  ra->closing = TRUE;
+  silc_remoteacc_unbusy(ra);
+
+  return TRUE;
+}
+
+/* Get statistics */
+
+SilcBool silc_remoteacc_get_stats(SilcAccStats stats)
+{
+  SilcRemoteacc ra;
+  int i;
+
+  ra = silc_global_get_var("remoteacc", FALSE);
+  if (!ra)
+    return FALSE;
+
+  stats->running = silc_list_count(ra->pending);
+  for (i = 0; i < SILC_ACC_STATS_MAX; i++)
+    silc_acc_stats_merge(&stats->op[i], &ra->stats.op[i]);
+
+  return TRUE;
+}
+
+/****************************** PKCS ALG API ********************************/
+
+/* Abort request.  The reply is ignored when it arrives. */
+
+void silc_remoteacc_abort(SilcAsyncOperation op, void *context)
+{
+  SilcRemoteaccExec e = context;
+  e->aborted = TRUE;
+}
+
+/* Accelerate public key.  Public key operations are done locally. */
+
+SILC_PKCS_ALG_IMPORT_PUBLIC_KEY(silc_remoteacc_acc_public_key)
+{
+  SilcRemoteaccPublicKey pubkey;
+
+  pubkey = silc_calloc(1, sizeof(*pubkey));
+  if (!pubkey)
+    return FALSE;
+  pubkey->key = key;
+
+  *ret_public_key = pubkey;
+
+  return TRUE;
+}
+
+/* Accelerate private key.  Only private keys returned by the
+   silc_remoteacc_private_key can be accelerated. */
+
+SILC_PKCS_ALG_IMPORT_PRIVATE_KEY(silc_remoteacc_acc_private_key)
+{
+  SilcPrivateKey private_key = key;
+
+  if (private_key->pkcs->private_key_free != silc_remoteacc_key_free) {
+    SILC_LOG_ERROR(("Private key is not a remote accelerator key"));
+    return FALSE;
+  }
+
+  *ret_private_key = private_key;
+
+  return TRUE;
+}
+
+/* Free public key */
+
+SILC_PKCS_ALG_PUBLIC_KEY_FREE(silc_remoteacc_free_public_key)
+{
+  silc_free(public_key);
+}
+
+/* Free private key.  Frees the remote private key also. */
+
+SILC_PKCS_ALG_PRIVATE_KEY_FREE(silc_remoteacc_free_private_key)
+{
+  SilcPrivateKey key = private_key;
+  SilcPKCSObject *key_pkcs = key->pkcs;
+
+  silc_pkcs_private_key_free(key);
+  silc_free(key_pkcs);
+}
+
+/* Encrypt locally */
+
+SILC_PKCS_ALG_ENCRYPT(silc_remoteacc_encrypt)
+{
+  SilcRemoteaccPublicKey pubkey = public_key;
+  return silc_pkcs_encrypt_async(pubkey->key, src, src_len, rng,
+				 encrypt_cb, context);
+}
+
+/* Remote decrypt */
+
+SILC_PKCS_ALG_DECRYPT(silc_remoteacc_decrypt)
+{
+  SilcPrivateKey key = private_key;
+
+  SILC_LOG_DEBUG(("Decrypt"));
+
+  return silc_remoteacc_request(key->private_key, SILC_REMOTEACC_DECRYPT,
+				src, src_len, FALSE, NULL,
+				decrypt_cb, context);
+}
+
+/* Remote signature */
+
+SILC_PKCS_ALG_SIGN(silc_remoteacc_sign)
+{
+  SilcPrivateKey key = private_key;
+
+  SILC_LOG_DEBUG(("Sign"));
+
+  return silc_remoteacc_request(key->private_key, SILC_REMOTEACC_SIGN,
+				src, src_len, compute_hash, hash,
+				sign_cb, context);
+}
+
+/* Verify locally */
+
+SILC_PKCS_ALG_VERIFY(silc_remoteacc_verify)
+{
+  SilcRemoteaccPublicKey pubkey = public_key;
+  return silc_pkcs_verify_async(pubkey->key, signature, signature_len,
+				data, data_len, compute_hash, hash,
+				verify_cb, context);
+}
+
+/***************************** Remote private key ***************************/
+
+/* Remote private key cannot be exported */
+
+SILC_PKCS_EXPORT_PRIVATE_KEY_FILE(silc_remoteacc_key_export_file)
+{
+  return NULL;
+}
+
+SILC_PKCS_EXPORT_PRIVATE_KEY(silc_remoteacc_key_export)
+{
+  return NULL;
+}
+
+/* Returns key length from the public key */
+
+SILC_PKCS_PRIVATE_KEY_BITLEN(silc_remoteacc_key_bitlen)
+{
+  SilcRemoteaccKey key = private_key;
+  return silc_pkcs_public_key_get_len(key->public_key);
+}
+
+/* Free remote private key */
+
+SILC_PKCS_PRIVATE_KEY_FREE(silc_remoteacc_key_free)
+{
+  SilcRemoteaccKey key = private_key;
+
+  silc_pkcs_public_key_free(key->public_key);
+  silc_free(key);
+}
+
+/* Remote decrypt with the unaccelerated remote private key */
+
+SILC_PKCS_DECRYPT(silc_remoteacc_key_decrypt)
+{
+  return silc_remoteacc_request(private_key, SILC_REMOTEACC_DECRYPT,
+				src, src_len, FALSE, NULL,
+				decrypt_cb, context);
+}
+
+/* Remote signature with the unaccelerated remote private key */
+
+SILC_PKCS_SIGN(silc_remoteacc_key_sign)
+{
+  return silc_remoteacc_request(private_key, SILC_REMOTEACC_SIGN,
+				src, src_len, compute_hash, hash,
+				sign_cb, context);
+}
+
+/* Returns private key of the public key held by the daemon */
+
+SilcPrivateKey silc_remoteacc_private_key(SilcPublicKey public_key)
+{
+  SilcPrivateKey key, acc_key;
+  SilcRemoteaccKey rkey;
+
+  if (!public_key)
+    return NULL;
+
+  rkey = silc_calloc(1, sizeof(*rkey));
+  if (!rkey)
+    return NULL;
+
+  rkey->public_key = silc_pkcs_public_key_copy(public_key);
+  if (!rkey->public_key) {
+    silc_free(rkey);
+    return NULL;
+  }
+
+  if (!silc_remoteacc_key_id(public_key, rkey->key_id)) {
+    silc_pkcs_public_key_free(rkey->public_key);
+    silc_free(rkey);
+    return NULL;
+  }
+
+  key = silc_calloc(1, sizeof(*key));
+  if (!key) {
+    silc_pkcs_public_key_free(rkey->public_key);
+    silc_free(rkey);
+    return NULL;
+  }
+
+  key->pkcs = silc_calloc(1, sizeof(*key->pkcs));
+  if (!key->pkcs) {
+    silc_free(key);
+    silc_pkcs_public_key_free(rkey->public_key);
+    silc_free(rkey);
+    return NULL;
+  }
+  *key->pkcs = silc_remoteacc_key_pkcs;
+  key->pkcs->type = silc_pkcs_get_type(public_key);
+  key->alg = silc_pkcs_get_algorithm(public_key);
+  key->private_key = rkey;
+
+  /* Accelerate it.  The accelerated key owns the remote key. */
+  acc_key = silc_acc_private_key(SILC_REMOTEACC, key);
+  if (!acc_key) {
+    silc_remoteacc_free_private_key(NULL, key);
+    return NULL;
+  }
+
+  return acc_key;
+}
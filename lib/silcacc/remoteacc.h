@@ -0,0 +1,148 @@
+/*
+
+  remoteacc.h
+
+  Author: Pekka Riikonen <priikone@silcnet.org>
+
+  Copyright (C) 2008 Pekka Riikonen
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; version 2 of the License.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+*/
+
+/****h* silcacc/Remote Accelerator
+ *
+ * DESCRIPTION
+ *
+ * Remote accelerator executes private key operations in a separate
+ * process, the remoteaccd daemon.  The daemon holds the private keys and
+ * the application never sees the key material.  Many applications can
+ * share one daemon over a Unix domain socket, and the daemon runs the
+ * operations with the software accelerator on the cores dedicated to it.
+ *
+ * Remote accelerator is not registered automatically.  It must be
+ * registered with silc_acc_register and initialized with silc_acc_init.
+ * The SilcSchedule must be given as argument to silc_acc_init.  The
+ * results of the operations are delivered in that scheduler.
+ *
+ * The private key is referred by its public key.  The application gets
+ * the private key by calling silc_remoteacc_private_key with the public
+ * key.  The returned private key can be used with the normal SILC PKCS
+ * API, but the signature and decryption are always asynchronous.  The
+ * synchronous silc_pkcs_sign and silc_pkcs_decrypt cannot be used with
+ * remote private key.  Public key operations (encryption and verification)
+ * are done locally.
+ *
+ * Requests are pipelined: the application may make any number of requests
+ * without waiting for the previous to complete.  All requests made before
+ * the control returns to the scheduler are sent to the daemon together.
+ * If the connection to the daemon is lost all pending requests fail, and
+ * the connection is opened again when next request is made.  If the daemon
+ * is busy the operation fails and silc_errno is set to
+ * SILC_ERR_WOULD_BLOCK.
+ *
+ * OPTIONS
+ *
+ * The following options can be given as argument to the silc_acc_init
+ * when initializing the remote accelerator.
+ *
+ * "socket"
+ *
+ * The path of the Unix domain socket of the remoteaccd daemon.  If this
+ * option is not given the default is "/var/run/remoteaccd.sock".
+ *
+ * "queue_max"
+ *
+ * The maximum number of requests waiting for reply.  When the limit is
+ * reached new requests fail with SILC_ERR_WOULD_BLOCK.  If this option is
+ * not given the default number is 1024.
+ *
+ * EXAMPLE
+ *
+ * // Register and initialize the remote accelerator
+ * silc_acc_register(SILC_REMOTEACC);
+ * silc_acc_init(SILC_REMOTEACC, schedule,
+ *               "socket", "/var/run/remoteaccd.sock", NULL);
+ *
+ * // Get the private key of the public key from the daemon
+ * private_key = silc_remoteacc_private_key(public_key);
+ *
+ * // Sign with the remote private key
+ * silc_pkcs_sign_async(private_key, data, data_len, TRUE, hash, NULL,
+ *                      sign_cb, context);
+ *
+ ***/
+
+#ifndef REMOTEACC_H
+#define REMOTEACC_H
+
+/****s* silcacc/remoteacc
+ *
+ * NAME
+ *
+ *    silc_remoteacc
+ *
+ * DESCRIPTION
+ *
+ *    The remote accelerator context.  It must be registered with
+ *    silc_acc_register and initialized with silc_acc_init before it can
+ *    be used.  When it is not needed anymore it must be uninitialized by
+ *    calling silc_acc_uninit.
+ *
+ ***/
+extern DLLAPI const SilcAcceleratorStruct silc_remoteacc;
+
+/****d* silcacc/SILC_REMOTEACC
+ *
+ * NAME
+ *
+ *    #define SILC_REMOTEACC (SilcAccelerator)&silc_remoteacc
+ *
+ * DESCRIPTION
+ *
+ *    Remote accelerator context macro that can be used with silc_acc_init.
+ *
+ ***/
+#define SILC_REMOTEACC (SilcAccelerator)&silc_remoteacc
+
+/****d* silcacc/SILC_REMOTEACC_NAME
+ *
+ * NAME
+ *
+ *    #define SILC_REMOTEACC_NAME "remoteacc"
+ *
+ * DESCRIPTION
+ *
+ *    The name of the remote accelerator.
+ *
+ ***/
+#define SILC_REMOTEACC_NAME "remoteacc"
+
+/****f* silcacc/silc_remoteacc_private_key
+ *
+ * SYNOPSIS
+ *
+ *    SilcPrivateKey silc_remoteacc_private_key(SilcPublicKey public_key);
+ *
+ * DESCRIPTION
+ *
+ *    Returns the private key of the `public_key' held by the remoteaccd
+ *    daemon.  The returned key is an accelerated private key that can be
+ *    used with silc_pkcs_sign_async and silc_pkcs_decrypt_async.  The
+ *    key cannot be exported.  The caller must free the returned key with
+ *    silc_pkcs_private_key_free.  Returns NULL on error.
+ *
+ *    This does not check that the daemon has the key.  If it doesn't, the
+ *    operations will fail.
+ *
+ ***/
+SilcPrivateKey silc_remoteacc_private_key(SilcPublicKey public_key);
+
+#endif /* REMOTEACC_H */
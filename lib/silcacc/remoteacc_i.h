@@ -0,0 +1,78 @@
+/*
+
+  remoteacc_i.h
+
+  Author: Pekka Riikonen <priikone@silcnet.org>
+
+  Copyright (C) 2008 Pekka Riikonen
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; version 2 of the License.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+*/
+
+#ifndef REMOTEACC_I_H
+#define REMOTEACC_I_H
+
+/* The remote accelerator protocol.  This is shared by the remote
+   accelerator and the remoteaccd daemon.  All integers are in network
+   byte order.
+
+   Request:
+
+     UINT32   length of the rest of the request
+     UINT32   request ID
+     UINT8    request type
+     UINT8    flags
+     UINT16 + hash algorithm name, may be empty
+     20 bytes key ID
+     UINT32 + request data
+
+   Reply:
+
+     UINT32   length of the rest of the reply
+     UINT32   request ID
+     UINT8    status
+     UINT32 + reply data
+
+   Requests are pipelined.  The client may send any number of requests
+   without waiting for the replies.  Replies are sent in the order the
+   operations complete, not in the order of requests. */
+
+/* Request types */
+#define SILC_REMOTEACC_SIGN       1	 /* Sign data */
+#define SILC_REMOTEACC_DECRYPT    2	 /* Decrypt data */
+
+/* Request flags */
+#define SILC_REMOTEACC_F_HASH     0x01	 /* Compute hash before signing */
+
+/* Reply status */
+#define SILC_REMOTEACC_OK         0	 /* Operation successful */
+#define SILC_REMOTEACC_FAILED     1	 /* Operation failed */
+#define SILC_REMOTEACC_NO_KEY     2	 /* Key not found */
+#define SILC_REMOTEACC_BUSY       3	 /* Daemon queue is full */
+
+/* Key ID is SHA-1 digest of the encoded public key */
+#define SILC_REMOTEACC_KEY_ID_LEN 20
+
+/* Maximum length of request or reply */
+#define SILC_REMOTEACC_MAX_LEN    65536
+
+/* Default socket path */
+#define SILC_REMOTEACC_SOCKET     "/var/run/remoteaccd.sock"
+
+/* Defaults */
+#define SILC_REMOTEACC_QUEUE_MAX  1024
+
+/* Computes the key ID of the public key to `key_id'.  Returns FALSE on
+   error. */
+SilcBool silc_remoteacc_key_id(SilcPublicKey public_key,
+			       unsigned char *key_id);
+
+#endif /* REMOTEACC_I_H */
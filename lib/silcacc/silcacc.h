@@ -30,14 +30,157 @@
  * Third-party accelerators can be registered into the accelerator interface
  * and used through the same generic interface.
  *
- * The interface can be used to accelerate public and private keys, and
- * ciphers.
+ * The interface can be used to accelerate public and private keys,
+ * ciphers, hash functions, MACs and Diffie-Hellman key agreement.
  *
  ***/
 
 #ifndef SILCACC_H
 #define SILCACC_H
 
+/****f* silcacc/SilcAccHashCb
+ *
+ * SYNOPSIS
+ *
+ *    typedef void (*SilcAccHashCb)(SilcBool success,
+ *                                  const unsigned char *digest,
+ *                                  SilcUInt32 digest_len,
+ *                                  void *context);
+ *
+ * DESCRIPTION
+ *
+ *    The hash and MAC completion callback given as argument to
+ *    silc_acc_hash_make and silc_acc_mac_make.  If `success' is TRUE the
+ *    `digest' of `digest_len' bytes is the computed hash or MAC.  The
+ *    `digest' is valid only for the duration of the callback.
+ *
+ ***/
+typedef void (*SilcAccHashCb)(SilcBool success,
+			      const unsigned char *digest,
+			      SilcUInt32 digest_len,
+			      void *context);
+
+/****s* silcacc/SilcAccHashObject
+ *
+ * NAME
+ *
+ *    typedef struct SilcAccHashObjectStruct { ... } SilcAccHashObject;
+ *
+ * DESCRIPTION
+ *
+ *    The accelerator hash and MAC operations.  The `name' is the name of
+ *    the hash function, or MAC in case of MAC acceleration, that the
+ *    accelerator supports.  It may also be "any".  The `make' computes
+ *    the hash from `data' with the algorithm of `hash', or if `mac' is
+ *    non-NULL, the MAC with the algorithm and key of `mac'.  The `make'
+ *    must not modify the `hash' or `mac' and must call the `callback'
+ *    once the digest has been computed.  The SILC_ACC_HASH_MAKE macro
+ *    can be used to declare the `make' operation.
+ *
+ ***/
+typedef struct SilcAccHashObjectStruct {
+  const char *name;			    /* Hash/MAC name or "any" */
+  SilcAsyncOperation (*make)(const struct SilcAccHashObjectStruct *ops,
+			     SilcHash hash, SilcMac mac,
+			     const unsigned char *data,
+			     SilcUInt32 data_len,
+			     SilcAccHashCb callback,
+			     void *context);
+} SilcAccHashObject;
+
+#define SILC_ACC_HASH_MAKE(name)					\
+  SilcAsyncOperation name(const struct SilcAccHashObjectStruct *ops,	\
+			  SilcHash hash, SilcMac mac,			\
+			  const unsigned char *data,			\
+			  SilcUInt32 data_len,				\
+			  SilcAccHashCb callback,			\
+			  void *context)
+
+/****d* silcacc/SilcAccStatsType
+ *
+ * NAME
+ *
+ *    typedef enum { ... } SilcAccStatsType;
+ *
+ * DESCRIPTION
+ *
+ *    The accelerated operation types.  The statistics returned by
+ *    silc_acc_get_stats are kept separately for each of these operations.
+ *
+ * SOURCE
+ */
+typedef enum {
+  SILC_ACC_STATS_ENCRYPT,		    /* Public key encryption */
+  SILC_ACC_STATS_DECRYPT,		    /* Private key decryption */
+  SILC_ACC_STATS_SIGN,			    /* Signature */
+  SILC_ACC_STATS_VERIFY,		    /* Signature verification */
+  SILC_ACC_STATS_CIPHER,		    /* Cipher encryption/decryption */
+  SILC_ACC_STATS_HASH,			    /* Hash function */
+  SILC_ACC_STATS_MAC,			    /* MAC */
+  SILC_ACC_STATS_DH,			    /* Diffie-Hellman */
+
+  SILC_ACC_STATS_MAX
+} SilcAccStatsType;
+/***/
+
+/* Number of latency histogram buckets */
+#define SILC_ACC_STATS_BUCKETS 128
+
+/****s* silcacc/SilcAccOpStats
+ *
+ * NAME
+ *
+ *    typedef struct { ... } *SilcAccOpStats, SilcAccOpStatsStruct;
+ *
+ * DESCRIPTION
+ *
+ *    Statistics of one accelerated operation type.  The `latency' is a
+ *    histogram of operation latencies in microseconds, measured from the
+ *    time the operation was given to the accelerator to the time the
+ *    result was delivered.  Each power of two is divided into four
+ *    buckets, so the precision of the histogram is about 25 percent over
+ *    the whole range.  The silc_acc_stats_percentile can be used to read
+ *    percentiles from the histogram.  Operations that complete in the
+ *    caller's thread, such as cipher operations, may not have latency
+ *    recorded.
+ *
+ * SOURCE
+ */
+typedef struct {
+  SilcUInt64 ops;			    /* Completed operations */
+  SilcUInt64 failed;			    /* Failed operations */
+  SilcUInt64 aborted;			    /* Aborted operations */
+  SilcUInt64 bytes;			    /* Processed data in bytes */
+  SilcUInt64 latency_sum;		    /* Sum of latencies, usec */
+  SilcUInt64 latency_max;		    /* Maximum latency, usec */
+  SilcUInt64 latency[SILC_ACC_STATS_BUCKETS]; /* Latency histogram */
+} *SilcAccOpStats, SilcAccOpStatsStruct;
+/***/
+
+/****s* silcacc/SilcAccStats
+ *
+ * NAME
+ *
+ *    typedef struct { ... } *SilcAccStats, SilcAccStatsStruct;
+ *
+ * DESCRIPTION
+ *
+ *    Accelerator statistics returned by silc_acc_get_stats.  Accelerator
+ *    fills the fields it has information on and leaves others zero.
+ *
+ * SOURCE
+ */
+typedef struct {
+  SilcUInt32 threads_max;		    /* Maximum number of threads */
+  SilcUInt32 threads_free;		    /* Number of idle threads */
+  SilcUInt32 queued;			    /* Queued operations */
+  SilcUInt32 running;			    /* Running operations or batches */
+  SilcUInt64 keystream_hits;		    /* Key stream was ready */
+  SilcUInt64 keystream_misses;		    /* Waited for key stream */
+  SilcAccOpStatsStruct op[SILC_ACC_STATS_MAX]; /* Per operation stats */
+} *SilcAccStats, SilcAccStatsStruct;
+/***/
+
 /****s* silcacc/SilcAccelerator
  *
  * NAME
@@ -60,10 +203,11 @@ typedef struct SilcAcceleratorObject {
   SilcBool (*uninit)(void);		    /* Uninitialize accelerator */
   const SilcPKCSAlgorithm *pkcs;            /* Accelerated PKCS algorithms */
   const SilcCipherObject *cipher;	    /* Accelerated ciphers */
-#if 0
+  const SilcAccHashObject *hash;	    /* Accelerated hashes */
+  const SilcAccHashObject *mac;		    /* Accelerated MACs */
   const SilcDHObject *dh;                   /* Accelerated Diffie-Hellmans */
-  const SilcHashObject *hash;		    /* Accelerated hashes */
-  const SilcHmacObject *hmac;		    /* Accelerated HMACs */
+  SilcBool (*get_stats)(SilcAccStats stats); /* Get statistics, optional */
+#if 0
   const SilcRngObject *rng;		    /* Accelerated RNG's */
 #endif /* 0 */
 } *SilcAccelerator, SilcAcceleratorStruct;
@@ -311,4 +455,255 @@ SilcCipher silc_acc_cipher(SilcAccelerator acc, SilcCipher cipher);
  ***/
 SilcCipher silc_acc_get_cipher(SilcAccelerator acc, SilcCipher cipher);
 
+/****f* silcacc/silc_acc_hash
+ *
+ * SYNOPSIS
+ *
+ *    SilcHash silc_acc_hash(SilcAccelerator acc, SilcHash hash);
+ *
+ * DESCRIPTION
+ *
+ *    Accelerate the hash function indicated by `hash'.  Returns new
+ *    accelerated SilcHash context.  It can be used just as normal hash
+ *    function and must be freed by calling silc_hash_free.  The associated
+ *    `hash' is not freed when the accelerated hash is freed.  The `hash'
+ *    must not be freed as long as it is accelerated.
+ *
+ *    The accelerated hash has its own hash state.  When it is used with
+ *    the normal SILC Hash API the digest is computed synchronously in the
+ *    calling thread.  To have the accelerator compute the digest the
+ *    silc_acc_hash_make must be called.
+ *
+ *    The associated `hash' can be retrieved from the accelerated hash
+ *    by calling silc_acc_get_hash.
+ *
+ *    If this returns NULL the hash could not be accelerated.  This
+ *    usually should not be considered serious error.  Instead, the hash
+ *    should be used without acceleration.
+ *
+ ***/
+SilcHash silc_acc_hash(SilcAccelerator acc, SilcHash hash);
+
+/****f* silcacc/silc_acc_get_hash
+ *
+ * SYNOPSIS
+ *
+ *    SilcHash silc_acc_get_hash(SilcAccelerator acc, SilcHash hash);
+ *
+ * DESCRIPTION
+ *
+ *    Returns the underlaying hash from the accelerated hash indicated
+ *    by `hash'.  Returns NULL if `hash' is not accelerated hash.
+ *
+ ***/
+SilcHash silc_acc_get_hash(SilcAccelerator acc, SilcHash hash);
+
+/****f* silcacc/silc_acc_hash_make
+ *
+ * SYNOPSIS
+ *
+ *    SilcAsyncOperation
+ *    silc_acc_hash_make(SilcHash hash, const unsigned char *data,
+ *                       SilcUInt32 data_len, SilcAccHashCb callback,
+ *                       void *context);
+ *
+ * DESCRIPTION
+ *
+ *    Computes the digest of `data' of `data_len' bytes with the hash
+ *    function `hash' and delivers it to `callback'.  If `hash' is an
+ *    accelerated hash the accelerator computes the digest.  Otherwise the
+ *    digest is computed synchronously and the `callback' is called before
+ *    this function returns.  Returns NULL if the operation was completed
+ *    synchronously, or the asynchronous operation context that can be
+ *    used to abort the operation.
+ *
+ *    The `data' need not remain valid after this function returns.
+ *
+ ***/
+SilcAsyncOperation silc_acc_hash_make(SilcHash hash,
+				      const unsigned char *data,
+				      SilcUInt32 data_len,
+				      SilcAccHashCb callback,
+				      void *context);
+
+/****f* silcacc/silc_acc_mac
+ *
+ * SYNOPSIS
+ *
+ *    SilcMac silc_acc_mac(SilcAccelerator acc, SilcMac mac);
+ *
+ * DESCRIPTION
+ *
+ *    Accelerate the MAC indicated by `mac'.  Returns new accelerated
+ *    SilcMac context.  It can be used just as normal MAC and must be
+ *    freed by calling silc_mac_free.  The associated `mac' is not freed
+ *    when the accelerated MAC is freed.  The `mac' must not be freed as
+ *    long as it is accelerated.
+ *
+ *    The key of the associated `mac' is copied to the accelerated MAC when
+ *    it is accelerated.  New key may be set with silc_mac_set_key.  When
+ *    the accelerated MAC is used with the normal SILC MAC API the MAC is
+ *    computed synchronously in the calling thread.  To have the
+ *    accelerator compute the MAC the silc_acc_mac_make must be called.
+ *
+ *    The associated `mac' can be retrieved from the accelerated MAC by
+ *    calling silc_acc_get_mac.
+ *
+ *    If this returns NULL the MAC could not be accelerated.  This
+ *    usually should not be considered serious error.  Instead, the MAC
+ *    should be used without acceleration.
+ *
+ ***/
+SilcMac silc_acc_mac(SilcAccelerator acc, SilcMac mac);
+
+/****f* silcacc/silc_acc_get_mac
+ *
+ * SYNOPSIS
+ *
+ *    SilcMac silc_acc_get_mac(SilcAccelerator acc, SilcMac mac);
+ *
+ * DESCRIPTION
+ *
+ *    Returns the underlaying MAC from the accelerated MAC indicated by
+ *    `mac'.  Returns NULL if `mac' is not accelerated MAC.
+ *
+ ***/
+SilcMac silc_acc_get_mac(SilcAccelerator acc, SilcMac mac);
+
+/****f* silcacc/silc_acc_mac_make
+ *
+ * SYNOPSIS
+ *
+ *    SilcAsyncOperation
+ *    silc_acc_mac_make(SilcMac mac, const unsigned char *data,
+ *                      SilcUInt32 data_len, SilcAccHashCb callback,
+ *                      void *context);
+ *
+ * DESCRIPTION
+ *
+ *    Computes the MAC of `data' of `data_len' bytes with the MAC `mac'
+ *    and its current key, and delivers it to `callback'.  If `mac' is an
+ *    accelerated MAC the accelerator computes the MAC.  Otherwise the MAC
+ *    is computed synchronously and the `callback' is called before this
+ *    function returns.  Returns NULL if the operation was completed
+ *    synchronously, or the asynchronous operation context that can be
+ *    used to abort the operation.
+ *
+ *    The `data' need not remain valid after this function returns.
+ *
+ ***/
+SilcAsyncOperation silc_acc_mac_make(SilcMac mac,
+				     const unsigned char *data,
+				     SilcUInt32 data_len,
+				     SilcAccHashCb callback,
+				     void *context);
+
+/****f* silcacc/silc_acc_dh
+ *
+ * SYNOPSIS
+ *
+ *    SilcBool silc_acc_dh(SilcAccelerator acc, SilcDH dh);
+ *
+ * DESCRIPTION
+ *
+ *    Accelerate the Diffie-Hellman context indicated by `dh'.  Unlike
+ *    other accelerated contexts, the `dh' is accelerated in place; after
+ *    this call the silc_dh_compute_public_async and
+ *    silc_dh_compute_key_async are executed by the accelerator `acc'.
+ *    The synchronous SILC DH API functions are not affected.  The `dh'
+ *    is freed normally with silc_dh_free.  The `dh' must not be
+ *    accelerated while an asynchronous operation is pending.
+ *
+ *    If this returns FALSE the DH could not be accelerated.  This usually
+ *    should not be considered serious error.  Instead, the DH should be
+ *    used without acceleration.
+ *
+ * EXAMPLE
+ *
+ *    dh = silc_dh_alloc(g, p, lpf);
+ *    silc_acc_dh(SILC_SOFTACC, dh);
+ *    silc_dh_generate_private(dh, NULL);
+ *    silc_dh_compute_public_async(dh, public_computed, ctx);
+ *
+ ***/
+SilcBool silc_acc_dh(SilcAccelerator acc, SilcDH dh);
+
+/****f* silcacc/silc_acc_get_stats
+ *
+ * SYNOPSIS
+ *
+ *    SilcBool silc_acc_get_stats(SilcAccelerator acc, SilcAccStats stats);
+ *
+ * DESCRIPTION
+ *
+ *    Returns the current statistics of the accelerator `acc' into the
+ *    `stats'.  Returns FALSE if the accelerator does not keep statistics
+ *    or it is not initialized.  The statistics are collected from the
+ *    time the accelerator was initialized.
+ *
+ * EXAMPLE
+ *
+ *    SilcAccStatsStruct stats;
+ *
+ *    silc_acc_get_stats(SILC_SOFTACC, &stats);
+ *    printf("Signatures %llu, 99th percentile %llu usec\n",
+ *           stats.op[SILC_ACC_STATS_SIGN].ops,
+ *           silc_acc_stats_percentile(&stats.op[SILC_ACC_STATS_SIGN], 99));
+ *
+ ***/
+SilcBool silc_acc_get_stats(SilcAccelerator acc, SilcAccStats stats);
+
+/****f* silcacc/silc_acc_stats_percentile
+ *
+ * SYNOPSIS
+ *
+ *    SilcUInt64 silc_acc_stats_percentile(SilcAccOpStats op,
+ *                                         SilcUInt32 percentile);
+ *
+ * DESCRIPTION
+ *
+ *    Returns the latency in microseconds under which `percentile' percent
+ *    of the operations in `op' completed.  The returned value is the upper
+ *    bound of the histogram bucket.  Returns 0 if no latencies have been
+ *    recorded.
+ *
+ ***/
+SilcUInt64 silc_acc_stats_percentile(SilcAccOpStats op,
+				     SilcUInt32 percentile);
+
+/****f* silcacc/silc_acc_stats_add
+ *
+ * SYNOPSIS
+ *
+ *    void silc_acc_stats_add(SilcAccOpStats op, SilcBool success,
+ *                            SilcUInt32 bytes, SilcInt64 latency);
+ *
+ * DESCRIPTION
+ *
+ *    Records one completed operation to `op'.  The `bytes' is the amount
+ *    of processed data and the `latency' is the latency in microseconds.
+ *    If `latency' is negative the latency is not recorded.  This is
+ *    intended to be used by accelerator implementations.  The function
+ *    does not lock; accelerator should record to per-thread statistics
+ *    and merge them with silc_acc_stats_merge when statistics are
+ *    requested.
+ *
+ ***/
+void silc_acc_stats_add(SilcAccOpStats op, SilcBool success,
+			SilcUInt32 bytes, SilcInt64 latency);
+
+/****f* silcacc/silc_acc_stats_merge
+ *
+ * SYNOPSIS
+ *
+ *    void silc_acc_stats_merge(SilcAccOpStats dst, SilcAccOpStats src);
+ *
+ * DESCRIPTION
+ *
+ *    Adds the statistics in `src' to `dst'.  This is intended to be used
+ *    by accelerator implementations.
+ *
+ ***/
+void silc_acc_stats_merge(SilcAccOpStats dst, SilcAccOpStats src);
+
 #endif /* SILCACC_H */
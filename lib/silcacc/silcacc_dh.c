@@ -0,0 +1,58 @@
+/*
+
+  silcacc_dh.c
+
+  Author: Pekka Riikonen <priikone@silcnet.org>
+
+  Copyright (C) 2008 Pekka Riikonen
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; version 2 of the License.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+*/
+
+#include "silccrypto.h"
+
+/*************************** SILC Accelerator API ***************************/
+
+/* Accelerate Diffie-Hellman.  The DH context is short-lived and owns its
+   key material, so instead of wrapping it we simply replace its
+   operations with the accelerator's. */
+
+SilcBool silc_acc_dh(SilcAccelerator acc, SilcDH dh)
+{
+  int i;
+
+  if (!acc || !dh)
+    return FALSE;
+
+  SILC_LOG_DEBUG(("Accelerate DH %p with accelerator %s", dh, acc->name));
+
+  if (!acc->dh) {
+    SILC_LOG_ERROR(("Accelerator '%s' does not support DH acceleration ",
+		    acc->name));
+    return FALSE;
+  }
+
+  /* Check that accelerator supports this DH */
+  for (i = 0; acc->dh[i].name; i++) {
+    if (!strcmp(acc->dh[i].name, dh->ops->name) ||
+	!strcmp(acc->dh[i].name, "any"))
+      break;
+  }
+  if (!acc->dh[i].name) {
+    SILC_LOG_DEBUG(("Accelerator %s does not support %s acceleration",
+		    acc->name, dh->ops->name));
+    return FALSE;
+  }
+
+  dh->ops = &acc->dh[i];
+
+  return TRUE;
+}
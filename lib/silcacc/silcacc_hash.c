@@ -0,0 +1,289 @@
+/*
+
+  silcacc_hash.c
+
+  Author: Pekka Riikonen <priikone@silcnet.org>
+
+  Copyright (C) 2008 Pekka Riikonen
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; version 2 of the License.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+*/
+
+#include "silccrypto.h"
+
+/************************** Types and definitions ***************************/
+
+/* Accelerated hash.  The accelerated SilcHash context points to this and
+   the hash operations are part of this context so that they are freed
+   when the hash is freed with silc_hash_free. */
+typedef struct SilcAcceleratorHashStruct {
+  SilcHashObject ops;			/* Accelerated hash operations */
+  SilcHash hash;			/* Associated hash */
+  SilcMac mac;				/* Associated MAC, when MAC */
+  const SilcAccHashObject *acc_hash;	/* Accelerator hash operations */
+  const SilcAccHashObject *acc_mac;	/* Accelerator MAC operations */
+  void *state;				/* Hash state */
+} *SilcAcceleratorHash;
+
+/*************************** Accelerator Hash API ***************************/
+
+/* The Hash API for the accelerated hash is simply a wrapper.  It calls
+   the associated hash algorithm with the accelerated hash's own state, so
+   the associated hash may be used at the same time. */
+
+static void silc_acc_hash_init(void *context)
+{
+  SilcAcceleratorHash h = context;
+  h->hash->hash->init(h->state);
+}
+
+static void silc_acc_hash_update(void *context, const unsigned char *data,
+				 SilcUInt32 len)
+{
+  SilcAcceleratorHash h = context;
+  h->hash->hash->update(h->state, data, len);
+}
+
+static void silc_acc_hash_final(void *context, unsigned char *digest)
+{
+  SilcAcceleratorHash h = context;
+  h->hash->hash->final(h->state, digest);
+}
+
+/* Allocate accelerated hash */
+
+static SilcHash silc_acc_hash_alloc(SilcHash hash)
+{
+  SilcAcceleratorHash h;
+  SilcHash new_hash;
+
+  new_hash = silc_calloc(1, sizeof(*new_hash));
+  if (!new_hash)
+    return NULL;
+
+  /* The hash state is allocated after the context */
+  h = silc_calloc(1, sizeof(*h) + hash->hash->context_len());
+  if (!h) {
+    silc_free(new_hash);
+    return NULL;
+  }
+  h->hash = hash;
+  h->state = h + 1;
+
+  /* Hash details come from the associated hash */
+  h->ops = *hash->hash;
+  h->ops.init = silc_acc_hash_init;
+  h->ops.update = silc_acc_hash_update;
+  h->ops.final = silc_acc_hash_final;
+
+  new_hash->hash = &h->ops;
+  new_hash->context = h;
+
+  return new_hash;
+}
+
+/* Returns accelerated hash context or NULL if `hash' is not accelerated */
+
+static SilcAcceleratorHash silc_acc_hash_context(SilcHash hash)
+{
+  if (!hash || hash->hash->init != silc_acc_hash_init)
+    return NULL;
+  return hash->context;
+}
+
+/*************************** SILC Accelerator API ***************************/
+
+/* Accelerate hash */
+
+SilcHash silc_acc_hash(SilcAccelerator acc, SilcHash hash)
+{
+  SilcAcceleratorHash h;
+  SilcHash new_hash;
+  int i;
+
+  if (!acc || !hash)
+    return NULL;
+
+  SILC_LOG_DEBUG(("Accelerate hash %p with accelerator %s",
+		  hash, acc->name));
+
+  if (!acc->hash) {
+    SILC_LOG_ERROR(("Accelerator '%s' does not support hash acceleration ",
+		    acc->name));
+    return NULL;
+  }
+
+  if (silc_acc_get_hash(NULL, hash)) {
+    SILC_LOG_DEBUG(("Hash %p is already accelerated", hash));
+    return NULL;
+  }
+
+  /* Check that accelerator supports this hash algorithm */
+  for (i = 0; acc->hash[i].name; i++) {
+    if (!strcmp(acc->hash[i].name, silc_hash_get_name(hash)) ||
+	!strcmp(acc->hash[i].name, "any"))
+      break;
+  }
+  if (!acc->hash[i].name) {
+    SILC_LOG_DEBUG(("Accelerator %s does not support %s acceleration",
+		    acc->name, silc_hash_get_name(hash)));
+    return NULL;
+  }
+
+  new_hash = silc_acc_hash_alloc(hash);
+  if (!new_hash)
+    return NULL;
+
+  h = new_hash->context;
+  h->acc_hash = &acc->hash[i];
+
+  SILC_LOG_DEBUG(("New accelerated hash %p", new_hash));
+
+  return new_hash;
+}
+
+/* Return underlaying hash from accelerated hash. */
+
+SilcHash silc_acc_get_hash(SilcAccelerator acc, SilcHash hash)
+{
+  SilcAcceleratorHash h = silc_acc_hash_context(hash);
+
+  if (!h || h->mac)
+    return NULL;
+
+  return h->hash;
+}
+
+/* Compute hash with the accelerator */
+
+SilcAsyncOperation silc_acc_hash_make(SilcHash hash,
+				      const unsigned char *data,
+				      SilcUInt32 data_len,
+				      SilcAccHashCb callback,
+				      void *context)
+{
+  SilcAcceleratorHash h = silc_acc_hash_context(hash);
+  unsigned char digest[SILC_HASH_MAXLEN];
+
+  if (h && h->acc_hash)
+    return h->acc_hash->make(h->acc_hash, hash, NULL, data, data_len,
+			     callback, context);
+
+  /* Not accelerated, compute synchronously */
+  silc_hash_make(hash, data, data_len, digest);
+  callback(TRUE, digest, silc_hash_len(hash), context);
+  memset(digest, 0, sizeof(digest));
+
+  return NULL;
+}
+
+/* Accelerate MAC */
+
+SilcMac silc_acc_mac(SilcAccelerator acc, SilcMac mac)
+{
+  SilcAcceleratorHash h;
+  SilcMac new_mac;
+  int i;
+
+  if (!acc || !mac)
+    return NULL;
+
+  SILC_LOG_DEBUG(("Accelerate MAC %p with accelerator %s", mac, acc->name));
+
+  if (!acc->mac) {
+    SILC_LOG_ERROR(("Accelerator '%s' does not support MAC acceleration ",
+		    acc->name));
+    return NULL;
+  }
+
+  if (silc_acc_get_mac(NULL, mac)) {
+    SILC_LOG_DEBUG(("MAC %p is already accelerated", mac));
+    return NULL;
+  }
+
+  /* Check that accelerator supports this MAC algorithm */
+  for (i = 0; acc->mac[i].name; i++) {
+    if (!strcmp(acc->mac[i].name, silc_mac_get_name(mac)) ||
+	!strcmp(acc->mac[i].name, "any"))
+      break;
+  }
+  if (!acc->mac[i].name) {
+    SILC_LOG_DEBUG(("Accelerator %s does not support %s acceleration",
+		    acc->name, silc_mac_get_name(mac)));
+    return NULL;
+  }
+
+  new_mac = silc_calloc(1, sizeof(*new_mac));
+  if (!new_mac)
+    return NULL;
+
+  /* The accelerated MAC uses accelerated hash of its own, so that it can
+     be used at the same time with the associated MAC. */
+  new_mac->hash = silc_acc_hash_alloc(mac->hash);
+  if (!new_mac->hash) {
+    silc_free(new_mac);
+    return NULL;
+  }
+  new_mac->mac = mac->mac;
+  new_mac->allocated_hash = TRUE;
+
+  h = new_mac->hash->context;
+  h->mac = mac;
+  h->acc_mac = &acc->mac[i];
+
+  /* Copy the key */
+  if (mac->key)
+    silc_mac_set_key(new_mac, mac->key, mac->key_len);
+
+  SILC_LOG_DEBUG(("New accelerated MAC %p", new_mac));
+
+  return new_mac;
+}
+
+/* Return underlaying MAC from accelerated MAC. */
+
+SilcMac silc_acc_get_mac(SilcAccelerator acc, SilcMac mac)
+{
+  SilcAcceleratorHash h;
+
+  if (!mac)
+    return NULL;
+
+  h = silc_acc_hash_context(mac->hash);
+  if (!h)
+    return NULL;
+
+  return h->mac;
+}
+
+/* Compute MAC with the accelerator */
+
+SilcAsyncOperation silc_acc_mac_make(SilcMac mac,
+				     const unsigned char *data,
+				     SilcUInt32 data_len,
+				     SilcAccHashCb callback,
+				     void *context)
+{
+  SilcAcceleratorHash h = silc_acc_hash_context(mac->hash);
+  unsigned char digest[SILC_HASH_MAXLEN];
+  SilcUInt32 digest_len;
+
+  if (h && h->acc_mac)
+    return h->acc_mac->make(h->acc_mac, mac->hash, mac, data, data_len,
+			    callback, context);
+
+  /* Not accelerated, compute synchronously */
+  silc_mac_make(mac, (unsigned char *)data, data_len, digest, &digest_len);
+  callback(TRUE, digest, digest_len, context);
+  memset(digest, 0, sizeof(digest));
+
+  return NULL;
+}
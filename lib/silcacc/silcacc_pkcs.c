@@ -342,6 +342,13 @@ SilcPublicKey silc_acc_public_key(SilcAccelerator acc,
   }
   pubkey->public_key = acc_pubkey;
 
+  /* Accelerated key encodes to the same key */
+  if (silc_atomic_get_int32(&public_key->digest_state) ==
+      SILC_PKCS_DIGEST_SET) {
+    memcpy(pubkey->digest, public_key->digest, sizeof(pubkey->digest));
+    silc_atomic_set_int32(&pubkey->digest_state, SILC_PKCS_DIGEST_SET);
+  }
+
   SILC_LOG_DEBUG(("New accelerated public key %p", pubkey));
 
   return pubkey;
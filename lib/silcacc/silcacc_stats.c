@@ -0,0 +1,146 @@
+/*
+
+  silcacc_stats.c
+
+  Author: Pekka Riikonen <priikone@silcnet.org>
+
+  Copyright (C) 2008 Pekka Riikonen
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; version 2 of the License.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+*/
+
+#include "silccrypto.h"
+
+/* The latency histogram is log-linear; every power of two is divided into
+   four buckets.  Values 0 - 3 have a bucket of their own. */
+
+/************************ Static utility functions **************************/
+
+/* Returns histogram bucket for the value */
+
+static SilcUInt32 silc_acc_stats_bucket(SilcUInt64 value)
+{
+  SilcUInt32 e = 0, bucket;
+
+  if (value < 4)
+    return (SilcUInt32)value;
+
+  /* Position of most significant bit */
+  while ((value >> e) > 1)
+    e++;
+
+  bucket = ((e - 1) << 2) + ((value >> (e - 2)) & 3);
+  if (bucket >= SILC_ACC_STATS_BUCKETS)
+    bucket = SILC_ACC_STATS_BUCKETS - 1;
+
+  return bucket;
+}
+
+/* Returns the largest value that falls into the bucket */
+
+static SilcUInt64 silc_acc_stats_bucket_max(SilcUInt32 bucket)
+{
+  SilcUInt32 e;
+
+  if (bucket < 4)
+    return bucket;
+
+  e = (bucket >> 2) + 1;
+  return (((SilcUInt64)(4 + (bucket & 3) + 1)) << (e - 2)) - 1;
+}
+
+/*************************** SILC Accelerator API ***************************/
+
+/* Get accelerator statistics */
+
+SilcBool silc_acc_get_stats(SilcAccelerator acc, SilcAccStats stats)
+{
+  if (!acc || !stats)
+    return FALSE;
+
+  memset(stats, 0, sizeof(*stats));
+
+  if (!acc->get_stats)
+    return FALSE;
+
+  return acc->get_stats(stats);
+}
+
+/* Return latency percentile */
+
+SilcUInt64 silc_acc_stats_percentile(SilcAccOpStats op,
+				     SilcUInt32 percentile)
+{
+  SilcUInt64 total = 0, count = 0, limit;
+  int i;
+
+  for (i = 0; i < SILC_ACC_STATS_BUCKETS; i++)
+    total += op->latency[i];
+  if (!total)
+    return 0;
+
+  if (percentile > 100)
+    percentile = 100;
+  limit = (total * percentile + 99) / 100;
+  if (!limit)
+    limit = 1;
+
+  for (i = 0; i < SILC_ACC_STATS_BUCKETS; i++) {
+    count += op->latency[i];
+    if (count >= limit)
+      break;
+  }
+  if (i == SILC_ACC_STATS_BUCKETS)
+    i--;
+
+  /* Last bucket is open ended */
+  if (i == SILC_ACC_STATS_BUCKETS - 1)
+    return op->latency_max;
+
+  return silc_acc_stats_bucket_max(i);
+}
+
+/* Record operation */
+
+void silc_acc_stats_add(SilcAccOpStats op, SilcBool success,
+			SilcUInt32 bytes, SilcInt64 latency)
+{
+  op->ops++;
+  if (!success)
+    op->failed++;
+  op->bytes += bytes;
+
+  if (latency < 0)
+    return;
+
+  op->latency[silc_acc_stats_bucket(latency)]++;
+  op->latency_sum += latency;
+  if (latency > op->latency_max)
+    op->latency_max = latency;
+}
+
+/* Merge statistics */
+
+void silc_acc_stats_merge(SilcAccOpStats dst, SilcAccOpStats src)
+{
+  int i;
+
+  dst->ops += src->ops;
+  dst->failed += src->failed;
+  dst->aborted += src->aborted;
+  dst->bytes += src->bytes;
+  dst->latency_sum += src->latency_sum;
+  if (src->latency_max > dst->latency_max)
+    dst->latency_max = src->latency_max;
+
+  for (i = 0; i < SILC_ACC_STATS_BUCKETS; i++)
+    dst->latency[i] += src->latency[i];
+}
@@ -41,8 +41,27 @@ const SilcAcceleratorStruct silc_softacc =
 #else /* !SILC_DIST_SOFTACC_CIPHER */
   NULL,
 #endif /* SILC_DIST_SOFTACC_CIPHER */
+#ifdef SILC_DIST_SOFTACC_HASH
+  softacc_hash,
+  softacc_mac,
+#else /* !SILC_DIST_SOFTACC_HASH */
+  NULL,
+  NULL,
+#endif /* SILC_DIST_SOFTACC_HASH */
+#ifdef SILC_DIST_SOFTACC_DH
+  softacc_dh,
+#else /* !SILC_DIST_SOFTACC_DH */
+  NULL,
+#endif /* SILC_DIST_SOFTACC_DH */
+  silc_softacc_get_stats,
 };
 
+/* Thread-local statistics pointer */
+typedef struct {
+  SilcSoftaccStats stats;		 /* This thread's statistics */
+  SilcInt64 generation;			 /* Accelerator it belongs to */
+} *SilcSoftaccThreadStats;
+
 /***************************** Accelerator API ******************************/
 
 /* Initialize software accelerator */
@@ -67,6 +86,12 @@ SilcBool silc_softacc_init(SilcSchedule schedule, va_list va)
   sa->cipher_threads = SILC_SOFTACC_CIPHER_THREADS;
   sa->cipher_blocks = SILC_SOFTACC_CIPHER_BLOCKS;
   sa->cipher_streams = SILC_SOFTACC_CIPHER_STREAMS;
+  sa->cipher_chunk = SILC_SOFTACC_CIPHER_CHUNK;
+  sa->hash_threshold = SILC_SOFTACC_HASH_THRESHOLD;
+  sa->hash_batch = SILC_SOFTACC_HASH_BATCH;
+  sa->pkcs_threads = SILC_SOFTACC_PKCS_THREADS;
+  sa->pkcs_batch = SILC_SOFTACC_PKCS_BATCH;
+  sa->pkcs_queue_max = SILC_SOFTACC_PKCS_QUEUE_MAX;
 
   /* Get options */
   while ((opt = va_arg(va, char *))) {
@@ -80,9 +105,26 @@ SilcBool silc_softacc_init(SilcSchedule schedule, va_list va)
       sa->cipher_blocks = va_arg(va, SilcUInt32);
     else if (!strcmp(opt, "cipher_streams"))
       sa->cipher_streams = va_arg(va, SilcUInt32);
+    else if (!strcmp(opt, "cipher_chunk"))
+      sa->cipher_chunk = va_arg(va, SilcUInt32);
+    else if (!strcmp(opt, "hash_threshold"))
+      sa->hash_threshold = va_arg(va, SilcUInt32);
+    else if (!strcmp(opt, "hash_batch"))
+      sa->hash_batch = va_arg(va, SilcUInt32);
+    else if (!strcmp(opt, "pkcs_threads"))
+      sa->pkcs_threads = va_arg(va, SilcUInt32);
+    else if (!strcmp(opt, "pkcs_batch"))
+      sa->pkcs_batch = va_arg(va, SilcUInt32);
+    else if (!strcmp(opt, "pkcs_queue_max"))
+      sa->pkcs_queue_max = va_arg(va, SilcUInt32);
   }
 
-  if (!sa->cipher_streams || !sa->cipher_blocks || !sa->cipher_threads)
+  if (!sa->cipher_streams || !sa->cipher_blocks || !sa->cipher_threads ||
+      !sa->cipher_chunk)
+    return FALSE;
+  if (!sa->hash_batch)
+    return FALSE;
+  if (!sa->pkcs_threads || !sa->pkcs_batch || !sa->pkcs_queue_max)
     return FALSE;
 
   SILC_LOG_DEBUG(("Initialize software accelerator, min_threads %d, "
@@ -96,6 +138,18 @@ SilcBool silc_softacc_init(SilcSchedule schedule, va_list va)
     return FALSE;
   }
 
+  if (!silc_mutex_alloc(&sa->stats_lock)) {
+    silc_thread_pool_free(sa->tp, FALSE);
+    silc_global_del_var("softacc", FALSE);
+    return FALSE;
+  }
+  silc_list_init(sa->stats, struct SilcSoftaccStatsStruct, next);
+  sa->generation = silc_time_usec();
+
+#ifdef SILC_DIST_SOFTACC_PKCS
+  silc_softacc_pkcs_init(sa);
+#endif /* SILC_DIST_SOFTACC_PKCS */
+
   return TRUE;
 }
 
@@ -103,6 +157,7 @@ SilcBool silc_softacc_init(SilcSchedule schedule, va_list va)
 
 SilcBool silc_softacc_uninit(void)
 {
+  SilcSoftaccStats stats;
   SilcSoftacc sa;
 
   sa = silc_global_get_var("softacc", FALSE);
@@ -111,8 +166,99 @@ SilcBool silc_softacc_uninit(void)
 
   SILC_LOG_DEBUG(("Uninitialize software accelerator"));
 
+#ifdef SILC_DIST_SOFTACC_HASH
+  silc_softacc_hash_uninit(sa);
+#endif /* SILC_DIST_SOFTACC_HASH */
+#ifdef SILC_DIST_SOFTACC_PKCS
+  silc_softacc_pkcs_uninit(sa);
+#endif /* SILC_DIST_SOFTACC_PKCS */
+
   silc_thread_pool_free(sa->tp, TRUE);
+
+  silc_list_start(sa->stats);
+  while ((stats = silc_list_get(sa->stats)))
+    silc_free(stats);
+  silc_mutex_free(sa->stats_lock);
+
   silc_global_del_var("softacc", FALSE);
 
   return TRUE;
 }
+
+/* Returns the calling thread's statistics */
+
+SilcSoftaccStats silc_softacc_stats(SilcSoftacc sa)
+{
+  SilcSoftaccThreadStats ts;
+
+  ts = silc_global_get_var("softacc_stats", TRUE);
+  if (ts && ts->stats && ts->generation == sa->generation)
+    return ts->stats;
+
+  /* First statistics in this thread since initialization */
+  if (!ts) {
+    ts = silc_global_set_var("softacc_stats", sizeof(*ts), NULL, TRUE);
+    if (!ts)
+      return NULL;
+  }
+
+  ts->stats = silc_calloc(1, sizeof(*ts->stats));
+  if (!ts->stats)
+    return NULL;
+  ts->generation = sa->generation;
+
+  silc_mutex_lock(sa->stats_lock);
+  silc_list_add(sa->stats, ts->stats);
+  silc_mutex_unlock(sa->stats_lock);
+
+  return ts->stats;
+}
+
+/* Get statistics.  Merges the statistics of all threads. */
+
+SilcBool silc_softacc_get_stats(SilcAccStats stats)
+{
+  SilcSoftaccStats ts;
+  SilcSoftacc sa;
+  int i;
+
+  sa = silc_global_get_var("softacc", FALSE);
+  if (!sa)
+    return FALSE;
+
+  stats->threads_max = sa->max_threads;
+  stats->threads_free = silc_thread_pool_num_free_threads(sa->tp);
+  stats->queued = sa->pkcs_queued;
+  stats->running = sa->pkcs_running;
+#ifdef SILC_DIST_SOFTACC_HASH
+  stats->queued += silc_softacc_hash_queued(sa);
+#endif /* SILC_DIST_SOFTACC_HASH */
+
+  silc_mutex_lock(sa->stats_lock);
+  silc_list_start(sa->stats);
+  while ((ts = silc_list_get(sa->stats))) {
+    stats->keystream_hits += ts->keystream_hits;
+    stats->keystream_misses += ts->keystream_misses;
+    for (i = 0; i < SILC_ACC_STATS_MAX; i++)
+      silc_acc_stats_merge(&stats->op[i], &ts->op[i]);
+  }
+  silc_mutex_unlock(sa->stats_lock);
+
+  return TRUE;
+}
+
+/* Returns the thread pool */
+
+SilcThreadPool silc_softacc_get_thread_pool(SilcUInt32 *ret_max_threads)
+{
+  SilcSoftacc sa;
+
+  sa = silc_global_get_var("softacc", FALSE);
+  if (!sa)
+    return NULL;
+
+  if (ret_max_threads)
+    *ret_max_threads = sa->max_threads;
+
+  return sa->tp;
+}
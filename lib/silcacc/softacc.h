@@ -46,13 +46,30 @@
  * The SilcSchedule must be given as argument to silc_acc_init if the
  * softacc is used to accelerate public keys and private keys.
  *
+ * The private key operations (signature and decryption) are interactive
+ * operations and they are always run before the queued public key
+ * operations (verification and encryption), so that a burst of bulk
+ * verifications does not delay the signatures of a handshake.  Queued
+ * operations of the same key are run in batches in one thread.  The number
+ * of queued operations is limited.  If the limit is reached the operation
+ * fails immediately and silc_errno is set to SILC_ERR_WOULD_BLOCK.  The
+ * application should then retry later or use the key without acceleration.
+ *
  * Ciphers:
  *
- * The software accelerator can accelerate ciphers.  The only supported
- * encryption mode is Counter Mode (CTR).  Ciphers with other encryption
- * modes cannot be accelerated.  The CTR mode is accelerated by pre-computing
- * the CTR key stream in threads.  This can significantly enhance both
- * encryption and decryption performance.
+ * The software accelerator can accelerate ciphers in Counter Mode (CTR),
+ * Cipher Block Chaining (CBC) mode and Electronic Codebook (ECB) mode.
+ * Ciphers with other encryption modes cannot be accelerated.  The CTR mode
+ * is accelerated by pre-computing the CTR key stream in threads.  This can
+ * significantly enhance both encryption and decryption performance.
+ *
+ * ECB encryption and decryption, and CBC decryption are accelerated by
+ * splitting one large silc_cipher_encrypt or silc_cipher_decrypt call into
+ * chunks that are processed in parallel in threads.  The call returns when
+ * all chunks are done.  CBC encryption cannot be parallelized and is not
+ * accelerated.  Data shorter than two "cipher_chunk" is processed without
+ * threads.  With CBC and ECB the data length must be multiple of the
+ * cipher block size.
  *
  * The accelerated cipher can be used with normal SILC Cipher API.
  * Internally however the software accelerator is used.  Currently only
@@ -61,6 +78,41 @@
  * cannot be used.  The IV must be set with silc_cipher_set_iv prior to
  * encrypting and decrypting.  Usually, this is not an issue for programmer.
  *
+ * Hash functions and MACs:
+ *
+ * The software accelerator can accelerate hash functions and MACs.  The
+ * digests requested with silc_acc_hash_make and silc_acc_mac_make are
+ * computed in threads.  Large jobs are run alone in a thread.  Small jobs
+ * are collected into a batch that is computed in one thread, which makes
+ * it possible to use all cores to compute large number of small digests.
+ * The SilcSchedule must be given as argument to silc_acc_init if the
+ * softacc is used to accelerate hash functions and MACs.
+ *
+ * The accelerated hash and MAC can be used with normal SILC Hash and
+ * SILC MAC API also, in which case the digest is computed synchronously
+ * without the software accelerator.
+ *
+ * Diffie-Hellman:
+ *
+ * The software accelerator can accelerate Diffie-Hellman key agreement.
+ * The modular exponentiations of silc_dh_compute_public_async and
+ * silc_dh_compute_key_async are executed in threads, so that bursts of
+ * key exchanges do not block the scheduler.  The SilcSchedule must be
+ * given as argument to silc_acc_init if the softacc is used to accelerate
+ * Diffie-Hellman.  Only the modular exponentiation groups are accelerated,
+ * X25519 is fast enough to be computed directly.
+ *
+ * Statistics:
+ *
+ * The software accelerator keeps statistics of all accelerated operations.
+ * They can be retrieved with silc_acc_get_stats.  Each thread records its
+ * statistics separately, and they are merged when statistics are
+ * retrieved, so keeping statistics is cheap.  Accelerated ciphers record
+ * their statistics each time a new key stream is taken into use.  The
+ * key stream misses tell how often encryption had to wait for the key
+ * stream to be computed.  If misses are frequent, increasing
+ * "cipher_threads" or "cipher_streams" may help.
+ *
  * PERFORMANCE
  *
  * Ciphers:
@@ -128,6 +180,46 @@
  * number can be used to tweak the performance of the softacc.  If this
  * option is not given the default number is 2 * "cipher_threads".
  *
+ * "cipher_chunk"
+ *
+ * The minimum number of bytes each thread processes when ECB or CBC
+ * encryption is split into chunks.  The number of chunks is also limited
+ * by "max_threads".  If this option is not given the default number is
+ * 65536.
+ *
+ * "hash_threshold"
+ *
+ * The data length in bytes from which on the hash and MAC jobs are
+ * computed alone in a thread.  Jobs with less data are collected into
+ * a batch.  The batch is also run when it has this much data in total.
+ * If this option is not given the default number is 16384.
+ *
+ * "hash_batch"
+ *
+ * The maximum number of small hash and MAC jobs collected into one batch.
+ * A batch is run when it becomes full, or when the control returns to
+ * the scheduler, whichever happens first.  If this option is not given
+ * the default number is 64.
+ *
+ * "pkcs_threads"
+ *
+ * The maximum number of threads that run public key and private key
+ * operations at the same time.  If this option is not given the default
+ * number is 4.
+ *
+ * "pkcs_batch"
+ *
+ * The maximum number of queued public key or private key operations of
+ * the same key that are run in one thread as a batch.  If this option is
+ * not given the default number is 8.
+ *
+ * "pkcs_queue_max"
+ *
+ * The maximum number of queued public key and private key operations.
+ * When the limit is reached new operations fail with SILC_ERR_WOULD_BLOCK
+ * until the queue drains.  If this option is not given the default number
+ * is 1024.
+ *
  * EXAMPLE
  *
  * // Initialize the software accelerator.
@@ -210,4 +302,22 @@ extern DLLAPI const SilcAcceleratorStruct silc_softacc;
  ***/
 #define SILC_SOFTACC_NAME "softacc"
 
+/****f* silcacc/silc_softacc_get_thread_pool
+ *
+ * SYNOPSIS
+ *
+ *    SilcThreadPool silc_softacc_get_thread_pool(SilcUInt32 *ret_max_threads);
+ *
+ * DESCRIPTION
+ *
+ *    Returns the thread pool of the software accelerator, or NULL if the
+ *    software accelerator has not been initialized.  The maximum number
+ *    of threads in the pool is returned to `ret_max_threads' if it is
+ *    non-NULL.  The crypto library uses the thread pool for operations
+ *    that can be run in parallel, such as RSA key generation.  The thread
+ *    pool must not be freed by the caller.
+ *
+ ***/
+SilcThreadPool silc_softacc_get_thread_pool(SilcUInt32 *ret_max_threads);
+
 #endif /* SOFTACC_H */
@@ -29,8 +29,10 @@
 /* Cipher accelerator accelerates ciphers using counter mode by precomputing
    the CTR key stream in threads.  Encryption and decryption uses the
    precomputed key stream and gets significant speed improvement in the
-   process.  The threads are reserved from the thread pool and they remain
-   reserved as long as the cipher is accelerated.
+   process.  ECB mode and CBC decryption are accelerated by splitting large
+   data into chunks that are processed in parallel in threads.  The
+   threads are reserved from the thread pool and they remain reserved as
+   long as the cipher is accelerated.
 
    As a queue we use SilcThreadQueue from SRT which handles locking and
    waiting automatically and supports multiple pipes for multiple key
@@ -111,6 +113,32 @@ const SilcCipherObject softacc_cipher[] =
     SILC_CIPHER_MODE_CTR, 	/* Only CTR mode can be accelerated */
   },
 
+  /* All ciphers in CBC mode.  Only decryption is parallelized. */
+  {
+    "any", "any",
+    silc_softacc_cipher_block_set_key,
+    silc_softacc_cipher_block_set_iv,
+    silc_softacc_cipher_block_encrypt,
+    silc_softacc_cipher_block_decrypt,
+    silc_softacc_cipher_block_init,
+    silc_softacc_cipher_block_uninit,
+    0, 0, 0,
+    SILC_CIPHER_MODE_CBC,
+  },
+
+  /* All ciphers in ECB mode */
+  {
+    "any", "any",
+    silc_softacc_cipher_block_set_key,
+    silc_softacc_cipher_block_set_iv,
+    silc_softacc_cipher_block_encrypt,
+    silc_softacc_cipher_block_decrypt,
+    silc_softacc_cipher_block_init,
+    silc_softacc_cipher_block_uninit,
+    0, 0, 0,
+    SILC_CIPHER_MODE_ECB,
+  },
+
   {
     NULL, NULL, NULL, NULL, NULL,
     NULL, NULL, 0, 0, 0, 0,
@@ -123,6 +151,9 @@ const SilcCipherObject softacc_cipher[] =
 /* Thread stop signal */
 #define SILC_KEYSTREAM_STOP (void *)0x01
 
+/* Number of counter blocks encrypted in one batch */
+#define SILC_KEYSTREAM_BATCH 8
+
 /* Key stream context */
 typedef struct {
   SilcUInt32 key_index;			      /* Key index in queue */
@@ -146,34 +177,122 @@ typedef struct SilcSoftaccCipherStruct {
   SilcUInt32 pad;			      /* Partial block offset */
   SilcUInt32 num_key_stream;		      /* Number of key streams */
   SilcUInt32 cipher_blocks;		      /* Number of cipher blocks */
+  SilcUInt64 ops;			      /* Statistics not yet recorded */
+  SilcUInt64 bytes;
+  SilcUInt32 hits;
+  SilcUInt32 misses;
   unsigned int cipher_threads : 31;	      /* Number of cipher threads */
   unsigned int key_set : 1;		      /* Set when key is set */
 } *SilcSoftaccCipher;
 
 /************************** Static utility functions ************************/
 
-/* Add value to MSB ordered counter. */
+/* Add value to MSB ordered counter.  The counter is processed in 64-bit
+   words and `block_len' must be multiple of 8. */
 
 static inline
 void silc_softacc_add_ctr(unsigned char *ctr, SilcUInt32 block_len,
 			  SilcUInt32 val)
 {
-  SilcUInt16 q = 0;
-  int i;
+  SilcUInt64 w, add = val;
+  SilcInt32 i;
 
   if (!val)
     return;
 
-  for (i = block_len - 1; i >= 0; i--) {
-    q += ctr[i] + (val & 0xff);
-    ctr[i] = (q & 0xff);
-    val >>= 8;
-    q >>= 8;
-    if (!val && !q)
+  for (i = block_len - 8; i >= 0; i -= 8) {
+    SILC_GET64_MSB(w, ctr + i);
+    w += add;
+    SILC_PUT64_MSB(w, ctr + i);
+    if (w >= add)
       return;
+    add = 1;
   }
 }
 
+/* XOR key stream to data.  The `len' must be multiple of 8. */
+
+static inline
+void silc_softacc_xor(unsigned char *dst, const unsigned char *src,
+		      const unsigned char *key, SilcUInt32 len)
+{
+#ifndef WORDS_BIGENDIAN
+  SilcUInt64 *d = (SilcUInt64 *)dst;
+  const SilcUInt64 *s = (const SilcUInt64 *)src;
+  const SilcUInt64 *k = (const SilcUInt64 *)key;
+
+  /* Four words at a time.  The compiler can vectorize this. */
+  for (; len >= 32; len -= 32) {
+    d[0] = s[0] ^ k[0];
+    d[1] = s[1] ^ k[1];
+    d[2] = s[2] ^ k[2];
+    d[3] = s[3] ^ k[3];
+    d += 4;
+    s += 4;
+    k += 4;
+  }
+  for (; len >= 8; len -= 8)
+    *d++ = *s++ ^ *k++;
+#else
+  SilcUInt64 dst_tmp, src_tmp, key_tmp;
+
+  for (; len >= 8; len -= 8) {
+    SILC_GET64_MSB(src_tmp, src);
+    SILC_GET64_MSB(key_tmp, key);
+    dst_tmp = src_tmp ^ key_tmp;
+    SILC_PUT64_MSB(dst_tmp, dst);
+    src += 8;
+    dst += 8;
+    key += 8;
+  }
+#endif /* !WORDS_BIGENDIAN */
+}
+
+/* Records the statistics collected in the cipher context to this thread's
+   statistics.  This is done when key stream is changed so that the
+   encryption need not touch the statistics. */
+
+static void silc_softacc_cipher_stats(SilcSoftaccCipher c)
+{
+  SilcSoftaccStats st;
+  SilcSoftacc sa;
+
+  sa = silc_global_get_var("softacc", FALSE);
+  if (!sa)
+    return;
+  st = silc_softacc_stats(sa);
+  if (!st)
+    return;
+
+  st->op[SILC_ACC_STATS_CIPHER].ops += c->ops;
+  st->op[SILC_ACC_STATS_CIPHER].bytes += c->bytes;
+  st->keystream_hits += c->hits;
+  st->keystream_misses += c->misses;
+  c->ops = c->bytes = 0;
+  c->hits = c->misses = 0;
+}
+
+/* Returns next key stream from the queue.  Waits for the key stream if it
+   is not precomputed yet. */
+
+static SilcSoftaccCipherKeyStream
+silc_softacc_cipher_next(SilcSoftaccCipher c)
+{
+  SilcSoftaccCipherKeyStream key;
+
+  key = silc_thread_queue_pop(c->queue, c->cur_index, FALSE);
+  if (key) {
+    c->hits++;
+  } else {
+    c->misses++;
+    key = silc_thread_queue_pop(c->queue, c->cur_index, TRUE);
+  }
+
+  silc_softacc_cipher_stats(c);
+
+  return key;
+}
+
 /*********************************** AES ************************************/
 
 #define SILC_AES_BLOCK 16
@@ -203,9 +322,9 @@ void silc_softacc_cipher_aes_thread(SilcSchedule schedule, void *context)
   SilcSoftaccCipher c = context;
   SilcThreadQueue queue = c->queue;
   SilcSoftaccCipherKeyStream key;
-  SilcUInt32 i, num_key_stream = c->num_key_stream;
+  SilcUInt32 i, k, n, num_key_stream = c->num_key_stream;
   SilcUInt32 cipher_blocks = c->cipher_blocks;
-  SilcInt32 k;
+  SilcUInt64 ctr_hi, ctr_lo;
   unsigned char *enc_ctr;
 
   SILC_SOFTACC_DEBUG(("Start CTR precomputation thread"));
@@ -224,20 +343,36 @@ void silc_softacc_cipher_aes_thread(SilcSchedule schedule, void *context)
     SILC_SOFTACC_DEBUG(("Precompute key stream %p, index %d", key,
 			key->key_index));
 
-    /* Encrypt */
+    SILC_GET64_MSB(ctr_hi, key->ctr);
+    SILC_GET64_MSB(ctr_lo, key->ctr + 8);
+
+    /* Encrypt.  The counter blocks of a batch are written to the key stream
+       first and then encrypted in place.  The blocks in a batch do not
+       depend on each other so the encryptions can overlap in the CPU. */
     enc_ctr = key->key;
-    for (i = 0; i < cipher_blocks; i++) {
-      for (k = SILC_AES_BLOCK - 1; k >= 0; k--)
-	if (++key->ctr[k])
-	  break;
-      aes_encrypt(key->ctr, enc_ctr, &c->c.aes.u.enc);
-      enc_ctr += SILC_AES_BLOCK;
+    for (i = 0; i < cipher_blocks; i += n) {
+      n = cipher_blocks - i;
+      if (n > SILC_KEYSTREAM_BATCH)
+	n = SILC_KEYSTREAM_BATCH;
+
+      for (k = 0; k < n; k++) {
+	if (!++ctr_lo)
+	  ctr_hi++;
+	SILC_PUT64_MSB(ctr_hi, enc_ctr + (k << 4));
+	SILC_PUT64_MSB(ctr_lo, enc_ctr + (k << 4) + 8);
+      }
+      for (k = 0; k < n; k++)
+	aes_encrypt(enc_ctr + (k << 4), enc_ctr + (k << 4), &c->c.aes.u.enc);
+
+      enc_ctr += (n << 4);
     }
 
     SILC_SOFTACC_DEBUG(("Precomputed key stream %p, index %d", key,
 			key->key_index));
 
     /* Update counter */
+    SILC_PUT64_MSB(ctr_hi, key->ctr);
+    SILC_PUT64_MSB(ctr_lo, key->ctr + 8);
     silc_softacc_add_ctr(key->ctr, SILC_AES_BLOCK,
 			 (num_key_stream - 1) * cipher_blocks);
 
@@ -377,12 +512,15 @@ SILC_CIPHER_API_ENCRYPT(softacc_cipher_aes)
   SilcSoftaccCipher c = context;
   SilcSoftaccCipherKeyStream key;
   SilcUInt32 pad = c->pad, block = c->cur_block;
-  SilcUInt32 blocks, cipher_blocks = c->cipher_blocks;
+  SilcUInt32 blocks, n, cipher_blocks = c->cipher_blocks;
   unsigned char *enc_ctr;
 
+  c->ops++;
+  c->bytes += len;
+
   key = c->cur;
   if (!key) {
-    c->cur = key = silc_thread_queue_pop(c->queue, c->cur_index, TRUE);
+    c->cur = key = silc_softacc_cipher_next(c);
     SILC_SOFTACC_DEBUG(("Got key stream %p, index %d", key, key->key_index));
   }
 
@@ -402,7 +540,7 @@ SILC_CIPHER_API_ENCRYPT(softacc_cipher_aes)
 
 	  /* Get new key stream from queue */
 	  c->cur_index = (c->cur_index + 1) % c->num_key_stream;
-	  c->cur = key = silc_thread_queue_pop(c->queue, c->cur_index, TRUE);
+	  c->cur = key = silc_softacc_cipher_next(c);
 	  SILC_SOFTACC_DEBUG(("Got key stream %p, index %d", key,
 			      key->key_index));
 	  enc_ctr = key->key;
@@ -413,35 +551,25 @@ SILC_CIPHER_API_ENCRYPT(softacc_cipher_aes)
     }
   }
 
-  /* Compute full blocks */
+  /* Compute full blocks.  As many blocks as the current key stream has
+     left are XORed at once. */
   blocks = len >> 4;
   len -= (blocks << 4);
-  while (blocks--) {
-    /* CTR mode */
-#ifndef WORDS_BIGENDIAN
-    *(SilcUInt64 *)dst = (*(SilcUInt64 *)src ^
-			  *(SilcUInt64 *)enc_ctr);
-    *(SilcUInt64 *)(dst + 8) = (*(SilcUInt64 *)(src + 8) ^
-				*(SilcUInt64 *)(enc_ctr + 8));
-#else
-    SilcUInt64 dst_tmp, src_tmp, enc_ctr_tmp;
-
-    SILC_GET64_MSB(src_tmp, src);
-    SILC_GET64_MSB(enc_ctr_tmp, enc_ctr);
-    dst_tmp = src_tmp ^ enc_ctr_tmp;
-    SILC_PUT64_MSB(dst_tmp, dst);
+  while (blocks) {
+    n = cipher_blocks - block;
+    if (n > blocks)
+      n = blocks;
 
-    SILC_GET64_MSB(src_tmp, src + 8);
-    SILC_GET64_MSB(enc_ctr_tmp, enc_ctr + 8);
-    dst_tmp = src_tmp ^ enc_ctr_tmp;
-    SILC_PUT64_MSB(dst_tmp, dst + 8);
-#endif /* !WORDS_BIGENDIAN */
+    /* CTR mode */
+    silc_softacc_xor(dst, src, enc_ctr, n << 4);
 
-    src += SILC_AES_BLOCK;
-    dst += SILC_AES_BLOCK;
-    enc_ctr += SILC_AES_BLOCK;
+    src += (n << 4);
+    dst += (n << 4);
+    enc_ctr += (n << 4);
+    blocks -= n;
+    block += n;
 
-    if (++block == cipher_blocks) {
+    if (block == cipher_blocks) {
       /* Push the used up key stream back to the queue */
       SILC_SOFTACC_DEBUG(("Push empty key stream %p index %d back to queue",
 			  key, key->key_index));
@@ -449,7 +577,7 @@ SILC_CIPHER_API_ENCRYPT(softacc_cipher_aes)
 
       /* Get new key stream from queue */
       c->cur_index = (c->cur_index + 1) % c->num_key_stream;
-      c->cur = key = silc_thread_queue_pop(c->queue, c->cur_index, TRUE);
+      c->cur = key = silc_softacc_cipher_next(c);
       SILC_SOFTACC_DEBUG(("Got key stream %p, index %d", key, key->key_index));
       enc_ctr = key->key;
       block = 0;
@@ -497,9 +625,9 @@ void silc_softacc_cipher_thread(SilcSchedule schedule, void *context)
   SilcSoftaccCipher c = context;
   SilcThreadQueue queue = c->queue;
   SilcSoftaccCipherKeyStream key = NULL;
-  SilcUInt32 i, block_len, num_key_stream = c->num_key_stream;
+  SilcCipher ecb = c->c.ecb;
+  SilcUInt32 i, k, n, block_len, num_key_stream = c->num_key_stream;
   SilcUInt32 cipher_blocks = c->cipher_blocks;
-  SilcInt32 k;
   unsigned char *enc_ctr;
 
   SILC_SOFTACC_DEBUG(("Start CTR precomputation thread"));
@@ -520,15 +648,22 @@ void silc_softacc_cipher_thread(SilcSchedule schedule, void *context)
     SILC_SOFTACC_DEBUG(("Precompute key stream %p, index %d", key,
 			key->key_index));
 
-    /* Encrypt */
+    /* Encrypt.  The counter blocks of a batch are written to the key stream
+       first and then encrypted in place with one call. */
     enc_ctr = key->key;
-    for (i = 0; i < cipher_blocks; i++) {
-      for (k = block_len - 1; k >= 0; k--)
-	if (++key->ctr[k])
-	  break;
-      c->c.ecb->cipher->encrypt(c->c.ecb, c->c.ecb->cipher, c->c.ecb->context,
-				key->ctr, enc_ctr, block_len, NULL);
-      enc_ctr += block_len;
+    for (i = 0; i < cipher_blocks; i += n) {
+      n = cipher_blocks - i;
+      if (n > SILC_KEYSTREAM_BATCH)
+	n = SILC_KEYSTREAM_BATCH;
+
+      for (k = 0; k < n; k++) {
+	silc_softacc_add_ctr(key->ctr, block_len, 1);
+	memcpy(enc_ctr + (k * block_len), key->ctr, block_len);
+      }
+      ecb->cipher->encrypt(ecb, ecb->cipher, ecb->context,
+			   enc_ctr, enc_ctr, n * block_len, NULL);
+
+      enc_ctr += (n * block_len);
     }
 
     SILC_SOFTACC_DEBUG(("Precomputed key stream %p, index %d", key,
@@ -688,12 +823,15 @@ SILC_CIPHER_API_ENCRYPT(softacc_cipher)
   SilcSoftaccCipherKeyStream key;
   SilcUInt32 pad = c->pad, block = c->cur_block;
   SilcUInt32 cipher_blocks = c->cipher_blocks;
-  SilcUInt32 blocks, block_len, i;
+  SilcUInt32 blocks, block_len, n;
   unsigned char *enc_ctr;
 
+  c->ops++;
+  c->bytes += len;
+
   key = c->cur;
   if (!key) {
-    c->cur = key = silc_thread_queue_pop(c->queue, c->cur_index, TRUE);
+    c->cur = key = silc_softacc_cipher_next(c);
     SILC_SOFTACC_DEBUG(("Got key stream %p, index %d", key, key->key_index));
   }
 
@@ -714,7 +852,7 @@ SILC_CIPHER_API_ENCRYPT(softacc_cipher)
 
 	  /* Get new key stream from queue */
 	  c->cur_index = (c->cur_index + 1) % c->num_key_stream;
-	  c->cur = key = silc_thread_queue_pop(c->queue, c->cur_index, TRUE);
+	  c->cur = key = silc_softacc_cipher_next(c);
 	  SILC_SOFTACC_DEBUG(("Got key stream %p, index %d", key,
 			      xskey->key_index));
 	  enc_ctr = key->key;
@@ -725,32 +863,25 @@ SILC_CIPHER_API_ENCRYPT(softacc_cipher)
     }
   }
 
-  /* Compute full blocks */
+  /* Compute full blocks.  As many blocks as the current key stream has
+     left are XORed at once. */
   blocks = (len / block_len);
   len -= (blocks * block_len);
-  while (blocks--) {
-    /* CTR mode */
-#ifndef WORDS_BIGENDIAN
-    for (i = 0; i < block_len / sizeof(SilcUInt64); i++)
-      *(SilcUInt64 *)(dst + (i * sizeof(SilcUInt64))) =
-	*(SilcUInt64 *)(src + (i * sizeof(SilcUInt64))) ^
-	*(SilcUInt64 *)(enc_ctr + (i * sizeof(SilcUInt64)));
-#else
-    SilcUInt64 dst_tmp, src_tmp, enc_ctr_tmp;
+  while (blocks) {
+    n = cipher_blocks - block;
+    if (n > blocks)
+      n = blocks;
 
-    for (i = 0; i < block_len / sizeof(SilcUInt64); i++) {
-      SILC_GET64_MSB(src_tmp, src + (i * sizeof(SilcUInt64)));
-      SILC_GET64_MSB(enc_ctr_tmp, enc_ctr + (i * sizeof(SilcUInt64)));
-      dst_tmp = src_tmp ^ enc_ctr_tmp;
-      SILC_PUT64_MSB(dst_tmp, dst + (i * sizeof(SilcUInt64)));
-    }
-#endif /* !WORDS_BIGENDIAN */
+    /* CTR mode */
+    silc_softacc_xor(dst, src, enc_ctr, n * block_len);
 
-    src += block_len;
-    dst += block_len;
-    enc_ctr += block_len;
+    src += (n * block_len);
+    dst += (n * block_len);
+    enc_ctr += (n * block_len);
+    blocks -= n;
+    block += n;
 
-    if (++block == cipher_blocks) {
+    if (block == cipher_blocks) {
       /* Push the used up key stream back to the queue */
       SILC_SOFTACC_DEBUG(("Push empty key stream %p index %d back to queue",
 			  key, key->key_index));
@@ -758,7 +889,7 @@ SILC_CIPHER_API_ENCRYPT(softacc_cipher)
 
       /* Get new key stream from queue */
       c->cur_index = (c->cur_index + 1) % c->num_key_stream;
-      c->cur = key = silc_thread_queue_pop(c->queue, c->cur_index, TRUE);
+      c->cur = key = silc_softacc_cipher_next(c);
       SILC_SOFTACC_DEBUG(("Got key stream %p, index %d", key,
 			  key->key_index));
       enc_ctr = key->key;
@@ -800,6 +931,8 @@ SILC_CIPHER_API_UNINIT(softacc_cipher)
   SilcSoftaccCipher c = context;
   int i;
 
+  silc_softacc_cipher_stats(c);
+
   /* Stop threads */
   if (c->queue) {
     for (i = 0; i < c->cipher_threads; i++)
@@ -815,3 +948,244 @@ SILC_CIPHER_API_UNINIT(softacc_cipher)
   memset(c, 0, sizeof(*c));
   silc_free(c);
 }
+
+/******************************* ECB and CBC ********************************/
+
+/* ECB encryption and decryption, and CBC decryption are accelerated by
+   splitting one large encryption call into chunks that are processed in
+   parallel in threads.  In CBC decryption each chunk uses the last cipher
+   block of the previous chunk as IV, so the chunks do not depend on each
+   other.  CBC encryption cannot be parallelized and is done in the
+   calling thread. */
+
+typedef struct SilcSoftaccBlockCipherStruct *SilcSoftaccBlockCipher;
+
+/* Chunk context */
+typedef struct SilcSoftaccBlockChunkStruct {
+  SilcSoftaccBlockCipher c;
+  const unsigned char *src;
+  unsigned char *dst;
+  SilcUInt32 len;
+  unsigned char iv[SILC_CIPHER_MAX_IV_SIZE];  /* IV for CBC */
+} *SilcSoftaccBlockChunk;
+
+/* Accelerator block cipher context */
+struct SilcSoftaccBlockCipherStruct {
+  SilcCipher cipher;			      /* Cipher in the same mode */
+  SilcThreadPool tp;			      /* Thread pool */
+  SilcMutex lock;			      /* Lock for `done' */
+  SilcCond cond;			      /* Signalled when chunk is done */
+  SilcSoftaccBlockChunk chunks;		      /* Chunks */
+  SilcUInt32 max_chunks;		      /* Maximum number of chunks */
+  SilcUInt32 chunk_len;			      /* Minimum chunk length */
+  SilcUInt32 done;			      /* Number of chunks done */
+  unsigned int encrypt : 1;		      /* Set when encrypting */
+  unsigned int failed : 1;		      /* Set if any chunk failed */
+};
+
+/* Chunk processing thread.  This is also called directly in the calling
+   thread. */
+
+static void silc_softacc_cipher_block_thread(SilcSchedule schedule,
+					     void *context)
+{
+  SilcSoftaccBlockChunk chunk = context;
+  SilcSoftaccBlockCipher c = chunk->c;
+  SilcCipher cipher = c->cipher;
+  SilcBool ret;
+
+  if (c->encrypt)
+    ret = cipher->cipher->encrypt(cipher, cipher->cipher, cipher->context,
+				  chunk->src, chunk->dst, chunk->len,
+				  chunk->iv);
+  else
+    ret = cipher->cipher->decrypt(cipher, cipher->cipher, cipher->context,
+				  chunk->src, chunk->dst, chunk->len,
+				  chunk->iv);
+
+  silc_mutex_lock(c->lock);
+  if (!ret)
+    c->failed = TRUE;
+  c->done++;
+  silc_cond_signal(c->cond);
+  silc_mutex_unlock(c->lock);
+}
+
+/* Splits the data into chunks and processes them in parallel.  Returns
+   when all chunks are done. */
+
+static SilcBool
+silc_softacc_cipher_block_run(SilcSoftaccBlockCipher c, SilcBool encrypt,
+			      const unsigned char *src, unsigned char *dst,
+			      SilcUInt32 len, unsigned char *iv)
+{
+  SilcCipher cipher = c->cipher;
+  SilcSoftaccBlockChunk chunk;
+  SilcSoftaccStats st;
+  SilcSoftacc sa;
+  SilcUInt32 block_len, blocks, num_chunks, i, n;
+  SilcBool cbc = silc_cipher_get_mode(cipher) == SILC_CIPHER_MODE_CBC;
+
+  block_len = silc_cipher_get_block_len(cipher);
+  if (len % block_len)
+    return FALSE;
+
+  sa = silc_global_get_var("softacc", FALSE);
+  if (sa) {
+    st = silc_softacc_stats(sa);
+    if (st) {
+      st->op[SILC_ACC_STATS_CIPHER].ops++;
+      st->op[SILC_ACC_STATS_CIPHER].bytes += len;
+    }
+  }
+
+  /* CBC encryption cannot be parallelized, and small data is not worth
+     it. */
+  num_chunks = len / c->chunk_len;
+  if (num_chunks > c->max_chunks)
+    num_chunks = c->max_chunks;
+  if ((encrypt && cbc) || num_chunks < 2) {
+    if (encrypt)
+      return cipher->cipher->encrypt(cipher, cipher->cipher, cipher->context,
+				     src, dst, len, iv);
+    return cipher->cipher->decrypt(cipher, cipher->cipher, cipher->context,
+				   src, dst, len, iv);
+  }
+
+  SILC_SOFTACC_DEBUG(("Split %d bytes into %d chunks", len, num_chunks));
+
+  /* Divide the blocks evenly to the chunks */
+  blocks = len / block_len;
+  for (i = 0; i < num_chunks; i++) {
+    chunk = &c->chunks[i];
+    n = blocks / num_chunks + (i < blocks % num_chunks);
+    chunk->src = src;
+    chunk->dst = dst;
+    chunk->len = n * block_len;
+
+    /* The IV of the chunk is the last cipher block of the previous chunk.
+       It must be copied now as the data may be decrypted in place. */
+    if (cbc)
+      memcpy(chunk->iv, i == 0 ? iv : src - block_len, block_len);
+
+    src += chunk->len;
+    dst += chunk->len;
+  }
+
+  /* Next IV is the last cipher block */
+  if (cbc)
+    memcpy(iv, src - block_len, block_len);
+
+  c->encrypt = encrypt;
+  c->failed = FALSE;
+  c->done = 0;
+
+  /* Run the chunks in threads.  If there are no free threads, the chunk is
+     processed in this thread.  Queueing the chunk could deadlock if the
+     threads are reserved by other accelerated ciphers. */
+  for (i = 1; i < num_chunks; i++)
+    if (!silc_thread_pool_run(c->tp, FALSE, NULL,
+			      silc_softacc_cipher_block_thread,
+			      &c->chunks[i], NULL, NULL))
+      silc_softacc_cipher_block_thread(NULL, &c->chunks[i]);
+  silc_softacc_cipher_block_thread(NULL, &c->chunks[0]);
+
+  /* Wait for all chunks */
+  silc_mutex_lock(c->lock);
+  while (c->done < num_chunks)
+    silc_cond_wait(c->cond, c->lock);
+  silc_mutex_unlock(c->lock);
+
+  return !c->failed;
+}
+
+/* Accelerate cipher */
+
+SILC_CIPHER_API_SET_KEY(softacc_cipher_block)
+{
+  SilcSoftaccBlockCipher c = context;
+  SilcSoftacc sa;
+  SilcUInt32 i;
+
+  /* If key is present set it.  If it is NULL this is initialization call. */
+  if (key) {
+    SILC_SOFTACC_DEBUG(("Set key for accelerator %s %p", ops->alg_name, c));
+    return silc_cipher_set_key(c->cipher, key, keylen, encryption);
+  }
+
+  /* Initialize the accelerator for this cipher */
+  SILC_LOG_DEBUG(("Initialize accelerator for %s %p", ops->alg_name, c));
+
+  sa = silc_global_get_var("softacc", FALSE);
+  if (!sa) {
+    SILC_LOG_ERROR(("Software accelerator not initialized"));
+    return FALSE;
+  }
+
+  /* Allocate cipher in the same mode.  The chunks are processed with it. */
+  if (!silc_cipher_alloc_full(ops->alg_name, ops->key_len, ops->mode,
+			      &c->cipher))
+    return FALSE;
+
+  /* The calling thread processes one chunk itself */
+  c->tp = sa->tp;
+  c->chunk_len = sa->cipher_chunk;
+  c->max_chunks = sa->max_threads + 1;
+  c->chunks = silc_calloc(c->max_chunks, sizeof(*c->chunks));
+  if (!c->chunks)
+    return FALSE;
+  for (i = 0; i < c->max_chunks; i++)
+    c->chunks[i].c = c;
+
+  if (!silc_mutex_alloc(&c->lock))
+    return FALSE;
+  if (!silc_cond_alloc(&c->cond))
+    return FALSE;
+
+  return TRUE;
+}
+
+/* IV is given in each encryption call */
+
+SILC_CIPHER_API_SET_IV(softacc_cipher_block)
+{
+  /* Nothing to do */
+}
+
+/* Accelerated encryption */
+
+SILC_CIPHER_API_ENCRYPT(softacc_cipher_block)
+{
+  return silc_softacc_cipher_block_run(context, TRUE, src, dst, len, iv);
+}
+
+/* Accelerated decryption */
+
+SILC_CIPHER_API_DECRYPT(softacc_cipher_block)
+{
+  return silc_softacc_cipher_block_run(context, FALSE, src, dst, len, iv);
+}
+
+/* Return accelerator block cipher context */
+
+SILC_CIPHER_API_INIT(softacc_cipher_block)
+{
+  return silc_calloc(1, sizeof(struct SilcSoftaccBlockCipherStruct));
+}
+
+/* Uninitialize the block cipher accelerator */
+
+SILC_CIPHER_API_UNINIT(softacc_cipher_block)
+{
+  SilcSoftaccBlockCipher c = context;
+
+  if (c->cipher)
+    silc_cipher_free(c->cipher);
+  if (c->lock)
+    silc_mutex_free(c->lock);
+  if (c->cond)
+    silc_cond_free(c->cond);
+  silc_free(c->chunks);
+  memset(c, 0, sizeof(*c));
+  silc_free(c);
+}
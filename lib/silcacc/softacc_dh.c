@@ -0,0 +1,163 @@
+/*
+
+  softacc_dh.c
+
+  Author: Pekka Riikonen <priikone@silcnet.org>
+
+  Copyright (C) 2008 Pekka Riikonen
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; version 2 of the License.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+*/
+
+#include "silccrypto.h"
+#include "softacc.h"
+#include "softacc_i.h"
+
+/* The Diffie-Hellman accelerator.  The modular exponentiations are
+   executed in threads run in the thread pool, and the result is delivered
+   in the main thread. */
+
+/************************** Types and definitions ***************************/
+
+/* Software accelerator DH operations */
+const SilcDHObject softacc_dh[] =
+{
+  { "modp", silc_softacc_dh_pow_mod },
+  { NULL, NULL }
+};
+
+/* Executor context */
+typedef struct {
+  SilcAsyncOperationStruct op;		 /* Operation for aborting */
+  SilcDHCb callback;			 /* Completion callback */
+  void *context;			 /* Callback context */
+  SilcMPInt base;			 /* Copy of base */
+  SilcMPInt exp;			 /* Copy of exponent */
+  SilcMPInt mod;			 /* Copy of modulus */
+  SilcMPInt result;			 /* Result */
+  SilcInt64 start;			 /* Start time */
+  unsigned int result_ok : 1;
+  unsigned int aborted   : 1;
+} *SilcSoftaccDHExec;
+
+/******************************* DH ACC API *********************************/
+
+/* Abort operation */
+
+static void silc_softacc_dh_abort(SilcAsyncOperation op, void *context)
+{
+  SilcSoftaccDHExec e = context;
+  e->aborted = TRUE;
+}
+
+/* Free executor */
+
+static void silc_softacc_dh_free(SilcSoftaccDHExec e)
+{
+  /* Clear the private exponent and the shared secret */
+  silc_mp_set_ui(&e->exp, 0);
+  silc_mp_set_ui(&e->result, 0);
+
+  silc_mp_uninit(&e->base);
+  silc_mp_uninit(&e->exp);
+  silc_mp_uninit(&e->mod);
+  silc_mp_uninit(&e->result);
+  silc_free(e);
+}
+
+/* Accelerator completion, executed in main thread. */
+
+SILC_TASK_CALLBACK(silc_softacc_dh_completion)
+{
+  SilcSoftaccDHExec e = context;
+  SilcSoftaccStats st;
+  SilcSoftacc sa;
+
+  sa = silc_global_get_var("softacc", FALSE);
+  if (sa && (st = silc_softacc_stats(sa))) {
+    if (e->aborted)
+      st->op[SILC_ACC_STATS_DH].aborted++;
+    else
+      silc_acc_stats_add(&st->op[SILC_ACC_STATS_DH], e->result_ok, 0,
+			 silc_time_usec() - e->start);
+  }
+
+  /* At the latest, abort is catched here in the main thread.  Don't
+     deliver callback if we were aborted */
+  if (!e->aborted) {
+    SILC_LOG_DEBUG(("Call completion, result=%s",
+		    e->result_ok ? "Ok" : "failed"));
+    e->callback(e->result_ok, e->result_ok ? &e->result : NULL,
+		e->context);
+  }
+
+  silc_softacc_dh_free(e);
+}
+
+/* Accelerator thread */
+
+static void silc_softacc_dh_thread(SilcSchedule schedule, void *context)
+{
+  SilcSoftaccDHExec e = context;
+
+  if (e->aborted)
+    return;
+
+  e->result_ok = silc_mp_pow_mod_secret(&e->result, &e->base, &e->exp,
+					&e->mod);
+}
+
+/* Accelerated modular exponentiation */
+
+SILC_DH_POW_MOD(silc_softacc_dh_pow_mod)
+{
+  SilcSoftaccDHExec e;
+  SilcSoftacc sa;
+
+  SILC_LOG_DEBUG(("DH pow_mod"));
+
+  sa = silc_global_get_var("softacc", FALSE);
+  if (!sa || !sa->schedule) {
+    SILC_LOG_ERROR(("Software accelerator not initialized"));
+    callback(FALSE, NULL, context);
+    return NULL;
+  }
+
+  e = silc_calloc(1, sizeof(*e));
+  if (!e) {
+    callback(FALSE, NULL, context);
+    return NULL;
+  }
+
+  /* The thread works on its own copies, so the caller's integers may
+     change while we run. */
+  silc_mp_init(&e->base);
+  silc_mp_init(&e->exp);
+  silc_mp_init(&e->mod);
+  silc_mp_init(&e->result);
+  if (!silc_mp_set(&e->base, base) || !silc_mp_set(&e->exp, exp) ||
+      !silc_mp_set(&e->mod, mod)) {
+    silc_softacc_dh_free(e);
+    callback(FALSE, NULL, context);
+    return NULL;
+  }
+
+  e->callback = callback;
+  e->context = context;
+  e->start = silc_time_usec();
+  silc_async_init(&e->op, silc_softacc_dh_abort, NULL, e);
+
+  /* Run */
+  silc_thread_pool_run(sa->tp, TRUE, sa->schedule, silc_softacc_dh_thread, e,
+		       silc_softacc_dh_completion, e);
+
+  return &e->op;
+}
@@ -0,0 +1,312 @@
+/*
+
+  softacc_hash.c
+
+  Author: Pekka Riikonen <priikone@silcnet.org>
+
+  Copyright (C) 2008 Pekka Riikonen
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; version 2 of the License.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+*/
+
+#include "silccrypto.h"
+#include "softacc.h"
+#include "softacc_i.h"
+
+/* The hash and MAC accelerator.  Digests are computed in threads run in
+   the thread pool.  Large jobs are run alone in a thread.  Small jobs are
+   collected into a batch which is run in one thread, either when the batch
+   becomes full or when the scheduler gets to run the batch task, whichever
+   happens first.  This way the thread pool overhead is paid once per
+   batch and not once per small digest. */
+
+/************************** Types and definitions ***************************/
+
+/* Software accelerator hash and MAC operations */
+const SilcAccHashObject softacc_hash[] =
+{
+  { "any", silc_softacc_hash_make },
+  { NULL, NULL }
+};
+
+const SilcAccHashObject softacc_mac[] =
+{
+  { "any", silc_softacc_hash_make },
+  { NULL, NULL }
+};
+
+/* Executor context, one hash or MAC computation */
+typedef struct SilcSoftaccHashExecStruct {
+  struct SilcSoftaccHashExecStruct *next;
+  SilcAsyncOperationStruct op;		 /* Operation for aborting */
+  SilcAccHashCb callback;		 /* Completion callback */
+  void *context;			 /* Callback context */
+  const char *name;			 /* Hash or MAC name */
+  unsigned char *key;			 /* MAC key */
+  unsigned char *data;			 /* Data to digest */
+  SilcUInt32 key_len;
+  SilcUInt32 data_len;
+  unsigned char digest[SILC_HASH_MAXLEN];
+  SilcUInt32 digest_len;
+  SilcInt64 start;			 /* Start time */
+  unsigned int mac     : 1;
+  unsigned int result  : 1;
+  unsigned int aborted : 1;
+} *SilcSoftaccHashExec;
+
+/* Batch of executors run in one thread */
+typedef struct SilcSoftaccHashBatchStruct {
+  SilcList execs;			 /* Executors */
+  SilcUInt32 data_len;			 /* Total amount of data */
+} *SilcSoftaccHashBatch;
+
+SILC_TASK_CALLBACK(silc_softacc_hash_flush);
+
+/****************************** Hash ACC API ********************************/
+
+/* Abort operation */
+
+static void silc_softacc_hash_abort(SilcAsyncOperation op, void *context)
+{
+  SilcSoftaccHashExec e = context;
+  e->aborted = TRUE;
+}
+
+/* Accelerator completion, executed in main thread. */
+
+SILC_TASK_CALLBACK(silc_softacc_hash_completion)
+{
+  SilcSoftaccHashBatch b = context;
+  SilcSoftaccHashExec e;
+  SilcSoftaccStats st = NULL;
+  SilcAccOpStats op;
+  SilcSoftacc sa;
+  SilcInt64 now = silc_time_usec();
+
+  SILC_LOG_DEBUG(("Call completion for %d digests",
+		  silc_list_count(b->execs)));
+
+  sa = silc_global_get_var("softacc", FALSE);
+  if (sa)
+    st = silc_softacc_stats(sa);
+
+  silc_list_start(b->execs);
+  while ((e = silc_list_get(b->execs))) {
+    if (st) {
+      op = &st->op[e->mac ? SILC_ACC_STATS_MAC : SILC_ACC_STATS_HASH];
+      if (e->aborted)
+	op->aborted++;
+      else
+	silc_acc_stats_add(op, e->result, e->data_len, now - e->start);
+    }
+
+    /* Don't deliver callback if we were aborted */
+    if (!e->aborted)
+      e->callback(e->result, e->digest, e->digest_len, e->context);
+
+    memset(e->digest, 0, sizeof(e->digest));
+    if (e->key)
+      memset(e->key, 0, e->key_len);
+    silc_free(e);
+  }
+
+  silc_free(b);
+}
+
+/* Accelerator thread.  Computes all digests in the batch. */
+
+static void silc_softacc_hash_thread(SilcSchedule schedule, void *context)
+{
+  SilcSoftaccHashBatch b = context;
+  SilcSoftaccHashExec e;
+  SilcHash hash = NULL;
+  SilcMac mac = NULL;
+
+  silc_list_start(b->execs);
+  while ((e = silc_list_get(b->execs))) {
+    if (e->aborted)
+      continue;
+
+    if (e->mac) {
+      /* Reuse the MAC from previous job if possible */
+      if (mac && strcmp(silc_mac_get_name(mac), e->name)) {
+	silc_mac_free(mac);
+	mac = NULL;
+      }
+      if (!mac && !silc_mac_alloc(e->name, &mac))
+	continue;
+
+      silc_mac_init_with_key(mac, e->key, e->key_len);
+      silc_mac_update(mac, e->data, e->data_len);
+      silc_mac_final(mac, e->digest, &e->digest_len);
+    } else {
+      /* Reuse the hash from previous job if possible */
+      if (hash && strcmp(silc_hash_get_name(hash), e->name)) {
+	silc_hash_free(hash);
+	hash = NULL;
+      }
+      if (!hash && !silc_hash_alloc(e->name, &hash))
+	continue;
+
+      silc_hash_make(hash, e->data, e->data_len, e->digest);
+      e->digest_len = silc_hash_len(hash);
+    }
+
+    e->result = TRUE;
+  }
+
+  silc_mac_free(mac);
+  silc_hash_free(hash);
+}
+
+/* Runs the batch in the thread pool */
+
+static void silc_softacc_hash_run(SilcSoftacc sa, SilcSoftaccHashBatch b)
+{
+  SILC_LOG_DEBUG(("Run batch of %d digests, %d bytes",
+		  silc_list_count(b->execs), b->data_len));
+
+  silc_thread_pool_run(sa->tp, TRUE, sa->schedule, silc_softacc_hash_thread,
+		       b, silc_softacc_hash_completion, b);
+}
+
+/* Runs the pending batch of small jobs */
+
+static void silc_softacc_hash_run_pending(SilcSoftacc sa)
+{
+  SilcSoftaccHashBatch b = sa->hash_pending;
+
+  if (!b)
+    return;
+
+  silc_schedule_task_del_by_all(sa->schedule, 0, silc_softacc_hash_flush, sa);
+  sa->hash_pending = NULL;
+  silc_softacc_hash_run(sa, b);
+}
+
+/* Pending batch task, run when we get back to the scheduler */
+
+SILC_TASK_CALLBACK(silc_softacc_hash_flush)
+{
+  SilcSoftacc sa = context;
+  silc_softacc_hash_run_pending(sa);
+}
+
+/* Runs the pending batch, if any, and delivers the results before
+   returning.  Called when the accelerator is uninitialized.  The batch is
+   run in this thread since the scheduler may be going away and would
+   never call the completion. */
+
+void silc_softacc_hash_uninit(SilcSoftacc sa)
+{
+  SilcSoftaccHashBatch b = sa->hash_pending;
+
+  if (!b)
+    return;
+
+  silc_schedule_task_del_by_all(sa->schedule, 0, silc_softacc_hash_flush, sa);
+  sa->hash_pending = NULL;
+
+  silc_softacc_hash_thread(NULL, b);
+  silc_softacc_hash_completion(sa->schedule, NULL, SILC_TASK_EXPIRE, 0, b);
+}
+
+/* Returns number of digests waiting in the pending batch */
+
+SilcUInt32 silc_softacc_hash_queued(SilcSoftacc sa)
+{
+  SilcSoftaccHashBatch b = sa->hash_pending;
+  return b ? silc_list_count(b->execs) : 0;
+}
+
+/* Accelerated hash and MAC */
+
+SILC_ACC_HASH_MAKE(silc_softacc_hash_make)
+{
+  SilcSoftaccHashExec e;
+  SilcSoftaccHashBatch b;
+  const unsigned char *key = NULL;
+  SilcUInt32 key_len = 0;
+  SilcSoftacc sa;
+
+  SILC_LOG_DEBUG(("%s, %d bytes", mac ? "MAC" : "Hash", data_len));
+
+  sa = silc_global_get_var("softacc", FALSE);
+  if (!sa || !sa->schedule) {
+    SILC_LOG_ERROR(("Software accelerator not initialized"));
+    callback(FALSE, NULL, 0, context);
+    return NULL;
+  }
+
+  if (mac)
+    key = silc_mac_get_key(mac, &key_len);
+
+  /* Key and data are copied after the context */
+  e = silc_calloc(1, sizeof(*e) + key_len + data_len);
+  if (!e) {
+    callback(FALSE, NULL, 0, context);
+    return NULL;
+  }
+  e->callback = callback;
+  e->context = context;
+  e->mac = mac != NULL;
+  e->name = mac ? silc_mac_get_name(mac) : silc_hash_get_name(hash);
+  e->key = key_len ? (unsigned char *)(e + 1) : NULL;
+  e->key_len = key_len;
+  e->data = (unsigned char *)(e + 1) + key_len;
+  e->data_len = data_len;
+  if (key_len)
+    memcpy(e->key, key, key_len);
+  memcpy(e->data, data, data_len);
+  e->start = silc_time_usec();
+  silc_async_init(&e->op, silc_softacc_hash_abort, NULL, e);
+
+  /* Large job is run alone */
+  if (data_len >= sa->hash_threshold) {
+    b = silc_calloc(1, sizeof(*b));
+    if (!b) {
+      silc_free(e);
+      callback(FALSE, NULL, 0, context);
+      return NULL;
+    }
+    silc_list_init(b->execs, struct SilcSoftaccHashExecStruct, next);
+    silc_list_add(b->execs, e);
+    b->data_len = data_len;
+    silc_softacc_hash_run(sa, b);
+    return &e->op;
+  }
+
+  /* Small job is added to the pending batch */
+  b = sa->hash_pending;
+  if (!b) {
+    b = silc_calloc(1, sizeof(*b));
+    if (!b) {
+      silc_free(e);
+      callback(FALSE, NULL, 0, context);
+      return NULL;
+    }
+    silc_list_init(b->execs, struct SilcSoftaccHashExecStruct, next);
+    sa->hash_pending = b;
+
+    /* Run the batch when we get back to scheduler at the latest */
+    silc_schedule_task_add_timeout(sa->schedule, silc_softacc_hash_flush,
+				   sa, 0, 0);
+  }
+  silc_list_add(b->execs, e);
+  b->data_len += data_len;
+
+  /* Run the batch now if it is full */
+  if (silc_list_count(b->execs) >= sa->hash_batch ||
+      b->data_len >= sa->hash_threshold)
+    silc_softacc_hash_run_pending(sa);
+
+  return &e->op;
+}
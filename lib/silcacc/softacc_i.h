@@ -32,6 +32,21 @@
 #define SILC_SOFTACC_CIPHER_THREADS 2
 #define SILC_SOFTACC_CIPHER_BLOCKS 4096
 #define SILC_SOFTACC_CIPHER_STREAMS (SILC_SOFTACC_CIPHER_THREADS * 2)
+#define SILC_SOFTACC_CIPHER_CHUNK 65536
+#define SILC_SOFTACC_HASH_THRESHOLD 16384
+#define SILC_SOFTACC_HASH_BATCH 64
+#define SILC_SOFTACC_PKCS_THREADS SILC_SOFTACC_MAX_THREADS
+#define SILC_SOFTACC_PKCS_BATCH 8
+#define SILC_SOFTACC_PKCS_QUEUE_MAX 1024
+
+/* Per-thread statistics.  Each thread records to its own statistics
+   which are merged when statistics are requested. */
+typedef struct SilcSoftaccStatsStruct {
+  struct SilcSoftaccStatsStruct *next;
+  SilcUInt64 keystream_hits;
+  SilcUInt64 keystream_misses;
+  SilcAccOpStatsStruct op[SILC_ACC_STATS_MAX];
+} *SilcSoftaccStats;
 
 /* Software accelerator context */
 typedef struct {
@@ -44,11 +59,28 @@ typedef struct {
   SilcUInt32 cipher_threads;
   SilcUInt32 cipher_blocks;
   SilcUInt32 cipher_streams;
+  SilcUInt32 cipher_chunk;
+  SilcUInt32 hash_threshold;
+  SilcUInt32 hash_batch;
+  SilcUInt32 pkcs_threads;
+  SilcUInt32 pkcs_batch;
+  SilcUInt32 pkcs_queue_max;
+
+  void *hash_pending;			 /* Pending batch of small digests */
+  SilcList pkcs_queue[2];		 /* Interactive and bulk PKCS queues */
+  SilcUInt32 pkcs_queued;		 /* Number of queued PKCS operations */
+  SilcUInt32 pkcs_running;		 /* Number of running PKCS batches */
+
+  SilcMutex stats_lock;			 /* Lock for the statistics list */
+  SilcList stats;			 /* Per-thread statistics */
+  SilcInt64 generation;			 /* Initialization time */
 } *SilcSoftacc;
 
 /* Accelerator API */
 SilcBool silc_softacc_init(SilcSchedule schedule, va_list va);
 SilcBool silc_softacc_uninit(void);
+SilcBool silc_softacc_get_stats(SilcAccStats stats);
+SilcSoftaccStats silc_softacc_stats(SilcSoftacc sa);
 
 #ifdef SILC_DIST_SOFTACC_PKCS
 extern const SilcPKCSAlgorithm softacc_pkcs[];
@@ -61,6 +93,8 @@ SILC_PKCS_ALG_ENCRYPT(silc_softacc_encrypt);
 SILC_PKCS_ALG_DECRYPT(silc_softacc_decrypt);
 SILC_PKCS_ALG_SIGN(silc_softacc_sign);
 SILC_PKCS_ALG_VERIFY(silc_softacc_verify);
+void silc_softacc_pkcs_init(SilcSoftacc sa);
+void silc_softacc_pkcs_uninit(SilcSoftacc sa);
 #endif /* SILC_DIST_SOFTACC_PKCS */
 
 #ifdef SILC_DIST_SOFTACC_CIPHER
@@ -75,6 +109,28 @@ SILC_CIPHER_API_SET_IV(softacc_cipher);
 SILC_CIPHER_API_ENCRYPT(softacc_cipher);
 SILC_CIPHER_API_INIT(softacc_cipher);
 SILC_CIPHER_API_UNINIT(softacc_cipher);
+
+SILC_CIPHER_API_SET_KEY(softacc_cipher_block);
+SILC_CIPHER_API_SET_IV(softacc_cipher_block);
+SILC_CIPHER_API_ENCRYPT(softacc_cipher_block);
+SILC_CIPHER_API_DECRYPT(softacc_cipher_block);
+SILC_CIPHER_API_INIT(softacc_cipher_block);
+SILC_CIPHER_API_UNINIT(softacc_cipher_block);
 #endif /* SILC_DIST_SOFTACC_CIPHER */
 
+#ifdef SILC_DIST_SOFTACC_HASH
+extern const SilcAccHashObject softacc_hash[];
+extern const SilcAccHashObject softacc_mac[];
+
+SILC_ACC_HASH_MAKE(silc_softacc_hash_make);
+void silc_softacc_hash_uninit(SilcSoftacc sa);
+SilcUInt32 silc_softacc_hash_queued(SilcSoftacc sa);
+#endif /* SILC_DIST_SOFTACC_HASH */
+
+#ifdef SILC_DIST_SOFTACC_DH
+extern const SilcDHObject softacc_dh[];
+
+SILC_DH_POW_MOD(silc_softacc_dh_pow_mod);
+#endif /* SILC_DIST_SOFTACC_DH */
+
 #endif /* SOFTACC_I_H */
@@ -22,7 +22,16 @@
 #include "softacc_i.h"
 
 /* The public and private key accelerator.  We perform the public key and
-   private key operations in threads.  Threads are run in the thread pool. */
+   private key operations in threads.  Threads are run in the thread pool.
+
+   Operations are not run directly.  They are first put into one of two
+   queues: the interactive queue for private key operations (signatures and
+   decryptions, typically done in handshakes while a peer waits) and the
+   bulk queue for public key operations.  At most "pkcs_threads" batches
+   run at the same time.  A batch is taken from the interactive queue
+   first, and it coalesces up to "pkcs_batch" queued operations of the same
+   key into one thread.  The queues are bounded by "pkcs_queue_max".  All
+   queue handling is done in the main thread. */
 
 /************************** Types and definitions ***************************/
 
@@ -63,14 +72,19 @@ typedef struct {
 
 /* Execution types */
 typedef enum {
-  SILC_SOFTACC_ENCRYPT,
-  SILC_SOFTACC_DECRYPT,
-  SILC_SOFTACC_SIGN,
-  SILC_SOFTACC_VERIFY,
+  SILC_SOFTACC_ENCRYPT = SILC_ACC_STATS_ENCRYPT,
+  SILC_SOFTACC_DECRYPT = SILC_ACC_STATS_DECRYPT,
+  SILC_SOFTACC_SIGN    = SILC_ACC_STATS_SIGN,
+  SILC_SOFTACC_VERIFY  = SILC_ACC_STATS_VERIFY,
 } SilcSoftaccType;
 
+/* Priority classes */
+#define SILC_SOFTACC_INTERACTIVE 0	 /* Private key operations */
+#define SILC_SOFTACC_BULK        1	 /* Public key operations */
+
 /* Executor context */
-typedef struct {
+typedef struct SilcSoftaccExecStruct {
+  struct SilcSoftaccExecStruct *next;
   SilcStack stack;			 /* Executor stack */
   void *context;			 /* Callback context */
   SilcSoftaccType type;			 /* Execution type */
@@ -97,28 +111,90 @@ typedef struct {
 
   unsigned char *result_data;
   SilcUInt32 result_len;
+  SilcInt64 start;			 /* Queueing time */
 
   unsigned int result       : 1;
   unsigned int compute_hash : 1;
+  unsigned int queued       : 1;
   unsigned int aborted      : 1;
 } *SilcSoftaccExec;
 
+/* Batch of executors of same key run in one thread */
+typedef struct {
+  SilcList execs;			 /* Executors */
+} *SilcSoftaccBatch;
+
 /****************************** PKCS ALG API ********************************/
 
-/* Abort operation */
+/* Free executor */
+
+static void silc_softacc_pkcs_free(SilcSoftaccExec e)
+{
+  SilcStack stack = e->stack;
+
+  silc_sfree(stack, e->src);
+  silc_sfree(stack, e->data);
+  silc_sfree(stack, e->result_data);
+  silc_sfree(stack, e);
+  silc_stack_free(stack);
+}
+
+/* Returns the priority queue of the executor */
+
+static SilcList *silc_softacc_pkcs_queue(SilcSoftacc sa, SilcSoftaccExec e)
+{
+  if (e->type == SILC_SOFTACC_SIGN || e->type == SILC_SOFTACC_DECRYPT)
+    return &sa->pkcs_queue[SILC_SOFTACC_INTERACTIVE];
+  return &sa->pkcs_queue[SILC_SOFTACC_BULK];
+}
+
+/* Records statistics of the operation */
+
+static void silc_softacc_pkcs_stats(SilcSoftaccExec e)
+{
+  SilcSoftaccStats st;
+  SilcSoftacc sa;
+
+  sa = silc_global_get_var("softacc", FALSE);
+  if (!sa)
+    return;
+  st = silc_softacc_stats(sa);
+  if (!st)
+    return;
+
+  if (e->aborted)
+    st->op[e->type].aborted++;
+  else
+    silc_acc_stats_add(&st->op[e->type], e->result, e->src_len,
+		       silc_time_usec() - e->start);
+}
+
+/* Abort operation.  If the operation is still queued it is removed from
+   the queue, otherwise the completion will free it. */
 
 void silc_softacc_pkcs_abort(SilcAsyncOperation op, void *context)
 {
   SilcSoftaccExec e = context;
+  SilcSoftacc sa;
+
+  if (e->queued) {
+    sa = silc_global_get_var("softacc", FALSE);
+    silc_list_del(*silc_softacc_pkcs_queue(sa, e), e);
+    sa->pkcs_queued--;
+    e->aborted = TRUE;
+    silc_softacc_pkcs_stats(e);
+    silc_softacc_pkcs_free(e);
+    return;
+  }
+
   e->aborted = TRUE;
 }
 
-/* Accelerator completion, executed in main thread. */
+/* Delivers the result of one operation, executed in main thread. */
 
-SILC_TASK_CALLBACK(silc_softacc_pkcs_completion)
+static void silc_softacc_pkcs_deliver(SilcSoftaccExec e)
 {
-  SilcSoftaccExec e = context;
-  SilcStack stack = e->stack;
+  silc_softacc_pkcs_stats(e);
 
   /* At the latest, abort is catched here in the main thread.  Don't
      deliver callback if we were aborted */
@@ -147,11 +223,7 @@ SILC_TASK_CALLBACK(silc_softacc_pkcs_completion)
   }
 
  out:
-  silc_sfree(stack, e->src);
-  silc_sfree(stack, e->data);
-  silc_sfree(stack, e->result_data);
-  silc_sfree(stack, e);
-  silc_stack_free(stack);
+  silc_softacc_pkcs_free(e);
 }
 
 /* Callback for encrypt, decrypt and signature */
@@ -184,12 +256,10 @@ void silc_softacc_pkcs_verify_cb(SilcBool success, void *context)
   e->result = success;
 }
 
-/* Accelerator thread */
+/* Executes one operation */
 
-void silc_softacc_pkcs_thread(SilcSchedule schedule, void *context)
+static void silc_softacc_pkcs_exec(SilcSoftaccExec e)
 {
-  SilcSoftaccExec e = context;
-
   if (e->aborted)
     return;
 
@@ -221,6 +291,183 @@ void silc_softacc_pkcs_thread(SilcSchedule schedule, void *context)
   }
 }
 
+/* Accelerator thread.  Executes all operations in the batch. */
+
+static void silc_softacc_pkcs_thread(SilcSchedule schedule, void *context)
+{
+  SilcSoftaccBatch b = context;
+  SilcSoftaccExec e;
+
+  silc_list_start(b->execs);
+  while ((e = silc_list_get(b->execs)))
+    silc_softacc_pkcs_exec(e);
+}
+
+static void silc_softacc_pkcs_dispatch(SilcSoftacc sa);
+
+/* Batch completion, executed in main thread. */
+
+SILC_TASK_CALLBACK(silc_softacc_pkcs_completion)
+{
+  SilcSoftaccBatch b = context;
+  SilcSoftaccExec e;
+  SilcSoftacc sa;
+
+  SILC_LOG_DEBUG(("Call completion for %d operations",
+		  silc_list_count(b->execs)));
+
+  silc_list_start(b->execs);
+  while ((e = silc_list_get(b->execs)))
+    silc_softacc_pkcs_deliver(e);
+  silc_free(b);
+
+  /* Thread is free, run next batch */
+  sa = silc_global_get_var("softacc", FALSE);
+  if (!sa || !sa->pkcs_running)
+    return;
+  sa->pkcs_running--;
+  silc_softacc_pkcs_dispatch(sa);
+}
+
+/* Takes next batch from the queues.  Interactive queue is served first.
+   Queued operations of the same key are coalesced into the batch. */
+
+static SilcSoftaccBatch silc_softacc_pkcs_next_batch(SilcSoftacc sa)
+{
+  SilcSoftaccBatch b;
+  SilcSoftaccExec e, q;
+  SilcList *queue;
+  SilcUInt32 n = 1;
+
+  queue = &sa->pkcs_queue[SILC_SOFTACC_INTERACTIVE];
+  if (!silc_list_count(*queue))
+    queue = &sa->pkcs_queue[SILC_SOFTACC_BULK];
+
+  silc_list_start(*queue);
+  e = silc_list_get(*queue);
+  if (e == SILC_LIST_END)
+    return NULL;
+
+  b = silc_calloc(1, sizeof(*b));
+  if (!b)
+    return NULL;
+  silc_list_init(b->execs, struct SilcSoftaccExecStruct, next);
+
+  silc_list_del(*queue, e);
+  silc_list_add(b->execs, e);
+  e->queued = FALSE;
+
+  while (n < sa->pkcs_batch && (q = silc_list_get(*queue))) {
+    if (q->key.public_key != e->key.public_key)
+      continue;
+    silc_list_del(*queue, q);
+    silc_list_add(b->execs, q);
+    q->queued = FALSE;
+    n++;
+  }
+
+  sa->pkcs_queued -= n;
+
+  return b;
+}
+
+/* Runs queued operations as long as there are free threads */
+
+static void silc_softacc_pkcs_dispatch(SilcSoftacc sa)
+{
+  SilcSoftaccBatch b;
+  SilcSoftaccExec e;
+
+  while (sa->pkcs_running < sa->pkcs_threads &&
+	 (b = silc_softacc_pkcs_next_batch(sa))) {
+    SILC_SOFTACC_DEBUG(("Run batch of %d operations, %d queued",
+			silc_list_count(b->execs), sa->pkcs_queued));
+    sa->pkcs_running++;
+    if (silc_thread_pool_run(sa->tp, TRUE, sa->schedule,
+			     silc_softacc_pkcs_thread, b,
+			     silc_softacc_pkcs_completion, b))
+      continue;
+
+    /* Could not run the batch, fail its operations.  They are failed from
+       the scheduler since the caller may not have returned yet. */
+    SILC_LOG_ERROR(("Cannot run batch of %d operations in thread",
+		    silc_list_count(b->execs)));
+    silc_list_start(b->execs);
+    while ((e = silc_list_get(b->execs))) {
+      e->result = FALSE;
+      e->result_data = NULL;
+      e->result_len = 0;
+    }
+    if (silc_schedule_task_add_timeout(sa->schedule,
+				       silc_softacc_pkcs_completion,
+				       b, 0, 0))
+      continue;
+
+    /* Put the operations back to queue and try again later */
+    sa->pkcs_running--;
+    silc_list_start(b->execs);
+    while ((e = silc_list_get(b->execs))) {
+      silc_list_add(*silc_softacc_pkcs_queue(sa, e), e);
+      e->queued = TRUE;
+      sa->pkcs_queued++;
+    }
+    silc_free(b);
+    break;
+  }
+}
+
+/* Queues operation.  Returns FALSE if the queue is full. */
+
+static SilcBool silc_softacc_pkcs_add(SilcSoftacc sa, SilcSoftaccExec e)
+{
+  if (sa->pkcs_queued >= sa->pkcs_queue_max) {
+    SILC_LOG_DEBUG(("Queue is full, %d operations queued", sa->pkcs_queued));
+    silc_set_errno(SILC_ERR_WOULD_BLOCK);
+    return FALSE;
+  }
+
+  silc_list_add(*silc_softacc_pkcs_queue(sa, e), e);
+  e->queued = TRUE;
+  e->start = silc_time_usec();
+  sa->pkcs_queued++;
+
+  silc_softacc_pkcs_dispatch(sa);
+
+  return TRUE;
+}
+
+/* Initialize PKCS queues */
+
+void silc_softacc_pkcs_init(SilcSoftacc sa)
+{
+  silc_list_init(sa->pkcs_queue[SILC_SOFTACC_INTERACTIVE],
+		 struct SilcSoftaccExecStruct, next);
+  silc_list_init(sa->pkcs_queue[SILC_SOFTACC_BULK],
+		 struct SilcSoftaccExecStruct, next);
+}
+
+/* Fails all queued operations.  Called when the accelerator is
+   uninitialized. */
+
+void silc_softacc_pkcs_uninit(SilcSoftacc sa)
+{
+  SilcSoftaccExec e;
+  int i;
+
+  for (i = 0; i < 2; i++) {
+    silc_list_start(sa->pkcs_queue[i]);
+    while ((e = silc_list_get(sa->pkcs_queue[i]))) {
+      silc_list_del(sa->pkcs_queue[i], e);
+      e->queued = FALSE;
+      e->result = FALSE;
+      e->result_data = NULL;
+      e->result_len = 0;
+      silc_softacc_pkcs_deliver(e);
+    }
+  }
+  sa->pkcs_queued = 0;
+}
+
 /* Accelerate public key */
 
 SILC_PKCS_ALG_IMPORT_PUBLIC_KEY(silc_softacc_acc_public_key)
@@ -320,9 +567,12 @@ SILC_PKCS_ALG_ENCRYPT(silc_softacc_encrypt)
   e->context = context;
   silc_async_init(&e->op, silc_softacc_pkcs_abort, NULL, e);
 
-  /* Run */
-  silc_thread_pool_run(sa->tp, TRUE, sa->schedule, silc_softacc_pkcs_thread, e,
-		       silc_softacc_pkcs_completion, e);
+  /* Queue for running */
+  if (!silc_softacc_pkcs_add(sa, e)) {
+    silc_softacc_pkcs_free(e);
+    encrypt_cb(FALSE, NULL, 0, context);
+    return NULL;
+  }
 
   return &e->op;
 }
@@ -365,9 +615,12 @@ SILC_PKCS_ALG_DECRYPT(silc_softacc_decrypt)
   e->context = context;
   silc_async_init(&e->op, silc_softacc_pkcs_abort, NULL, e);
 
-  /* Run */
-  silc_thread_pool_run(sa->tp, TRUE, sa->schedule, silc_softacc_pkcs_thread, e,
-		       silc_softacc_pkcs_completion, e);
+  /* Queue for running */
+  if (!silc_softacc_pkcs_add(sa, e)) {
+    silc_softacc_pkcs_free(e);
+    decrypt_cb(FALSE, NULL, 0, context);
+    return NULL;
+  }
 
   return &e->op;
 }
@@ -413,9 +666,12 @@ SILC_PKCS_ALG_SIGN(silc_softacc_sign)
   e->context = context;
   silc_async_init(&e->op, silc_softacc_pkcs_abort, NULL, e);
 
-  /* Run */
-  silc_thread_pool_run(sa->tp, TRUE, sa->schedule, silc_softacc_pkcs_thread, e,
-		       silc_softacc_pkcs_completion, e);
+  /* Queue for running */
+  if (!silc_softacc_pkcs_add(sa, e)) {
+    silc_softacc_pkcs_free(e);
+    sign_cb(FALSE, NULL, 0, context);
+    return NULL;
+  }
 
   return &e->op;
 }
@@ -462,9 +718,12 @@ SILC_PKCS_ALG_VERIFY(silc_softacc_verify)
   e->context = context;
   silc_async_init(&e->op, silc_softacc_pkcs_abort, NULL, e);
 
-  /* Run */
-  silc_thread_pool_run(sa->tp, TRUE, sa->schedule, silc_softacc_pkcs_thread, e,
-		       silc_softacc_pkcs_completion, e);
+  /* Queue for running */
+  if (!silc_softacc_pkcs_add(sa, e)) {
+    silc_softacc_pkcs_free(e);
+    verify_cb(FALSE, context);
+    return NULL;
+  }
 
   return &e->op;
 }
@@ -0,0 +1,199 @@
+/* Software accelerator Diffie-Hellman tests */
+
+#include "silccrypto.h"
+#include "softacc.h"
+
+/* 1024-bit MODP group (RFC 2409 Oakley group 2) */
+#define GROUP_P								\
+  "FFFFFFFFFFFFFFFFC90FDAA22168C234C4C6628B80DC1CD1"			\
+  "29024E088A67CC74020BBEA63B139B22514A08798E3404DD"			\
+  "EF9519B3CD3A431B302B0A6DF25F14374FE1356D6D51C245"			\
+  "E485B576625E7EC6F44C42E9A637ED6B0BFF5CB6F406B7ED"			\
+  "EE386BFB5A899FA5AE9F24117C4B1FE649286651ECE65381"			\
+  "FFFFFFFFFFFFFFFF"
+#define DH_PAIRS 16
+
+SilcSchedule schedule;
+SilcMPInt g, p;
+SilcDH dh[DH_PAIRS * 2];
+int pending = 0, failed = 0;
+
+void key_compl(SilcBool success, const SilcMPInt *z, void *context)
+{
+  SilcDH d = context;
+  SilcMPInt tmp;
+
+  silc_mp_init(&tmp);
+
+  /* Compare with synchronously computed key */
+  if (!success || !silc_mp_set(&tmp, (SilcMPInt *)z) ||
+      !silc_dh_compute_key(d, NULL) || silc_mp_cmp(&tmp, d->z)) {
+    SILC_LOG_DEBUG(("Key mismatch"));
+    failed++;
+  }
+
+  silc_mp_uninit(&tmp);
+
+  if (--pending == 0)
+    silc_schedule_stop(schedule);
+}
+
+void public_compl(SilcBool success, const SilcMPInt *y, void *context)
+{
+  SilcDH d = context;
+  int i;
+
+  if (!success) {
+    SILC_LOG_DEBUG(("Public value failed"));
+    failed++;
+  }
+
+  if (--pending)
+    return;
+
+  /* All public values done, exchange them and compute the keys */
+  pending = DH_PAIRS * 2;
+  for (i = 0; i < DH_PAIRS * 2; i += 2) {
+    if (!silc_dh_set_remote_public(dh[i], dh[i + 1]->my_y) ||
+	!silc_dh_set_remote_public(dh[i + 1], dh[i]->my_y)) {
+      failed++;
+      silc_schedule_stop(schedule);
+      return;
+    }
+  }
+  for (i = 0; i < DH_PAIRS * 2; i++)
+    silc_dh_compute_key_async(dh[i], key_compl, dh[i]);
+}
+
+SILC_TASK_CALLBACK(start)
+{
+  int i;
+
+  pending = DH_PAIRS * 2;
+  for (i = 0; i < DH_PAIRS * 2; i++)
+    silc_dh_compute_public_async(dh[i], public_compl, dh[i]);
+}
+
+SILC_TASK_CALLBACK(timeout)
+{
+  SILC_LOG_DEBUG(("Timeout, %d operations pending", pending));
+  failed++;
+  silc_schedule_stop(schedule);
+}
+
+int main(int argc, char **argv)
+{
+  SilcBool success = FALSE;
+  SilcAccStatsStruct stats;
+  unsigned char *k1, *k2;
+  SilcUInt32 k1_len, k2_len;
+  int i;
+
+  if (argc > 1 && !strcmp(argv[1], "-d")) {
+    silc_log_debug(TRUE);
+    silc_log_quick(TRUE);
+    silc_log_debug_hexdump(TRUE);
+    silc_log_set_debug_string("*acc*,*dh*");
+  }
+
+  silc_crypto_init(NULL);
+  silc_rng_global_init(NULL);
+  schedule = silc_schedule_init(0, NULL, NULL);
+
+  if (!silc_acc_init(SILC_SOFTACC, schedule, "min_threads", 2,
+		     "max_threads", 8, NULL))
+    goto err;
+
+  silc_mp_init(&g);
+  silc_mp_init(&p);
+  silc_mp_set_ui(&g, 2);
+  silc_mp_set_str(&p, GROUP_P, 16);
+
+  /* Invalid remote public values */
+  SILC_LOG_DEBUG(("Check remote public value range"));
+  dh[0] = silc_dh_alloc(&g, &p, NULL);
+  if (!dh[0])
+    goto err;
+  if (silc_dh_set_remote_public(dh[0], &g) == FALSE)
+    goto err;
+  if (silc_dh_set_remote_public(dh[0], &p) == TRUE)
+    goto err;
+  silc_dh_free(dh[0]);
+
+  /* Synchronous key agreement */
+  SILC_LOG_DEBUG(("Synchronous key agreement"));
+  dh[0] = silc_dh_alloc(&g, &p, NULL);
+  dh[1] = silc_dh_alloc(&g, &p, NULL);
+  if (!dh[0] || !dh[1])
+    goto err;
+  if (!silc_dh_generate_private(dh[0], NULL) ||
+      !silc_dh_generate_private(dh[1], NULL))
+    goto err;
+  if (!silc_dh_compute_public(dh[0], NULL) ||
+      !silc_dh_compute_public(dh[1], NULL))
+    goto err;
+  if (!silc_dh_set_remote_public(dh[0], dh[1]->my_y) ||
+      !silc_dh_set_remote_public(dh[1], dh[0]->my_y))
+    goto err;
+  if (!silc_dh_compute_key_data(dh[0], &k1, &k1_len) ||
+      !silc_dh_compute_key_data(dh[1], &k2, &k2_len))
+    goto err;
+  if (k1_len != k2_len || memcmp(k1, k2, k1_len))
+    goto err;
+  silc_free(k1);
+  silc_free(k2);
+  silc_dh_free(dh[0]);
+  silc_dh_free(dh[1]);
+
+  /* Accelerated key agreements */
+  SILC_LOG_DEBUG(("Accelerated key agreement, %d pairs", DH_PAIRS));
+  for (i = 0; i < DH_PAIRS * 2; i++) {
+    dh[i] = silc_dh_alloc(&g, &p, NULL);
+    if (!dh[i])
+      goto err;
+    if (!silc_acc_dh(SILC_SOFTACC, dh[i]))
+      goto err;
+    if (!silc_dh_generate_private(dh[i], NULL))
+      goto err;
+  }
+
+  silc_schedule_task_add_timeout(schedule, start, NULL, 0, 1);
+  silc_schedule_task_add_timeout(schedule, timeout, NULL, 60, 0);
+  silc_schedule(schedule);
+
+  if (failed || pending)
+    goto err;
+
+  for (i = 0; i < DH_PAIRS * 2; i += 2)
+    if (silc_mp_cmp(dh[i]->z, dh[i + 1]->z))
+      goto err;
+
+  /* Public value and key for each */
+  SILC_LOG_DEBUG(("Check statistics"));
+  if (!silc_acc_get_stats(SILC_SOFTACC, &stats))
+    goto err;
+  SILC_LOG_DEBUG(("DH operations %llu, median %llu usec, max %llu usec",
+		  stats.op[SILC_ACC_STATS_DH].ops,
+		  silc_acc_stats_percentile(&stats.op[SILC_ACC_STATS_DH], 50),
+		  stats.op[SILC_ACC_STATS_DH].latency_max));
+  if (stats.op[SILC_ACC_STATS_DH].ops != DH_PAIRS * 4 ||
+      stats.op[SILC_ACC_STATS_DH].failed)
+    goto err;
+
+  for (i = 0; i < DH_PAIRS * 2; i++)
+    silc_dh_free(dh[i]);
+  silc_mp_uninit(&g);
+  silc_mp_uninit(&p);
+  silc_acc_uninit(SILC_SOFTACC);
+  silc_schedule_uninit(schedule);
+  silc_rng_global_uninit();
+  silc_crypto_uninit();
+
+  success = TRUE;
+
+ err:
+  SILC_LOG_DEBUG(("Testing was %s", success ? "SUCCESS" : "FAILURE"));
+  fprintf(stderr, "Testing was %s\n", success ? "SUCCESS" : "FAILURE");
+
+  return !success;
+}
@@ -0,0 +1,139 @@
+/* Software accelerator hash and MAC tests */
+
+#include "silccrypto.h"
+#include "softacc.h"
+
+#define DATA_LEN 0x00100000	/* large job data len */
+#define SMALL_LEN 64		/* small job data len */
+#define SMALL_JOBS 1000		/* number of small jobs */
+#define LARGE_JOBS 16		/* number of large jobs */
+
+SilcSchedule schedule;
+SilcHash hash, acc_hash;
+SilcMac mac, acc_mac;
+unsigned char *data;
+unsigned char hash_small[SILC_HASH_MAXLEN], hash_large[SILC_HASH_MAXLEN];
+unsigned char mac_small[SILC_HASH_MAXLEN], mac_large[SILC_HASH_MAXLEN];
+SilcUInt32 mac_len;
+int pending = 0, failed = 0;
+
+void digest_compl(SilcBool success, const unsigned char *digest,
+		  SilcUInt32 digest_len, void *context)
+{
+  unsigned char *expected = context;
+
+  if (!success || memcmp(digest, expected, digest_len)) {
+    SILC_LOG_DEBUG(("Digest mismatch"));
+    failed++;
+  }
+
+  if (--pending == 0)
+    silc_schedule_stop(schedule);
+}
+
+SILC_TASK_CALLBACK(start)
+{
+  int i;
+
+  pending = 2 * (SMALL_JOBS + LARGE_JOBS);
+
+  for (i = 0; i < SMALL_JOBS; i++) {
+    silc_acc_hash_make(acc_hash, data, SMALL_LEN, digest_compl, hash_small);
+    silc_acc_mac_make(acc_mac, data, SMALL_LEN, digest_compl, mac_small);
+  }
+
+  for (i = 0; i < LARGE_JOBS; i++) {
+    silc_acc_hash_make(acc_hash, data, DATA_LEN, digest_compl, hash_large);
+    silc_acc_mac_make(acc_mac, data, DATA_LEN, digest_compl, mac_large);
+  }
+}
+
+SILC_TASK_CALLBACK(timeout)
+{
+  SILC_LOG_DEBUG(("Timeout, %d jobs pending", pending));
+  failed++;
+  silc_schedule_stop(schedule);
+}
+
+int main(int argc, char **argv)
+{
+  SilcBool success = FALSE;
+  int i;
+
+  if (argc > 1 && !strcmp(argv[1], "-d")) {
+    silc_log_debug(TRUE);
+    silc_log_quick(TRUE);
+    silc_log_debug_hexdump(TRUE);
+    silc_log_set_debug_string("*acc*");
+  }
+
+  silc_crypto_init(NULL);
+  schedule = silc_schedule_init(0, NULL, NULL);
+
+  data = silc_malloc(DATA_LEN);
+  if (!data)
+    goto err;
+  for (i = 0; i < DATA_LEN; i++)
+    data[i] = i % 255;
+
+  if (!silc_acc_init(SILC_SOFTACC, schedule, "min_threads", 2,
+		     "max_threads", 8, NULL))
+    goto err;
+
+  SILC_LOG_DEBUG(("Accelerate sha256"));
+  if (!silc_hash_alloc("sha256", &hash))
+    goto err;
+  acc_hash = silc_acc_hash(SILC_SOFTACC, hash);
+  if (!acc_hash)
+    goto err;
+  if (silc_acc_get_hash(SILC_SOFTACC, acc_hash) != hash)
+    goto err;
+
+  SILC_LOG_DEBUG(("Accelerate hmac-sha256"));
+  if (!silc_mac_alloc("hmac-sha256", &mac))
+    goto err;
+  silc_mac_set_key(mac, data, 32);
+  acc_mac = silc_acc_mac(SILC_SOFTACC, mac);
+  if (!acc_mac)
+    goto err;
+  if (silc_acc_get_mac(SILC_SOFTACC, acc_mac) != mac)
+    goto err;
+
+  /* Expected digests computed synchronously */
+  silc_hash_make(hash, data, SMALL_LEN, hash_small);
+  silc_hash_make(hash, data, DATA_LEN, hash_large);
+  silc_mac_make(mac, data, SMALL_LEN, mac_small, &mac_len);
+  silc_mac_make(mac, data, DATA_LEN, mac_large, &mac_len);
+
+  /* Synchronous use of accelerated hash */
+  {
+    unsigned char tmp[SILC_HASH_MAXLEN];
+    silc_hash_make(acc_hash, data, SMALL_LEN, tmp);
+    if (memcmp(tmp, hash_small, silc_hash_len(hash)))
+      goto err;
+  }
+
+  silc_schedule_task_add_timeout(schedule, start, NULL, 0, 1);
+  silc_schedule_task_add_timeout(schedule, timeout, NULL, 60, 0);
+  silc_schedule(schedule);
+
+  if (failed || pending)
+    goto err;
+
+  silc_mac_free(acc_mac);
+  silc_mac_free(mac);
+  silc_hash_free(acc_hash);
+  silc_hash_free(hash);
+  silc_acc_uninit(SILC_SOFTACC);
+  silc_schedule_uninit(schedule);
+  silc_free(data);
+  silc_crypto_uninit();
+
+  success = TRUE;
+
+ err:
+  SILC_LOG_DEBUG(("Testing was %s", success ? "SUCCESS" : "FAILURE"));
+  fprintf(stderr, "Testing was %s\n", success ? "SUCCESS" : "FAILURE");
+
+  return !success;
+}
@@ -866,7 +866,7 @@ SilcBool silc_asn1_decode(SilcAsn1 asn1, SilcBuffer src, ...);
  *
  ***/
 #define SILC_ASN1_OID(x) SILC_ASN1_U1(OID, x)
-#define SILC_ASN1_OID_T(o, t, x) SILC_ASN1_UT(OID, o, t, x)
+#define SILC_ASN1_OID_T(o, t, x) SILC_ASN1_T1(OID, o, t, x)
 
 /****f* silcasn1/SILC_ASN1_OCTET_STRING
  *
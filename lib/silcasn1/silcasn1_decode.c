@@ -481,7 +481,8 @@ silc_asn1_decoder(SilcAsn1 asn1, SilcStack stack1, SilcAsn1Tag type,
 	    goto fail;
 	  }
 
-	  silc_mp_sinit(SILC_ASN1_STACK(stack1, asn1), *intval);
+	  silc_mp_sinit_size(SILC_ASN1_STACK(stack1, asn1), *intval,
+			     rdata_len * 8);
 
 	  /* Check whether the integer is positive or negative */
 	  if (rdata[0] & 0x80) {
@@ -0,0 +1,2898 @@
+/*
+
+  curve25519.c
+
+  Author: Pekka Riikonen <priikone@silcnet.org>
+
+  Copyright (C) 2008 Pekka Riikonen
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; version 2 of the License.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+*/
+
+/* Curve25519 and edwards25519 arithmetic.
+
+   The field elements modulo p = 2 ^ 255 - 19 are five 51 bit limbs in
+   64 bit words.  The products of the limbs are accumulated in 128 bit
+   integers, which are emulated with 64 bit halves if the compiler does
+   not have them.  All field operations leave the limbs below 2 ^ 52, so
+   that their results can be used directly as input of any other
+   operation.  The field arithmetic does not branch or index memory on
+   the values.
+
+   X25519 is the Montgomery ladder of RFC 7748, and the X25519 public
+   value is computed with the Edwards base point multiplication, which is
+   several times faster than the ladder.
+
+   The Edwards points are in extended coordinates.  The base point
+   multiplication uses signed 4 bit digits and a table of 8 multiples of
+   256 ^ i * B for each digit pair i, selecting each entry with a full
+   table scan.  The verification, which uses only public values, is a
+   variable time Straus multi-scalar multiplication with width 5 NAF for
+   the public keys and width 8 NAF with precomputed table for B.  Batch
+   verification shares the doublings between all signatures.
+
+   The scalars modulo the group order l use the constant time Montgomery
+   arithmetic of ecp.c. */
+
+#include "silccrypto.h"
+#include "ecp.h"
+#include "curve25519.h"
+
+#ifndef CONST64
+#ifdef _MSC_VER
+#define CONST64(n) n ## ui64
+#else
+#define CONST64(n) n ## ULL
+#endif /* _MSC_VER */
+#endif /* CONST64 */
+
+/* Limb mask */
+#define SILC_C25519_MASK CONST64(0x7ffffffffffff)
+
+/* NAF widths of public key and base point in verification */
+#define SILC_C25519_NAF_WIDTH 5
+#define SILC_C25519_NAF_WIDTH_B 8
+
+/* Maximum signatures in one batch equation */
+#define SILC_C25519_BATCH_MAX 64
+
+/* Field element, x = sum of f[i] * 2 ^ (51 * i) */
+typedef SilcUInt64 Fe25519[5];
+
+/* Point in extended coordinates, x = X / Z, y = Y / Z, x * y = T / Z */
+typedef struct {
+  Fe25519 X;
+  Fe25519 Y;
+  Fe25519 Z;
+  Fe25519 T;
+} Ge25519;
+
+/* Projective point, x = X / Z, y = Y / Z */
+typedef struct {
+  Fe25519 X;
+  Fe25519 Y;
+  Fe25519 Z;
+} Ge25519P2;
+
+/* Completed point, x = X / Z, y = Y / T */
+typedef struct {
+  Fe25519 X;
+  Fe25519 Y;
+  Fe25519 Z;
+  Fe25519 T;
+} Ge25519P1P1;
+
+/* Affine point for mixed addition, (y + x, y - x, 2 * d * x * y) */
+typedef struct {
+  Fe25519 ypx;
+  Fe25519 ymx;
+  Fe25519 xy2d;
+} Ge25519Niels;
+
+/* Point for addition, (Y + X, Y - X, Z, 2 * d * T) */
+typedef struct {
+  Fe25519 YpX;
+  Fe25519 YmX;
+  Fe25519 Z;
+  Fe25519 T2d;
+} Ge25519Cached;
+
+/* 128 bit integer */
+#if defined(__SIZEOF_INT128__)
+typedef unsigned __int128 C25519Wide;
+#define SILC_C25519_MUL(r, a, b) (r) = (C25519Wide)(a) * (b)
+#define SILC_C25519_MULADD(r, a, b) (r) += (C25519Wide)(a) * (b)
+#define SILC_C25519_ADD(r, a) (r) += (a)
+#define SILC_C25519_SHR(r, n) ((SilcUInt64)((r) >> (n)))
+#define SILC_C25519_LO(r) ((SilcUInt64)(r))
+#else
+typedef struct {
+  SilcUInt64 lo;
+  SilcUInt64 hi;
+} C25519Wide;
+#define SILC_C25519_MUL(r, a, b) silc_c25519_wide_mul(&(r), a, b, FALSE)
+#define SILC_C25519_MULADD(r, a, b) silc_c25519_wide_mul(&(r), a, b, TRUE)
+#define SILC_C25519_ADD(r, a)			\
+do {						\
+  (r).lo += (a);				\
+  (r).hi += (r).lo < (a);			\
+} while(0)
+#define SILC_C25519_SHR(r, n) (((r).lo >> (n)) | ((r).hi << (64 - (n))))
+#define SILC_C25519_LO(r) ((r).lo)
+
+/* r = a * b, or r += a * b if `add' is TRUE */
+
+static inline void silc_c25519_wide_mul(C25519Wide *r, SilcUInt64 a,
+					SilcUInt64 b, SilcBool add)
+{
+  SilcUInt64 a0 = a & 0xffffffff, a1 = a >> 32;
+  SilcUInt64 b0 = b & 0xffffffff, b1 = b >> 32;
+  SilcUInt64 p00 = a0 * b0, p01 = a0 * b1, p10 = a1 * b0, p11 = a1 * b1;
+  SilcUInt64 mid, lo, hi;
+
+  mid = (p00 >> 32) + (p01 & 0xffffffff) + (p10 & 0xffffffff);
+  lo = (p00 & 0xffffffff) | (mid << 32);
+  hi = p11 + (p01 >> 32) + (p10 >> 32) + (mid >> 32);
+
+  if (add) {
+    r->lo += lo;
+    r->hi += hi + (r->lo < lo);
+  } else {
+    r->lo = lo;
+    r->hi = hi;
+  }
+}
+#endif /* __SIZEOF_INT128__ */
+
+/******************************** Constants *********************************/
+
+/* d = -121665 / 121666 */
+static const Fe25519 silc_c25519_d = {
+  CONST64(0x34dca135978a3), CONST64(0x1a8283b156ebd), CONST64(0x5e7a26001c029),
+  CONST64(0x739c663a03cbb), CONST64(0x52036cee2b6ff)
+};
+
+/* 2 * d */
+static const Fe25519 silc_c25519_d2 = {
+  CONST64(0x69b9426b2f159), CONST64(0x35050762add7a), CONST64(0x3cf44c0038052),
+  CONST64(0x6738cc7407977), CONST64(0x2406d9dc56dff)
+};
+
+/* sqrt(-1) */
+static const Fe25519 silc_c25519_sqrtm1 = {
+  CONST64(0x61b274a0ea0b0), CONST64(0x0d5a5fc8f189d), CONST64(0x7ef5e9cbd0c60),
+  CONST64(0x78595a6804c9e), CONST64(0x2b8324804fc1d)
+};
+
+/* The group order l = 2 ^ 252 + 27742317777372353535851937790883648493,
+   R = 2 ^ 256 */
+static const EcpField silc_c25519_l = {
+  { 0x5cf5d3ed, 0x5812631a, 0xa2f79cd6, 0x14def9de,
+    0x00000000, 0x00000000, 0x00000000, 0x10000000 },
+  { 0x449c0f01, 0xa40611e3, 0x68859347, 0xd00e1ba7,
+    0x17f5be65, 0xceec73d2, 0x7c309a3d, 0x0399411b },
+  { 0x8d98951d, 0xd6ec3174, 0x737dcf70, 0xc6ef5bf4,
+    0xfffffffe, 0xffffffff, 0xffffffff, 0x0fffffff },
+  0x12547e1b,
+  8
+};
+
+/* Base point table.  Entry 8 * i + j is (j + 1) * 256 ^ i * B, in the
+   Ge25519Niels layout, 15 limbs each. */
+static const SilcUInt64 silc_c25519_base_table[] = {
+  CONST64(0x493c6f58c3b85), CONST64(0x0df7181c325f7), CONST64(0x0f50b0b3e4cb7),
+  CONST64(0x5329385a44c32), CONST64(0x07cf9d3a33d4b), CONST64(0x03905d740913e),
+  CONST64(0x0ba2817d673a2), CONST64(0x23e2827f4e67c), CONST64(0x133d2e0c21a34),
+  CONST64(0x44fd2f9298f81), CONST64(0x11205877aaa68), CONST64(0x479955893d579),
+  CONST64(0x50d66309b67a0), CONST64(0x2d42d0dbee5ee), CONST64(0x6f117b689f0c6),
+  CONST64(0x4e7fc933c71d7), CONST64(0x2cf41feb6b244), CONST64(0x7581c0a7d1a76),
+  CONST64(0x7172d534d32f0), CONST64(0x590c063fa87d2), CONST64(0x1a56042b4d5a8),
+  CONST64(0x189cc159ed153), CONST64(0x5b8deaa3cae04), CONST64(0x2aaf04f11b5d8),
+  CONST64(0x6bb595a669c92), CONST64(0x2a8b3a59b7a5f), CONST64(0x3abb359ef087f),
+  CONST64(0x4f5a8c4db05af), CONST64(0x5b9a807d04205), CONST64(0x701af5b13ea50),
+  CONST64(0x5b0a84cee9730), CONST64(0x61d10c97155e4), CONST64(0x4059cc8096a10),
+  CONST64(0x47a608da8014f), CONST64(0x7a164e1b9a80f), CONST64(0x11fe8a4fcd265),
+  CONST64(0x7bcb8374faacc), CONST64(0x52f5af4ef4d4f), CONST64(0x5314098f98d10),
+  CONST64(0x2ab91587555bd), CONST64(0x6933f0dd0d889), CONST64(0x44386bb4c4295),
+  CONST64(0x3cb6d3162508c), CONST64(0x26368b872a2c6), CONST64(0x5a2826af12b9b),
+  CONST64(0x351b98efc099f), CONST64(0x68fbfa4a7050e), CONST64(0x42a49959d971b),
+  CONST64(0x393e51a469efd), CONST64(0x680e910321e58), CONST64(0x6050a056818bf),
+  CONST64(0x62acc1f5532bf), CONST64(0x28141ccc9fa25), CONST64(0x24d61f471e683),
+  CONST64(0x27933f4c7445a), CONST64(0x3fbe9c476ff09), CONST64(0x0af6b982e4b42),
+  CONST64(0x0ad1251ba78e5), CONST64(0x715aeedee7c88), CONST64(0x7f9d0cbf63553),
+  CONST64(0x2bc4408a5bb33), CONST64(0x078ebdda05442), CONST64(0x2ffb112354123),
+  CONST64(0x375ee8df5862d), CONST64(0x2945ccf146e20), CONST64(0x182c3a447d6ba),
+  CONST64(0x22964e536eff2), CONST64(0x192821f540053), CONST64(0x2f9f19e788e5c),
+  CONST64(0x154a7e73eb1b5), CONST64(0x3dbf1812a8285), CONST64(0x0fa17ba3f9797),
+  CONST64(0x6f69cb49c3820), CONST64(0x34d5a0db3858d), CONST64(0x43aabe696b3bb),
+  CONST64(0x4eeeb77157131), CONST64(0x1201915f10741), CONST64(0x1669cda6c9c56),
+  CONST64(0x45ec032db346d), CONST64(0x51e57bb6a2cc3), CONST64(0x006b67b7d8ca4),
+  CONST64(0x084fa44e72933), CONST64(0x1154ee55d6f8a), CONST64(0x4425d842e7390),
+  CONST64(0x38b64c41ae417), CONST64(0x4326702ea4b71), CONST64(0x06834376030b5),
+  CONST64(0x0ef0512f9c380), CONST64(0x0f1a9f2512584), CONST64(0x10b8e91a9f0d6),
+  CONST64(0x25cd0944ea3bf), CONST64(0x75673b81a4d63), CONST64(0x150b925d1c0d4),
+  CONST64(0x13f38d9294114), CONST64(0x461bea69283c9), CONST64(0x72c9aaa3221b1),
+  CONST64(0x267774474f74d), CONST64(0x064b0e9b28085), CONST64(0x3f04ef53b27c9),
+  CONST64(0x1d6edd5d2e531), CONST64(0x36dc801b8b3a2), CONST64(0x0e0a7d4935e30),
+  CONST64(0x1deb7cecc0d7d), CONST64(0x053a94e20dd2c), CONST64(0x7a9fbb1c6a0f9),
+  CONST64(0x7596604dd3e8f), CONST64(0x6fc510e058b36), CONST64(0x3670c8db2cc0d),
+  CONST64(0x297d899ce332f), CONST64(0x0915e76061bce), CONST64(0x75dedf39234d9),
+  CONST64(0x01c36ab1f3c54), CONST64(0x0f08fee58f5da), CONST64(0x0e19613a0d637),
+  CONST64(0x3a9024a1320e0), CONST64(0x1f5d9c9a2911a), CONST64(0x7117994fafcf8),
+  CONST64(0x2d8a8cae28dc5), CONST64(0x74ab1b2090c87), CONST64(0x26907c5c2ecc4),
+  CONST64(0x4dd0e632f9c1d), CONST64(0x2ced12622a5d9), CONST64(0x18de9614742da),
+  CONST64(0x79ca96fdbb5d4), CONST64(0x6dd37d49a00ee), CONST64(0x3635449aa515e),
+  CONST64(0x3e178d0475dab), CONST64(0x50b4712a19712), CONST64(0x2dcc2860ff4ad),
+  CONST64(0x30d76d6f03d31), CONST64(0x444172106e4c7), CONST64(0x01251afed2d88),
+  CONST64(0x534fc9bed4f5a), CONST64(0x5d85a39cf5234), CONST64(0x10c697112e864),
+  CONST64(0x62aa08358c805), CONST64(0x46f440848e194), CONST64(0x447b771a8f52b),
+  CONST64(0x377ba3269d31d), CONST64(0x03bf9baf55080), CONST64(0x3c4277dbe5fde),
+  CONST64(0x5a335afd44c92), CONST64(0x0c1164099753e), CONST64(0x70487006fe423),
+  CONST64(0x25e61cabed66f), CONST64(0x3e128cc586604), CONST64(0x5968b2e8fc7e2),
+  CONST64(0x049a3d5bd61cf), CONST64(0x116505b1ef6e6), CONST64(0x566d78634586e),
+  CONST64(0x54285c65a2fd0), CONST64(0x55e62ccf87420), CONST64(0x46bb961b19044),
+  CONST64(0x1153405712039), CONST64(0x14fba5f34793b), CONST64(0x7a49f9cc10834),
+  CONST64(0x2b513788a22c6), CONST64(0x5ff4b6ef2395b), CONST64(0x2ec8e5af607bf),
+  CONST64(0x33975bca5ecc3), CONST64(0x746166985f7d4), CONST64(0x09939000ae79a),
+  CONST64(0x5844c7964f97a), CONST64(0x13617e1f95b3d), CONST64(0x14829cea83fc5),
+  CONST64(0x70b2f4e71ecb8), CONST64(0x728148efc643c), CONST64(0x0753e03995b76),
+  CONST64(0x5bf5fb2ab6767), CONST64(0x05fc3bc4535d7), CONST64(0x37b8497dd95c2),
+  CONST64(0x61549d6b4ffe8), CONST64(0x217a22db1d138), CONST64(0x0b9cf062eb09e),
+  CONST64(0x2fd9c71e5f758), CONST64(0x0b3ae52afdedd), CONST64(0x19da76619e497),
+  CONST64(0x6fa0654d2558e), CONST64(0x78219d25e41d4), CONST64(0x373767475c651),
+  CONST64(0x095cb14246590), CONST64(0x002d82aa6ac68), CONST64(0x442f183bc4851),
+  CONST64(0x6464f1c0a0644), CONST64(0x6bf5905730907), CONST64(0x299fd40d1add9),
+  CONST64(0x5f2de9a04e5f7), CONST64(0x7c0eebacc1c59), CONST64(0x4cca1b1f8290a),
+  CONST64(0x1fbea56c3b18f), CONST64(0x778f1e1415b8a), CONST64(0x6f75874efc1f4),
+  CONST64(0x28a694019027f), CONST64(0x52b37a96bdc4d), CONST64(0x02521cf67a635),
+  CONST64(0x46720772f5ee4), CONST64(0x632c0f359d622), CONST64(0x2b2092ba3e252),
+  CONST64(0x662257c112680), CONST64(0x001753d9f7cd6), CONST64(0x7ee0b0a9d5294),
+  CONST64(0x381fbeb4cca27), CONST64(0x7841f3a3e639d), CONST64(0x676ea30c3445f),
+  CONST64(0x3fa00a7e71382), CONST64(0x1232d963ddb34), CONST64(0x35692e70b078d),
+  CONST64(0x247ca14777a1f), CONST64(0x6db556be8fcd0), CONST64(0x12b5fe2fa048e),
+  CONST64(0x37c26ad6f1e92), CONST64(0x46a0971227be5), CONST64(0x4722f0d2d9b4c),
+  CONST64(0x3dc46204ee03a), CONST64(0x6f7e93c20796c), CONST64(0x0fbc496fce34d),
+  CONST64(0x575be6b7dae3e), CONST64(0x4a31585cee609), CONST64(0x037e9023930ff),
+  CONST64(0x749b76f96fb12), CONST64(0x2f604aea6ae05), CONST64(0x637dc939323eb),
+  CONST64(0x3fdad9b048d47), CONST64(0x0a8b0d4045af7), CONST64(0x0fcec10f01e02),
+  CONST64(0x2d29dc4244e45), CONST64(0x6927b1bc147be), CONST64(0x0308534ac0839),
+  CONST64(0x4853664033f41), CONST64(0x413779166feab), CONST64(0x558a649fe1e44),
+  CONST64(0x44635aeefcc89), CONST64(0x1ff434887f2ba), CONST64(0x0f981220e2d44),
+  CONST64(0x4901aa7183c51), CONST64(0x1b7548c1af8f0), CONST64(0x7848c53368116),
+  CONST64(0x01b64e7383de9), CONST64(0x109fbb0587c8f), CONST64(0x41bb887b726d1),
+  CONST64(0x34c597c6691ae), CONST64(0x7a150b6990fc4), CONST64(0x52beb9d922274),
+  CONST64(0x70eed7164861a), CONST64(0x0a871e070c6a9), CONST64(0x07d44744346be),
+  CONST64(0x282b6a564a81d), CONST64(0x4ed80f875236b), CONST64(0x6fbbe1d450c50),
+  CONST64(0x4eb728c12fcdb), CONST64(0x1b5994bbc8989), CONST64(0x74b7ba84c0660),
+  CONST64(0x75678f1cdaeb8), CONST64(0x23206b0d6f10c), CONST64(0x3ee7300f2685d),
+  CONST64(0x27947841e7518), CONST64(0x32c7388dae87f), CONST64(0x414add3971be9),
+  CONST64(0x01850832f0ef1), CONST64(0x7d47c6a2cfb89), CONST64(0x255e49e7dd6b7),
+  CONST64(0x38c2163d59eba), CONST64(0x3861f2a005845), CONST64(0x2e11e4ccbaec9),
+  CONST64(0x1381576297912), CONST64(0x2d0148ef0d6e0), CONST64(0x3522a8de787fb),
+  CONST64(0x2ee055e74f9d2), CONST64(0x64038f6310813), CONST64(0x148cf58d34c9e),
+  CONST64(0x72f7d9ae4756d), CONST64(0x7711e690ffc4a), CONST64(0x582a2355b0d16),
+  CONST64(0x0dccfe885b6b4), CONST64(0x278febad4eaea), CONST64(0x492f67934f027),
+  CONST64(0x7ded0815528d4), CONST64(0x58461511a6612), CONST64(0x5ea2e50de1544),
+  CONST64(0x3ff2fa1ebd5db), CONST64(0x2681f8c933966), CONST64(0x3840521931635),
+  CONST64(0x674f14a308652), CONST64(0x3bd9c88a94890), CONST64(0x4104dd02fe9c6),
+  CONST64(0x14e06db096ab8), CONST64(0x1219c89e6b024), CONST64(0x278abd486a2db),
+  CONST64(0x240b292609520), CONST64(0x0165b5a48efca), CONST64(0x2bf5e1124422a),
+  CONST64(0x673146756ae56), CONST64(0x14ad99a87e830), CONST64(0x1eaca65b080fd),
+  CONST64(0x2c863b00afaf5), CONST64(0x0a474a0846a76), CONST64(0x099a5ef981e32),
+  CONST64(0x2a8ae3c4bbfe6), CONST64(0x45c34af14832c), CONST64(0x591b67d9bffec),
+  CONST64(0x1b3719f18b55d), CONST64(0x754318c83d337), CONST64(0x27c17b7919797),
+  CONST64(0x145b084089b61), CONST64(0x489b4f8670301), CONST64(0x70d1c80b49bfa),
+  CONST64(0x3d57e7d914625), CONST64(0x3c0722165e545), CONST64(0x5e5b93819e04f),
+  CONST64(0x3de02ec7ca8f7), CONST64(0x2102d3aeb92ef), CONST64(0x68c22d50c3a46),
+  CONST64(0x42ea89385894e), CONST64(0x75f9ebf55f38c), CONST64(0x49f5fbba496cb),
+  CONST64(0x5628c1e9c572e), CONST64(0x598b108e822ab), CONST64(0x55d8fae29361a),
+  CONST64(0x0adc8d1a97b28), CONST64(0x06a1a6c288675), CONST64(0x49a108a5bcfd4),
+  CONST64(0x6178c8e7d6612), CONST64(0x1f03473710375), CONST64(0x73a49614a6098),
+  CONST64(0x5604a86dcbfa6), CONST64(0x0d1d47c1764b6), CONST64(0x01c08316a2e51),
+  CONST64(0x2b3db45c95045), CONST64(0x1634f818d300c), CONST64(0x20989e89fe274),
+  CONST64(0x4278b85eaec2e), CONST64(0x0ef59657be2ce), CONST64(0x72fd169588770),
+  CONST64(0x2e9b205260b30), CONST64(0x730b9950f7059), CONST64(0x777fd3a2dcc7f),
+  CONST64(0x594a9fb124932), CONST64(0x01f8e80ca15f0), CONST64(0x714d13cec3269),
+  CONST64(0x0403ed1d0ca67), CONST64(0x32d35874ec552), CONST64(0x1f3048df1b929),
+  CONST64(0x300d73b179b23), CONST64(0x6e67be5a37d0b), CONST64(0x5bd7454308303),
+  CONST64(0x4932115e7792a), CONST64(0x457b9bbb930b8), CONST64(0x68f5d8b193226),
+  CONST64(0x4164e8f1ed456), CONST64(0x5bb7db123067f), CONST64(0x2d19528b24cc2),
+  CONST64(0x4ac66b8302ff3), CONST64(0x701c8d9fdad51), CONST64(0x6c1b35c5b3727),
+  CONST64(0x133a78007380a), CONST64(0x1f467c6ca62be), CONST64(0x2c4232a5dc12c),
+  CONST64(0x7551dc013b087), CONST64(0x0690c11b03bcd), CONST64(0x740dca6d58f0e),
+  CONST64(0x28c570478433c), CONST64(0x1d8502873a463), CONST64(0x7641e7eded49c),
+  CONST64(0x1ecedd54cf571), CONST64(0x2c03f5256c2b0), CONST64(0x0ee0752cfce4e),
+  CONST64(0x660dd8116fbe9), CONST64(0x55167130fffeb), CONST64(0x1c682b885955c),
+  CONST64(0x161d25fa963ea), CONST64(0x718757b53a47d), CONST64(0x619e18b0f2f21),
+  CONST64(0x5fbdfe4c1ec04), CONST64(0x5d798c81ebb92), CONST64(0x699468bdbd96b),
+  CONST64(0x53de66aa91948), CONST64(0x045f81a599b1b), CONST64(0x3f7a8bd214193),
+  CONST64(0x71d4da412331a), CONST64(0x293e1c4e6c4a2), CONST64(0x72f46f4dafecf),
+  CONST64(0x2948ffadef7a3), CONST64(0x11ecdfdf3bc04), CONST64(0x3c2e98ffeed25),
+  CONST64(0x525219a473905), CONST64(0x6134b925112e1), CONST64(0x6bb942bb406ed),
+  CONST64(0x070c445c0dde2), CONST64(0x411d822c4d7a3), CONST64(0x5b605c447f032),
+  CONST64(0x1fec6f0e7f04c), CONST64(0x3cebc692c477d), CONST64(0x077986a19a95e),
+  CONST64(0x6eaaaa1778b0f), CONST64(0x2f12fef4cc5ab), CONST64(0x5805920c47c89),
+  CONST64(0x1924771f9972c), CONST64(0x38bbddf9fc040), CONST64(0x1f7000092b281),
+  CONST64(0x24a76dcea8aeb), CONST64(0x522b2dfc0c740), CONST64(0x7e8193480e148),
+  CONST64(0x33fd9a04341b9), CONST64(0x3c863678a20bc), CONST64(0x5e607b2518a43),
+  CONST64(0x4431ca596cf14), CONST64(0x015da7c801405), CONST64(0x03c9b6f8f10b5),
+  CONST64(0x0346922934017), CONST64(0x201f33139e457), CONST64(0x31d8f6cdf1818),
+  CONST64(0x1f86c4b144b16), CONST64(0x39875b8d73e9d), CONST64(0x2fbf0d9ffa7b3),
+  CONST64(0x5067acab6ccdd), CONST64(0x27f6b08039d51), CONST64(0x4802f8000dfaa),
+  CONST64(0x09692a062c525), CONST64(0x1baea91075817), CONST64(0x397cba8862460),
+  CONST64(0x5c3fbc81379e7), CONST64(0x41bbc255e2f02), CONST64(0x6a3f756998650),
+  CONST64(0x1297fd4e07c42), CONST64(0x771b4022c1e1c), CONST64(0x13093f05959b2),
+  CONST64(0x1bd352f2ec618), CONST64(0x075789b88ea86), CONST64(0x61d1117ea48b9),
+  CONST64(0x2339d320766e6), CONST64(0x5d986513a2fa7), CONST64(0x63f3a99e11b0f),
+  CONST64(0x28a0ecfd6b26d), CONST64(0x53b6835e18d8f), CONST64(0x331a189219971),
+  CONST64(0x12f3a9d7572af), CONST64(0x10d00e953c4ca), CONST64(0x603df116f2f8a),
+  CONST64(0x33dc276e0e088), CONST64(0x1ac9619ff649a), CONST64(0x66f45fb4f80c6),
+  CONST64(0x3cc38eeb9fea2), CONST64(0x107647270db1f), CONST64(0x710f1ea740dc8),
+  CONST64(0x31167c6b83bdf), CONST64(0x33842524b1068), CONST64(0x77dd39d30fe45),
+  CONST64(0x189432141a0d0), CONST64(0x088fe4eb8c225), CONST64(0x612436341f08b),
+  CONST64(0x349e31a2d2638), CONST64(0x0137a7fa6b16c), CONST64(0x681ae92777edc),
+  CONST64(0x222bfc5f8dc51), CONST64(0x1522aa3178d90), CONST64(0x541db874e898d),
+  CONST64(0x62d80fb841b33), CONST64(0x03e6ef027fa97), CONST64(0x7a03c9e9633e8),
+  CONST64(0x46ebe2309e5ef), CONST64(0x02f5369614938), CONST64(0x356e5ada20587),
+  CONST64(0x11bc89f6bf902), CONST64(0x036746419c8db), CONST64(0x45fe70f505243),
+  CONST64(0x24920c8951491), CONST64(0x107ec61944c5e), CONST64(0x72752e017c01f),
+  CONST64(0x122b7dda2e97a), CONST64(0x16619f6db57a2), CONST64(0x075a6960c0b8c),
+  CONST64(0x6dde1c5e41b49), CONST64(0x42e3f516da341), CONST64(0x16a03fda8e79e),
+  CONST64(0x428d1623a0e39), CONST64(0x74a4401a308fd), CONST64(0x06ed4b9558109),
+  CONST64(0x746f1f6a08867), CONST64(0x4636f5c6f2321), CONST64(0x1d81592d60bd3),
+  CONST64(0x5b69f7b85c5e8), CONST64(0x17a2d175650ec), CONST64(0x4cc3e6dbfc19e),
+  CONST64(0x73e1d3873be0e), CONST64(0x3a5f6d51b0af8), CONST64(0x68756a60dac5f),
+  CONST64(0x55d757b8aec26), CONST64(0x3383df45f80bd), CONST64(0x6783f8c9f96a6),
+  CONST64(0x20234a7789ecd), CONST64(0x20db67178b252), CONST64(0x73aa3da2c0eda),
+  CONST64(0x79045c01c70d3), CONST64(0x1b37b15251059), CONST64(0x7cd682353cffe),
+  CONST64(0x5cd6068acf4f3), CONST64(0x3079afc7a74cc), CONST64(0x58097650b64b4),
+  CONST64(0x47fabac9c4e99), CONST64(0x3ef0253b2b2cd), CONST64(0x1a45bd887fab6),
+  CONST64(0x65748076dc17c), CONST64(0x5b98000aa11a8), CONST64(0x4a1ecc9080974),
+  CONST64(0x2838c8863bdc0), CONST64(0x3b0cf4a465030), CONST64(0x022b8aef57a2d),
+  CONST64(0x2ad0677e925ad), CONST64(0x4094167d7457a), CONST64(0x21dcb8a606a82),
+  CONST64(0x500fabe7731ba), CONST64(0x7cc53c3113351), CONST64(0x7cf65fe080d81),
+  CONST64(0x3c5d966011ba1), CONST64(0x5d840dbf6c6f6), CONST64(0x004468c9d9fc8),
+  CONST64(0x5da8554796b8c), CONST64(0x3b8be70950025), CONST64(0x6d5892da6a609),
+  CONST64(0x0bc3d08194a31), CONST64(0x6380d309fe18b), CONST64(0x4d73c2cb8ee0d),
+  CONST64(0x6b882adbac0b6), CONST64(0x36eabdddd4cbe), CONST64(0x3a4276232ac19),
+  CONST64(0x0c172db447ecb), CONST64(0x3f8c505b7a77f), CONST64(0x6a857f97f3f10),
+  CONST64(0x4fcc0567fe03a), CONST64(0x0770c9e824e1a), CONST64(0x2432c8a7084fa),
+  CONST64(0x47bf73ca8a968), CONST64(0x1639176262867), CONST64(0x5e8df4f8010ce),
+  CONST64(0x1ff177cea16de), CONST64(0x1d99a45b5b5fd), CONST64(0x523674f2499ec),
+  CONST64(0x0f8fa26182613), CONST64(0x58f7398048c98), CONST64(0x39f264fd41500),
+  CONST64(0x34aabfe097be1), CONST64(0x43bfc03253a33), CONST64(0x29bc7fe91b7f3),
+  CONST64(0x0a761e4844a16), CONST64(0x65c621272c35f), CONST64(0x53417dbe7e29c),
+  CONST64(0x54573827394f5), CONST64(0x565eea6f650dd), CONST64(0x42050748dc749),
+  CONST64(0x1712d73468889), CONST64(0x389f8ce3193dd), CONST64(0x2d424b8177ce5),
+  CONST64(0x073fa0d3440cd), CONST64(0x139020cd49e97), CONST64(0x22f9800ab19ce),
+  CONST64(0x29fdd9a6efdac), CONST64(0x7c694a9282840), CONST64(0x6f7cdeee44b3a),
+  CONST64(0x55a3207b25cc3), CONST64(0x4171a4d38598c), CONST64(0x2368a3e9ef8cb),
+  CONST64(0x454aa08e2ac0b), CONST64(0x490923f8fa700), CONST64(0x372aa9ea4582f),
+  CONST64(0x13f416cd64762), CONST64(0x758aa99c94c8c), CONST64(0x5f6001700ff44),
+  CONST64(0x7694e488c01bd), CONST64(0x0d5fde948eed6), CONST64(0x508214fa574bd),
+  CONST64(0x215bb53d003d6), CONST64(0x1179e792ca8c3), CONST64(0x1a0e96ac840a2),
+  CONST64(0x22393e2bb3ab6), CONST64(0x3a7758a4c86cb), CONST64(0x269153ed6fe4b),
+  CONST64(0x72a23aef89840), CONST64(0x052be5299699c), CONST64(0x3a5e5ef132316),
+  CONST64(0x22f960ec6faba), CONST64(0x111f693ae5076), CONST64(0x3e3bfaa94ca90),
+  CONST64(0x445799476b887), CONST64(0x24a0912464879), CONST64(0x5d9fd15f8de7f),
+  CONST64(0x44d2aeed7521e), CONST64(0x50865d2c2a7e4), CONST64(0x2705b5238ea40),
+  CONST64(0x46c70b25d3b97), CONST64(0x3bc187fa47eb9), CONST64(0x408d36d63727f),
+  CONST64(0x5faf8f6a66062), CONST64(0x2bb892da8de6b), CONST64(0x769d4f0c7e2e6),
+  CONST64(0x332f35914f8fb), CONST64(0x70115ea86c20c), CONST64(0x16d88da24ada8),
+  CONST64(0x1980622662adf), CONST64(0x501ebbc195a9d), CONST64(0x450d81ce906fb),
+  CONST64(0x4d8961cae743f), CONST64(0x6bdc38c7dba0e), CONST64(0x7d3b4a7e1b463),
+  CONST64(0x0844bdee2adf3), CONST64(0x4cbad279663ab), CONST64(0x3b6a1a6205275),
+  CONST64(0x2e82791d06dcf), CONST64(0x23d72caa93c87), CONST64(0x5f0b7ab68aaf4),
+  CONST64(0x2de25d4ba6345), CONST64(0x19024a0d71fcd), CONST64(0x15f65115f101a),
+  CONST64(0x4e99067149708), CONST64(0x119d8d1cba5af), CONST64(0x7d7fbcefe2007),
+  CONST64(0x45dc5f3c29094), CONST64(0x3455220b579af), CONST64(0x070c1631e068a),
+  CONST64(0x26bc0630e9b21), CONST64(0x4f9cd196dcd8d), CONST64(0x71e6a266b2801),
+  CONST64(0x09aae73e2df5d), CONST64(0x40dd8b219b1a3), CONST64(0x546fb4517de0d),
+  CONST64(0x5975435e87b75), CONST64(0x297d86a7b3768), CONST64(0x4835a2f4c6332),
+  CONST64(0x070305f434160), CONST64(0x183dd014e56ae), CONST64(0x7ccdd084387a0),
+  CONST64(0x484186760cc93), CONST64(0x7435665533361), CONST64(0x02f686336b801),
+  CONST64(0x5225446f64331), CONST64(0x3593ca848190c), CONST64(0x6422c6d260417),
+  CONST64(0x212904817bb94), CONST64(0x5a319deb854f5), CONST64(0x7a9d4e060da7d),
+  CONST64(0x428bd0ed61d0c), CONST64(0x3189a5e849aa7), CONST64(0x6acbb1f59b242),
+  CONST64(0x7f6ef4753630c), CONST64(0x1f346292a2da9), CONST64(0x27398308da2d6),
+  CONST64(0x10e4c0a702453), CONST64(0x4daafa37bd734), CONST64(0x49f6bdc3e8961),
+  CONST64(0x1feffdcecdae6), CONST64(0x572c2945492c3), CONST64(0x38d28435ed413),
+  CONST64(0x4064f19992858), CONST64(0x7680fbef543cd), CONST64(0x1aadd83d58d3c),
+  CONST64(0x269597aebe8c3), CONST64(0x7c745d6cd30be), CONST64(0x27c7755df78ef),
+  CONST64(0x1776833937fa3), CONST64(0x5405116441855), CONST64(0x7f985498c05bc),
+  CONST64(0x615520fbf6363), CONST64(0x0b9e9bf74da6a), CONST64(0x4fe8308201169),
+  CONST64(0x173f76127de43), CONST64(0x30f2653cd69b1), CONST64(0x1ce889f0be117),
+  CONST64(0x36f6a94510709), CONST64(0x7f248720016b4), CONST64(0x1821ed1e1cf91),
+  CONST64(0x76c2ec470a31f), CONST64(0x0c938aac10c85), CONST64(0x41b64ed797141),
+  CONST64(0x1beb1c1185e6d), CONST64(0x1ed5490600f07), CONST64(0x2f1273f159647),
+  CONST64(0x08bd755a70bc0), CONST64(0x49e3a885ce609), CONST64(0x16585881b5ad6),
+  CONST64(0x3c27568d34f5e), CONST64(0x38ac1997edc5f), CONST64(0x1fc7c8ae01e11),
+  CONST64(0x2094d5573e8e7), CONST64(0x5ca3cbbf549d2), CONST64(0x4f920ecc54143),
+  CONST64(0x5d9e572ad85b6), CONST64(0x6b517a751b13b), CONST64(0x0cfd370b180cc),
+  CONST64(0x5377925d1f41a), CONST64(0x34e56566008a2), CONST64(0x22dfcd9cbfe9e),
+  CONST64(0x459b4103be0a1), CONST64(0x59a4b3f2d2add), CONST64(0x7d734c8bb8eeb),
+  CONST64(0x2393cbe594a09), CONST64(0x0fe9877824cde), CONST64(0x3d2e0c30d0cd9),
+  CONST64(0x3f597686671bb), CONST64(0x0aa587eb63999), CONST64(0x0e3c7b592c619),
+  CONST64(0x6b2916c05448c), CONST64(0x334d10aba913b), CONST64(0x045cdb581cfdb),
+  CONST64(0x5e3e0553a8f36), CONST64(0x50bb3041effb2), CONST64(0x4c303f307ff00),
+  CONST64(0x403580dd94500), CONST64(0x48df77d92653f), CONST64(0x38a9fe3b349ea),
+  CONST64(0x0ea89850aafe1), CONST64(0x416b151ab706a), CONST64(0x23bd617b28c85),
+  CONST64(0x6e72ee77d5a61), CONST64(0x1a972ff174dde), CONST64(0x3e2636373c60f),
+  CONST64(0x0d61b8f78b2ab), CONST64(0x0d7efe9c136b0), CONST64(0x1ab1c89640ad5),
+  CONST64(0x55f82aef41f97), CONST64(0x46957f317ed0d), CONST64(0x191a2af74277e),
+  CONST64(0x62b434f460efb), CONST64(0x294c6c0fad3fc), CONST64(0x68368937b4c0f),
+  CONST64(0x5c9f82910875b), CONST64(0x237e7dbe00545), CONST64(0x6f74bc53c1431),
+  CONST64(0x1c40e5dbbd9c2), CONST64(0x6c8fb9cae5c97), CONST64(0x4845c5ce1b7da),
+  CONST64(0x7e2e0e450b5cc), CONST64(0x575ed6701b430), CONST64(0x4d3e17fa20026),
+  CONST64(0x791fc888c4253), CONST64(0x2f1ba99078ac1), CONST64(0x71afa699b1115),
+  CONST64(0x23c1c473b50d6), CONST64(0x3e7671de21d48), CONST64(0x326fa5547a1e8),
+  CONST64(0x50e4dc25fafd9), CONST64(0x00731fbc78f89), CONST64(0x66f9b3953b61d),
+  CONST64(0x555f4283cccb9), CONST64(0x7dd67fb1960e7), CONST64(0x14707a1affed4),
+  CONST64(0x021142e9c2b1c), CONST64(0x0c71848f81880), CONST64(0x44bd9d8233c86),
+  CONST64(0x6e8578efe5830), CONST64(0x4045b6d7041b5), CONST64(0x4c4d6f3347e15),
+  CONST64(0x4ddfc988f1970), CONST64(0x4f6173ea365e1), CONST64(0x645daf9ae4588),
+  CONST64(0x7d43763db623b), CONST64(0x38bf9500a88f9), CONST64(0x7eccfc17d1fc9),
+  CONST64(0x4ca280782831e), CONST64(0x7b8337db1d7d6), CONST64(0x5116def3895fb),
+  CONST64(0x193fddaaa7e47), CONST64(0x2c93c37e8876f), CONST64(0x3431a28c583fa),
+  CONST64(0x49049da8bd879), CONST64(0x4b4a8407ac11c), CONST64(0x6a6fb99ebf0d4),
+  CONST64(0x122b5b6e423c6), CONST64(0x21e50dff1ddd6), CONST64(0x73d76324e75c0),
+  CONST64(0x588485495418e), CONST64(0x136fda9f42c5e), CONST64(0x6c1bb560855eb),
+  CONST64(0x71f127e13ad48), CONST64(0x5c6b304905aec), CONST64(0x3756b8e889bc7),
+  CONST64(0x75f76914a3189), CONST64(0x4dfb1a305bdd1), CONST64(0x3b3ff05811f29),
+  CONST64(0x6ed62283cd92e), CONST64(0x65d1543ec52e1), CONST64(0x022183510be8d),
+  CONST64(0x2710143307a7f), CONST64(0x3d88fb48bf3ab), CONST64(0x249eb4ec18f7a),
+  CONST64(0x136115dff295f), CONST64(0x1387c441fd404), CONST64(0x766385ead2d14),
+  CONST64(0x0194f8b06095e), CONST64(0x08478f6823b62), CONST64(0x6018689d37308),
+  CONST64(0x6a071ce17b806), CONST64(0x3c3d187978af8), CONST64(0x7afe1c88276ba),
+  CONST64(0x51df281c8ad68), CONST64(0x64906bda4245d), CONST64(0x3171b26aaf1ed),
+  CONST64(0x5b7d8b28a47d1), CONST64(0x2c2ee149e34c1), CONST64(0x776f5629afc53),
+  CONST64(0x1f4ea50fc49a9), CONST64(0x6c514a6334424), CONST64(0x7319097564ca8),
+  CONST64(0x1844ebc233525), CONST64(0x21d4543fdeee1), CONST64(0x1ad27aaff1bd2),
+  CONST64(0x221fd4873cf08), CONST64(0x2204f3a156341), CONST64(0x537414065a464),
+  CONST64(0x43c0c3bedcf83), CONST64(0x5557e706ea620), CONST64(0x48daa596fb924),
+  CONST64(0x61d5dc84c9793), CONST64(0x47de83040c29e), CONST64(0x189deb26507e7),
+  CONST64(0x4d4e6fadc479a), CONST64(0x58c837fa0e8a7), CONST64(0x28e665ca59cc7),
+  CONST64(0x165c715940dd9), CONST64(0x0785f3aa11c95), CONST64(0x57b98d7e38469),
+  CONST64(0x676dd6fccad84), CONST64(0x1688596fc9058), CONST64(0x66f6ad403619f),
+  CONST64(0x4d759a87772ef), CONST64(0x7856e6173bea4), CONST64(0x1c4f73f2c6a57),
+  CONST64(0x6706efc7c3484), CONST64(0x6987839ec366d), CONST64(0x0731f95cf7f26),
+  CONST64(0x3ae758ebce4bc), CONST64(0x70459adb7daf6), CONST64(0x24fbd305fa0bb),
+  CONST64(0x40a98cc75a1cf), CONST64(0x78ce1220a7533), CONST64(0x6217a10e1c197),
+  CONST64(0x795ac80d1bf64), CONST64(0x1db4991b42bb3), CONST64(0x469605b994372),
+  CONST64(0x631e3715c9a58), CONST64(0x7e9cfefcf728f), CONST64(0x5fe162848ce21),
+  CONST64(0x1852d5d7cb208), CONST64(0x60d0fbe5ce50f), CONST64(0x5a1e246e37b75),
+  CONST64(0x51aee05ffd590), CONST64(0x2b44c043677da), CONST64(0x1214fe194961a),
+  CONST64(0x0e1ae39a9e9cb), CONST64(0x543c8b526f9f7), CONST64(0x119498067e91d),
+  CONST64(0x4789d446fc917), CONST64(0x487ab074eb78e), CONST64(0x1d33b5e8ce343),
+  CONST64(0x13e419feb1b46), CONST64(0x2721f565de6a4), CONST64(0x60c52eef2bb9a),
+  CONST64(0x3c5c27cae6d11), CONST64(0x36a9491956e05), CONST64(0x124bac9131da6),
+  CONST64(0x3b6f7de202b5d), CONST64(0x70d77248d9b66), CONST64(0x589bc3bfd8bf1),
+  CONST64(0x6f93e6aa3416b), CONST64(0x4c0a3d6c1ae48), CONST64(0x55587260b586a),
+  CONST64(0x10bc9c312ccfc), CONST64(0x2e84b3ec2a05b), CONST64(0x69da2f03c1551),
+  CONST64(0x23a174661a67b), CONST64(0x209bca289f238), CONST64(0x63755bd3a976f),
+  CONST64(0x7101897f1acb7), CONST64(0x3d82cb77b07b8), CONST64(0x684083d7769f5),
+  CONST64(0x52b28472dce07), CONST64(0x2763751737c52), CONST64(0x7a03e2ad10853),
+  CONST64(0x213dcc6ad36ab), CONST64(0x1a6e240d5bdd6), CONST64(0x7c24ffcf8fedf),
+  CONST64(0x0d8cc1c48bc16), CONST64(0x402d36eb419a9), CONST64(0x7cef68c14a052),
+  CONST64(0x0f1255bc2d139), CONST64(0x373e7d431186a), CONST64(0x70c2dd8a7ad16),
+  CONST64(0x4967db8ed7e13), CONST64(0x15aeed02f523a), CONST64(0x6149591d094bc),
+  CONST64(0x672f204c17006), CONST64(0x32b8613816a53), CONST64(0x194509f6fec0e),
+  CONST64(0x528d8ca31acac), CONST64(0x7826d73b8b9fa), CONST64(0x24acb99e0f9b3),
+  CONST64(0x2e0fac6363948), CONST64(0x7f7bee448cd64), CONST64(0x4e10f10da0f3c),
+  CONST64(0x3936cb9ab20e9), CONST64(0x7a0fc4fea6cd0), CONST64(0x4179215c735a4),
+  CONST64(0x633b9286bcd34), CONST64(0x6cab3badb9c95), CONST64(0x74e387edfbdfa),
+  CONST64(0x14313c58a0fd9), CONST64(0x31fa85662241c), CONST64(0x094e7d7dced2a),
+  CONST64(0x068fa738e118e), CONST64(0x41b640a5fee2b), CONST64(0x6bb709df019d4),
+  CONST64(0x700344a30cd99), CONST64(0x26c422e3622f4), CONST64(0x0f3066a05b5f0),
+  CONST64(0x4e2448f0480a6), CONST64(0x244cde0dbf095), CONST64(0x24bb2312a9952),
+  CONST64(0x00c2af5f85c6b), CONST64(0x0609f4cf2883f), CONST64(0x6e86eb5a1ca13),
+  CONST64(0x68b44a2efccd1), CONST64(0x0d1d2af9ffeb5), CONST64(0x0ed1732de67c3),
+  CONST64(0x308c369291635), CONST64(0x33ef348f2d250), CONST64(0x004475ea1a1bb),
+  CONST64(0x0fee3e871e188), CONST64(0x28aa132621edf), CONST64(0x42b244caf353b),
+  CONST64(0x66b064cc2e08a), CONST64(0x6bb20020cbdd3), CONST64(0x16acd79718531),
+  CONST64(0x1c6c57887b6ad), CONST64(0x5abf21fd7592b), CONST64(0x50bd41253867a),
+  CONST64(0x3800b71273151), CONST64(0x164ed34b18161), CONST64(0x772af2d9b1d3d),
+  CONST64(0x6d486448b4e5b), CONST64(0x2ce58dd8d18a8), CONST64(0x1849f67503c8b),
+  CONST64(0x123e0ef6b9302), CONST64(0x6d94c192fe69a), CONST64(0x5475222a2690f),
+  CONST64(0x693789d86b8b3), CONST64(0x1f5c3bdfb69dc), CONST64(0x78da0fc61073f),
+  CONST64(0x780f1680c3a94), CONST64(0x2a35d3cfcd453), CONST64(0x005e5cdc7ddf8),
+  CONST64(0x6ee888078ac24), CONST64(0x054aa4b316b38), CONST64(0x15d28e52bc66a),
+  CONST64(0x30e1e0351cb7e), CONST64(0x30a2f74b11f8c), CONST64(0x39d120cd7de03),
+  CONST64(0x2d25deeb256b1), CONST64(0x0468d19267cb8), CONST64(0x38cdca9b5fbf9),
+  CONST64(0x1bbb05c2ca1e2), CONST64(0x3b015758e9533), CONST64(0x134610a6ab7da),
+  CONST64(0x265e777d1f515), CONST64(0x0f1f54c1e39a5), CONST64(0x2f01b95522646),
+  CONST64(0x4fdd8db9dde6d), CONST64(0x654878cba97cc), CONST64(0x38ec78df6b0fe),
+  CONST64(0x13caebea36a22), CONST64(0x5ebc6e54e5f6a), CONST64(0x32804903d0eb8),
+  CONST64(0x2102fdba2b20d), CONST64(0x6e405055ce6a1), CONST64(0x5024a35a532d3),
+  CONST64(0x1f69054daf29d), CONST64(0x15d1d0d7a8bd5), CONST64(0x0ad725db29ecb),
+  CONST64(0x7bc0c9b056f85), CONST64(0x51cfebffaffd8), CONST64(0x44abbe94df549),
+  CONST64(0x7ecbbd7e33121), CONST64(0x4f675f5302399), CONST64(0x267b1834e2457),
+  CONST64(0x6ae19c378bb88), CONST64(0x7457b5ed9d512), CONST64(0x3280d783d05fb),
+  CONST64(0x4aefcffb71a03), CONST64(0x536360415171e), CONST64(0x2313309077865),
+  CONST64(0x251444334afbc), CONST64(0x2b0c3853756e8), CONST64(0x0bccbb72a2a86),
+  CONST64(0x55e4c50fe1296), CONST64(0x05fdd13efc30d), CONST64(0x1c0c6c380e5ee),
+  CONST64(0x3e11de3fb62a8), CONST64(0x6678fd69108f3), CONST64(0x6962feab1a9c8),
+  CONST64(0x6aca28fb9a30b), CONST64(0x56db7ca1b9f98), CONST64(0x39f58497018dd),
+  CONST64(0x4024f0ab59d6b), CONST64(0x6fa31636863c2), CONST64(0x10ae5a67e42b0),
+  CONST64(0x27abbf01fda31), CONST64(0x380a7b9e64fbc), CONST64(0x2d42e2108ead4),
+  CONST64(0x17b0d0f537593), CONST64(0x16263c0c9842e), CONST64(0x4ab827e4539a4),
+  CONST64(0x6370ddb43d73a), CONST64(0x420bf3a79b423), CONST64(0x5131594dfd29b),
+  CONST64(0x3a627e98d52fe), CONST64(0x1154041855661), CONST64(0x19175d09f8384),
+  CONST64(0x676b2608b8d2d), CONST64(0x0ba651c5b2b47), CONST64(0x5862363701027),
+  CONST64(0x0c4d6c219c6db), CONST64(0x0f03dff8658de), CONST64(0x745d2ffa9c0cf),
+  CONST64(0x6df5721d34e6a), CONST64(0x4f32f767a0c06), CONST64(0x1d5abeac76e20),
+  CONST64(0x41ce9e104e1e4), CONST64(0x06e15be54c1dc), CONST64(0x25a1e2bc9c8bd),
+  CONST64(0x104c8f3b037ea), CONST64(0x405576fa96c98), CONST64(0x2e86a88e3876f),
+  CONST64(0x1ae23ceb960cf), CONST64(0x25d871932994a), CONST64(0x6b9d63b560b6e),
+  CONST64(0x2df2814c8d472), CONST64(0x0fbbee20aa4ed), CONST64(0x58ded861278ec),
+  CONST64(0x35ba8b6c2c9a8), CONST64(0x1dea58b3185bf), CONST64(0x4b455cd23bbbe),
+  CONST64(0x5ec19c04883f8), CONST64(0x08ba696b531d5), CONST64(0x73793f266c55c),
+  CONST64(0x0b988a9c93b02), CONST64(0x09b0ea32325db), CONST64(0x37cae71c17c5e),
+  CONST64(0x2ff39de85485f), CONST64(0x53eeec3efc57a), CONST64(0x2fa9fe9022efd),
+  CONST64(0x699c72c138154), CONST64(0x72a751ebd1ff8), CONST64(0x120633b4947cf),
+  CONST64(0x531474912100a), CONST64(0x5afcdf7c0d057), CONST64(0x7a9e71b788ded),
+  CONST64(0x5ef708f3b0c88), CONST64(0x07433be3cb393), CONST64(0x4987891610042),
+  CONST64(0x79d9d7f5d0172), CONST64(0x3c293013b9ec4), CONST64(0x0c2b85f39caca),
+  CONST64(0x35d30a99b4d59), CONST64(0x144c05ce997f4), CONST64(0x4960b8a347fef),
+  CONST64(0x1da11f15d74f7), CONST64(0x54fac19c0fead), CONST64(0x2d873ede7af6d),
+  CONST64(0x202e14e5df981), CONST64(0x2ea02bc3eb54c), CONST64(0x38875b2883564),
+  CONST64(0x1298c513ae9dd), CONST64(0x0543618a01600), CONST64(0x2316443373409),
+  CONST64(0x5de95503b22af), CONST64(0x699201beae2df), CONST64(0x3db5849ff737a),
+  CONST64(0x2e773654707fa), CONST64(0x2bdf4974c23c1), CONST64(0x4b3b9c8d261bd),
+  CONST64(0x26ae8b2a9bc28), CONST64(0x3068210165c51), CONST64(0x4b1443362d079),
+  CONST64(0x454e91c529ccb), CONST64(0x24c98c6bf72cf), CONST64(0x0486594c3d89a),
+  CONST64(0x7ae13a3d7fa3c), CONST64(0x17038418eaf66), CONST64(0x4b7c7b66e1f7a),
+  CONST64(0x4bea185efd998), CONST64(0x4fabc711055f8), CONST64(0x1fb9f7836fe38),
+  CONST64(0x582f446752da6), CONST64(0x17bd320324ce4), CONST64(0x51489117898c6),
+  CONST64(0x1684d92a0410b), CONST64(0x6e4d90f78c5a7), CONST64(0x0c2a1c4bcda28),
+  CONST64(0x4814869bd6945), CONST64(0x7b7c391a45db8), CONST64(0x57316ac35b641),
+  CONST64(0x641e31de9096a), CONST64(0x5a6a9b30a314d), CONST64(0x5c7d06f1f0447),
+  CONST64(0x7db70f80b3a49), CONST64(0x6cb4a3ec89a78), CONST64(0x43be8ad81397d),
+  CONST64(0x7c558bd1c6f64), CONST64(0x41524d396463d), CONST64(0x1586b449e1a1d),
+  CONST64(0x2f17e904aed8a), CONST64(0x7e1d2861d3c8e), CONST64(0x0404a5ca0afba),
+  CONST64(0x49e1b2a416fd1), CONST64(0x51c6a0b316c57), CONST64(0x575a59ed71bdc),
+  CONST64(0x74c021a1fec1e), CONST64(0x39527516e7f8e), CONST64(0x740070aa743d6),
+  CONST64(0x16b64cbdd1183), CONST64(0x23f4b7b32eb43), CONST64(0x319aba58235b3),
+  CONST64(0x46395bfdcadd9), CONST64(0x7db2d1a5d9a9c), CONST64(0x79a200b85422f),
+  CONST64(0x355bfaa71dd16), CONST64(0x00b77ea5f78aa), CONST64(0x76579a29e822d),
+  CONST64(0x4b51352b434f2), CONST64(0x1327bd01c2667), CONST64(0x434d73b60c8a1),
+  CONST64(0x3e0daa89443ba), CONST64(0x02c514bb2a277), CONST64(0x68e7e49c02a17),
+  CONST64(0x45795346fe8b6), CONST64(0x089306c8f3546), CONST64(0x6d89f6b2f88f6),
+  CONST64(0x43a384dc9e05b), CONST64(0x3d5da8bf1b645), CONST64(0x7ded6a96a6d09),
+  CONST64(0x6c3494fee2f4d), CONST64(0x02c989c8b6bd4), CONST64(0x1160920961548),
+  CONST64(0x05616369b4dcd), CONST64(0x4ecab86ac6f47), CONST64(0x3c60085d700b2),
+  CONST64(0x0213ee10dfcea), CONST64(0x2f637d7491e6e), CONST64(0x5166929dacfaa),
+  CONST64(0x190826b31f689), CONST64(0x4f55567694a7d), CONST64(0x705f4f7b1e522),
+  CONST64(0x351e125bc5698), CONST64(0x49b461af67bbe), CONST64(0x75915712c3a96),
+  CONST64(0x69a67ef580c0d), CONST64(0x54d38ef70cffc), CONST64(0x7f182d06e7ce2),
+  CONST64(0x54b728e217522), CONST64(0x69a90971b0128), CONST64(0x51a40f2a963a3),
+  CONST64(0x10be9ac12a6bf), CONST64(0x44acc043241c5), CONST64(0x48e64ab0168ec),
+  CONST64(0x2a2bdb8a86f4f), CONST64(0x7343b6b2d6929), CONST64(0x1d804aa8ce9a3),
+  CONST64(0x67d4ac8c343e9), CONST64(0x56bbb4f7a5777), CONST64(0x29230627c238f),
+  CONST64(0x5ad1a122cd7fb), CONST64(0x0dea56e50e364), CONST64(0x556d1c8312ad7),
+  CONST64(0x06756b11be821), CONST64(0x462147e7bb03e), CONST64(0x26519743ebfe0),
+  CONST64(0x782fc59682ab5), CONST64(0x097abe38cc8c7), CONST64(0x740e30c8d3982),
+  CONST64(0x7c2b47f4682fd), CONST64(0x5cd91b8c7dc1c), CONST64(0x77fa790f9e583),
+  CONST64(0x746c6c6d1d824), CONST64(0x1c9877ea52da4), CONST64(0x2b37b83a86189),
+  CONST64(0x733af49310da5), CONST64(0x25e81161c04fb), CONST64(0x577e14a34bee8),
+  CONST64(0x6cebebd4dd72b), CONST64(0x340c1e442329f), CONST64(0x32347ffd1a93f),
+  CONST64(0x14a89252cbbe0), CONST64(0x705304b8fb009), CONST64(0x268ac61a73b0a),
+  CONST64(0x206f234bebe1c), CONST64(0x5b403a7cbebe8), CONST64(0x7a160f09f4135),
+  CONST64(0x60fa7ee96fd78), CONST64(0x51d354d296ec6), CONST64(0x7cbf5a63b16c7),
+  CONST64(0x2f50bb3cf0c14), CONST64(0x1feb385cac65a), CONST64(0x21398e0ca1635),
+  CONST64(0x0aaf9b4b75601), CONST64(0x26b91b5ae44f3), CONST64(0x6de808d7ab1c8),
+  CONST64(0x6a769675530b0), CONST64(0x1bbfb284e98f7), CONST64(0x5058a382b33f3),
+  CONST64(0x175a91816913e), CONST64(0x4f6cdb96b8ae8), CONST64(0x17347c9da81d2),
+  CONST64(0x5aa3ed9d95a23), CONST64(0x777e9c7d96561), CONST64(0x28e58f006ccac),
+  CONST64(0x541bbbb2cac49), CONST64(0x3e63282994cec), CONST64(0x4a07e14e5e895),
+  CONST64(0x358cdc477a49b), CONST64(0x3cc88fe02e481), CONST64(0x721aab7f4e36b),
+  CONST64(0x0408cc9469953), CONST64(0x50af7aed84afa), CONST64(0x412cb980df999),
+  CONST64(0x5e78dd8ee29dc), CONST64(0x171dff68c575d), CONST64(0x2015dd2f6ef49),
+  CONST64(0x3f0bac391d313), CONST64(0x7de0115f65be5), CONST64(0x4242c21364dc9),
+  CONST64(0x6b75b64a66098), CONST64(0x0033c0102c085), CONST64(0x1921a316baebd),
+  CONST64(0x2ad9ad9f3c18b), CONST64(0x5ec1638339aeb), CONST64(0x5703b6559a83b),
+  CONST64(0x3fa9f4d05d612), CONST64(0x7b049deca062c), CONST64(0x22f7edfb870fc),
+  CONST64(0x569eed677b128), CONST64(0x30937dcb0a5af), CONST64(0x758039c78ea1b),
+  CONST64(0x6458df41e273a), CONST64(0x3e37a35444483), CONST64(0x661fdb7d27b99),
+  CONST64(0x317761dd621e4), CONST64(0x7323c30026189), CONST64(0x6093dccbc2950),
+  CONST64(0x6eebe6084034b), CONST64(0x6cf01f70a8d7b), CONST64(0x0b41a54c6670a),
+  CONST64(0x6c84b99bb55db), CONST64(0x6e3180c98b647), CONST64(0x39a8585e0706d),
+  CONST64(0x3167ce72663fe), CONST64(0x63d14ecdb4297), CONST64(0x4be21dcf970b8),
+  CONST64(0x57d1ea084827a), CONST64(0x2b6e7a128b071), CONST64(0x5b27511755dcf),
+  CONST64(0x08584c2930565), CONST64(0x68c7bda6f4159), CONST64(0x363e999ddd97b),
+  CONST64(0x048dce24baec6), CONST64(0x2b75795ec05e3), CONST64(0x3bfa4c5da6dc9),
+  CONST64(0x1aac8659e371e), CONST64(0x231f979bc6f9b), CONST64(0x043c135ee1fc4),
+  CONST64(0x2a11c9919f2d5), CONST64(0x6334cc25dbacd), CONST64(0x295da17b400da),
+  CONST64(0x48ee9b78693a0), CONST64(0x1de4bcc2af3c6), CONST64(0x61fc411a3eb86),
+  CONST64(0x53ed19ac12ec0), CONST64(0x209dbc6b804e0), CONST64(0x079bfa9b08792),
+  CONST64(0x1ed80a2d54245), CONST64(0x70efec72a5e79), CONST64(0x42151d42a822d),
+  CONST64(0x1b5ebb6d631e8), CONST64(0x1ef4fb1594706), CONST64(0x03a51da300df4),
+  CONST64(0x467b52b561c72), CONST64(0x4d5920210e590), CONST64(0x0ca769e789685),
+  CONST64(0x038c77f684817), CONST64(0x65ee65b167bec), CONST64(0x052da19b850a9),
+  CONST64(0x0408665656429), CONST64(0x7ab39596f9a4c), CONST64(0x575ee92a4a0bf),
+  CONST64(0x6bc450aa4d801), CONST64(0x4f4a6773b0ba8), CONST64(0x6241b0b0ebc48),
+  CONST64(0x40d9c4f1d9315), CONST64(0x200a1e7e382f5), CONST64(0x080908a182fcf),
+  CONST64(0x0532913b7ba98), CONST64(0x3dccf78c385c3), CONST64(0x68002dd5eaba9),
+  CONST64(0x43d4e7112cd3f), CONST64(0x5b967eaf93ac5), CONST64(0x360acca580a31),
+  CONST64(0x1c65fd5c6f262), CONST64(0x71c7f15c2ecab), CONST64(0x050eca52651e4),
+  CONST64(0x4397660e668ea), CONST64(0x7c2a75692f2f5), CONST64(0x3b29e7e6c66ef),
+  CONST64(0x72ba658bcda9a), CONST64(0x6151c09fa131a), CONST64(0x31ade453f0c9c),
+  CONST64(0x3dfee07737868), CONST64(0x611ecf7a7d411), CONST64(0x2637e6cbd64f6),
+  CONST64(0x4b0ee6c21c58f), CONST64(0x55c0dfdf05d96), CONST64(0x405569dcf475e),
+  CONST64(0x05c5c277498bb), CONST64(0x18588d95dc389), CONST64(0x1fef24fa800f0),
+  CONST64(0x2aff530976b86), CONST64(0x0d85a48c0845a), CONST64(0x796eb963642e0),
+  CONST64(0x60bee50c4b626), CONST64(0x28005fe6c8340), CONST64(0x653fb1aa73196),
+  CONST64(0x607faec8306fa), CONST64(0x4e85ec83e5254), CONST64(0x09f56900584fd),
+  CONST64(0x544d49292fc86), CONST64(0x7ba9f34528688), CONST64(0x284a20fb42d5d),
+  CONST64(0x3652cd9706ffe), CONST64(0x6fd7baddde6b3), CONST64(0x72e472930f316),
+  CONST64(0x3f635d32a7627), CONST64(0x0cbecacde00fe), CONST64(0x3411141eaa936),
+  CONST64(0x21c1e42f3cb94), CONST64(0x1fee7f000fe06), CONST64(0x5208c9781084f),
+  CONST64(0x16468a1dc24d2), CONST64(0x7bf780ac540a8), CONST64(0x1a67eced75301),
+  CONST64(0x5a9d2e8c2733a), CONST64(0x305da03dbf7e5), CONST64(0x1228699b7aeca),
+  CONST64(0x12a23b2936bc9), CONST64(0x2a1bda56ae6e9), CONST64(0x00f94051ee040),
+  CONST64(0x793bb07af9753), CONST64(0x1e7b6ecd4fafd), CONST64(0x02c7b1560fb43),
+  CONST64(0x2296734cc5fb7), CONST64(0x47b7ffd25dd40), CONST64(0x56b23c3d330b2),
+  CONST64(0x37608e360d1a6), CONST64(0x10ae0f3c8722e), CONST64(0x086d9b618b637),
+  CONST64(0x07d79c7e8beab), CONST64(0x3fb9cbc08dd12), CONST64(0x75c3dd85370ff),
+  CONST64(0x47f06fe2819ac), CONST64(0x5db06ab9215ed), CONST64(0x1c3520a35ea64),
+  CONST64(0x06f40216bc059), CONST64(0x3a2579b0fd9b5), CONST64(0x71c26407eec8c),
+  CONST64(0x72ada4ab54f0b), CONST64(0x38750c3b66d12), CONST64(0x253a6bccba34a),
+  CONST64(0x427070433701a), CONST64(0x20b8e58f9870e), CONST64(0x337c861db00cc),
+  CONST64(0x1c3d05775d0ee), CONST64(0x6f1409422e51a), CONST64(0x7856bbece2d25),
+  CONST64(0x13380a72f031c), CONST64(0x43e1080a7f3ba), CONST64(0x0621e2c7d3304),
+  CONST64(0x61796b0dbf0f3), CONST64(0x73c2f9c32d6f5), CONST64(0x6aa8ed1537ebe),
+  CONST64(0x74e92c91838f4), CONST64(0x5d8e589ca1002), CONST64(0x060cc8259838d),
+  CONST64(0x038d3f35b95f3), CONST64(0x56078c243a923), CONST64(0x2de3293241bb2),
+  CONST64(0x0007d6097bd3a), CONST64(0x71d950842a94b), CONST64(0x46b11e5c7d817),
+  CONST64(0x5478bbecb4f0d), CONST64(0x7c3054b0a1c5d), CONST64(0x1583d7783c1cb),
+  CONST64(0x34704cc9d28c7), CONST64(0x3dee598b1f200), CONST64(0x16e1c98746d9e),
+  CONST64(0x4050b7095afdf), CONST64(0x4958064e83c55), CONST64(0x6a2ef5da27ae1),
+  CONST64(0x28aace02e9d9d), CONST64(0x02459e965f0e8), CONST64(0x7b864d3150933),
+  CONST64(0x252a5f2e81ed8), CONST64(0x094265066e80d), CONST64(0x0a60f918d61a5),
+  CONST64(0x0444bf7f30fde), CONST64(0x1c40da9ed3c06), CONST64(0x079c170bd843b),
+  CONST64(0x6cd50c0d5d056), CONST64(0x5b7606ae779ba), CONST64(0x70fbd226bdda1),
+  CONST64(0x5661e53391ff9), CONST64(0x6768c0d7317b8), CONST64(0x6ece464fa6fff),
+  CONST64(0x3cc40bca460a0), CONST64(0x6e3a90afb8d0c), CONST64(0x5801abca11228),
+  CONST64(0x6dec05e34ac9f), CONST64(0x625e5f155c1b3), CONST64(0x4f32f6f723296),
+  CONST64(0x5ac980105efce), CONST64(0x17a61165eee36), CONST64(0x51445e14ddcd5),
+  CONST64(0x147ab2bbea455), CONST64(0x1f240f2253126), CONST64(0x0c3de9e314e89),
+  CONST64(0x21ea5a4fca45f), CONST64(0x12e990086e4fd), CONST64(0x02b4b3b144951),
+  CONST64(0x5688977966aea), CONST64(0x18e176e399ffd), CONST64(0x2e45c5eb4938b),
+  CONST64(0x13186f31e3929), CONST64(0x496b37fdfbb2e), CONST64(0x3c2439d5f3e21),
+  CONST64(0x16e60fe7e6a4d), CONST64(0x4d7ef889b621d), CONST64(0x77b2e3f05d3e9),
+  CONST64(0x0639c12ddb0a4), CONST64(0x6180490cd7ab3), CONST64(0x3f3918297467c),
+  CONST64(0x74568be1781ac), CONST64(0x07a195152e095), CONST64(0x7a9c59c2ec4de),
+  CONST64(0x7e9f09e79652d), CONST64(0x6a3e422f22d86), CONST64(0x2ae8e3b836c8b),
+  CONST64(0x63b795fc7ad32), CONST64(0x68f02389e5fc8), CONST64(0x059f1bc877506),
+  CONST64(0x504990e410cec), CONST64(0x09bd7d0feaee2), CONST64(0x3e8fe83d032f0),
+  CONST64(0x04c8de8efd13c), CONST64(0x1c67c06e6210e), CONST64(0x183378f7f146a),
+  CONST64(0x64352ceaed289), CONST64(0x22d60899a6258), CONST64(0x315b90570a294),
+  CONST64(0x60ce108a925f1), CONST64(0x6eff61253c909), CONST64(0x003ef0e2d70b0),
+  CONST64(0x75ba3b797fac4), CONST64(0x1dbc070cdd196), CONST64(0x16d8fb1534c47),
+  CONST64(0x500498183fa2a), CONST64(0x72f59c423de75), CONST64(0x0904d07b87779),
+  CONST64(0x22d6648f940b9), CONST64(0x197a5a1873e86), CONST64(0x207e4c41a54bc),
+  CONST64(0x5360b3b4bd6d0), CONST64(0x6240aacebaf72), CONST64(0x61fd4ddba919c),
+  CONST64(0x7d8e991b55699), CONST64(0x61b31473cc76c), CONST64(0x7039631e631d6),
+  CONST64(0x43e2143fbc1dd), CONST64(0x4749c5ba295a0), CONST64(0x37946fa4b5f06),
+  CONST64(0x724c5ab5a51f1), CONST64(0x65633789dd3f3), CONST64(0x56bdaf238db40),
+  CONST64(0x0d36cc19d3bb2), CONST64(0x6ec4470d72262), CONST64(0x6853d7018a9ae),
+  CONST64(0x3aa3e4dc2c8eb), CONST64(0x03aa31507e1e5), CONST64(0x2b9e3f53533eb),
+  CONST64(0x2add727a806c5), CONST64(0x56955c8ce15a3), CONST64(0x18c4f070a290e),
+  CONST64(0x1d24a86d83741), CONST64(0x47648ffd4ce1f), CONST64(0x60a9591839e9d),
+  CONST64(0x424d5f38117ab), CONST64(0x42cc46912c10e), CONST64(0x43b261dc9aeb4),
+  CONST64(0x13d8b6c951364), CONST64(0x4c0017e8f632a), CONST64(0x53e559e53f9c4),
+  CONST64(0x4b20146886eea), CONST64(0x02b4d5e242940), CONST64(0x31e1988bb79bb),
+  CONST64(0x7b82f46b3bcab), CONST64(0x0f7a8ce827b41), CONST64(0x5e15816177130),
+  CONST64(0x326055cf5b276), CONST64(0x155cb28d18df2), CONST64(0x0c30d9ca11694),
+  CONST64(0x2090e27ab3119), CONST64(0x208624e7a49b6), CONST64(0x27a6c809ae5d3),
+  CONST64(0x4270ac43d6954), CONST64(0x2ed4cd95659a5), CONST64(0x75c0db37528f9),
+  CONST64(0x2ccbcfd2c9234), CONST64(0x221503603d8c2), CONST64(0x6ebcd1f0db188),
+  CONST64(0x74ceb4b7d1174), CONST64(0x7d56168df4f5c), CONST64(0x0bf79176fd18a),
+  CONST64(0x2cb67174ff60a), CONST64(0x6cdf9390be1d0), CONST64(0x08e519c7e2b3d),
+  CONST64(0x253c3d2a50881), CONST64(0x21b41448e333d), CONST64(0x7b1df4b73890f),
+  CONST64(0x6221807f8f58c), CONST64(0x3fa92813a8be5), CONST64(0x6da98c38d5572),
+  CONST64(0x01ed95554468f), CONST64(0x68698245d352e), CONST64(0x2f2e0b3b2a224),
+  CONST64(0x0c56aa22c1c92), CONST64(0x5fdec39f1b278), CONST64(0x4c90af5c7f106),
+  CONST64(0x61fcef2658fc5), CONST64(0x15d852a18187a), CONST64(0x270dbb59afb76),
+  CONST64(0x7db120bcf92ab), CONST64(0x0e7a25d714087), CONST64(0x46cf4c473daf0),
+  CONST64(0x46ea7f1498140), CONST64(0x70725690a8427), CONST64(0x0a73ae9f079fb),
+  CONST64(0x2dd924461c62b), CONST64(0x1065aae50d8cc), CONST64(0x525ed9ec4e5f9),
+  CONST64(0x022d20660684c), CONST64(0x7972b70397b68), CONST64(0x7a03958d3f965),
+  CONST64(0x29387bcd14eb5), CONST64(0x44525df200d57), CONST64(0x2d7f94ce94385),
+  CONST64(0x60d00c170ecb7), CONST64(0x38b0503f3d8f0), CONST64(0x69a198e64f1ce),
+  CONST64(0x14434dcc5caed), CONST64(0x2c7909f667c20), CONST64(0x61a839d1fb576),
+  CONST64(0x4f23800cabb76), CONST64(0x25b2697bd267f), CONST64(0x2b2e0d91a78bc),
+  CONST64(0x3990a12ccf20c), CONST64(0x141c2e11f2622), CONST64(0x0dfcefaa53320),
+  CONST64(0x7369e6a92493a), CONST64(0x73ffb13986864), CONST64(0x3282bb8f713ac),
+  CONST64(0x49ced78f297ef), CONST64(0x6697027661def), CONST64(0x1420683db54e4),
+  CONST64(0x6bb6fc1cc5ad0), CONST64(0x532c8d591669d), CONST64(0x1af794da86c33),
+  CONST64(0x0e0e9d86d24d3), CONST64(0x31e83b4161d08), CONST64(0x0bd1e249dd197),
+  CONST64(0x00bcb1820568f), CONST64(0x2eab1718830d4), CONST64(0x396fd816997e6),
+  CONST64(0x60b63bebf508a), CONST64(0x0c7129e062b4f), CONST64(0x1e526415b12fd),
+  CONST64(0x461a0fd27923d), CONST64(0x18badf670a5b7), CONST64(0x55cf1eb62d550),
+  CONST64(0x6b5e37df58c52), CONST64(0x3bcf33986c60e), CONST64(0x44fb8835ceae7),
+  CONST64(0x099dec18e71a4), CONST64(0x1a56fbaa62ba0), CONST64(0x1101065c23d58),
+  CONST64(0x5aa1290338b0f), CONST64(0x3157e9e2e7421), CONST64(0x0ea712017d489),
+  CONST64(0x669a656457089), CONST64(0x66b505c9dc9ec), CONST64(0x774ef86e35287),
+  CONST64(0x4d1d944c0955e), CONST64(0x52e4c39d72b20), CONST64(0x13c4836799c58),
+  CONST64(0x4fb6a5d8bd080), CONST64(0x58ae34908589b), CONST64(0x3954d977baf13),
+  CONST64(0x413ea597441dc), CONST64(0x50bdc87dc8e5b), CONST64(0x25d465ab3e1b9),
+  CONST64(0x0f8fe27ec2847), CONST64(0x2d6e6dbf04f06), CONST64(0x3038cfc1b3276),
+  CONST64(0x66f80c93a637b), CONST64(0x537836edfe111), CONST64(0x2be02357b2c0d),
+  CONST64(0x6dcee58c8d4f8), CONST64(0x2d732581d6192), CONST64(0x1dd56444725fd),
+  CONST64(0x7e60008bac89a), CONST64(0x23d5c387c1852), CONST64(0x79e5df1f533a8),
+  CONST64(0x2e6f9f1c5f0cf), CONST64(0x3a3a450f63a30), CONST64(0x47ff83362127d),
+  CONST64(0x08e39af82b1f4), CONST64(0x488322ef27dab), CONST64(0x1973738a2a1a4),
+  CONST64(0x0e645912219f7), CONST64(0x72f31d8394627), CONST64(0x07bd294a200f1),
+  CONST64(0x665be00e274c6), CONST64(0x43de8f1b6368b), CONST64(0x318c8d9393a9a),
+  CONST64(0x69e29ab1dd398), CONST64(0x30685b3c76bac), CONST64(0x565cf37f24859),
+  CONST64(0x57b2ac28efef9), CONST64(0x509a41c325950), CONST64(0x45d032afffe19),
+  CONST64(0x12fe49b6cde4e), CONST64(0x21663bc327cf1), CONST64(0x18a5e4c69f1dd),
+  CONST64(0x224c7c679a1d5), CONST64(0x06edca6f925e9), CONST64(0x68c8363e677b8),
+  CONST64(0x60cfa25e4fbcf), CONST64(0x1c4c17609404e), CONST64(0x05bff02328a11),
+  CONST64(0x1a0dd0dc512e4), CONST64(0x10894bf5fcd10), CONST64(0x52949013f9c37),
+  CONST64(0x1f50fba4735c7), CONST64(0x576277cdee01a), CONST64(0x2137023cae00b),
+  CONST64(0x15a3599eb26c6), CONST64(0x0687221512b3c), CONST64(0x253cb3a0824e9),
+  CONST64(0x780b8cc3fa2a4), CONST64(0x38abc234f305f), CONST64(0x7a280bbc103de),
+  CONST64(0x398a836695dfe), CONST64(0x3d0af41528a1a), CONST64(0x5ff418726271b),
+  CONST64(0x347e813b69540), CONST64(0x76864c21c3cbb), CONST64(0x1e049dbcd74a8),
+  CONST64(0x5b4d60f93749c), CONST64(0x29d4db8ca0a0c), CONST64(0x6080c1789db9d),
+  CONST64(0x4be7cef1ea731), CONST64(0x2f40d769d8080), CONST64(0x35f7d4c44a603),
+  CONST64(0x106a03dc25a96), CONST64(0x50aaf333353d0), CONST64(0x4b59a613cbb35),
+  CONST64(0x223dfc0e19a76), CONST64(0x77d1e2bb2c564), CONST64(0x4ab38a51052cb),
+  CONST64(0x7d1ef5fddc09c), CONST64(0x7beeaebb9dad9), CONST64(0x058d30ba0acfb),
+  CONST64(0x5cd92eab5ae90), CONST64(0x3041c6bb04ed2), CONST64(0x42b256768d593),
+  CONST64(0x2e88459427b4f), CONST64(0x02b3876630701), CONST64(0x34878d405eae5),
+  CONST64(0x29cdd1adc088a), CONST64(0x2f2f9d956e148), CONST64(0x6b3e6ad65c1fe),
+  CONST64(0x5b00972b79e5d), CONST64(0x53d8d234c5daf), CONST64(0x104bbd6814049),
+  CONST64(0x59a5fd67ff163), CONST64(0x3a998ead0352b), CONST64(0x083c95fa4af9a),
+  CONST64(0x6fadbfc01266f), CONST64(0x204f2a20fb072), CONST64(0x0fd3168f1ed67),
+  CONST64(0x1bb0de7784a3e), CONST64(0x34bcb78b20477), CONST64(0x0a4a26e2e2182),
+  CONST64(0x5be8cc57092a7), CONST64(0x43b3d30ebb079), CONST64(0x357aca5c61902),
+  CONST64(0x5b570c5d62455), CONST64(0x30fb29e1e18c7), CONST64(0x2570fb17c2791),
+  CONST64(0x6a9550bb8245a), CONST64(0x511f20a1a2325), CONST64(0x29324d7239bee),
+  CONST64(0x3343cc37516c4), CONST64(0x241c5f91de018), CONST64(0x2367f2cb61575),
+  CONST64(0x6c39ac04d87df), CONST64(0x6d4958bd7e5bd), CONST64(0x566f4638a1532),
+  CONST64(0x3dcb65ea53030), CONST64(0x0172940de6caa), CONST64(0x6045b2e67451b),
+  CONST64(0x56c07463efcb3), CONST64(0x0728b6bfe6e91), CONST64(0x08420edd5fcdf),
+  CONST64(0x0c34e04f410ce), CONST64(0x344edc0d0a06b), CONST64(0x6e45486d84d6d),
+  CONST64(0x44e2ecb3863f5), CONST64(0x04d654f321db8), CONST64(0x720ab8362fa4a),
+  CONST64(0x29c4347cdd9bf), CONST64(0x0e798ad5f8463), CONST64(0x4fef18bcb0bfe),
+  CONST64(0x0d9a53efbc176), CONST64(0x5c116ddbdb5d5), CONST64(0x6d1b4bba5abcf),
+  CONST64(0x4d28a48a5537a), CONST64(0x56b8e5b040b99), CONST64(0x4a7a4f2618991),
+  CONST64(0x3b291af372a4b), CONST64(0x60e3028fe4498), CONST64(0x2267bca4f6a09),
+  CONST64(0x719eec242b243), CONST64(0x4a96314223e0e), CONST64(0x718025fb15f95),
+  CONST64(0x68d6b8371fe94), CONST64(0x3804448f7d97c), CONST64(0x42466fe784280),
+  CONST64(0x11b50c4cddd31), CONST64(0x0274408a4ffd6), CONST64(0x7d382aedb34dd),
+  CONST64(0x40acfc9ce385d), CONST64(0x628bb99a45b1e), CONST64(0x4f4bce4dce6bc),
+  CONST64(0x2616ec49d0b6f), CONST64(0x1f95d8462e61c), CONST64(0x1ad3e9b9159c6),
+  CONST64(0x79ba475a04df9), CONST64(0x3042cee561595), CONST64(0x7ce5ae2242584),
+  CONST64(0x2d25eb153d4e3), CONST64(0x3a8f3d09ba9c9), CONST64(0x0f3690d04eb8e),
+  CONST64(0x73fcdd14b71c0), CONST64(0x67079449bac41), CONST64(0x5b79c4621484f),
+  CONST64(0x61069f2156b8d), CONST64(0x0eb26573b10af), CONST64(0x389e740c9a9ce),
+  CONST64(0x578f6570eac28), CONST64(0x644f2339c3937), CONST64(0x66e47b7956c2c),
+  CONST64(0x34832fe1f55d0), CONST64(0x25c425e5d6263), CONST64(0x4b3ae34dcb9ce),
+  CONST64(0x47c691a15ac9f), CONST64(0x318e06e5d400c), CONST64(0x3c422d9f83eb1),
+  CONST64(0x61545379465a6), CONST64(0x606a6f1d7de6e), CONST64(0x4f1c0c46107e7),
+  CONST64(0x229b1dcfbe5d8), CONST64(0x3acc60a7b1327), CONST64(0x6539a08915484),
+  CONST64(0x4dbd414bb4a19), CONST64(0x7930849f1dbb8), CONST64(0x329c5a466caf0),
+  CONST64(0x6c824544feb9b), CONST64(0x0f65320ef019b), CONST64(0x21f74c3d2f773),
+  CONST64(0x024b88d08bd3a), CONST64(0x6e678cf054151), CONST64(0x43631272e747c),
+  CONST64(0x11c5e4aac5cd1), CONST64(0x6d1b1cafde0c6), CONST64(0x462c76a303a90),
+  CONST64(0x3ca4e693cff9b), CONST64(0x3952cd45786fd), CONST64(0x4cabc7bdec330),
+  CONST64(0x7788f3f78d289), CONST64(0x5942809b3f811), CONST64(0x5973277f8c29c),
+  CONST64(0x010f93bc5fe67), CONST64(0x7ee498165acb2), CONST64(0x69624089c0a2e),
+  CONST64(0x0075fc8e70473), CONST64(0x13e84ab1d2313), CONST64(0x2c10bedf6953b),
+  CONST64(0x639b93f0321c8), CONST64(0x508e39111a1c3), CONST64(0x290120e912f7a),
+  CONST64(0x1cbf464acae43), CONST64(0x15373e9576157), CONST64(0x0edf493c85b60),
+  CONST64(0x7c4d284764113), CONST64(0x7fefebf06acec), CONST64(0x39afb7a824100),
+  CONST64(0x1b48e47e7fd65), CONST64(0x04c00c54d1dfa), CONST64(0x48158599b5a68),
+  CONST64(0x1fd75bc41d5d9), CONST64(0x2d9fc1fa95d3c), CONST64(0x7da27f20eba11),
+  CONST64(0x403b92e3019d4), CONST64(0x22f818b465cf8), CONST64(0x342901dff09b8),
+  CONST64(0x31f595dc683cd), CONST64(0x37a57745fd682), CONST64(0x355bb12ab2617),
+  CONST64(0x1dac75a8c7318), CONST64(0x3b679d5423460), CONST64(0x6b8fcb7b6400e),
+  CONST64(0x6c73783be5f9d), CONST64(0x7518eaf8e052a), CONST64(0x664cc7493bbf4),
+  CONST64(0x33d94761874e3), CONST64(0x0179e1796f613), CONST64(0x1890535e2867d),
+  CONST64(0x0f9b8132182ec), CONST64(0x059c41b7f6c32), CONST64(0x79e8706531491),
+  CONST64(0x6c747643cb582), CONST64(0x2e20c0ad494e4), CONST64(0x47c3871bbb175),
+  CONST64(0x65d50c85066b0), CONST64(0x6167453361f7c), CONST64(0x06ba3818bb312),
+  CONST64(0x6aff29baa7522), CONST64(0x08fea02ce8d48), CONST64(0x4539771ec4f48),
+  CONST64(0x7b9318badca28), CONST64(0x70f19afe016c5), CONST64(0x4ee7bb1608d23),
+  CONST64(0x00b89b8576469), CONST64(0x5dd7668deead0), CONST64(0x4096d0ba47049),
+  CONST64(0x6275997219114), CONST64(0x29bda8a67e6ae), CONST64(0x473829a74f75d),
+  CONST64(0x1533aad3902c9), CONST64(0x1dde06b11e47b), CONST64(0x784bed1930b77),
+  CONST64(0x1c80a92b9c867), CONST64(0x6c668b4d44e4d), CONST64(0x2da754679c418),
+  CONST64(0x3164c31be105a), CONST64(0x11fac2b98ef5f), CONST64(0x35a1aaf779256),
+  CONST64(0x2078684c4833c), CONST64(0x0cf217a78820c), CONST64(0x65024e7d2e769),
+  CONST64(0x23bb5efdda82a), CONST64(0x19fd4b632d3c6), CONST64(0x7411a6054f8a4),
+  CONST64(0x2e53d18b175b4), CONST64(0x33e7254204af3), CONST64(0x3bcd7d5a1c4c5),
+  CONST64(0x4c7c22af65d0f), CONST64(0x1ec9a872458c3), CONST64(0x59d32b99dc86d),
+  CONST64(0x6ac075e22a9ac), CONST64(0x30b9220113371), CONST64(0x27fd9a638966e),
+  CONST64(0x7c136574fb813), CONST64(0x6a4d400a2509b), CONST64(0x041791056971c),
+  CONST64(0x655d5866e075c), CONST64(0x2302bf3e64df8), CONST64(0x3add88a5c7cd6),
+  CONST64(0x298d459393046), CONST64(0x30bfecb3d90b8), CONST64(0x3d9b8ea3df8d6),
+  CONST64(0x3900e96511579), CONST64(0x61ba1131a406a), CONST64(0x15770b635dcf2),
+  CONST64(0x59ecd83f79571), CONST64(0x2db461c0b7fbd), CONST64(0x73a42a981345f),
+  CONST64(0x249929fccc879), CONST64(0x0a0f116959029), CONST64(0x5974fd7b1347a),
+  CONST64(0x1e0cc1c08edad), CONST64(0x673bdf8ad1f13), CONST64(0x5620310cbbd8e),
+  CONST64(0x6b5f477e285d6), CONST64(0x4ed91ec326cc8), CONST64(0x6d6537503a3fd),
+  CONST64(0x626d3763988d5), CONST64(0x7ec846f3658ce), CONST64(0x193434934d643),
+  CONST64(0x0d4a2445eaa51), CONST64(0x7d0708ae76fe0), CONST64(0x39847b6c3c7e1),
+  CONST64(0x37676a2a4d9d9), CONST64(0x68f3f1da22ec7), CONST64(0x6ed8039a2736b),
+  CONST64(0x2627ee04c3c75), CONST64(0x6ea90a647e7d1), CONST64(0x6daaf723399b9),
+  CONST64(0x304bfacad8ea2), CONST64(0x502917d108b07), CONST64(0x043176ca6dd0f),
+  CONST64(0x5d5158f2c1d84), CONST64(0x2b5449e58eb3b), CONST64(0x27562eb3dbe47),
+  CONST64(0x291d7b4170be7), CONST64(0x5d1ca67dfa8e1), CONST64(0x2a88061f298a2),
+  CONST64(0x1304e9e71627d), CONST64(0x014d26adc9cfe), CONST64(0x7f1691ba16f13),
+  CONST64(0x5e71828f06eac), CONST64(0x349ed07f0fffc), CONST64(0x4468de2d7c2dd),
+  CONST64(0x2d8c6f86307ce), CONST64(0x6286ba1850973), CONST64(0x5e9dcb08444d4),
+  CONST64(0x1a96a543362b2), CONST64(0x5da6427e63247), CONST64(0x3355e9419469e),
+  CONST64(0x1847bb8ea8a37), CONST64(0x1fe6588cf9b71), CONST64(0x6b1c9d2db6b22),
+  CONST64(0x6cce7c6ffb44b), CONST64(0x4c688deac22ca), CONST64(0x6f775c3ff0352),
+  CONST64(0x565603ee419bb), CONST64(0x6544456c61c46), CONST64(0x58f29abfe79f2),
+  CONST64(0x264bf710ecdf6), CONST64(0x708c58527896b), CONST64(0x42ceae6c53394),
+  CONST64(0x4381b21e82b6a), CONST64(0x6af93724185b4), CONST64(0x6cfab8de73e68),
+  CONST64(0x3e6efced4bd21), CONST64(0x0056609500dbe), CONST64(0x71b7824ad85df),
+  CONST64(0x577629c4a7f41), CONST64(0x0024509c6a888), CONST64(0x2696ab12e6644),
+  CONST64(0x0cca27f4b80d8), CONST64(0x0c7c1f11b119e), CONST64(0x701f25bb0caec),
+  CONST64(0x0f6d97cbec113), CONST64(0x4ce97fb7c93a3), CONST64(0x139835a11281b),
+  CONST64(0x728907ada9156), CONST64(0x720a5bc050955), CONST64(0x0b0f8e4616ced),
+  CONST64(0x1d3c4b50fb875), CONST64(0x2f29673dc0198), CONST64(0x5f4b0f1830ffa),
+  CONST64(0x2e0c92bfbdc40), CONST64(0x709439b805a35), CONST64(0x6ec48557f8187),
+  CONST64(0x08a4d1ba13a2c), CONST64(0x076348a0bf9ae), CONST64(0x0e9b9cbb144ef),
+  CONST64(0x69bd55db1beee), CONST64(0x6e14e47f731bd), CONST64(0x1a35e47270eac),
+  CONST64(0x66f225478df8e), CONST64(0x366d44191cfd3), CONST64(0x2d48ffb5720ad),
+  CONST64(0x57b7f21a1df77), CONST64(0x5550effba0645), CONST64(0x5ec6a4098a931),
+  CONST64(0x221104eb3f337), CONST64(0x41743f2bc8c14), CONST64(0x796b0ad8773c7),
+  CONST64(0x29fee5cbb689b), CONST64(0x122665c178734), CONST64(0x4167a4e6bc593),
+  CONST64(0x62665f8ce8fee), CONST64(0x29d101ac59857), CONST64(0x4d93bbba59ffc),
+  CONST64(0x17b7897373f17), CONST64(0x34b33370cb7ed), CONST64(0x39d2876f62700),
+  CONST64(0x001cecd1d6c87), CONST64(0x7f01a11747675), CONST64(0x2350da5a18190),
+  CONST64(0x7938bb7e22552), CONST64(0x591ee8681d6cc), CONST64(0x39db0b4ea79b8),
+  CONST64(0x202220f380842), CONST64(0x2f276ba42e0ac), CONST64(0x1176fc6e2dfe6),
+  CONST64(0x0e28949770eb8), CONST64(0x5559e88147b72), CONST64(0x35e1e6e63ef30),
+  CONST64(0x35b109aa7ff6f), CONST64(0x1f6a3e54f2690), CONST64(0x76cd05b9c619b),
+  CONST64(0x69654b0901695), CONST64(0x7a53710b77f27), CONST64(0x79a1ea7d28175),
+  CONST64(0x08fc3a4c677d5), CONST64(0x4c199d30734ea), CONST64(0x6c622cb9acc14),
+  CONST64(0x5660a55030216), CONST64(0x068f1199f11fb), CONST64(0x4f2fad0116b90),
+  CONST64(0x4d91db73bb638), CONST64(0x55f82538112c5), CONST64(0x6d85a279815de),
+  CONST64(0x740b7b0cd9cf9), CONST64(0x3451995f2944e), CONST64(0x6b24194ae4e54),
+  CONST64(0x2230afded8897), CONST64(0x23412617d5071), CONST64(0x3d5d30f35969b),
+  CONST64(0x445484a4972ef), CONST64(0x2fcd09fea7d7c), CONST64(0x296126b9ed22a),
+  CONST64(0x4a171012a05b2), CONST64(0x1db92c74d5523), CONST64(0x10b89ca604289),
+  CONST64(0x141be5a45f06e), CONST64(0x5adb38becaea7), CONST64(0x3fd46db41f2bb),
+  CONST64(0x6d488bbb5ce39), CONST64(0x17d2d1d9ef0d4), CONST64(0x147499718289c),
+  CONST64(0x0a48a67e4c7ab), CONST64(0x30fbc544bafe3), CONST64(0x0c701315fe58a),
+  CONST64(0x20b878d577b75), CONST64(0x2af18073f3e6a), CONST64(0x33aea420d24fe),
+  CONST64(0x298008bf4ff94), CONST64(0x3539171db961e), CONST64(0x72214f63cc65c),
+  CONST64(0x5b7b9f43b29c9), CONST64(0x149ea31eea3b3), CONST64(0x4be7713581609),
+  CONST64(0x2d87960395e98), CONST64(0x1f24ac855a154), CONST64(0x37f405307a693),
+  CONST64(0x2e5e66cf2b69c), CONST64(0x5d84266ae9c53), CONST64(0x5e4eb7de853b9),
+  CONST64(0x5fdf48c58171c), CONST64(0x608328e9505aa), CONST64(0x22182841dc49a),
+  CONST64(0x3ec96891d2307), CONST64(0x2f363fff22e03), CONST64(0x00ba739e2ae39),
+  CONST64(0x426f5ea88bb26), CONST64(0x33092e77f75c8), CONST64(0x1a53940d819e7),
+  CONST64(0x1132e4f818613), CONST64(0x72297de7d518d), CONST64(0x698de5c8790d6),
+  CONST64(0x268b8545beb25), CONST64(0x6d2648b96fedf), CONST64(0x47988ad1db07c),
+  CONST64(0x03283a3e67ad7), CONST64(0x41dc7be0cb939), CONST64(0x1b16c66100904),
+  CONST64(0x0a24c20cbc66d), CONST64(0x4a2e9efe48681), CONST64(0x05e1296846271),
+  CONST64(0x7bbc8242c4550), CONST64(0x59a06103b35b7), CONST64(0x7237e4af32033),
+  CONST64(0x726421ab3537a), CONST64(0x78cf25d38258c), CONST64(0x2eeb32d9c495a),
+  CONST64(0x79e25772f9750), CONST64(0x6d747833bbf23), CONST64(0x6cdd816d5d749),
+  CONST64(0x39c00c9c13698), CONST64(0x66b8e31489d68), CONST64(0x573857e10e2b5),
+  CONST64(0x13be816aa1472), CONST64(0x41964d3ad4bf8), CONST64(0x006b52076b3ff),
+  CONST64(0x37e16b9ce082d), CONST64(0x1882f57853eb9), CONST64(0x7d29eacd01fc5),
+  CONST64(0x2e76a59b5e715), CONST64(0x7de2e9561a9f7), CONST64(0x0cfe19d95781c),
+  CONST64(0x312cc621c453c), CONST64(0x145ace6da077c), CONST64(0x0912bef9ce9b8),
+  CONST64(0x4d57e3443bc76), CONST64(0x0d4f4b6a55ecb), CONST64(0x7ebb0bb733bce),
+  CONST64(0x7ba6a05200549), CONST64(0x4f6ede4e22069), CONST64(0x6b2a90af1a602),
+  CONST64(0x3f3245bb2d80a), CONST64(0x0e5f720f36efd), CONST64(0x3b9cccf60c06d),
+  CONST64(0x084e323f37926), CONST64(0x465812c8276c2), CONST64(0x3f4fc9ae61e97),
+  CONST64(0x3bc07ebfa2d24), CONST64(0x3b744b55cd4a0), CONST64(0x72553b25721f3),
+  CONST64(0x5fd8f4e9d12d3), CONST64(0x3beb22a1062d9), CONST64(0x6a7063b82c9a8),
+  CONST64(0x0a5a35dc197ed), CONST64(0x3c80c06a53def), CONST64(0x05b32c2b1cb16),
+  CONST64(0x4a42c7ad58195), CONST64(0x5c8667e799eff), CONST64(0x02e5e74c850a1),
+  CONST64(0x3f0db614e869a), CONST64(0x31771a4856730), CONST64(0x05eccd24da8fd),
+  CONST64(0x580bbfdf07918), CONST64(0x7e73586873c6a), CONST64(0x74ceddf77f93e),
+  CONST64(0x3b5556a37b471), CONST64(0x0c524e14dd482), CONST64(0x283457496c656),
+  CONST64(0x0ad6bcfb6cd45), CONST64(0x375d1e8b02414), CONST64(0x4fc079d27a733),
+  CONST64(0x48b440c86c50d), CONST64(0x139929cca3b86), CONST64(0x0f8f2e44cdf2f),
+  CONST64(0x68432117ba6b2), CONST64(0x241170c2bae3c), CONST64(0x138b089bf2f7f),
+  CONST64(0x4a05bfd34ea39), CONST64(0x203914c925ef5), CONST64(0x7497fffe04e3c),
+  CONST64(0x124567cecaf98), CONST64(0x1ab860ac473b4), CONST64(0x5c0227c86a7ff),
+  CONST64(0x71b12bfc24477), CONST64(0x006a573a83075), CONST64(0x3f8612966c870),
+  CONST64(0x0fcfa36048d13), CONST64(0x66e7133bbb383), CONST64(0x64b42a8a45676),
+  CONST64(0x4ea6e4f9a85cf), CONST64(0x26f57eee878a1), CONST64(0x20cc9782a0dde),
+  CONST64(0x65d4e3070aab3), CONST64(0x7bc8e31547736), CONST64(0x09ebfb1432d98),
+  CONST64(0x504aa77679736), CONST64(0x32cd55687efb1), CONST64(0x4448f5e2f6195),
+  CONST64(0x568919d460345), CONST64(0x034c2e0ad1a27), CONST64(0x4041943d9dba3),
+  CONST64(0x17743a26caadd), CONST64(0x48c9156f9c964), CONST64(0x7ef278d1e9ad0),
+  CONST64(0x00ce58ea7bd01), CONST64(0x12d931429800d), CONST64(0x0eeba43ebcc96),
+  CONST64(0x384dd5395f878), CONST64(0x1df331a35d272), CONST64(0x207ecfd4af70e),
+  CONST64(0x1420a1d976843), CONST64(0x67799d337594f), CONST64(0x01647548f6018),
+  CONST64(0x57fce5578f145), CONST64(0x009220c142a71), CONST64(0x1b4f92314359a),
+  CONST64(0x73030a49866b1), CONST64(0x2442be90b2679), CONST64(0x77bd3d8947dcf),
+  CONST64(0x1fb55c1552028), CONST64(0x5ff191d56f9a2), CONST64(0x4109d89150951),
+  CONST64(0x225bd2d2d47cb), CONST64(0x57cc080e73bea), CONST64(0x6d71075721fcb),
+  CONST64(0x239b572a7f132), CONST64(0x6d433ac2d9068), CONST64(0x72bf930a47033),
+  CONST64(0x64facf4a20ead), CONST64(0x365f7a2b9402a), CONST64(0x020c526a758f3),
+  CONST64(0x1ef59f042cc89), CONST64(0x3b1c24976dd26), CONST64(0x31d665cb16272),
+  CONST64(0x28656e470c557), CONST64(0x452cfe0a5602c), CONST64(0x034f89ed8dbbc),
+  CONST64(0x73b8f948d8ef3), CONST64(0x786c1d323caab), CONST64(0x43bd4a9266e51),
+  CONST64(0x02aacc4615313), CONST64(0x0f7a0647877df), CONST64(0x4e1cc0f93f0d4),
+  CONST64(0x7ec4726ef1190), CONST64(0x3bdd58bf512f8), CONST64(0x4cfb7d7b304b8),
+  CONST64(0x699c29789ef12), CONST64(0x63beae321bc50), CONST64(0x325c340adbb35),
+  CONST64(0x562e1a1e42bf6), CONST64(0x5b1d4cbc434d3), CONST64(0x43d6cb89b75fe),
+  CONST64(0x3338d5b900e56), CONST64(0x38d327d531a53), CONST64(0x1b25c61d51b9f),
+  CONST64(0x14b4622b39075), CONST64(0x32615cc0a9f26), CONST64(0x57711b99cb6df),
+  CONST64(0x5a69c14e93c38), CONST64(0x6e88980a4c599), CONST64(0x2f98f71258592),
+  CONST64(0x2ae444f54a701), CONST64(0x615397afbc5c2), CONST64(0x60d7783f3f8fb),
+  CONST64(0x2aa675fc486ba), CONST64(0x1d8062e9e7614), CONST64(0x4a74cb50f9e56),
+  CONST64(0x531d1c2640192), CONST64(0x0c03d9d6c7fd2), CONST64(0x57ccd156610c1),
+  CONST64(0x3a6ae249d806a), CONST64(0x2da85a9907c5a), CONST64(0x6b23721ec4caf),
+  CONST64(0x4d2d3a4683aa2), CONST64(0x7f9c6870efdef), CONST64(0x298b8ce8aef25),
+  CONST64(0x272ea0a2165de), CONST64(0x68179ef3ed06f), CONST64(0x4e2b9c0feac1e),
+  CONST64(0x3ee290b1b63bb), CONST64(0x6ba6271803a7d), CONST64(0x27953eff70cb2),
+  CONST64(0x54f22ae0ec552), CONST64(0x29f3da92e2724), CONST64(0x242ca0c22bd18),
+  CONST64(0x34b8a8404d5ce), CONST64(0x6ecb583693335), CONST64(0x3ec76bfdfb84d),
+  CONST64(0x2c895cf56a04f), CONST64(0x6355149d54d52), CONST64(0x71d62bdd465e1),
+  CONST64(0x5b5dab1f75ef5), CONST64(0x1e2d60cbeb9a5), CONST64(0x527c2175dfe57),
+  CONST64(0x59e8a2b8ff51f), CONST64(0x1c333621262b2), CONST64(0x3cc28d378df80),
+  CONST64(0x72141f4968ca6), CONST64(0x407696bdb6d0d), CONST64(0x5d271b22ffcfb),
+  CONST64(0x74d5f317f3172), CONST64(0x7e55467d9ca81), CONST64(0x6a5653186f50d),
+  CONST64(0x6b188ece62df1), CONST64(0x4c66d36844971), CONST64(0x4aebcc4547e9d),
+  CONST64(0x08d9e7354b610), CONST64(0x26b750b6dc168), CONST64(0x162881e01acc9),
+  CONST64(0x7966df31d01a5), CONST64(0x173bd9ddc9a1d), CONST64(0x0071b276d01c9),
+  CONST64(0x0b0d8918e025e), CONST64(0x75beea79ee2eb), CONST64(0x3c92984094db8),
+  CONST64(0x5d88fbf95a3db), CONST64(0x00f1efe5872df), CONST64(0x5da872318256a),
+  CONST64(0x59ceb81635960), CONST64(0x18cf37693c764), CONST64(0x06e1cd13b19ea),
+  CONST64(0x3af629e5b0353), CONST64(0x204f1a088e8e5), CONST64(0x10efc9ceea82e),
+  CONST64(0x589863c2fa34b), CONST64(0x7f3a6a1a8d837), CONST64(0x0ad516f166f23),
+  CONST64(0x263f56d57c81a), CONST64(0x13422384638ca), CONST64(0x1331ff1af0a50),
+  CONST64(0x3080603526e16), CONST64(0x644395d3d800b), CONST64(0x2b9203dbedefc),
+  CONST64(0x4b18ce656a355), CONST64(0x03f3466bc182c), CONST64(0x30d0fded2e513),
+  CONST64(0x4971e68b84750), CONST64(0x52ccc9779f396), CONST64(0x3e904ae8255c8),
+  CONST64(0x4ecae46f39339), CONST64(0x4615084351c58), CONST64(0x14d1af21233b3),
+  CONST64(0x1de1989b39c0b), CONST64(0x52669dc6f6f9e), CONST64(0x43434b28c3fc7),
+  CONST64(0x0a9214202c099), CONST64(0x019c0aeb9a02e), CONST64(0x1a2c06995d792),
+  CONST64(0x664cbb1571c44), CONST64(0x6ff0736fa80b2), CONST64(0x3bca0d2895ca5),
+  CONST64(0x08eb69ecc01bf), CONST64(0x5b4c8912df38d), CONST64(0x5ea7f8bc2f20e),
+  CONST64(0x120e516caafaf), CONST64(0x4ea8b4038df28), CONST64(0x031bc3c5d62a4),
+  CONST64(0x7d9fe0f4c081e), CONST64(0x43ed51467f22c), CONST64(0x1e6cc0c1ed109),
+  CONST64(0x5631deddae8f1), CONST64(0x5460af1cad202), CONST64(0x0b4919dd0655d),
+  CONST64(0x7c4697d18c14c), CONST64(0x231c890bba2a4), CONST64(0x24ce0930542ca),
+  CONST64(0x7a155fdf30b85), CONST64(0x1c6c6e5d487f9), CONST64(0x24be1134bdc5a),
+  CONST64(0x1405970326f32), CONST64(0x549928a7324f4), CONST64(0x090f5fd06c106),
+  CONST64(0x6abb1021e43fd), CONST64(0x232bcfad711a0), CONST64(0x3a5c13c047f37),
+  CONST64(0x41d4e3c28a06d), CONST64(0x632a763ee1a2e), CONST64(0x6fa4bffbd5e4d),
+  CONST64(0x5fd35a6ba4792), CONST64(0x7b55e1de99de8), CONST64(0x491b66dec0dcf),
+  CONST64(0x04a8ed0da64a1), CONST64(0x5ecfc45096ebe), CONST64(0x5edee93b488b2),
+  CONST64(0x5b3c11a51bc8f), CONST64(0x4cf6b8b0b7018), CONST64(0x5b13dc7ea32a7),
+  CONST64(0x18fc2db73131e), CONST64(0x7e3651f8f57e3), CONST64(0x25656055fa965),
+  CONST64(0x08f338d0c85ee), CONST64(0x3a821991a73bd), CONST64(0x03be6418f5870),
+  CONST64(0x1ddc18eac9ef0), CONST64(0x54ce09e998dc2), CONST64(0x530d4a82eb078),
+  CONST64(0x173456c9abf9e), CONST64(0x7892015100dad), CONST64(0x33ee14095fecb),
+  CONST64(0x6ad95d67a0964), CONST64(0x0db3e7e00cbfb), CONST64(0x43630e1f94825),
+  CONST64(0x4d1956a6b4009), CONST64(0x213fe2df8b5e0), CONST64(0x05ce3a41191e6),
+  CONST64(0x65ea753f10177), CONST64(0x6fc3ee2096363), CONST64(0x7ec36b96d67ac),
+  CONST64(0x510ec6a0758b1), CONST64(0x0ed87df022109), CONST64(0x02a4ec1921e1a),
+  CONST64(0x06162f1cf795f), CONST64(0x324ddcafe5eb9), CONST64(0x018d5e0463218),
+  CONST64(0x7e78b9092428e), CONST64(0x36d12b5dec067), CONST64(0x6259a3b24b8a2),
+  CONST64(0x188b5f4170b9c), CONST64(0x681c0dee15deb), CONST64(0x4dfe665f37445),
+  CONST64(0x3d143c5112780), CONST64(0x5279179154557), CONST64(0x39f8f0741424d),
+  CONST64(0x45e6eb357923d), CONST64(0x42c9b5edb746f), CONST64(0x2ef517885ba82),
+  CONST64(0x6bffb305b2f51), CONST64(0x5b112b2d712dd), CONST64(0x35774974fe4e2),
+  CONST64(0x04af87a96e3a3), CONST64(0x57968290bb3a0), CONST64(0x7974e8c58aedc),
+  CONST64(0x7757e083488c6), CONST64(0x601c62ae7bc8b), CONST64(0x45370c2ecab74),
+  CONST64(0x2f1b78fab143a), CONST64(0x2b8430a20e101), CONST64(0x1a49e1d88fee3),
+  CONST64(0x38bbb47ce4d96), CONST64(0x1f0e7ba84d437), CONST64(0x7dc43e35dc2aa),
+  CONST64(0x02a5c273e9718), CONST64(0x32bc9dfb28b4f), CONST64(0x48df4f8d5db1a),
+  CONST64(0x54c87976c028f), CONST64(0x044fb81d82d50), CONST64(0x66665887dd9c3),
+  CONST64(0x629760a6ab0b2), CONST64(0x481e6c7243e6c), CONST64(0x097e37046fc77),
+  CONST64(0x7ef72016758cc), CONST64(0x718c5a907e3d9), CONST64(0x3b9c98c6b383b),
+  CONST64(0x006ed255eccdc), CONST64(0x6976538229a59), CONST64(0x7f79823f9c30d),
+  CONST64(0x41ff068f587ba), CONST64(0x1c00a191bcd53), CONST64(0x7b56f9c209e25),
+  CONST64(0x3781e5fccaabe), CONST64(0x64a9b0431c06d), CONST64(0x4d239a3b513e8),
+  CONST64(0x29723f51b1066), CONST64(0x642f4cf04d9c3), CONST64(0x4da095aa09b7a),
+  CONST64(0x0a4e0373d784d), CONST64(0x3d6a15b7d2919), CONST64(0x41aa75046a5d6),
+  CONST64(0x691751ec2d3da), CONST64(0x23638ab6721c4), CONST64(0x071a7d0ace183),
+  CONST64(0x4355220e14431), CONST64(0x0e1362a283981), CONST64(0x2757cd8359654),
+  CONST64(0x2e9cd7ab10d90), CONST64(0x7c69bcf761775), CONST64(0x72daac887ba0b),
+  CONST64(0x0b7f4ac5dda60), CONST64(0x3bdda2c0498a4), CONST64(0x74e67aa180160),
+  CONST64(0x2c3bcc7146ea7), CONST64(0x0d7eb04e8295f), CONST64(0x4a5ea1e6fa0fe),
+  CONST64(0x45e635c436c60), CONST64(0x28ef4a8d4d18b), CONST64(0x6f5a9a7322aca),
+  CONST64(0x1d4eba3d944be), CONST64(0x0100f15f3dce5), CONST64(0x61a700e367825),
+  CONST64(0x5922292ab3d23), CONST64(0x02ab9680ee8d3), CONST64(0x1000c2f41c6c5),
+  CONST64(0x0219fdf737174), CONST64(0x314727f127de7), CONST64(0x7e5277d23b81e),
+  CONST64(0x494e21a2e147a), CONST64(0x48a85dde50d9a), CONST64(0x1c1f734493df4),
+  CONST64(0x47bdb64866889), CONST64(0x59a7d048f8eec), CONST64(0x6b5d76cbea46b),
+  CONST64(0x141171e782522), CONST64(0x6806d26da7c1f), CONST64(0x3f31d1bc79ab9),
+  CONST64(0x09f20459f5168), CONST64(0x16fb869c03dd3), CONST64(0x7556cec0cd994),
+  CONST64(0x5eb9a03b7510a), CONST64(0x50ad1dd91cb71), CONST64(0x1aa5780b48a47),
+  CONST64(0x0ae333f685277), CONST64(0x6199733b60962), CONST64(0x69b157c266511),
+  CONST64(0x64740f893f1ca), CONST64(0x03aa408fbf684), CONST64(0x3f81e38b8f70d),
+  CONST64(0x37f355f17c824), CONST64(0x07ae85334815b), CONST64(0x7e3abddd2e48f),
+  CONST64(0x61eeabe1f45e5), CONST64(0x0ad3e2d34cded), CONST64(0x10fcc7ed9affe),
+  CONST64(0x4248cb0e96ff2), CONST64(0x4311c115172e2), CONST64(0x4c9d41cbf6925),
+  CONST64(0x50510fc104f50), CONST64(0x40fc5336e249d), CONST64(0x3386639fb2de1),
+  CONST64(0x7bbf871d17b78), CONST64(0x75f796b7e8004), CONST64(0x127c158bf0fa1),
+  CONST64(0x28fc4ae51b974), CONST64(0x26e89bfd2dbd4), CONST64(0x4e122a07665cf),
+  CONST64(0x7cab1203405c3), CONST64(0x4ed82479d167d), CONST64(0x17c422e9879a2),
+  CONST64(0x28a5946c8fec3), CONST64(0x53ab32e912b77), CONST64(0x7b44da09fe0a5),
+  CONST64(0x354ef87d07ef4), CONST64(0x3b52260c5d975), CONST64(0x79d6836171fdc),
+  CONST64(0x7d994f140d4bb), CONST64(0x1b6c404561854), CONST64(0x302d92d205392),
+  CONST64(0x46fb6e4e0f177), CONST64(0x53497ad5265b7), CONST64(0x1ebdba01386fc),
+  CONST64(0x0302f0cb36a3c), CONST64(0x0edc5f5eb426d), CONST64(0x3c1a2bca4283d),
+  CONST64(0x23430c7bb2f02), CONST64(0x1a3ea1bb58bc2), CONST64(0x7265763de5c61),
+  CONST64(0x10e5d3b76f1ca), CONST64(0x3bfd653da8e67), CONST64(0x584953ec82a8a),
+  CONST64(0x55e288fa7707b), CONST64(0x5395fc3931d81), CONST64(0x45b46c51361cb),
+  CONST64(0x54ddd8a7fe3e4), CONST64(0x2cecc41c619d3), CONST64(0x43a6562ac4d91),
+  CONST64(0x4efa5aca7bdd9), CONST64(0x5c1c0aef32122), CONST64(0x02abf314f7fa1),
+  CONST64(0x391d19e8a1528), CONST64(0x6a2fa13895fc7), CONST64(0x09d8eddeaa591),
+  CONST64(0x2177bfa36dcb7), CONST64(0x01bbcfa79db8f), CONST64(0x3d84beb3666e1),
+  CONST64(0x20c921d812204), CONST64(0x2dd843d3b32ce), CONST64(0x4ae619387d8ab),
+  CONST64(0x17e44985bfb83), CONST64(0x54e32c626cc22), CONST64(0x096412ff38118),
+  CONST64(0x6b241d61a246a), CONST64(0x75685abe5ba43), CONST64(0x3f6aa5344a32e),
+  CONST64(0x69683680f11bb), CONST64(0x04c3581f623aa), CONST64(0x701af5875cba5),
+  CONST64(0x1a00d91b17bf3), CONST64(0x60933eb61f2b2), CONST64(0x5193fe92a4dd2),
+  CONST64(0x3d995a550f43e), CONST64(0x3556fb93a883d), CONST64(0x135529b623b0e),
+  CONST64(0x716bce22e83fe), CONST64(0x33d0130b83eb8), CONST64(0x0952abad0afac),
+  CONST64(0x309f64ed31b8a), CONST64(0x5972ea051590a), CONST64(0x0dbd7add1d518),
+  CONST64(0x119f823e2231e), CONST64(0x451d66e5e7de2), CONST64(0x500c39970f838),
+  CONST64(0x79b5b81a65ca3), CONST64(0x4ac20dc8f7811), CONST64(0x29589a9f501fa),
+  CONST64(0x4d810d26a6b4a), CONST64(0x5ede00d96b259), CONST64(0x4f7e9c95905f3),
+  CONST64(0x0443d355299fe), CONST64(0x39b7d7d5aee39), CONST64(0x692519a2f34ec),
+  CONST64(0x6e4404924cf78), CONST64(0x1942eec4a144a), CONST64(0x74bbc5781302e),
+  CONST64(0x73135bb81ec4c), CONST64(0x7ef671b61483c), CONST64(0x7264614ccd729),
+  CONST64(0x31993ad92e638), CONST64(0x45319ae234992), CONST64(0x2219d47d24fb5),
+  CONST64(0x4f04488b06cf6), CONST64(0x53aaa9e724a12), CONST64(0x2a0a65314ef9c),
+  CONST64(0x61acd3c1c793a), CONST64(0x58b46b78779e6), CONST64(0x3369aacbe7af2),
+  CONST64(0x509b0743074d4), CONST64(0x055dc39b6dea1), CONST64(0x7937ff7f927c2),
+  CONST64(0x0c2fa14c6a5b6), CONST64(0x556bddb6dd07c), CONST64(0x6f6acc179d108),
+  CONST64(0x4cf6e218647c2), CONST64(0x1227cc28d5bb6), CONST64(0x78ee9bff57623),
+  CONST64(0x28cb2241f893a), CONST64(0x25b541e3c6772), CONST64(0x121a307710aa2),
+  CONST64(0x1713ec77483c9), CONST64(0x6f70572d5facb), CONST64(0x25ef34e22ff81),
+  CONST64(0x54d944f141188), CONST64(0x527bb94a6ced3), CONST64(0x35d5e9f034a97),
+  CONST64(0x126069785bc9b), CONST64(0x5474ec7854ff0), CONST64(0x296a302a348ca),
+  CONST64(0x333fc76c7a40e), CONST64(0x5992a995b482e), CONST64(0x78dc707002ac7),
+  CONST64(0x5936394d01741), CONST64(0x4fba4281aef17), CONST64(0x6b89069b20a7a),
+  CONST64(0x2fa8cb5c7db77), CONST64(0x718e6982aa810), CONST64(0x39e95f81a1a1b),
+  CONST64(0x5e794f3646cfb), CONST64(0x0473d308a7639), CONST64(0x2a0416270220d),
+  CONST64(0x75f248b69d025), CONST64(0x1cbbc16656a27), CONST64(0x5b9ffd6e26728),
+  CONST64(0x23bc2103aa73e), CONST64(0x6792603589e05), CONST64(0x248db9892595d),
+  CONST64(0x006a53cad2d08), CONST64(0x20d0150f7ba73), CONST64(0x102f73bfde043),
+  CONST64(0x4dae0b5511c9a), CONST64(0x5257fffe0d456), CONST64(0x54108d1eb2180),
+  CONST64(0x096cc0f9baefa), CONST64(0x3f6bd725da4ea), CONST64(0x0b9ab7f5745c6),
+  CONST64(0x5caf0f8d21d63), CONST64(0x7debea408ea2b), CONST64(0x09edb93896d16),
+  CONST64(0x36597d25ea5c0), CONST64(0x58d7b106058ac), CONST64(0x3cdf8d20bee69),
+  CONST64(0x00a4cb765015e), CONST64(0x36832337c7cc9), CONST64(0x7b7ecc19da60d),
+  CONST64(0x64a51a77cfa9b), CONST64(0x29cf470ca0db5), CONST64(0x4b60b6e0898d9),
+  CONST64(0x55d04ddffe6c7), CONST64(0x03bedc661bf5c), CONST64(0x2373c695c690d),
+  CONST64(0x4c0c8520dcf18), CONST64(0x384af4b7494b9), CONST64(0x4ab4a8ea22225),
+  CONST64(0x4235ad7601743), CONST64(0x0cb0d078975f5), CONST64(0x292313e530c4b),
+  CONST64(0x38dbb9124a509), CONST64(0x350d0655a11f1), CONST64(0x0e7ce2b0cdf06),
+  CONST64(0x6fedfd94b70f9), CONST64(0x2383f9745bfd4), CONST64(0x4beae27c4c301),
+  CONST64(0x75aa4416a3f3f), CONST64(0x615256138aece), CONST64(0x4643ac48c85a3),
+  CONST64(0x6878c2735b892), CONST64(0x3a53523f4d877), CONST64(0x3a504ed8bee9d),
+  CONST64(0x666e0a5d8fb46), CONST64(0x3f64e4870cb0d), CONST64(0x61548b16d6557),
+  CONST64(0x7a261773596f3), CONST64(0x7724d5f275d3a), CONST64(0x7f0bc810d514d),
+  CONST64(0x49dad737213a0), CONST64(0x745dee5d31075), CONST64(0x7b1a55e7fdbe2),
+  CONST64(0x5ba988f176ea1), CONST64(0x1d3a907ddec5a), CONST64(0x06ba426f4136f),
+  CONST64(0x3cafc0606b720), CONST64(0x518f0a2359cda), CONST64(0x5fae5e46feca7),
+  CONST64(0x0d1f8dbcf8eed), CONST64(0x693313ed081dc), CONST64(0x5b0a366901742),
+  CONST64(0x40c872ca4ca7e), CONST64(0x6f18094009e01), CONST64(0x00011b44a31bf),
+  CONST64(0x61f696a0aa75c), CONST64(0x38b0a57ad42ca), CONST64(0x1e59ab706fdc9),
+  CONST64(0x01308d46ebfcd), CONST64(0x63d988a2d2851), CONST64(0x7a06c3fc66c0c),
+  CONST64(0x1c9bac1ba47fb), CONST64(0x23935c575038e), CONST64(0x3f0bd71c59c13),
+  CONST64(0x3ac48d916e835), CONST64(0x20753afbd232e), CONST64(0x71fbb1ed06002),
+  CONST64(0x39cae47a4af3a), CONST64(0x0337c0b34d9c2), CONST64(0x33fad52b2368a),
+  CONST64(0x4c8d0c422cfe8), CONST64(0x760b4275971a5), CONST64(0x3da95bc1cad3d),
+  CONST64(0x0f151ff5b7376), CONST64(0x3cc355ccb90a7), CONST64(0x649c6c5e41e16),
+  CONST64(0x60667eee6aa80), CONST64(0x4179d182be190), CONST64(0x653d9567e6979),
+  CONST64(0x16c0f429a256d), CONST64(0x69443903e9131), CONST64(0x16f4ac6f9dd36),
+  CONST64(0x2ea4912e29253), CONST64(0x2b4643e68d25d), CONST64(0x631eaf426bae7),
+  CONST64(0x175b9a3700de8), CONST64(0x77c5f00aa48fb), CONST64(0x3917785ca0317),
+  CONST64(0x05aa9b2c79399), CONST64(0x431f2c7f665f8), CONST64(0x10410da66fe9f),
+  CONST64(0x24d82dcb4d67d), CONST64(0x3e6fe0e17752d), CONST64(0x4dade1ecbb08f),
+  CONST64(0x5599648b1ea91), CONST64(0x26344858f7b19), CONST64(0x5f43d4a295ac0),
+  CONST64(0x242a75c52acd4), CONST64(0x5934480220d10), CONST64(0x7b04715f91253),
+  CONST64(0x6c280c4e6bac6), CONST64(0x3ada3b361766e), CONST64(0x42fe5125c3b4f),
+  CONST64(0x111d84d4aac22), CONST64(0x48d0acfa57cde), CONST64(0x5bd28acf6ae43),
+  CONST64(0x16fab8f56907d), CONST64(0x7acb11218d5f2), CONST64(0x41fe02023b4db),
+  CONST64(0x59b37bf5c2f65), CONST64(0x726e47dabe671), CONST64(0x2ec45e746f6c1),
+  CONST64(0x6580e53c74686), CONST64(0x5eda104673f74), CONST64(0x16234191336d3),
+  CONST64(0x19cd61ff38640), CONST64(0x060c6c4b41ba9), CONST64(0x75cf70ca7366f),
+  CONST64(0x118a8f16c011e), CONST64(0x4a25707a203b9), CONST64(0x499def6267ff6),
+  CONST64(0x76e858108773c), CONST64(0x693cac5ddcb29), CONST64(0x00311d00a9ff4),
+  CONST64(0x2cdfdfecd5d05), CONST64(0x7668a53f6ed6a), CONST64(0x303ba2e142556),
+  CONST64(0x3880584c10909), CONST64(0x4fe20000a261d), CONST64(0x5721896d248e4),
+  CONST64(0x55091a1d0da4e), CONST64(0x4f6bfc7c1050b), CONST64(0x64e4ecd2ea9be),
+  CONST64(0x07eb1f28bbe70), CONST64(0x03c935afc4b03), CONST64(0x65517fd181bae),
+  CONST64(0x3e5772c76816d), CONST64(0x019189640898a), CONST64(0x1ed2a84de7499),
+  CONST64(0x578edd74f63c1), CONST64(0x276c6492b0c3d), CONST64(0x09bfc40bf932e),
+  CONST64(0x588e8f11f330b), CONST64(0x3d16e694dc26e), CONST64(0x3ec2ab590288c),
+  CONST64(0x13a09ae32d1cb), CONST64(0x3e81eb85ab4e4), CONST64(0x07aaca43cae1f),
+  CONST64(0x62f05d7526374), CONST64(0x0e1bf66c6adba), CONST64(0x0d27be4d87bb9),
+  CONST64(0x56c27235db434), CONST64(0x72e6e0ea62d37), CONST64(0x5674cd06ee839),
+  CONST64(0x2dd5c25a200fc), CONST64(0x3d5e9792c887e), CONST64(0x319724dabbc55),
+  CONST64(0x2b97c78680800), CONST64(0x7afdfdd34e6dd), CONST64(0x730548b35ae88),
+  CONST64(0x3094ba1d6e334), CONST64(0x6e126a7e3300b), CONST64(0x089c0aefcfbc5),
+  CONST64(0x2eea11f836583), CONST64(0x585a2277d8784), CONST64(0x551a3cba8b8ee),
+  CONST64(0x3b6422be2d886), CONST64(0x630e1419689bc), CONST64(0x4653b07a7a955),
+  CONST64(0x3043443b411db), CONST64(0x25f8233d48962), CONST64(0x6bd8f04aff431),
+  CONST64(0x4f907fd9a6312), CONST64(0x40fd3c737d29b), CONST64(0x7656278950ef9),
+  CONST64(0x073a3ea86cf9d), CONST64(0x6e0e2abfb9c2e), CONST64(0x60e2a38ea33ee),
+  CONST64(0x30b2429f3fe18), CONST64(0x28bbf484b613f), CONST64(0x3cf59d51fc8c0),
+  CONST64(0x7a0a0d6de4718), CONST64(0x55c3a3e6fb74b), CONST64(0x353135f884fd5),
+  CONST64(0x3f4160a8c1b84), CONST64(0x12f5c6f136c7c), CONST64(0x0fedba237de4c),
+  CONST64(0x779bccebfab44), CONST64(0x3aea93f4d6909), CONST64(0x1e79cb358188f),
+  CONST64(0x153d8f5e08181), CONST64(0x08533bbdb2efd), CONST64(0x1149796129431),
+  CONST64(0x17a6e36168643), CONST64(0x478ab52d39d1f), CONST64(0x436c3eef7e3f1),
+  CONST64(0x7ffd3c21f0026), CONST64(0x3e77bf20a2da9), CONST64(0x418bffc8472de),
+  CONST64(0x65d7951b3a3b3), CONST64(0x6a4d39252d159), CONST64(0x790e35900ecd4),
+  CONST64(0x30725bf977786), CONST64(0x10a5c1635a053), CONST64(0x16d87a411a212),
+  CONST64(0x4d5e2d54e0583), CONST64(0x2e5d7b33f5f74), CONST64(0x3a5de3f887ebf),
+  CONST64(0x6ef24bd6139b7), CONST64(0x1f990b577a5a6), CONST64(0x57e5a42066215),
+  CONST64(0x1a18b44983677), CONST64(0x3e652de1e6f8f), CONST64(0x6532be02ed8eb),
+  CONST64(0x28f87c8165f38), CONST64(0x44ead1be8f7d6), CONST64(0x5759d4f31f466),
+  CONST64(0x0378149f47943), CONST64(0x69f3be32b4f29), CONST64(0x45882fe1534d6),
+  CONST64(0x49929943c6fe4), CONST64(0x4347072545b15), CONST64(0x3226bced7e7c5),
+  CONST64(0x03a134ced89df), CONST64(0x7dcf843ce405f), CONST64(0x1345d757983d6),
+  CONST64(0x222f54234cccd), CONST64(0x1784a3d8adbb4), CONST64(0x36ebeee8c2bcc),
+  CONST64(0x688fe5b8f626f), CONST64(0x0d6484a4732c0), CONST64(0x7b94ac6532d92),
+  CONST64(0x5771b8754850f), CONST64(0x48dd9df1461c8), CONST64(0x6739687e73271),
+  CONST64(0x5cc9dc80c1ac0), CONST64(0x683671486d4cd), CONST64(0x76f5f1a5e8173),
+  CONST64(0x6d5d3f5f9df4a), CONST64(0x7da0b8f68d7e7), CONST64(0x02014385675a6),
+  CONST64(0x6155fb53d1def), CONST64(0x37ea32e89927c), CONST64(0x059a668f5a82e),
+  CONST64(0x46115aba1d4dc), CONST64(0x71953c3b5da76), CONST64(0x6642233d37a81),
+  CONST64(0x2c9658076b1bd), CONST64(0x5a581e63010ff), CONST64(0x5a5f887e83674),
+  CONST64(0x628d3a0a643b9), CONST64(0x01cd8640c93d2), CONST64(0x0b7b0cad70f2c),
+  CONST64(0x3864da98144be), CONST64(0x43e37ae2d5d1c), CONST64(0x301cf70a13d11),
+  CONST64(0x2a6a1ba1891ec), CONST64(0x2f291fb3f3ae0), CONST64(0x21a7b814bea52),
+  CONST64(0x3669b656e44d1), CONST64(0x63f06eda6e133), CONST64(0x233342758070f),
+  CONST64(0x098e0459cc075), CONST64(0x4df5ead6c7c1b), CONST64(0x6a21e6cd4fd5e),
+  CONST64(0x129126699b2e3), CONST64(0x0ee11a2603de8), CONST64(0x60ac2f5c74c21),
+  CONST64(0x59b192a196808), CONST64(0x45371b07001e8), CONST64(0x6170a3046e65f),
+  CONST64(0x5401a46a49e38), CONST64(0x20add5561c4a8), CONST64(0x7abb4edde9e46),
+  CONST64(0x586bf9f1a195f), CONST64(0x3088d5ef8790b), CONST64(0x38c2126fcb4db),
+  CONST64(0x685bae149e3c3), CONST64(0x0bcd601a4e930), CONST64(0x0eafb03790e52),
+  CONST64(0x0805e0f75ae1d), CONST64(0x464cc59860a28), CONST64(0x248e5b7b00bef),
+  CONST64(0x5d99675ef8f75), CONST64(0x44ae3344c5435), CONST64(0x555c13748042f),
+  CONST64(0x4d041754232c0), CONST64(0x521b430866907), CONST64(0x3308e40fb9c39),
+  CONST64(0x309acc675a02c), CONST64(0x289b9bba543ee), CONST64(0x3ab592e28539e),
+  CONST64(0x64d82abcdd83a), CONST64(0x3c78ec172e327), CONST64(0x62d5221b7f946),
+  CONST64(0x5d4263af77a3c), CONST64(0x23fdd2289aeb0), CONST64(0x7dc64f77eb9ec),
+  CONST64(0x01bd28338402c), CONST64(0x14f29a5383922), CONST64(0x4299c18d0936d),
+  CONST64(0x5914183418a49), CONST64(0x52a18c721aed5), CONST64(0x2b151ba82976d),
+  CONST64(0x5c0efde4bc754), CONST64(0x17edc25b2d7f5), CONST64(0x37336a6081bee),
+  CONST64(0x7b5318887e5c3), CONST64(0x49f6d491a5be1), CONST64(0x5e72365c7bee0),
+  CONST64(0x339062f08b33e), CONST64(0x4bbf3e657cfb2), CONST64(0x67af7f56e5967),
+  CONST64(0x4dbd67f9ed68f), CONST64(0x70b20555cb734), CONST64(0x3fc074571217f),
+  CONST64(0x3a0d29b2b6aeb), CONST64(0x06478ccdde59d), CONST64(0x55e4d051bddfa),
+  CONST64(0x77f1104c47b4e), CONST64(0x113c555112c4c), CONST64(0x7535103f9b7ca),
+  CONST64(0x140ed1d9a2108), CONST64(0x02522333bc2af), CONST64(0x0e34398f4a064),
+  CONST64(0x30b093e4b1928), CONST64(0x1ce7e7ec80312), CONST64(0x4e575bdf78f84),
+  CONST64(0x61f7a190bed39), CONST64(0x6f8aded6ca379), CONST64(0x522d93ecebde8),
+  CONST64(0x024f045e0f6cf), CONST64(0x16db63426cfa1), CONST64(0x1b93a1fd30fd8),
+  CONST64(0x5e5405368a362), CONST64(0x0123dfdb7b29a), CONST64(0x4344356523c68),
+  CONST64(0x79a527921ee5f), CONST64(0x74bfccb3e817e), CONST64(0x780de72ec8d3d),
+  CONST64(0x7eaf300f42772), CONST64(0x5455188354ce3), CONST64(0x4dcca4a3dcbac),
+  CONST64(0x3d314d0bfebcb), CONST64(0x1defc6ad32b58), CONST64(0x28545089ae7bc),
+  CONST64(0x1e38fe9a0c15c), CONST64(0x12046e0e2377b), CONST64(0x6721c560aa885),
+  CONST64(0x0eb28bf671928), CONST64(0x3be1aef5195a7), CONST64(0x6f22f62bdb5eb),
+  CONST64(0x39768b8523049), CONST64(0x43394c8fbfdbd), CONST64(0x467d201bf8dd2),
+  CONST64(0x6f4bd567ae7a9), CONST64(0x65ac89317b783), CONST64(0x07d3b20fd8932),
+  CONST64(0x000f208326916), CONST64(0x2ef9c5a5ba384), CONST64(0x6919a74ef4fad),
+  CONST64(0x59ed4611452bf), CONST64(0x691ec04ea09ef), CONST64(0x3cbcb2700e984),
+  CONST64(0x71c43c4f5ba3c), CONST64(0x56df6fa9e74cd), CONST64(0x79c95e4cf56df),
+  CONST64(0x7be643bc609e2), CONST64(0x149c12ad9e878), CONST64(0x5a758ca390c5f),
+  CONST64(0x0918b1d61dc94), CONST64(0x0d350260cd19c), CONST64(0x7a2ab4e37b4d9),
+  CONST64(0x21fea735414d7), CONST64(0x0a738027f639d), CONST64(0x72710d9462495),
+  CONST64(0x25aafaa007456), CONST64(0x2d21f28eaa31b), CONST64(0x17671ea005fd0),
+  CONST64(0x2dbae244b3eb7), CONST64(0x74a2f57ffe1cc), CONST64(0x1bc3073087301),
+  CONST64(0x7ec57f4019c34), CONST64(0x34e082e1fa524), CONST64(0x2698ca635126a),
+  CONST64(0x5702f5e3dd90e), CONST64(0x31c9a4a70c5c7), CONST64(0x136a5aa78fc24),
+  CONST64(0x1992f3b9f7b01), CONST64(0x3c004b0c4afa3), CONST64(0x5318832b0ba78),
+  CONST64(0x6f24b9ff17cec), CONST64(0x0a47f30e060c7), CONST64(0x58384540dc8d0),
+  CONST64(0x1fb43dcc49cae), CONST64(0x146ac06f4b82b), CONST64(0x4b500d89e7355),
+  CONST64(0x3351e1c728a12), CONST64(0x10b9f69932fe3), CONST64(0x6b43fd01cd1fd),
+  CONST64(0x742583e760ef3), CONST64(0x73dc1573216b8), CONST64(0x4ae48fdd7714a),
+  CONST64(0x4f85f8a13e103), CONST64(0x73420b2d6ff0d), CONST64(0x75d4b4697c544),
+  CONST64(0x11be1fff7f8f4), CONST64(0x119e16857f7e1), CONST64(0x38a14345cf5d5),
+  CONST64(0x5a68d7105b52f), CONST64(0x4f6cb9e851e06), CONST64(0x278c4471895e5),
+  CONST64(0x7efcdce3d64e4), CONST64(0x64f6d455c4b4c), CONST64(0x3db5632fea34b),
+  CONST64(0x190b1829825d5), CONST64(0x0e7d3513225c9), CONST64(0x1c12be3b7abae),
+  CONST64(0x58777781e9ca6), CONST64(0x59197ea495df2), CONST64(0x6ee2bf75dd9d8),
+  CONST64(0x6c72ceb34be8d), CONST64(0x679c9cc345ec7), CONST64(0x7898df96898a4),
+  CONST64(0x04321adf49d75), CONST64(0x16019e4e55aae), CONST64(0x74fc5f25d209c),
+  CONST64(0x4566a939ded0d), CONST64(0x66063e716e0b7), CONST64(0x45eafdc1f4d70),
+  CONST64(0x64624cfccb1ed), CONST64(0x257ab8072b6c1), CONST64(0x0120725676f0a),
+  CONST64(0x4a018d04e8eee), CONST64(0x3f73ceea5d56d), CONST64(0x401858045d72b),
+  CONST64(0x459e5e0ca2d30), CONST64(0x488b719308bea), CONST64(0x56f4a0d1b32b5),
+  CONST64(0x5a5eebc80362d), CONST64(0x7bfd10a4e8dc6), CONST64(0x7c899366736f4),
+  CONST64(0x55ebbeaf95c01), CONST64(0x46db060903f8a), CONST64(0x2605889126621),
+  CONST64(0x18e3cc676e542), CONST64(0x26079d995a990), CONST64(0x04a7c217908b2),
+  CONST64(0x1dc7603e6655a), CONST64(0x0dedfa10b2444), CONST64(0x704a68360ff04),
+  CONST64(0x3cecc3cde8b3e), CONST64(0x21cd5470f64ff), CONST64(0x6abc18d953989),
+  CONST64(0x54ad0c2e4e615), CONST64(0x367d5b82b522a), CONST64(0x0d3f4b83d7dc7),
+  CONST64(0x3067f4cdbc58d), CONST64(0x20452da697937), CONST64(0x62ecb2baa77a9),
+  CONST64(0x72836afb62874), CONST64(0x0af3c2094b240), CONST64(0x0c285297f357a),
+  CONST64(0x7cc2d5680d6e3), CONST64(0x61913d5075663), CONST64(0x5795261152b3d),
+  CONST64(0x7a1dbbafa3cbd), CONST64(0x5ad31c52588d5), CONST64(0x45f3a4164685c),
+  CONST64(0x2e59f919a966d), CONST64(0x62d361a3231da), CONST64(0x65284004e01b8),
+  CONST64(0x656533be91d60), CONST64(0x6ae016c00a89f), CONST64(0x3ddbc2a131c05),
+  CONST64(0x257a22796bb14), CONST64(0x6f360fb443e75), CONST64(0x680e47220eaea),
+  CONST64(0x2fcf2a5f10c18), CONST64(0x5ee7fb38d8320), CONST64(0x40ff9ce5ec54b),
+  CONST64(0x57185e261b35b), CONST64(0x3e254540e70a9), CONST64(0x1b5814003e3f8),
+  CONST64(0x78968314ac04b), CONST64(0x5fdcb41446a8e), CONST64(0x5286926ff2a71),
+  CONST64(0x0f231e296b3f6), CONST64(0x684a357c84693), CONST64(0x61d0633c9bca0),
+  CONST64(0x328bcf8fc73df), CONST64(0x3b4de06ff95b4), CONST64(0x30aa427ba11a5),
+  CONST64(0x5ee31bfda6d9c), CONST64(0x5b23ac2df8067), CONST64(0x44935ffdb2566),
+  CONST64(0x12f016d176c6e), CONST64(0x4fbb00f16f5ae), CONST64(0x3fab78d99402a),
+  CONST64(0x6e965fd847aed), CONST64(0x2b953ee80527b), CONST64(0x55f5bcdb1b35a),
+  CONST64(0x43a0b3fa23c66), CONST64(0x76e07388b820a), CONST64(0x79b9bbb9dd95d),
+  CONST64(0x17dae8e9f7374), CONST64(0x719f76102da33), CONST64(0x5117c2a80ca8b),
+  CONST64(0x41a66b65d0936), CONST64(0x1ba811460accb), CONST64(0x355406a3126c2),
+  CONST64(0x50d1918727d76), CONST64(0x6e5ea0b498e0e), CONST64(0x0a3b6063214f2),
+  CONST64(0x5065f158c9fd2), CONST64(0x169fb0c429954), CONST64(0x59aedd9ecee10),
+  CONST64(0x39916eb851802), CONST64(0x57917555cc538), CONST64(0x3981f39e58a4f),
+  CONST64(0x5dfa56de66fde), CONST64(0x0058809075908), CONST64(0x6d3d8cb854a94),
+  CONST64(0x5b2f4e970b1e3), CONST64(0x30f4452edcbc1), CONST64(0x38a7559230a93),
+  CONST64(0x52c1cde8ba31f), CONST64(0x2a4f2d4745a3d), CONST64(0x07e9d42d4a28a),
+  CONST64(0x38dc083705acd), CONST64(0x52782c5759740), CONST64(0x53f3397d990ad),
+  CONST64(0x3a939c7e84d15), CONST64(0x234c4227e39e0), CONST64(0x632d9a1a593f2),
+  CONST64(0x1fd11ed0c84a7), CONST64(0x021b3ed2757e1), CONST64(0x73e1de58fc1c6),
+  CONST64(0x5d110c84616ab), CONST64(0x3a5a7df28af64), CONST64(0x36b15b807cba6),
+  CONST64(0x3f78a9e1afed7), CONST64(0x0a59c2c608f1f), CONST64(0x52bdd8ecb81b7),
+  CONST64(0x0b24f48847ed4), CONST64(0x2d4be511beac7), CONST64(0x6bda4d99e5b9b),
+  CONST64(0x17e6996914e01), CONST64(0x7b1f0ce7fcf80), CONST64(0x34fcf74475481),
+  CONST64(0x31dab78cfaa98), CONST64(0x4e3216e5e54b7), CONST64(0x249823973b689),
+  CONST64(0x2584984e48885), CONST64(0x0119a3042fb37), CONST64(0x7e04c789767ca),
+  CONST64(0x1671b28cfb832), CONST64(0x7e57ea2e1c537), CONST64(0x1fbaaef444141),
+  CONST64(0x3d3bdc164dfa6), CONST64(0x2d89ce8c2177d), CONST64(0x6cd12ba182cf4),
+  CONST64(0x20a8ac19a7697), CONST64(0x539fab2cc72d9), CONST64(0x56c088f1ede20),
+  CONST64(0x35fac24f38f02), CONST64(0x7d75c6197ab03), CONST64(0x33e4bc2a42fa7),
+  CONST64(0x1c7cd10b48145), CONST64(0x038b7ea483590), CONST64(0x53d1110a86e17),
+  CONST64(0x6416eb65f466d), CONST64(0x41ca6235fce20), CONST64(0x5c3fc8a99bb12),
+  CONST64(0x09674c6b99108), CONST64(0x6f82199316ff8), CONST64(0x05d54f1a9f3e9),
+  CONST64(0x3bcc5d0bd274a), CONST64(0x5b284b8d2d5ad), CONST64(0x6e5e31025969e),
+  CONST64(0x4fb0e63066222), CONST64(0x130f59747e660), CONST64(0x041868fecd41a),
+  CONST64(0x3105e8c923bc6), CONST64(0x3058ad43d1838), CONST64(0x462f587e593fb),
+  CONST64(0x3d94ba7ce362d), CONST64(0x330f9b52667b7), CONST64(0x5d45a48e0f00a),
+  CONST64(0x08f5114789a8d), CONST64(0x40ffde57663d0), CONST64(0x71445d4c20647),
+  CONST64(0x2653e68170f7c), CONST64(0x64cdee3c55ed6), CONST64(0x26549fa4efe3d),
+  CONST64(0x68549af3f666e), CONST64(0x09e2941d4bb68), CONST64(0x2e8311f5dff3c),
+  CONST64(0x6429ef91ffbd2), CONST64(0x3a10dfe132ce3), CONST64(0x55a461e6bf9d6),
+  CONST64(0x78eeef4b02e83), CONST64(0x1d34f648c16cf), CONST64(0x07fea2aba5132),
+  CONST64(0x1926e1dc6401e), CONST64(0x74e8aea17cea0), CONST64(0x0c743f83fbc0f),
+  CONST64(0x7cb03c4bf5455), CONST64(0x68a8ba9917e98), CONST64(0x1fa1d01d861e5),
+  CONST64(0x4ac00d1df94ab), CONST64(0x3ba2101bd271b), CONST64(0x7578988b9c4af),
+  CONST64(0x0f2bf89f49f7e), CONST64(0x73fced18ee9a0), CONST64(0x055947d599832),
+  CONST64(0x346fe2aa41990), CONST64(0x0164c8079195b), CONST64(0x799ccfb7bba27),
+  CONST64(0x773563bc6a75c), CONST64(0x1e90863139cb3), CONST64(0x4f8b407d9a0d6),
+  CONST64(0x58e24ca924f69), CONST64(0x7a246bbe76456), CONST64(0x1f426b701b864),
+  CONST64(0x635c891a12552), CONST64(0x26aebd38ede2f), CONST64(0x66dc8faddae05),
+  CONST64(0x21c7d41a03786), CONST64(0x0b76bb1b3fa7e), CONST64(0x1264c41911c01),
+  CONST64(0x702f44584bdf9), CONST64(0x43c511fc68ede), CONST64(0x0482c3aed35f9),
+  CONST64(0x4e1af5271d31b), CONST64(0x0c1f97f92939b), CONST64(0x17a88956dc117),
+  CONST64(0x6ee005ef99dc7), CONST64(0x4aa9172b231cc), CONST64(0x7b6dd61eb772a),
+  CONST64(0x0abf9ab01d2c7), CONST64(0x3880287630ae6), CONST64(0x32eca045beddb),
+  CONST64(0x57f43365f32d0), CONST64(0x53fa9b659bff6), CONST64(0x5c1e850f33d92),
+  CONST64(0x1ec119ab9f6f5), CONST64(0x7f16f6de663e9), CONST64(0x7a7d6cb16dec6),
+  CONST64(0x703e9bceaf1d2), CONST64(0x4c8e994885455), CONST64(0x4ccb5da9cad82),
+  CONST64(0x3596bc610e975), CONST64(0x7a80c0ddb9f5e), CONST64(0x398d93e5c4c61),
+  CONST64(0x77c60d2e7e3f2), CONST64(0x4061051763870), CONST64(0x67bc4e0ecd2aa),
+  CONST64(0x2bb941f1373b9), CONST64(0x699c9c9002c30), CONST64(0x3d16733e248f3),
+  CONST64(0x0e2b7e14be389), CONST64(0x42c0ddaf6784a), CONST64(0x589ea1fc67850),
+  CONST64(0x53b09b5ddf191), CONST64(0x6a7235946f1cc), CONST64(0x6b99cbb2fbe60),
+  CONST64(0x6d3a5d6485c62), CONST64(0x4839466e923c0), CONST64(0x51caf30c6fcdd),
+  CONST64(0x2f99a18ac54c7), CONST64(0x398a39661ee6f), CONST64(0x384331e40cde3),
+  CONST64(0x4cd15c4de19a6), CONST64(0x12ae29c189f8e), CONST64(0x3a7427674e00a),
+  CONST64(0x6142f4f7e74c1), CONST64(0x4cc93318c3a15), CONST64(0x6d51bac2b1ee7),
+  CONST64(0x5504aa292383f), CONST64(0x6c0cb1f0d01cf), CONST64(0x187469ef5d533),
+  CONST64(0x27138883747bf), CONST64(0x2f52ae53a90e8), CONST64(0x5fd14fe958eba),
+  CONST64(0x2fe5ebf93cb8e), CONST64(0x226da8acbe788), CONST64(0x10883a2fb7ea1),
+  CONST64(0x094707842cf44), CONST64(0x7dd73f960725d), CONST64(0x42ddf2845ab2c),
+  CONST64(0x6214ffd3276bb), CONST64(0x00b8d181a5246), CONST64(0x268a6d579eb20),
+  CONST64(0x093ff26e58647), CONST64(0x524fe68059829), CONST64(0x65b75e47cb621),
+  CONST64(0x15eb0a5d5cc19), CONST64(0x05209b3929d5a), CONST64(0x2f59bcbc86b47),
+  CONST64(0x1d560b691c301), CONST64(0x7f5bafce3ce08), CONST64(0x4cd561614806c),
+  CONST64(0x4588b6170b188), CONST64(0x2aa55e3d01082), CONST64(0x47d429917135f),
+  CONST64(0x3eacfa07af070), CONST64(0x1deab46b46e44), CONST64(0x7a53f3ba46cdf),
+  CONST64(0x5458b42e2e51a), CONST64(0x192e60c07444f), CONST64(0x5ae8843a21daa),
+  CONST64(0x6d721910b1538), CONST64(0x3321a95a6417e), CONST64(0x13e9004a8a768),
+  CONST64(0x600c9193b877f), CONST64(0x21c1b8a0d7765), CONST64(0x379927fb38ea2),
+  CONST64(0x70d7679dbe01b), CONST64(0x5f46040898de9), CONST64(0x58845832fcedb),
+  CONST64(0x135cd7f0c6e73), CONST64(0x53ffbdfe8e35b), CONST64(0x22f195e06e55b),
+  CONST64(0x73937e8814bce), CONST64(0x37116297bf48d), CONST64(0x45a9e0d069720),
+  CONST64(0x25af71aa744ec), CONST64(0x41af0cb8aaba3), CONST64(0x2cf8a4e891d5e),
+  CONST64(0x5487e17d06ba2), CONST64(0x3872a032d6596), CONST64(0x65e28c09348e0),
+  CONST64(0x27b6bb2ce40c2), CONST64(0x7a6f7f2891d6a), CONST64(0x3fd8707110f67),
+  CONST64(0x26f8716a92db2), CONST64(0x1cdaa1b753027), CONST64(0x504be58b52661),
+  CONST64(0x2049bd6e58252), CONST64(0x1fd8d6a9aef49), CONST64(0x7cb67b7216fa1),
+  CONST64(0x67aff53c3b982), CONST64(0x20ea610da9628), CONST64(0x6011aadfc5459),
+  CONST64(0x6d0c802cbf890), CONST64(0x141bfed554c7b), CONST64(0x6dbb667ef4263),
+  CONST64(0x58f3126857edc), CONST64(0x69ce18b779340), CONST64(0x7926dcf95f83c),
+  CONST64(0x42e25120e2bec), CONST64(0x63de96df1fa15), CONST64(0x4f06b50f3f9cc),
+  CONST64(0x6fc5cc1b0b62f), CONST64(0x75528b29879cb), CONST64(0x79a8fd2125a3d),
+  CONST64(0x27c8d4b746ab8), CONST64(0x0f8893f02210c), CONST64(0x15596b3ae5710),
+  CONST64(0x731167e5124ca), CONST64(0x17b38e8bbe13f), CONST64(0x3d55b942f9056),
+  CONST64(0x09c1495be913f), CONST64(0x3aa4e241afb6d), CONST64(0x739d23f9179a2),
+  CONST64(0x632fadbb9e8c4), CONST64(0x7c8522bfe0c48), CONST64(0x6ed0983ef5aa9),
+  CONST64(0x0d2237687b5f4), CONST64(0x138bf2a3305f5), CONST64(0x1f45d24d86598),
+  CONST64(0x5274bad2160fe), CONST64(0x1b6041d58d12a), CONST64(0x32fcaa6e4687a),
+  CONST64(0x7a4732787ccdf), CONST64(0x11e427c7f0640), CONST64(0x03659385f8c64),
+  CONST64(0x5f4ead9766bfb), CONST64(0x746f6336c2600), CONST64(0x56e8dc57d9af5),
+  CONST64(0x5b3be17be4f78), CONST64(0x3bf928cf82f4b), CONST64(0x52e55600a6f11),
+  CONST64(0x4627e9cefebd6), CONST64(0x2f345ab6c971c), CONST64(0x653286e63e7e9),
+  CONST64(0x51061b78a23ad), CONST64(0x14999acb54501), CONST64(0x7b4917007ed66),
+  CONST64(0x41b28dd53a2dd), CONST64(0x37be85f87ea86), CONST64(0x74be3d2a85e41),
+  CONST64(0x1be87fac96ca6), CONST64(0x1d03620fe08cd), CONST64(0x5fb5cab84b064),
+  CONST64(0x2513e778285b0), CONST64(0x457383125e043), CONST64(0x6bda3b56e223d),
+  CONST64(0x122ba376f844f), CONST64(0x232cda2b4e554), CONST64(0x0422ba30ff840),
+  CONST64(0x751e7667b43f5), CONST64(0x6261755da5f3e), CONST64(0x02c70bf52b68e),
+  CONST64(0x532bf458d72e1), CONST64(0x40f96e796b59c), CONST64(0x22ef79d6f9da3),
+  CONST64(0x501ab67beca77), CONST64(0x6b0697e3feb43), CONST64(0x7ec4b5d0b2fbb),
+  CONST64(0x200e910595450), CONST64(0x742057105715e), CONST64(0x2f07022530f60),
+  CONST64(0x26334f0a409ef), CONST64(0x0f04adf62a3c0), CONST64(0x5e0edb48bb6d9),
+  CONST64(0x7c34aa4fbc003), CONST64(0x7d74e4e5cac24), CONST64(0x1cc37f43441b2),
+  CONST64(0x656f1c9ceaeb9), CONST64(0x7031cacad5aec), CONST64(0x1308cd0716c57),
+  CONST64(0x41c1373941942), CONST64(0x3a346f772f196), CONST64(0x7565a5cc7324f),
+  CONST64(0x01ca0d5244a11), CONST64(0x116b067418713), CONST64(0x0a57d8c55edae),
+  CONST64(0x6c6809c103803), CONST64(0x55112e2da6ac8), CONST64(0x6363d0a3dba5a),
+  CONST64(0x319c98ba6f40c), CONST64(0x2e84b03a36ec7), CONST64(0x05911b9f6ef7c),
+  CONST64(0x1acf3512eeaef), CONST64(0x2639839692a69), CONST64(0x669a234830507),
+  CONST64(0x68b920c0603d4), CONST64(0x555ef9d1c64b2), CONST64(0x39983f5df0ebb),
+  CONST64(0x1ea2589959826), CONST64(0x6ce638703cdd6), CONST64(0x6311678898505),
+  CONST64(0x6b3cecf9aa270), CONST64(0x770ba3b73bd08), CONST64(0x11475f7e186d4),
+  CONST64(0x0251bc9892bbc), CONST64(0x24eab9bffcc5a), CONST64(0x675f4de133817),
+  CONST64(0x7f6d93bdab31d), CONST64(0x1f3aca5bfd425), CONST64(0x2fa521c1c9760),
+  CONST64(0x62180ce27f9cd), CONST64(0x60f450b882cd3), CONST64(0x452036b1782fc),
+  CONST64(0x02d95b07681c5), CONST64(0x5901cf99205b2), CONST64(0x290686e5eecb4),
+  CONST64(0x13d99df70164c), CONST64(0x35ec321e5c0ca), CONST64(0x13ae337f44029),
+  CONST64(0x4008e813f2da7), CONST64(0x640272f8e0c3a), CONST64(0x1c06de9e55eda),
+  CONST64(0x52b40ff6d69aa), CONST64(0x31b8809377ffa), CONST64(0x536625cd14c2c),
+  CONST64(0x516af252e17d1), CONST64(0x78096f8e7d32b), CONST64(0x77ad6a33ec4e2),
+  CONST64(0x717c5dc11d321), CONST64(0x4a114559823e4), CONST64(0x306ce50a1e2b1),
+  CONST64(0x4cf38a1fec2db), CONST64(0x2aa650dfa5ce7), CONST64(0x54916a8f19415),
+  CONST64(0x00dc96fe71278), CONST64(0x55f2784e63eb8), CONST64(0x373cad3a26091),
+  CONST64(0x6a8fb89ddbbad), CONST64(0x78c35d5d97e37), CONST64(0x66e3674ef2cb2),
+  CONST64(0x34347ac53dd8f), CONST64(0x21547eda5112a), CONST64(0x4634d82c9f57c),
+  CONST64(0x4249268a6d652), CONST64(0x6336d687f2ff7), CONST64(0x4fe4f4e26d9a0),
+  CONST64(0x0040f3d945441), CONST64(0x5e939fd5986d3), CONST64(0x12a2147019bdf),
+  CONST64(0x4c466e7d09cb2), CONST64(0x6fa5b95d203dd), CONST64(0x63550a334a254),
+  CONST64(0x2584572547b49), CONST64(0x75c58811c1377), CONST64(0x4d3c637cc171b),
+  CONST64(0x33d30747d34e3), CONST64(0x39a92bafaa7d7), CONST64(0x7d6edb569cf37),
+  CONST64(0x60194a5dc2ca0), CONST64(0x5af59745e10a6), CONST64(0x7a8f53e004875),
+  CONST64(0x3eea62c7daf78), CONST64(0x4c713e693274e), CONST64(0x6ed1b7a6eb3a4),
+  CONST64(0x62ace697d8e15), CONST64(0x266b8292ab075), CONST64(0x68436a0665c9c),
+  CONST64(0x6d317e820107c), CONST64(0x090815d2ca3ca), CONST64(0x03ff1eb1499a1),
+  CONST64(0x23960f050e319), CONST64(0x5373669c91611), CONST64(0x235e8202f3f27),
+  CONST64(0x44c9f2eb61780), CONST64(0x630905b1d7003), CONST64(0x4fcc8d274ead1),
+  CONST64(0x17b6e7f68ab78), CONST64(0x014ab9a0e5257), CONST64(0x09939567f8ba5),
+  CONST64(0x4b47b2a423c82), CONST64(0x688d7e57ac42d), CONST64(0x1cb4b5a678f87),
+  CONST64(0x4aa62a2a007e7), CONST64(0x61e0e38f62d6e), CONST64(0x02f888fcc4782),
+  CONST64(0x7562b83f21c00), CONST64(0x2dc0fd2d82ef6), CONST64(0x4c06b394afc6c),
+  CONST64(0x4931b4bf636cc), CONST64(0x72b60d0322378), CONST64(0x25127c6818b25),
+  CONST64(0x330bca78de743), CONST64(0x6ff841119744e), CONST64(0x2c560e8e49305),
+  CONST64(0x7254fefe5a57a), CONST64(0x67ae2c560a7df), CONST64(0x3c31be1b369f1),
+  CONST64(0x0bc93f9cb4272), CONST64(0x3f8f9db73182d), CONST64(0x2b235eabae1c4),
+  CONST64(0x2ddbf8729551a), CONST64(0x41cec1097e7d5), CONST64(0x4864d08948aee),
+  CONST64(0x5d237438df61e), CONST64(0x2b285601f7067), CONST64(0x25dbcbae6d753),
+  CONST64(0x330b61134262d), CONST64(0x619d7a26d808a), CONST64(0x3c3b3c2adbef2),
+  CONST64(0x6877c9eec7f52), CONST64(0x3beb9ebe1b66d), CONST64(0x26b44cd91f287),
+  CONST64(0x7f29362730383), CONST64(0x7fd7951459c36), CONST64(0x7504c512d49e7),
+  CONST64(0x087ed7e3bc55f), CONST64(0x7deb10149c726), CONST64(0x048478f387475),
+  CONST64(0x69397d9678a3e), CONST64(0x67c8156c976f3), CONST64(0x2eb4d5589226c),
+  CONST64(0x2c709e6c1c10a), CONST64(0x2af6a8766ee7a), CONST64(0x08aaa79a1d96c),
+  CONST64(0x42f92d59b2fb0), CONST64(0x1752c40009c07), CONST64(0x08e68e9ff62ce),
+  CONST64(0x509d50ab8f2f9), CONST64(0x1b8ab247be5e5), CONST64(0x5d9b2e6b2e486),
+  CONST64(0x4faa5479a1339), CONST64(0x4cb13bd738f71), CONST64(0x5500a4bc130ad),
+  CONST64(0x127a17a938695), CONST64(0x02a26fa34e36d), CONST64(0x584d12e1ecc28),
+  CONST64(0x2f1f3f87eeba3), CONST64(0x48c75e515b64a), CONST64(0x75b6952071ef0),
+  CONST64(0x5d46d42965406), CONST64(0x7746106989f9f), CONST64(0x19a1e353c0ae2),
+  CONST64(0x172cdd596bdbd), CONST64(0x0731ddf881684), CONST64(0x10426d64f8115),
+  CONST64(0x71a4fd8a9a3da), CONST64(0x736bd3990266a), CONST64(0x47560bafa05c3),
+  CONST64(0x418dcabcc2fa3), CONST64(0x35991cecf8682), CONST64(0x24371a94b8c60),
+  CONST64(0x41546b11c20c3), CONST64(0x32d509334b3b4), CONST64(0x16c102cae70aa),
+  CONST64(0x1720dd51bf445), CONST64(0x5ae662faf9821), CONST64(0x412295a2b87fa),
+  CONST64(0x55261e293eac6), CONST64(0x06426759b65cc), CONST64(0x40265ae116a48),
+  CONST64(0x6c02304bae5bc), CONST64(0x0760bb8d195ad), CONST64(0x19b88f57ed6e9),
+  CONST64(0x4cdbf1904a339), CONST64(0x42b49cd4e4f2c), CONST64(0x71a2e771909d9),
+  CONST64(0x14e153ebb52d2), CONST64(0x61a17cde6818a), CONST64(0x53dad34108827),
+  CONST64(0x32b32c55c55b6), CONST64(0x2f9165f9347a3), CONST64(0x6b34be9bc33ac),
+  CONST64(0x469656571f2d3), CONST64(0x0aa61ce6f423f), CONST64(0x3f940d71b27a1),
+  CONST64(0x185f19d73d16a), CONST64(0x01b9c7b62e6dd), CONST64(0x72f643a78c0b2),
+  CONST64(0x3de45c04f9e7b), CONST64(0x706d68d30fa5c), CONST64(0x696f63e8e2f24),
+  CONST64(0x2012c18f0922d), CONST64(0x355e55ac89d29), CONST64(0x3e8b414ec7101),
+  CONST64(0x39db07c520c90), CONST64(0x6f41e9b77efe1), CONST64(0x08af5b784e4ba),
+  CONST64(0x314d289cc2c4b), CONST64(0x23450e2f1bc4e), CONST64(0x0cd93392f92f4),
+  CONST64(0x1370c6a946b7d), CONST64(0x6423c1d5afd98), CONST64(0x499dc881f2533),
+  CONST64(0x34ef26476c506), CONST64(0x4d107d2741497), CONST64(0x346c4bd6efdb3),
+  CONST64(0x32b79d71163a1), CONST64(0x5f8d9edfcb36a), CONST64(0x1e6e8dcbf3990),
+  CONST64(0x7974f348af30a), CONST64(0x6e6724ef19c7c), CONST64(0x480a5efbc13e2),
+  CONST64(0x14ce442ce221f), CONST64(0x18980a72516cc), CONST64(0x072f80db86677),
+  CONST64(0x703331fda526e), CONST64(0x24b31d47691c8), CONST64(0x1e70b01622071),
+  CONST64(0x1f163b5f8a16a), CONST64(0x56aaf341ad417), CONST64(0x7989635d830f7),
+  CONST64(0x47aa27600cb7b), CONST64(0x41eedc015f8c3), CONST64(0x7cf8d27ef854a),
+  CONST64(0x289e3584693f9), CONST64(0x04a7857b309a7), CONST64(0x545b585d14dda),
+  CONST64(0x4e4d0e3b321e1), CONST64(0x7451fe3d2ac40), CONST64(0x666f678eea98d),
+  CONST64(0x038858667fead), CONST64(0x4d22dc3e64c8d), CONST64(0x7275ea0d43a0f),
+  CONST64(0x681137dd7ccf7), CONST64(0x1e79cbab79a38), CONST64(0x22a214489a66a),
+  CONST64(0x0f62f9c332ba5), CONST64(0x46589d63b5f39), CONST64(0x7eaf979ec3f96),
+  CONST64(0x4ebe81572b9a8), CONST64(0x21b7f5d61694a), CONST64(0x1c0fa01a36371),
+  CONST64(0x02b0e8c936a50), CONST64(0x6b83b58b6cd21), CONST64(0x37ed8d3e72680),
+  CONST64(0x0a037db9f2a62), CONST64(0x4005419b1d2bc), CONST64(0x604b622943dff),
+  CONST64(0x1c899f6741a58), CONST64(0x60219e2f232fb), CONST64(0x35fae92a7f9cb),
+  CONST64(0x0fa3614f3b1ca), CONST64(0x3febdb9be82f0), CONST64(0x5e74895921400),
+  CONST64(0x553ea38822706), CONST64(0x5a17c24cfc88c), CONST64(0x1fba218aef40a),
+  CONST64(0x657043e7b0194), CONST64(0x5c11b55efe9e7), CONST64(0x7737bc6a074fb),
+  CONST64(0x0eae41ce355cc), CONST64(0x6c535d13ff776), CONST64(0x49448fac8f53e),
+  CONST64(0x34f74c6e8356a), CONST64(0x0ad780607dba2), CONST64(0x7213a7eb63eb6),
+  CONST64(0x392e3acaa8c86), CONST64(0x534e93e8a35af), CONST64(0x08b10fd02c997),
+  CONST64(0x26ac2acb81e05), CONST64(0x09d8c98ce3b79), CONST64(0x25e17fe4d50ac),
+  CONST64(0x77ff576f121a7), CONST64(0x4e5f9b0fc722b), CONST64(0x46f949b0d28c8),
+  CONST64(0x4cde65d17ef26), CONST64(0x6bba828f89698), CONST64(0x09bd71e04f676),
+  CONST64(0x25ac841f2a145), CONST64(0x1a47eac823871), CONST64(0x1a8a8c36c581a),
+  CONST64(0x255751442a9fb), CONST64(0x1bc6690fe3901), CONST64(0x314132f5abc5a),
+  CONST64(0x611835132d528), CONST64(0x5f24b8eb48a57), CONST64(0x559d504f7f6b7),
+  CONST64(0x091e7f6d266fd), CONST64(0x36060ef037389), CONST64(0x18788ec1d1286),
+  CONST64(0x287441c478eb0), CONST64(0x123ea6a3354bd), CONST64(0x38378b3eb54d5),
+  CONST64(0x4d4aaa78f94ee), CONST64(0x4a002e875a74d), CONST64(0x10b851367b17c),
+  CONST64(0x01ab12d5807e3), CONST64(0x5189041e32d96), CONST64(0x05b062b090231),
+  CONST64(0x0c91766e7b78f), CONST64(0x0aa0f55a138ec), CONST64(0x4a3961e2c918a),
+  CONST64(0x7d644f3233f1e), CONST64(0x1c69f9e02c064), CONST64(0x36ae5e5266898),
+  CONST64(0x08fc1dad38b79), CONST64(0x68aceead9bd41), CONST64(0x43be0f8e6bba0),
+  CONST64(0x68fdffc614e3b), CONST64(0x4e91dab5b3be0), CONST64(0x3b1d4c9212ff0),
+  CONST64(0x2cd6bce3fb1db), CONST64(0x4c90ef3d7c210), CONST64(0x496f5a0818716),
+  CONST64(0x79cf88cc239b8), CONST64(0x2cb9c306cf8db), CONST64(0x595760d5b508f),
+  CONST64(0x2cbebfd022790), CONST64(0x0b8822aec1105), CONST64(0x4d1cfd226bccc),
+  CONST64(0x515b2fa4971be), CONST64(0x2cb2c5df54515), CONST64(0x1bfe104aa6397),
+  CONST64(0x11494ff996c25), CONST64(0x64251623e5800), CONST64(0x0d49fc5e044be),
+  CONST64(0x709fa43edcb29), CONST64(0x25d8c63fd2aca), CONST64(0x4c5cd29dffd61),
+  CONST64(0x32ec0eb48af05), CONST64(0x18f9391f9b77c), CONST64(0x70f029ecf0c81),
+  CONST64(0x2afaa5e10b0b9), CONST64(0x61de08355254d), CONST64(0x0eb587de3c28d),
+  CONST64(0x4f0bb9f7dbbd5), CONST64(0x44eca5a2a74bd), CONST64(0x307b32eed3e33),
+  CONST64(0x6748ab03ce8c2), CONST64(0x57c0d9ab810bc), CONST64(0x42c64a224e98c),
+  CONST64(0x0b7d5d8a6c314), CONST64(0x448327b95d543), CONST64(0x0146681e3a4ba),
+  CONST64(0x38714adc34e0c), CONST64(0x4f26f0e298e30), CONST64(0x272224512c7de),
+  CONST64(0x3bb8a42a975fc), CONST64(0x6f2d5b46b17ef), CONST64(0x7b6a9223170e5),
+  CONST64(0x053713fe3b7e6), CONST64(0x19735fd7f6bc2), CONST64(0x492af49c5342e),
+  CONST64(0x2365cdf5a0357), CONST64(0x32138a7ffbb60), CONST64(0x2a1f7d14646fe),
+  CONST64(0x11b5df18a44cc), CONST64(0x390d042c84266), CONST64(0x1efe32a8fdc75),
+  CONST64(0x6925ee7ae1238), CONST64(0x4af9281d0e832), CONST64(0x0fef911191df8)
+};
+
+/* Odd multiples of the base point.  Entry i is (2 * i + 1) * B, in the
+   Ge25519Niels layout, 15 limbs each. */
+static const SilcUInt64 silc_c25519_odd_table[] = {
+  CONST64(0x493c6f58c3b85), CONST64(0x0df7181c325f7), CONST64(0x0f50b0b3e4cb7),
+  CONST64(0x5329385a44c32), CONST64(0x07cf9d3a33d4b), CONST64(0x03905d740913e),
+  CONST64(0x0ba2817d673a2), CONST64(0x23e2827f4e67c), CONST64(0x133d2e0c21a34),
+  CONST64(0x44fd2f9298f81), CONST64(0x11205877aaa68), CONST64(0x479955893d579),
+  CONST64(0x50d66309b67a0), CONST64(0x2d42d0dbee5ee), CONST64(0x6f117b689f0c6),
+  CONST64(0x5b0a84cee9730), CONST64(0x61d10c97155e4), CONST64(0x4059cc8096a10),
+  CONST64(0x47a608da8014f), CONST64(0x7a164e1b9a80f), CONST64(0x11fe8a4fcd265),
+  CONST64(0x7bcb8374faacc), CONST64(0x52f5af4ef4d4f), CONST64(0x5314098f98d10),
+  CONST64(0x2ab91587555bd), CONST64(0x6933f0dd0d889), CONST64(0x44386bb4c4295),
+  CONST64(0x3cb6d3162508c), CONST64(0x26368b872a2c6), CONST64(0x5a2826af12b9b),
+  CONST64(0x2bc4408a5bb33), CONST64(0x078ebdda05442), CONST64(0x2ffb112354123),
+  CONST64(0x375ee8df5862d), CONST64(0x2945ccf146e20), CONST64(0x182c3a447d6ba),
+  CONST64(0x22964e536eff2), CONST64(0x192821f540053), CONST64(0x2f9f19e788e5c),
+  CONST64(0x154a7e73eb1b5), CONST64(0x3dbf1812a8285), CONST64(0x0fa17ba3f9797),
+  CONST64(0x6f69cb49c3820), CONST64(0x34d5a0db3858d), CONST64(0x43aabe696b3bb),
+  CONST64(0x25cd0944ea3bf), CONST64(0x75673b81a4d63), CONST64(0x150b925d1c0d4),
+  CONST64(0x13f38d9294114), CONST64(0x461bea69283c9), CONST64(0x72c9aaa3221b1),
+  CONST64(0x267774474f74d), CONST64(0x064b0e9b28085), CONST64(0x3f04ef53b27c9),
+  CONST64(0x1d6edd5d2e531), CONST64(0x36dc801b8b3a2), CONST64(0x0e0a7d4935e30),
+  CONST64(0x1deb7cecc0d7d), CONST64(0x053a94e20dd2c), CONST64(0x7a9fbb1c6a0f9),
+  CONST64(0x6678aa6a8632f), CONST64(0x5ea3788d8b365), CONST64(0x21bd6d6994279),
+  CONST64(0x7ace75919e4e3), CONST64(0x34b9ed338add7), CONST64(0x6217e039d8064),
+  CONST64(0x6dea408337e6d), CONST64(0x57ac112628206), CONST64(0x647cb65e30473),
+  CONST64(0x49c05a51fadc9), CONST64(0x4e8bf9045af1b), CONST64(0x514e33a45e0d6),
+  CONST64(0x7533c5b8bfe0f), CONST64(0x583557b7e14c9), CONST64(0x73c172021b008),
+  CONST64(0x700848a802ade), CONST64(0x1e04605c4e5f7), CONST64(0x5c0d01b9767fb),
+  CONST64(0x7d7889f42388b), CONST64(0x4275aae2546d8), CONST64(0x75b0249864348),
+  CONST64(0x52ee11070262b), CONST64(0x237ae54fb5acd), CONST64(0x3bfd1d03aaab5),
+  CONST64(0x18ab598029d5c), CONST64(0x32cc5fd6089e9), CONST64(0x426505c949b05),
+  CONST64(0x46a18880c7ad2), CONST64(0x4a4221888ccda), CONST64(0x3dc65522b53df),
+  CONST64(0x0c222a2007f6d), CONST64(0x356b79bdb77ee), CONST64(0x41ee81efe12ce),
+  CONST64(0x120a9bd07097d), CONST64(0x234fd7eec346f), CONST64(0x7013b327fbf93),
+  CONST64(0x1336eeded6a0d), CONST64(0x2b565a2bbf3af), CONST64(0x253ce89591955),
+  CONST64(0x0267882d17602), CONST64(0x0a119732ea378), CONST64(0x63bf1ba8e2a6c),
+  CONST64(0x69f94cc90df9a), CONST64(0x431d1779bfc48), CONST64(0x497ba6fdaa097),
+  CONST64(0x6cc0313cfeaa0), CONST64(0x1a313848da499), CONST64(0x7cb534219230a),
+  CONST64(0x39596dedefd60), CONST64(0x61e22917f12de), CONST64(0x3cd86468ccf0b),
+  CONST64(0x48553221ac081), CONST64(0x6c9464b4e0a6e), CONST64(0x75fba84180403),
+  CONST64(0x43b5cd4218d05), CONST64(0x2762f9bd0b516), CONST64(0x1c6e7fbddcbb3),
+  CONST64(0x75909c3ace2bd), CONST64(0x42101972d3ec9), CONST64(0x511d61210ae4d),
+  CONST64(0x676ef950e9d81), CONST64(0x1b81ae089f258), CONST64(0x63c4922951883),
+  CONST64(0x2f1d54d9b3237), CONST64(0x6d325924ddb85), CONST64(0x386484420de87),
+  CONST64(0x2d6b25db68102), CONST64(0x650b4962873c0), CONST64(0x4081cfd271394),
+  CONST64(0x71a7fe6fe2482), CONST64(0x182b8a5c8c854), CONST64(0x73fcbe5406d8e),
+  CONST64(0x5de3430cff451), CONST64(0x554b967ac8c41), CONST64(0x4746c4b6559ee),
+  CONST64(0x77b3c6dc69a2b), CONST64(0x4edf13ec2fa6e), CONST64(0x4e85ad77beac8),
+  CONST64(0x7dba2b28e7bda), CONST64(0x5c9a51de34fe9), CONST64(0x546c864741147),
+  CONST64(0x3a1df99092690), CONST64(0x1ca8cc9f4d6bb), CONST64(0x36b7fc9cd3b03),
+  CONST64(0x219663497db5e), CONST64(0x0f1cf79f10e67), CONST64(0x43ccb0a2b7ea2),
+  CONST64(0x05089dfff776a), CONST64(0x1dd84e1d38b88), CONST64(0x4804503c60822),
+  CONST64(0x49ed02ca37fc7), CONST64(0x474c2b5957884), CONST64(0x5b8388e816683),
+  CONST64(0x4b6c454b76be4), CONST64(0x553398a516506), CONST64(0x021d23a36d175),
+  CONST64(0x4fd3373c6476d), CONST64(0x20e291eeed02a), CONST64(0x62f2ecf2e7210),
+  CONST64(0x771e098858de4), CONST64(0x2f5d278451edf), CONST64(0x730b133997342),
+  CONST64(0x6965420eb6975), CONST64(0x308a3bfa516cf), CONST64(0x5a5ed1d68ff5a),
+  CONST64(0x5122afe150e83), CONST64(0x4afc966bb0232), CONST64(0x1c478833c8268),
+  CONST64(0x17839c3fc148f), CONST64(0x44acb897d8bf9), CONST64(0x5e0c558527359),
+  CONST64(0x3395b73afd75c), CONST64(0x072afa4e4b970), CONST64(0x62214329e0f6d),
+  CONST64(0x019b60135fefd), CONST64(0x068145e134b83), CONST64(0x1e4860982c3cc),
+  CONST64(0x068fb5f13d799), CONST64(0x7c9283744547e), CONST64(0x150c49fde6ad2),
+  CONST64(0x3f29509471138), CONST64(0x729eeb4ca31cf), CONST64(0x69c22b575bfbc),
+  CONST64(0x4910857bce212), CONST64(0x6b2b5a075bb99), CONST64(0x1863c9cdca868),
+  CONST64(0x3770e295a1709), CONST64(0x0d85a3720fd13), CONST64(0x5e0ff1f71ab06),
+  CONST64(0x78a6d7791e05f), CONST64(0x7704b47a0b976), CONST64(0x2ae82e91aab17),
+  CONST64(0x50bd6429806cd), CONST64(0x68055158fd8ea), CONST64(0x725c7ffc4ad55),
+  CONST64(0x26715d1cf99b2), CONST64(0x2205441a69c88), CONST64(0x448427dcd4b54),
+  CONST64(0x1d191e88abdc5), CONST64(0x794cc9277cb1f), CONST64(0x02bf71cd098c0),
+  CONST64(0x49dabcc6cd230), CONST64(0x40a6533f905b2), CONST64(0x573efac2eb8a4),
+  CONST64(0x4cd54625f855f), CONST64(0x6c426c2ac5053), CONST64(0x5a65ece4b095e),
+  CONST64(0x0c44086f26bb6), CONST64(0x7429568197885), CONST64(0x7008357b6fcc8),
+  CONST64(0x0672738773f01), CONST64(0x752bf799f6171), CONST64(0x6b4a6dae33323),
+  CONST64(0x7b54696ead1dc), CONST64(0x06ef7e9851ad0), CONST64(0x39fbb82584a34),
+  CONST64(0x47a568f257a03), CONST64(0x14d88091ead91), CONST64(0x2145b18b1ce24),
+  CONST64(0x13a92a3669d6d), CONST64(0x3771cc0577de5), CONST64(0x3ca06bb8b9952),
+  CONST64(0x00b81c5d50390), CONST64(0x43512340780ec), CONST64(0x3c296ddf8a2af),
+  CONST64(0x515f9d914a713), CONST64(0x73191ff2255d5), CONST64(0x54f5cc2a4bdef),
+  CONST64(0x3dd57fc118bcf), CONST64(0x7a99d393490c7), CONST64(0x34d2ebb1f2541),
+  CONST64(0x0e815b723ff9d), CONST64(0x286b416e25443), CONST64(0x0bdfe38d1bee8),
+  CONST64(0x0a892c7007477), CONST64(0x2ed2436bda3e8), CONST64(0x02afd00f291ea),
+  CONST64(0x0be7381dea321), CONST64(0x3e952d4b2b193), CONST64(0x286762d28302f),
+  CONST64(0x036093ce35b25), CONST64(0x3b64d7552e9cf), CONST64(0x71ee0fe0b8460),
+  CONST64(0x69d0660c969e5), CONST64(0x32f1da046a9d9), CONST64(0x58e2bce2ef5bd),
+  CONST64(0x68ce8f78c6f8a), CONST64(0x6ee26e39261b2), CONST64(0x33d0aa50bcf9d),
+  CONST64(0x7686f2a3d6f17), CONST64(0x512a66d597c6a), CONST64(0x0609a70a57551),
+  CONST64(0x026c08a3c464c), CONST64(0x4531fc8ee39e1), CONST64(0x561305f8a9ad2),
+  CONST64(0x4978dec92aed1), CONST64(0x069adae7ca201), CONST64(0x11ee923290f55),
+  CONST64(0x69641898d916c), CONST64(0x00aaec53e35d4), CONST64(0x2cc28e7b0c0d5),
+  CONST64(0x77b60eb8a6ce4), CONST64(0x4042985c277a6), CONST64(0x636657b46d3eb),
+  CONST64(0x030a1aef2c57c), CONST64(0x1f773003ad2aa), CONST64(0x005642cc10f76),
+  CONST64(0x03b48f82cfca6), CONST64(0x2403c10ee4329), CONST64(0x20be9c1c24065),
+  CONST64(0x387d8249673a6), CONST64(0x5bea8dc927c2a), CONST64(0x5bd8ed5650ef0),
+  CONST64(0x0ef0e3fcd40e1), CONST64(0x750ab3361f0ac), CONST64(0x0e44ae2025e60),
+  CONST64(0x5f97b9727041c), CONST64(0x5683472c0ecec), CONST64(0x188882eb1ce7c),
+  CONST64(0x69764c545067e), CONST64(0x23283a2f81037), CONST64(0x477aff97e23d1),
+  CONST64(0x0b8958dbcbb68), CONST64(0x0205b97e8add6), CONST64(0x54f96b3fb7075),
+  CONST64(0x5f20429669279), CONST64(0x08fafae4941f5), CONST64(0x15d83c4eb7688),
+  CONST64(0x1cf379eca4146), CONST64(0x3d7fe9c52bb75), CONST64(0x5afc616b11ecd),
+  CONST64(0x39f4aec8f22ef), CONST64(0x3b39e1625d92e), CONST64(0x5f85bd4508873),
+  CONST64(0x78e6839fbe85d), CONST64(0x32df737b8856b), CONST64(0x0608342f14e06),
+  CONST64(0x3967889d74175), CONST64(0x1211907fba550), CONST64(0x70f268f350088),
+  CONST64(0x64583b1805f47), CONST64(0x22c1baf832cd0), CONST64(0x132c01bd4d717),
+  CONST64(0x4ecf4c3a75b8f), CONST64(0x7c0d345cfad88), CONST64(0x4112070dcf355),
+  CONST64(0x7dcff9c22e464), CONST64(0x54ada60e03325), CONST64(0x25cd98eef769a),
+  CONST64(0x404e56c039b8c), CONST64(0x71f4b8c78338a), CONST64(0x62cfc16bc2b23),
+  CONST64(0x17cf51280d9aa), CONST64(0x3bbae5e20a95a), CONST64(0x20d754762aaec),
+  CONST64(0x7c36fc73bb758), CONST64(0x4a6c797734bd1), CONST64(0x0ef248ab3950e),
+  CONST64(0x63154c9a53ec8), CONST64(0x2b8f1e46f3cee), CONST64(0x4feb135b9f543),
+  CONST64(0x63bd192ad93ae), CONST64(0x44e2ea612cdf7), CONST64(0x670f4991583ab),
+  CONST64(0x38b8ada8790b4), CONST64(0x04a9cdf51f95d), CONST64(0x5d963fbd596b8),
+  CONST64(0x22d9b68ace54a), CONST64(0x4a98e8836c599), CONST64(0x049aeb32ceba1),
+  CONST64(0x07d0b75fc7931), CONST64(0x16f4ce4ba754a), CONST64(0x5ace4c03fbe49),
+  CONST64(0x27e0ec12a159c), CONST64(0x795ee17530f67), CONST64(0x67d3c63dcfe7e),
+  CONST64(0x112f0adc81aee), CONST64(0x53df04c827165), CONST64(0x2fe5b33b430f0),
+  CONST64(0x51c665e0c8d62), CONST64(0x25b0a52ecbd81), CONST64(0x5dc0695fce4a9),
+  CONST64(0x3b928c575047d), CONST64(0x23bf3512686e5), CONST64(0x6cd19bf49dc54),
+  CONST64(0x6612165afc386), CONST64(0x1171aa36203ff), CONST64(0x2642ea820a8aa),
+  CONST64(0x1f3bb7b313f10), CONST64(0x5e01b3a7429e4), CONST64(0x7619052179ca3),
+  CONST64(0x0c16593f0afd0), CONST64(0x265c4795c7428), CONST64(0x31c40515d5442),
+  CONST64(0x7520f3db40b2e), CONST64(0x50be3d39357a1), CONST64(0x3ab33d294a7b6),
+  CONST64(0x4c479ba59edb3), CONST64(0x4c30d184d326f), CONST64(0x71092c9ccef3c),
+  CONST64(0x3d8ac74051dcf), CONST64(0x10ab6f543d0ad), CONST64(0x5d0f3ac0fda90),
+  CONST64(0x5ef1d2573e5e4), CONST64(0x4173a5bb7137a), CONST64(0x0523f0364918c),
+  CONST64(0x687f56d638a7b), CONST64(0x20796928ad013), CONST64(0x5d38405a54f33),
+  CONST64(0x0ea15b03d0257), CONST64(0x56e31f0f9218a), CONST64(0x5635f88e102f8),
+  CONST64(0x2cbc5d969a5b8), CONST64(0x533fbc98b347a), CONST64(0x5fc565614a4e3),
+  CONST64(0x2e1e67790988e), CONST64(0x1e38b9ae44912), CONST64(0x648fbb4075654),
+  CONST64(0x28df1d840cd72), CONST64(0x3214c7409d466), CONST64(0x6570dc46d7ae5),
+  CONST64(0x18a9f1b91e26d), CONST64(0x436b6183f42ab), CONST64(0x550acaa4f8198),
+  CONST64(0x62711c414c454), CONST64(0x1827406651770), CONST64(0x4d144f286c265),
+  CONST64(0x17488f0ee9281), CONST64(0x19e6cdb5c760c), CONST64(0x5bea94073ecb8),
+  CONST64(0x0ce63f343d2f8), CONST64(0x1e0a87d1e368e), CONST64(0x045edbc019eea),
+  CONST64(0x6979aed28d0d1), CONST64(0x4ad0785944f1b), CONST64(0x5bf0912c89be4),
+  CONST64(0x62fadcaf38c83), CONST64(0x25ec196b3ce2c), CONST64(0x77655ff4f017b),
+  CONST64(0x3aacd5c148f61), CONST64(0x63b34c3318301), CONST64(0x0e0e62d04d0b1),
+  CONST64(0x676a233726701), CONST64(0x29e9a042d9769), CONST64(0x3aff0cb1d9028),
+  CONST64(0x6430bf4c53505), CONST64(0x264c3e4507244), CONST64(0x74c9f19a39270),
+  CONST64(0x73f84f799bc47), CONST64(0x2ccf9f732bd99), CONST64(0x5c7eb3a20405e),
+  CONST64(0x5fdb5aad930f8), CONST64(0x4a757e63b8c47), CONST64(0x28e9492972456),
+  CONST64(0x110e7e86f4cd2), CONST64(0x0d89ed603f5e4), CONST64(0x51e1604018af8),
+  CONST64(0x0b8eedc4a2218), CONST64(0x51ba98b9384d0), CONST64(0x05c557e0b9693),
+  CONST64(0x6bbb089c20eb0), CONST64(0x6df41fb0b9eee), CONST64(0x51087ed87e16f),
+  CONST64(0x102db5c9fa731), CONST64(0x289fef0841861), CONST64(0x1ce311fc97e6f),
+  CONST64(0x6023f3fb5db1f), CONST64(0x7b49775e8fc98), CONST64(0x3ad70adbf5045),
+  CONST64(0x6e154c178fe98), CONST64(0x16336fed69abf), CONST64(0x4f066b929f9ec),
+  CONST64(0x4e9ff9e6c5b93), CONST64(0x18c89bc4bb2ba), CONST64(0x6afbf642a95ca),
+  CONST64(0x55070f913a8cc), CONST64(0x765619eac2bbc), CONST64(0x3ab5225f47459),
+  CONST64(0x76ced14ab5b48), CONST64(0x12c093cedb801), CONST64(0x0de0c62f5d2c1),
+  CONST64(0x49601cf734fb5), CONST64(0x6b5c38263f0f6), CONST64(0x4623ef5b56d06),
+  CONST64(0x0db4b851b9503), CONST64(0x47f9308b8190f), CONST64(0x414235c621f82),
+  CONST64(0x31f5ff41a5a76), CONST64(0x6736773aab96d), CONST64(0x33aa8799c6635),
+  CONST64(0x0f588fc156cb1), CONST64(0x363414da4f069), CONST64(0x7296ad9b68aea),
+  CONST64(0x4d3711316ae43), CONST64(0x212cd0c1c8d58), CONST64(0x7f51ebd085cf2),
+  CONST64(0x12cfa67e3f5e1), CONST64(0x1800cf1e3d46a), CONST64(0x54337615ff0a8),
+  CONST64(0x233c6f29e8e21), CONST64(0x4d5107f18c781), CONST64(0x64a4fd3a51a5e),
+  CONST64(0x4f4cd0448bb37), CONST64(0x671d38543151e), CONST64(0x1db7778911914),
+  CONST64(0x14769dd701ab6), CONST64(0x28339f1b4b667), CONST64(0x4ab214b8ae37b),
+  CONST64(0x25f0aefa0b0fe), CONST64(0x7ae2ca8a017d2), CONST64(0x352397c6bc26f),
+  CONST64(0x18a7aa0227bbe), CONST64(0x5e68cc1ea5f8b), CONST64(0x6fe3e3a7a1d5f),
+  CONST64(0x31ad97ad26e2a), CONST64(0x017ed0920b962), CONST64(0x187e33b53b6fd),
+  CONST64(0x55829907a1463), CONST64(0x641f248e0a792), CONST64(0x1ed1fc53a6622),
+  CONST64(0x642a61c092d2d), CONST64(0x31937e711d17f), CONST64(0x4dc4bedcd4122),
+  CONST64(0x2569f0c8b3ddf), CONST64(0x503d664a57aa2), CONST64(0x1e98e4d89f26e),
+  CONST64(0x510ae16fcfe97), CONST64(0x2171172ce0b7c), CONST64(0x55191edbf3682),
+  CONST64(0x5b12b36f28bc0), CONST64(0x3395b90a91537), CONST64(0x6f9e6fcbe5943),
+  CONST64(0x23a2feae6ea0f), CONST64(0x4718c95011f06), CONST64(0x36906685e9a1f),
+  CONST64(0x4be3c4fd8781d), CONST64(0x242716afc8a89), CONST64(0x16cf4e4bf3c77),
+  CONST64(0x1d2f593f7325f), CONST64(0x355dccf04805c), CONST64(0x10dd8b8699e48),
+  CONST64(0x7463aeb8f8d63), CONST64(0x760856e91c033), CONST64(0x0cf2b008ee055),
+  CONST64(0x5b1112708474b), CONST64(0x5984dcb3c75db), CONST64(0x4eafecacff977),
+  CONST64(0x16606587ed97b), CONST64(0x7b2d89c5ac45b), CONST64(0x584587b225ae4),
+  CONST64(0x5c10f66a67ed6), CONST64(0x5997232f8890a), CONST64(0x2c8862e13ad85),
+  CONST64(0x62a45a7ffe9c0), CONST64(0x05e27ba4b982a), CONST64(0x3a363f12f57a6),
+  CONST64(0x36677857dc672), CONST64(0x6016edd50d745), CONST64(0x777eda40c0454),
+  CONST64(0x3d8918fb87d11), CONST64(0x6a67d1e5a864d), CONST64(0x61bc54210c7e0),
+  CONST64(0x5a0ab3f96bab6), CONST64(0x2ed35b0884775), CONST64(0x7f8f3424d64a5),
+  CONST64(0x24807b24886af), CONST64(0x3d8885fbc4f63), CONST64(0x115953e5523b4),
+  CONST64(0x132d7a918d23d), CONST64(0x7e755cba0310f), CONST64(0x6293624794ed1),
+  CONST64(0x0ed1e1ed161da), CONST64(0x08ef30fb86fc3), CONST64(0x362557eff0b67),
+  CONST64(0x0caa7059c3235), CONST64(0x44f52761a3023), CONST64(0x104d2decd135f),
+  CONST64(0x791656699386a), CONST64(0x11871237a067e), CONST64(0x4536c2aee70b3),
+  CONST64(0x3eff321ccb9c3), CONST64(0x68ca42af7119c), CONST64(0x58c5a2e68e2fd),
+  CONST64(0x3d9ee302ff687), CONST64(0x6a15d0f5ca449), CONST64(0x1a302599db7fa),
+  CONST64(0x6fe05f844dc03), CONST64(0x1c40635bad39c), CONST64(0x238ff0dfc297f),
+  CONST64(0x7bbdf8041ba47), CONST64(0x5e1f109bfa8d5), CONST64(0x73c44389e11c1),
+  CONST64(0x25e21637093ab), CONST64(0x5bd7d979ccd1b), CONST64(0x55c206d4035cd),
+  CONST64(0x7faad90de7625), CONST64(0x3c286391c6144), CONST64(0x529672e089f46),
+  CONST64(0x61287ccedae10), CONST64(0x5cd6b3922ee71), CONST64(0x38159b8443d37),
+  CONST64(0x55ad9ec9f2e2a), CONST64(0x47a7bf00acf6d), CONST64(0x75c2cce0a6006),
+  CONST64(0x278fc8bcd74e9), CONST64(0x4a994d633ebc7), CONST64(0x5cf46f4f7de07),
+  CONST64(0x33450af844449), CONST64(0x21429fa184f70), CONST64(0x468615291ab88),
+  CONST64(0x03851d54ceb6f), CONST64(0x559bfad6ce588), CONST64(0x389e4afb488a7),
+  CONST64(0x242fa5690a98c), CONST64(0x5523e2f353889), CONST64(0x1099c54a5efd2),
+  CONST64(0x41e0af3f2ee34), CONST64(0x753ef3fd7141a), CONST64(0x6e9ee0c59c789),
+  CONST64(0x636db66a5894e), CONST64(0x2536e7bd0d4de), CONST64(0x56cb47e3c535f),
+  CONST64(0x72130d43d8496), CONST64(0x7cc447ad13e59), CONST64(0x5288cf65559b0),
+  CONST64(0x2b629f0d9881c), CONST64(0x27caae1ce21f2), CONST64(0x12eebeff2c7ec),
+  CONST64(0x0e92ff727c4a4), CONST64(0x12c70c85f4524), CONST64(0x5c8c50a97289b),
+  CONST64(0x75d502547f652), CONST64(0x5da24a563faae), CONST64(0x30a36eb796307),
+  CONST64(0x63f01b555a964), CONST64(0x5bda5e538767f), CONST64(0x0fa612c198d48),
+  CONST64(0x354cd4580a64c), CONST64(0x4aa9e49cfb4ea), CONST64(0x437165416ab62),
+  CONST64(0x5b1fbddfdad86), CONST64(0x75c96cef1bc3a), CONST64(0x603747eb606fe),
+  CONST64(0x0dbb5bc0c8ccc), CONST64(0x46fe985f1b972), CONST64(0x00a2836e64b9a),
+  CONST64(0x21e92a74e2c26), CONST64(0x7cd91d540da93), CONST64(0x11e423291a7a3),
+  CONST64(0x3ea46dc72c2dd), CONST64(0x5018588e2dfa7), CONST64(0x03fa0ebdd53fe),
+  CONST64(0x271d3959ce7d0), CONST64(0x4a735072f4bec), CONST64(0x088b0ca7df432),
+  CONST64(0x70e54fefe6cc0), CONST64(0x2751ca3b2820c), CONST64(0x4d68f7c3aee75),
+  CONST64(0x449fd4f8711fa), CONST64(0x3c755700af5ee), CONST64(0x445337c54aa9d),
+  CONST64(0x7cfc86df9a4c8), CONST64(0x4466d61db423a), CONST64(0x1bcf6c7d0eb4a),
+  CONST64(0x7d5b0546110e1), CONST64(0x73a96d7c70596), CONST64(0x7615f603e6f13),
+  CONST64(0x087035eabe3f9), CONST64(0x556b20b23346a), CONST64(0x1ae5c564b3a77),
+  CONST64(0x1ad4c0302594b), CONST64(0x28f8d4b709b41), CONST64(0x2178a904fef9b),
+  CONST64(0x331a28073e004), CONST64(0x201a641198d92), CONST64(0x0e6863e708d5b),
+  CONST64(0x09914b654bfb1), CONST64(0x1d176412796b7), CONST64(0x3c307983e740f),
+  CONST64(0x5d9cf1e818af1), CONST64(0x21d3be2a1592b), CONST64(0x54c571883eb7b),
+  CONST64(0x109312caf6eaa), CONST64(0x5932abca49e6e), CONST64(0x3aa0a0c361fe0),
+  CONST64(0x45fe508dff693), CONST64(0x56cc1f071b283), CONST64(0x1de95131f404a),
+  CONST64(0x1a0239374eeae), CONST64(0x3e6190f708b20), CONST64(0x46e21e149ef2e),
+  CONST64(0x04a00ce2d20cf), CONST64(0x1e2ccc2338304), CONST64(0x094d8553aae4f),
+  CONST64(0x6ee309f230d1a), CONST64(0x0ae32ac67b877), CONST64(0x1ea8fd8412729),
+  CONST64(0x3a126b5e8888a), CONST64(0x3a5b0ba127bd8), CONST64(0x64cde98364f1d),
+  CONST64(0x6b982b66c4ffa), CONST64(0x218c3e0b9085f), CONST64(0x654ec3ee2d06c),
+  CONST64(0x00396913cabc3), CONST64(0x19767cc144203), CONST64(0x7d6e4071f6450),
+  CONST64(0x1f7c3ea3ee4e1), CONST64(0x0a53ecdf4e3da), CONST64(0x418c2797ed200),
+  CONST64(0x2c41a80e5b453), CONST64(0x60fe08e9dc54b), CONST64(0x6b2f1c309a0b7),
+  CONST64(0x3293b11cbbbbc), CONST64(0x1f4578658a7ed), CONST64(0x393bc7b77c81c),
+  CONST64(0x367a868cd8c15), CONST64(0x74719add93627), CONST64(0x4174ad15a144f),
+  CONST64(0x34b3df65cfb24), CONST64(0x6ebb5599ac3d3), CONST64(0x38645b73f4755),
+  CONST64(0x1b10773615d37), CONST64(0x70305ea7d72d4), CONST64(0x731fbdc8a9de2),
+  CONST64(0x7c0cebbd0ca4e), CONST64(0x4c5da306059bd), CONST64(0x4acefccbf4853),
+  CONST64(0x6b25a6c99b7af), CONST64(0x6461833026867), CONST64(0x7cead1176a994),
+  CONST64(0x31e08c64de622), CONST64(0x7af71922a0c43), CONST64(0x6c048211cacec),
+  CONST64(0x56e6e9b5b0e13), CONST64(0x7b816374fe4d0), CONST64(0x64cdb68564783),
+  CONST64(0x03acd825866df), CONST64(0x4bb8f4c4cca1d), CONST64(0x2a8bfe5c9f091),
+  CONST64(0x32e73d7c414d7), CONST64(0x71bc104113fcc), CONST64(0x1f1194e6b0a52),
+  CONST64(0x17e905170f1f4), CONST64(0x0b1c793ce3aeb), CONST64(0x6f56ae3ce96f0),
+  CONST64(0x2a3e186f6b4b9), CONST64(0x41e64af26a8ef), CONST64(0x134dafe05997e),
+  CONST64(0x074a2b9edc733), CONST64(0x2bcbc96fc92ab), CONST64(0x096ed8c1e9273),
+  CONST64(0x068c2dacbaba7), CONST64(0x3cbdc9b7e4dad), CONST64(0x68bcdc69bd16a),
+  CONST64(0x6ff27a9feafb3), CONST64(0x1f73e611f6329), CONST64(0x0d51039c82d81),
+  CONST64(0x1b8b0d7c0cec5), CONST64(0x466a870023ad2), CONST64(0x72b5a5b6de284),
+  CONST64(0x12c4628a337c3), CONST64(0x46c67f460e78e), CONST64(0x490e5de68725e),
+  CONST64(0x68435d2018c42), CONST64(0x3485a7aa6fde7), CONST64(0x69774ed68e720),
+  CONST64(0x3297de2957e26), CONST64(0x6450077e37426), CONST64(0x0b3fe28b59cae),
+  CONST64(0x61aa1160d97b7), CONST64(0x48a7b7f55128e), CONST64(0x6bab0c5b2e4a6),
+  CONST64(0x3822130dd2f2d), CONST64(0x0a159b9f678b4), CONST64(0x2c6ce0503ee8d),
+  CONST64(0x717e676469b1a), CONST64(0x43c043c63d129), CONST64(0x44a290cd033b3),
+  CONST64(0x1d3877054dc01), CONST64(0x0f8c2b5378339), CONST64(0x2dfb19c632889),
+  CONST64(0x38525489e51b0), CONST64(0x3da48697a5b33), CONST64(0x3d4f27772b64d),
+  CONST64(0x0e77ad1d92649), CONST64(0x2301df2db5c75), CONST64(0x21501a33bc5e3),
+  CONST64(0x276b53f750382), CONST64(0x6fabc7001775c), CONST64(0x4cc1e54c7258d),
+  CONST64(0x3e1d86b3ae19c), CONST64(0x28f3017a71713), CONST64(0x0d04fe40c7a9e),
+  CONST64(0x73bc322e1cfff), CONST64(0x7294f2237a32d), CONST64(0x4c0667543638e),
+  CONST64(0x70c89c91f7e7f), CONST64(0x2a6ed9bd0987d), CONST64(0x1727ae4d753a0),
+  CONST64(0x62ef3fdce7514), CONST64(0x08017f77d3efd), CONST64(0x3c70d3e486dcb),
+  CONST64(0x409977a7b4776), CONST64(0x1525ed4e71ba7), CONST64(0x1928c87d15666),
+  CONST64(0x047d566087229), CONST64(0x156b2eb18c947), CONST64(0x738a46cb6a68b),
+  CONST64(0x54a2baad4303a), CONST64(0x4ae0ec1d4499f), CONST64(0x4955ab57e2130),
+  CONST64(0x7b2c89ebea361), CONST64(0x2f4b265bfadfe), CONST64(0x31821023a7684),
+  CONST64(0x77db41774458f), CONST64(0x6cb9ba2be7da7), CONST64(0x3019c0fbab07a),
+  CONST64(0x742ff1219ac76), CONST64(0x387575fd24bc9), CONST64(0x17f1b3461da31),
+  CONST64(0x16b3d036c2886), CONST64(0x1dc7c9cf34134), CONST64(0x105ec02eb1d75),
+  CONST64(0x126d5e3ac73ca), CONST64(0x78a82c43f443d), CONST64(0x4199b3403ce52),
+  CONST64(0x34f6ce21cb1c9), CONST64(0x5da9cd4b28d84), CONST64(0x31368bb16bda2),
+  CONST64(0x3d9b99a13ada9), CONST64(0x38112702675c4), CONST64(0x5688d28e9c0ad),
+  CONST64(0x712b1ffbf44e7), CONST64(0x1c8229cd3ad7b), CONST64(0x0b49208bd81bb),
+  CONST64(0x550fb0a0d0782), CONST64(0x62dd31ddac07f), CONST64(0x4026023ab23b5),
+  CONST64(0x22460b1c9cc37), CONST64(0x3e40a64da2d51), CONST64(0x2dcb32d287241),
+  CONST64(0x6b892b09826b7), CONST64(0x5a36039ecf45d), CONST64(0x290c3d6097e79),
+  CONST64(0x157ee7b2e1f28), CONST64(0x5a52e9dca709f), CONST64(0x378e7ff97b2fe),
+  CONST64(0x4b8fe54948b42), CONST64(0x75a0fadd77b78), CONST64(0x5a277115c55fb),
+  CONST64(0x0d921e5854c55), CONST64(0x70dfbc6364f68), CONST64(0x048b9b89cf1ec),
+  CONST64(0x6b9f1b1b72827), CONST64(0x0f4e191892dd3), CONST64(0x23015328300cc),
+  CONST64(0x7fab0f4f85562), CONST64(0x1b6e3c321fb1d), CONST64(0x777279c16beac),
+  CONST64(0x4689b02ab17df), CONST64(0x51c12ec4132ed), CONST64(0x31b2456b7b877),
+  CONST64(0x5c21e5387d181), CONST64(0x313c37a49ca2f), CONST64(0x3b2432ebc9edd),
+  CONST64(0x0899781c7d8ef), CONST64(0x10de7318502e0), CONST64(0x0db18be90ad68),
+  CONST64(0x060da1115b11c), CONST64(0x361fd1330328d), CONST64(0x6ccc2b78c2e59),
+  CONST64(0x706382f92b777), CONST64(0x70258f43764dc), CONST64(0x5dcc6ff9a04f6),
+  CONST64(0x6c55c1f2ab2db), CONST64(0x30c8165159986), CONST64(0x22ef8a1e89a45),
+  CONST64(0x3e81112e25ce4), CONST64(0x24358acb40b6a), CONST64(0x3cd845a927b2c),
+  CONST64(0x506d72c1951df), CONST64(0x4bd1f05fea25e), CONST64(0x06e39d7efa8cd),
+  CONST64(0x156aab5585124), CONST64(0x45f998ac7247f), CONST64(0x715addf6fd3b0),
+  CONST64(0x7cf1aebd6e3a2), CONST64(0x0391b7101c8a9), CONST64(0x56887ab35ab69),
+  CONST64(0x36121e8a0da91), CONST64(0x30728c55d3ecd), CONST64(0x188cd2a66f481),
+  CONST64(0x151333b5b850d), CONST64(0x18dffa3616ab9), CONST64(0x23b086cf066d5),
+  CONST64(0x66080b4bdd58f), CONST64(0x130c6974631ac), CONST64(0x4b2f0e6f5f290),
+  CONST64(0x30aa27f229a80), CONST64(0x16c5fa19014f1), CONST64(0x35118ea05195e),
+  CONST64(0x046f82d20b86d), CONST64(0x34a3ccac75145), CONST64(0x53a7519c28496),
+  CONST64(0x01ebb5388c6e8), CONST64(0x5416ee772f53b), CONST64(0x0b9739d12a1e8),
+  CONST64(0x2581c43263fe3), CONST64(0x02857fe94e1ab), CONST64(0x4864ef1818473),
+  CONST64(0x5a83a0bd0b830), CONST64(0x37723868519a1), CONST64(0x054fbd2193bae),
+  CONST64(0x12873379f4d82), CONST64(0x26c03aed7f6bc), CONST64(0x7c33297639ab3),
+  CONST64(0x5640d1a71df02), CONST64(0x588f03cd11f1e), CONST64(0x7b62e6025c41d),
+  CONST64(0x2a7adc0c34dba), CONST64(0x67a2f581c7dce), CONST64(0x40905352db2c3),
+  CONST64(0x62690f0ea7a25), CONST64(0x3aa486ca53ddc), CONST64(0x78b5169959e1d),
+  CONST64(0x4c85a5769cc40), CONST64(0x74ae9ba657f2b), CONST64(0x61aa0db9bfa54),
+  CONST64(0x0da0ee5c50b2a), CONST64(0x457ec0224bcd2), CONST64(0x18254df5d180d),
+  CONST64(0x0ff9d3a8ca21f), CONST64(0x239c47dd41854), CONST64(0x38493ab951aa4),
+  CONST64(0x02314bc90371e), CONST64(0x0aefe8f26908a), CONST64(0x3bf6aa75a6f3d),
+  CONST64(0x2133be85aeecc), CONST64(0x524ddc5bc9b75), CONST64(0x79572c534fcf0),
+  CONST64(0x34300e0749597), CONST64(0x4720c80988687), CONST64(0x22326917cdc98),
+  CONST64(0x50e0a49fb55cb), CONST64(0x7890c0b6e7f19), CONST64(0x5b23ca35b2d6f),
+  CONST64(0x7572598372473), CONST64(0x65ba812ec2836), CONST64(0x79f82199bc406),
+  CONST64(0x70ddf8d98b60e), CONST64(0x140b7fdd75dc4), CONST64(0x30b5f02d37e92),
+  CONST64(0x2d212168ecc0e), CONST64(0x05515ac7118f6), CONST64(0x45769691e89a7),
+  CONST64(0x63ddc5ba643ad), CONST64(0x33d37236d6721), CONST64(0x19e76422173fb),
+  CONST64(0x63c45d73a082b), CONST64(0x2ec0f706b05c7), CONST64(0x3e305345b2ddb),
+  CONST64(0x6bd805d736a9c), CONST64(0x55785f51ea730), CONST64(0x6c10111aef7ee),
+  CONST64(0x10b74232f01c1), CONST64(0x21694608f59d8), CONST64(0x3f7c7a18f9f87),
+  CONST64(0x13851c22537b8), CONST64(0x353c8285b3715), CONST64(0x5d6fa9d25a3f4),
+  CONST64(0x45afeb2a3a6dd), CONST64(0x0f3be01ccb585), CONST64(0x27e72b699b3b4),
+  CONST64(0x38e032665fb0c), CONST64(0x574fa41887c9e), CONST64(0x74185e46e6cbb),
+  CONST64(0x025e447ca48db), CONST64(0x5f49918a9a730), CONST64(0x4bd3cbffafbfa),
+  CONST64(0x645e704f775f6), CONST64(0x529dade891efa), CONST64(0x5a245dcfb1925),
+  CONST64(0x53854443ce9cf), CONST64(0x499791aacc114), CONST64(0x7420e574dcaab),
+  CONST64(0x66e3f94234b1c), CONST64(0x4d36843821f07), CONST64(0x711529721ed87),
+  CONST64(0x03aa2a599d849), CONST64(0x2ba60fa9c3cdc), CONST64(0x6a138a034513c),
+  CONST64(0x5e8df3a73beec), CONST64(0x51b92983f9880), CONST64(0x1e994571c80c6),
+  CONST64(0x44ef4632b581b), CONST64(0x6491c21d364c9), CONST64(0x58ca44944b47a),
+  CONST64(0x01c725d1768ee), CONST64(0x1e7ab7a88ece0), CONST64(0x7054899c44b5f)
+};
+
+/**************************** Field arithmetic ******************************/
+
+/* Propagates carries so that the limbs are below 2 ^ 51, except that
+   the lowest limb may be slightly larger. */
+
+static inline void silc_fe_carry(Fe25519 h)
+{
+  SilcUInt64 c;
+
+  c = h[0] >> 51;
+  h[0] &= SILC_C25519_MASK;
+  h[1] += c;
+  c = h[1] >> 51;
+  h[1] &= SILC_C25519_MASK;
+  h[2] += c;
+  c = h[2] >> 51;
+  h[2] &= SILC_C25519_MASK;
+  h[3] += c;
+  c = h[3] >> 51;
+  h[3] &= SILC_C25519_MASK;
+  h[4] += c;
+  c = h[4] >> 51;
+  h[4] &= SILC_C25519_MASK;
+  h[0] += c * 19;
+}
+
+static inline void silc_fe_0(Fe25519 h)
+{
+  memset(h, 0, sizeof(Fe25519));
+}
+
+static inline void silc_fe_1(Fe25519 h)
+{
+  memset(h, 0, sizeof(Fe25519));
+  h[0] = 1;
+}
+
+static inline void silc_fe_copy(Fe25519 h, const Fe25519 f)
+{
+  memcpy(h, f, sizeof(Fe25519));
+}
+
+/* h = f + g */
+
+static inline void silc_fe_add(Fe25519 h, const Fe25519 f, const Fe25519 g)
+{
+  h[0] = f[0] + g[0];
+  h[1] = f[1] + g[1];
+  h[2] = f[2] + g[2];
+  h[3] = f[3] + g[3];
+  h[4] = f[4] + g[4];
+  silc_fe_carry(h);
+}
+
+/* h = f - g.  The 4 * p is added so that the limbs do not underflow. */
+
+static inline void silc_fe_sub(Fe25519 h, const Fe25519 f, const Fe25519 g)
+{
+  h[0] = f[0] + CONST64(0x1fffffffffffb4) - g[0];
+  h[1] = f[1] + CONST64(0x1ffffffffffffc) - g[1];
+  h[2] = f[2] + CONST64(0x1ffffffffffffc) - g[2];
+  h[3] = f[3] + CONST64(0x1ffffffffffffc) - g[3];
+  h[4] = f[4] + CONST64(0x1ffffffffffffc) - g[4];
+  silc_fe_carry(h);
+}
+
+/* h = -f */
+
+static inline void silc_fe_neg(Fe25519 h, const Fe25519 f)
+{
+  Fe25519 zero;
+
+  silc_fe_0(zero);
+  silc_fe_sub(h, zero, f);
+}
+
+/* Reduces the 128 bit column sums to limbs */
+
+#define SILC_FE_REDUCE(h, r0, r1, r2, r3, r4)				\
+do {									\
+  SilcUInt64 c;								\
+  c = SILC_C25519_SHR(r0, 51);						\
+  h[0] = SILC_C25519_LO(r0) & SILC_C25519_MASK;				\
+  SILC_C25519_ADD(r1, c);						\
+  c = SILC_C25519_SHR(r1, 51);						\
+  h[1] = SILC_C25519_LO(r1) & SILC_C25519_MASK;				\
+  SILC_C25519_ADD(r2, c);						\
+  c = SILC_C25519_SHR(r2, 51);						\
+  h[2] = SILC_C25519_LO(r2) & SILC_C25519_MASK;				\
+  SILC_C25519_ADD(r3, c);						\
+  c = SILC_C25519_SHR(r3, 51);						\
+  h[3] = SILC_C25519_LO(r3) & SILC_C25519_MASK;				\
+  SILC_C25519_ADD(r4, c);						\
+  c = SILC_C25519_SHR(r4, 51);						\
+  h[4] = SILC_C25519_LO(r4) & SILC_C25519_MASK;				\
+  h[0] += c * 19;							\
+  h[1] += h[0] >> 51;							\
+  h[0] &= SILC_C25519_MASK;						\
+} while(0)
+
+/* h = f * g */
+
+static void silc_fe_mul(Fe25519 h, const Fe25519 f, const Fe25519 g)
+{
+  C25519Wide r0, r1, r2, r3, r4;
+  SilcUInt64 g1_19 = g[1] * 19, g2_19 = g[2] * 19;
+  SilcUInt64 g3_19 = g[3] * 19, g4_19 = g[4] * 19;
+
+  SILC_C25519_MUL(r0, f[0], g[0]);
+  SILC_C25519_MULADD(r0, f[1], g4_19);
+  SILC_C25519_MULADD(r0, f[2], g3_19);
+  SILC_C25519_MULADD(r0, f[3], g2_19);
+  SILC_C25519_MULADD(r0, f[4], g1_19);
+
+  SILC_C25519_MUL(r1, f[0], g[1]);
+  SILC_C25519_MULADD(r1, f[1], g[0]);
+  SILC_C25519_MULADD(r1, f[2], g4_19);
+  SILC_C25519_MULADD(r1, f[3], g3_19);
+  SILC_C25519_MULADD(r1, f[4], g2_19);
+
+  SILC_C25519_MUL(r2, f[0], g[2]);
+  SILC_C25519_MULADD(r2, f[1], g[1]);
+  SILC_C25519_MULADD(r2, f[2], g[0]);
+  SILC_C25519_MULADD(r2, f[3], g4_19);
+  SILC_C25519_MULADD(r2, f[4], g3_19);
+
+  SILC_C25519_MUL(r3, f[0], g[3]);
+  SILC_C25519_MULADD(r3, f[1], g[2]);
+  SILC_C25519_MULADD(r3, f[2], g[1]);
+  SILC_C25519_MULADD(r3, f[3], g[0]);
+  SILC_C25519_MULADD(r3, f[4], g4_19);
+
+  SILC_C25519_MUL(r4, f[0], g[4]);
+  SILC_C25519_MULADD(r4, f[1], g[3]);
+  SILC_C25519_MULADD(r4, f[2], g[2]);
+  SILC_C25519_MULADD(r4, f[3], g[1]);
+  SILC_C25519_MULADD(r4, f[4], g[0]);
+
+  SILC_FE_REDUCE(h, r0, r1, r2, r3, r4);
+}
+
+/* h = f ^ 2 */
+
+static void silc_fe_sq(Fe25519 h, const Fe25519 f)
+{
+  C25519Wide r0, r1, r2, r3, r4;
+  SilcUInt64 d0 = f[0] * 2, d1 = f[1] * 2, d2 = f[2] * 2, d3 = f[3] * 2;
+  SilcUInt64 f3_19 = f[3] * 19, f4_19 = f[4] * 19;
+
+  SILC_C25519_MUL(r0, f[0], f[0]);
+  SILC_C25519_MULADD(r0, d1, f4_19);
+  SILC_C25519_MULADD(r0, d2, f3_19);
+
+  SILC_C25519_MUL(r1, d0, f[1]);
+  SILC_C25519_MULADD(r1, d2, f4_19);
+  SILC_C25519_MULADD(r1, f[3], f3_19);
+
+  SILC_C25519_MUL(r2, d0, f[2]);
+  SILC_C25519_MULADD(r2, f[1], f[1]);
+  SILC_C25519_MULADD(r2, d3, f4_19);
+
+  SILC_C25519_MUL(r3, d0, f[3]);
+  SILC_C25519_MULADD(r3, d1, f[2]);
+  SILC_C25519_MULADD(r3, f[4], f4_19);
+
+  SILC_C25519_MUL(r4, d0, f[4]);
+  SILC_C25519_MULADD(r4, d1, f[3]);
+  SILC_C25519_MULADD(r4, f[2], f[2]);
+
+  SILC_FE_REDUCE(h, r0, r1, r2, r3, r4);
+}
+
+/* h = f ^ (2 ^ n) */
+
+static void silc_fe_sqn(Fe25519 h, const Fe25519 f, int n)
+{
+  silc_fe_sq(h, f);
+  while (--n > 0)
+    silc_fe_sq(h, h);
+}
+
+/* h = f * 121665 */
+
+static void silc_fe_mul121665(Fe25519 h, const Fe25519 f)
+{
+  C25519Wide r0, r1, r2, r3, r4;
+
+  SILC_C25519_MUL(r0, f[0], 121665);
+  SILC_C25519_MUL(r1, f[1], 121665);
+  SILC_C25519_MUL(r2, f[2], 121665);
+  SILC_C25519_MUL(r3, f[3], 121665);
+  SILC_C25519_MUL(r4, f[4], 121665);
+
+  SILC_FE_REDUCE(h, r0, r1, r2, r3, r4);
+}
+
+/* Computes z ^ (2 ^ 250 - 1) into `r' and z ^ 11 into `z11' */
+
+static void silc_fe_pow2_250(Fe25519 r, Fe25519 z11, const Fe25519 z)
+{
+  Fe25519 t, z9, z2_5, z2_10, z2_20, z2_50, z2_100;
+
+  silc_fe_sq(t, z);				/* 2 */
+  silc_fe_sqn(z9, t, 2);			/* 8 */
+  silc_fe_mul(z9, z9, z);			/* 9 */
+  silc_fe_mul(z11, z9, t);			/* 11 */
+  silc_fe_sq(t, z11);				/* 22 */
+  silc_fe_mul(z2_5, t, z9);			/* 2 ^ 5 - 1 */
+  silc_fe_sqn(t, z2_5, 5);
+  silc_fe_mul(z2_10, t, z2_5);			/* 2 ^ 10 - 1 */
+  silc_fe_sqn(t, z2_10, 10);
+  silc_fe_mul(z2_20, t, z2_10);			/* 2 ^ 20 - 1 */
+  silc_fe_sqn(t, z2_20, 20);
+  silc_fe_mul(t, t, z2_20);			/* 2 ^ 40 - 1 */
+  silc_fe_sqn(t, t, 10);
+  silc_fe_mul(z2_50, t, z2_10);			/* 2 ^ 50 - 1 */
+  silc_fe_sqn(t, z2_50, 50);
+  silc_fe_mul(z2_100, t, z2_50);		/* 2 ^ 100 - 1 */
+  silc_fe_sqn(t, z2_100, 100);
+  silc_fe_mul(t, t, z2_100);			/* 2 ^ 200 - 1 */
+  silc_fe_sqn(t, t, 50);
+  silc_fe_mul(r, t, z2_50);			/* 2 ^ 250 - 1 */
+}
+
+/* h = z ^ -1 = z ^ (p - 2) */
+
+static void silc_fe_invert(Fe25519 h, const Fe25519 z)
+{
+  Fe25519 t, z11;
+
+  silc_fe_pow2_250(t, z11, z);
+  silc_fe_sqn(t, t, 5);
+  silc_fe_mul(h, t, z11);			/* 2 ^ 255 - 21 */
+}
+
+/* h = z ^ ((p - 5) / 8) */
+
+static void silc_fe_pow22523(Fe25519 h, const Fe25519 z)
+{
+  Fe25519 t, z11;
+
+  silc_fe_pow2_250(t, z11, z);
+  silc_fe_sqn(t, t, 2);
+  silc_fe_mul(h, t, z);				/* 2 ^ 252 - 3 */
+}
+
+/* Sets `g' to `f' if `b' is 1, keeps `f' if `b' is 0 */
+
+static inline void silc_fe_cmov(Fe25519 f, const Fe25519 g, SilcUInt64 b)
+{
+  SilcUInt64 mask = 0 - b;
+
+  f[0] ^= mask & (f[0] ^ g[0]);
+  f[1] ^= mask & (f[1] ^ g[1]);
+  f[2] ^= mask & (f[2] ^ g[2]);
+  f[3] ^= mask & (f[3] ^ g[3]);
+  f[4] ^= mask & (f[4] ^ g[4]);
+}
+
+/* Swaps `f' and `g' if `b' is 1 */
+
+static inline void silc_fe_cswap(Fe25519 f, Fe25519 g, SilcUInt64 b)
+{
+  SilcUInt64 mask = 0 - b, x;
+  int i;
+
+  for (i = 0; i < 5; i++) {
+    x = mask & (f[i] ^ g[i]);
+    f[i] ^= x;
+    g[i] ^= x;
+  }
+}
+
+/* Decodes field element, the highest bit is ignored */
+
+static void silc_fe_frombytes(Fe25519 h, const unsigned char *s)
+{
+  SilcUInt64 w[4];
+  SilcUInt32 lo, hi;
+  int i;
+
+  for (i = 0; i < 4; i++) {
+    SILC_GET32_LSB(lo, s + i * 8);
+    SILC_GET32_LSB(hi, s + i * 8 + 4);
+    w[i] = ((SilcUInt64)hi << 32) | lo;
+  }
+
+  h[0] = w[0] & SILC_C25519_MASK;
+  h[1] = ((w[0] >> 51) | (w[1] << 13)) & SILC_C25519_MASK;
+  h[2] = ((w[1] >> 38) | (w[2] << 26)) & SILC_C25519_MASK;
+  h[3] = ((w[2] >> 25) | (w[3] << 39)) & SILC_C25519_MASK;
+  h[4] = (w[3] >> 12) & SILC_C25519_MASK;
+}
+
+/* Encodes field element, fully reduced modulo p */
+
+static void silc_fe_tobytes(unsigned char *s, const Fe25519 f)
+{
+  Fe25519 h;
+  SilcUInt64 q, w[4];
+  int i;
+
+  silc_fe_copy(h, f);
+  silc_fe_carry(h);
+
+  /* The h is now less than 2p.  q is 1 if h >= p. */
+  q = (h[0] + 19) >> 51;
+  q = (h[1] + q) >> 51;
+  q = (h[2] + q) >> 51;
+  q = (h[3] + q) >> 51;
+  q = (h[4] + q) >> 51;
+
+  /* h = h - q * p */
+  h[0] += 19 * q;
+  h[1] += h[0] >> 51;
+  h[0] &= SILC_C25519_MASK;
+  h[2] += h[1] >> 51;
+  h[1] &= SILC_C25519_MASK;
+  h[3] += h[2] >> 51;
+  h[2] &= SILC_C25519_MASK;
+  h[4] += h[3] >> 51;
+  h[3] &= SILC_C25519_MASK;
+  h[4] &= SILC_C25519_MASK;
+
+  w[0] = h[0] | (h[1] << 51);
+  w[1] = (h[1] >> 13) | (h[2] << 38);
+  w[2] = (h[2] >> 26) | (h[3] << 25);
+  w[3] = (h[3] >> 39) | (h[4] << 12);
+
+  for (i = 0; i < 4; i++) {
+    SILC_PUT32_LSB((SilcUInt32)w[i], s + i * 8);
+    SILC_PUT32_LSB((SilcUInt32)(w[i] >> 32), s + i * 8 + 4);
+  }
+}
+
+/* Returns 1 if f is negative, ie. the lowest bit is set */
+
+static int silc_fe_isnegative(const Fe25519 f)
+{
+  unsigned char s[32];
+
+  silc_fe_tobytes(s, f);
+  return s[0] & 1;
+}
+
+/* Returns 1 if f is not zero */
+
+static int silc_fe_isnonzero(const Fe25519 f)
+{
+  unsigned char s[32], x = 0;
+  int i;
+
+  silc_fe_tobytes(s, f);
+  for (i = 0; i < 32; i++)
+    x |= s[i];
+
+  return x != 0;
+}
+
+/********************************* X25519 ***********************************/
+
+/* out = scalar * u, the Montgomery ladder of RFC 7748 */
+
+void silc_c25519_x25519(unsigned char *out, const unsigned char *scalar,
+			const unsigned char *u)
+{
+  unsigned char k[32];
+  Fe25519 x1, x2, z2, x3, z3, a, aa, b, bb, e, c, d, da, cb;
+  SilcUInt64 swap = 0, bit;
+  int t;
+
+  memcpy(k, scalar, sizeof(k));
+  k[0] &= 248;
+  k[31] &= 127;
+  k[31] |= 64;
+
+  silc_fe_frombytes(x1, u);
+  silc_fe_1(x2);
+  silc_fe_0(z2);
+  silc_fe_copy(x3, x1);
+  silc_fe_1(z3);
+
+  for (t = 254; t >= 0; t--) {
+    bit = (k[t >> 3] >> (t & 7)) & 1;
+    swap ^= bit;
+    silc_fe_cswap(x2, x3, swap);
+    silc_fe_cswap(z2, z3, swap);
+    swap = bit;
+
+    silc_fe_add(a, x2, z2);
+    silc_fe_sq(aa, a);
+    silc_fe_sub(b, x2, z2);
+    silc_fe_sq(bb, b);
+    silc_fe_sub(e, aa, bb);
+    silc_fe_add(c, x3, z3);
+    silc_fe_sub(d, x3, z3);
+    silc_fe_mul(da, d, a);
+    silc_fe_mul(cb, c, b);
+    silc_fe_add(x3, da, cb);
+    silc_fe_sq(x3, x3);
+    silc_fe_sub(z3, da, cb);
+    silc_fe_sq(z3, z3);
+    silc_fe_mul(z3, z3, x1);
+    silc_fe_mul(x2, aa, bb);
+    silc_fe_mul121665(z2, e);
+    silc_fe_add(z2, z2, aa);
+    silc_fe_mul(z2, z2, e);
+  }
+  silc_fe_cswap(x2, x3, swap);
+  silc_fe_cswap(z2, z3, swap);
+
+  silc_fe_invert(z2, z2);
+  silc_fe_mul(x2, x2, z2);
+  silc_fe_tobytes(out, x2);
+
+  memset(k, 0, sizeof(k));
+  memset(x2, 0, sizeof(x2));
+  memset(z2, 0, sizeof(z2));
+  memset(x3, 0, sizeof(x3));
+  memset(z3, 0, sizeof(z3));
+}
+
+/**************************** Point arithmetic ******************************/
+
+/* Sets point at infinity, (0, 1) */
+
+static void silc_ge_p3_0(Ge25519 *h)
+{
+  silc_fe_0(h->X);
+  silc_fe_1(h->Y);
+  silc_fe_1(h->Z);
+  silc_fe_0(h->T);
+}
+
+static void silc_ge_p1p1_to_p2(Ge25519P2 *r, const Ge25519P1P1 *p)
+{
+  silc_fe_mul(r->X, p->X, p->T);
+  silc_fe_mul(r->Y, p->Y, p->Z);
+  silc_fe_mul(r->Z, p->Z, p->T);
+}
+
+static void silc_ge_p1p1_to_p3(Ge25519 *r, const Ge25519P1P1 *p)
+{
+  silc_fe_mul(r->X, p->X, p->T);
+  silc_fe_mul(r->Y, p->Y, p->Z);
+  silc_fe_mul(r->Z, p->Z, p->T);
+  silc_fe_mul(r->T, p->X, p->Y);
+}
+
+static void silc_ge_p3_to_p2(Ge25519P2 *r, const Ge25519 *p)
+{
+  silc_fe_copy(r->X, p->X);
+  silc_fe_copy(r->Y, p->Y);
+  silc_fe_copy(r->Z, p->Z);
+}
+
+static void silc_ge_p3_to_cached(Ge25519Cached *r, const Ge25519 *p)
+{
+  silc_fe_add(r->YpX, p->Y, p->X);
+  silc_fe_sub(r->YmX, p->Y, p->X);
+  silc_fe_copy(r->Z, p->Z);
+  silc_fe_mul(r->T2d, p->T, silc_c25519_d2);
+}
+
+/* r = 2 * p */
+
+static void silc_ge_p2_dbl(Ge25519P1P1 *r, const Ge25519P2 *p)
+{
+  Fe25519 t0;
+
+  silc_fe_sq(r->X, p->X);
+  silc_fe_sq(r->Z, p->Y);
+  silc_fe_sq(r->T, p->Z);
+  silc_fe_add(r->T, r->T, r->T);
+  silc_fe_add(r->Y, p->X, p->Y);
+  silc_fe_sq(t0, r->Y);
+  silc_fe_add(r->Y, r->Z, r->X);
+  silc_fe_sub(r->Z, r->Z, r->X);
+  silc_fe_sub(r->X, t0, r->Y);
+  silc_fe_sub(r->T, r->T, r->Z);
+}
+
+/* r = p + q */
+
+static void silc_ge_add(Ge25519P1P1 *r, const Ge25519 *p,
+			const Ge25519Cached *q)
+{
+  Fe25519 t0;
+
+  silc_fe_add(r->X, p->Y, p->X);
+  silc_fe_sub(r->Y, p->Y, p->X);
+  silc_fe_mul(r->Z, r->X, q->YpX);
+  silc_fe_mul(r->Y, r->Y, q->YmX);
+  silc_fe_mul(r->T, q->T2d, p->T);
+  silc_fe_mul(r->X, p->Z, q->Z);
+  silc_fe_add(t0, r->X, r->X);
+  silc_fe_sub(r->X, r->Z, r->Y);
+  silc_fe_add(r->Y, r->Z, r->Y);
+  silc_fe_add(r->Z, t0, r->T);
+  silc_fe_sub(r->T, t0, r->T);
+}
+
+/* r = p - q */
+
+static void silc_ge_sub(Ge25519P1P1 *r, const Ge25519 *p,
+			const Ge25519Cached *q)
+{
+  Fe25519 t0;
+
+  silc_fe_add(r->X, p->Y, p->X);
+  silc_fe_sub(r->Y, p->Y, p->X);
+  silc_fe_mul(r->Z, r->X, q->YmX);
+  silc_fe_mul(r->Y, r->Y, q->YpX);
+  silc_fe_mul(r->T, q->T2d, p->T);
+  silc_fe_mul(r->X, p->Z, q->Z);
+  silc_fe_add(t0, r->X, r->X);
+  silc_fe_sub(r->X, r->Z, r->Y);
+  silc_fe_add(r->Y, r->Z, r->Y);
+  silc_fe_sub(r->Z, t0, r->T);
+  silc_fe_add(r->T, t0, r->T);
+}
+
+/* r = p + q, the `q' is affine */
+
+static void silc_ge_madd(Ge25519P1P1 *r, const Ge25519 *p,
+			 const Ge25519Niels *q)
+{
+  Fe25519 t0;
+
+  silc_fe_add(r->X, p->Y, p->X);
+  silc_fe_sub(r->Y, p->Y, p->X);
+  silc_fe_mul(r->Z, r->X, q->ypx);
+  silc_fe_mul(r->Y, r->Y, q->ymx);
+  silc_fe_mul(r->T, q->xy2d, p->T);
+  silc_fe_add(t0, p->Z, p->Z);
+  silc_fe_sub(r->X, r->Z, r->Y);
+  silc_fe_add(r->Y, r->Z, r->Y);
+  silc_fe_add(r->Z, t0, r->T);
+  silc_fe_sub(r->T, t0, r->T);
+}
+
+/* r = p - q, the `q' is affine */
+
+static void silc_ge_msub(Ge25519P1P1 *r, const Ge25519 *p,
+			 const Ge25519Niels *q)
+{
+  Fe25519 t0;
+
+  silc_fe_add(r->X, p->Y, p->X);
+  silc_fe_sub(r->Y, p->Y, p->X);
+  silc_fe_mul(r->Z, r->X, q->ymx);
+  silc_fe_mul(r->Y, r->Y, q->ypx);
+  silc_fe_mul(r->T, q->xy2d, p->T);
+  silc_fe_add(t0, p->Z, p->Z);
+  silc_fe_sub(r->X, r->Z, r->Y);
+  silc_fe_add(r->Y, r->Z, r->Y);
+  silc_fe_sub(r->Z, t0, r->T);
+  silc_fe_add(r->T, t0, r->T);
+}
+
+/* Loads table entry */
+
+static inline void silc_ge_niels_load(Ge25519Niels *r, const SilcUInt64 *t)
+{
+  memcpy(r->ypx, t, sizeof(Fe25519));
+  memcpy(r->ymx, t + 5, sizeof(Fe25519));
+  memcpy(r->xy2d, t + 10, sizeof(Fe25519));
+}
+
+/* Encodes point */
+
+static void silc_ge_tobytes(unsigned char *s, const Fe25519 X,
+			    const Fe25519 Y, const Fe25519 Z)
+{
+  Fe25519 recip, x, y;
+
+  silc_fe_invert(recip, Z);
+  silc_fe_mul(x, X, recip);
+  silc_fe_mul(y, Y, recip);
+  silc_fe_tobytes(s, y);
+  s[31] ^= silc_fe_isnegative(x) << 7;
+}
+
+/* Decodes point and negates it.  Returns FALSE if the encoding is not
+   canonical or is not a point on the curve.  This is not constant time. */
+
+static SilcBool silc_ge_frombytes_negate(Ge25519 *h, const unsigned char *s)
+{
+  Fe25519 u, v, v3, vxx, check;
+  unsigned char t[32];
+
+  silc_fe_frombytes(h->Y, s);
+
+  /* The y must be less than p */
+  silc_fe_tobytes(t, h->Y);
+  t[31] |= s[31] & 0x80;
+  if (memcmp(t, s, sizeof(t)))
+    return FALSE;
+
+  /* x = sqrt((y ^ 2 - 1) / (d * y ^ 2 + 1)) = u * v ^ 3 *
+     (u * v ^ 7) ^ ((p - 5) / 8) */
+  silc_fe_1(h->Z);
+  silc_fe_sq(u, h->Y);
+  silc_fe_mul(v, u, silc_c25519_d);
+  silc_fe_sub(u, u, h->Z);
+  silc_fe_add(v, v, h->Z);
+
+  silc_fe_sq(v3, v);
+  silc_fe_mul(v3, v3, v);
+  silc_fe_sq(h->X, v3);
+  silc_fe_mul(h->X, h->X, v);
+  silc_fe_mul(h->X, h->X, u);
+  silc_fe_pow22523(h->X, h->X);
+  silc_fe_mul(h->X, h->X, v3);
+  silc_fe_mul(h->X, h->X, u);
+
+  silc_fe_sq(vxx, h->X);
+  silc_fe_mul(vxx, vxx, v);
+  silc_fe_sub(check, vxx, u);
+  if (silc_fe_isnonzero(check)) {
+    silc_fe_add(check, vxx, u);
+    if (silc_fe_isnonzero(check))
+      return FALSE;
+    silc_fe_mul(h->X, h->X, silc_c25519_sqrtm1);
+  }
+
+  /* x = 0 has only the positive encoding */
+  if (!silc_fe_isnonzero(h->X) && (s[31] >> 7))
+    return FALSE;
+
+  /* Take the negative of the encoded x */
+  if (silc_fe_isnegative(h->X) == (s[31] >> 7))
+    silc_fe_neg(h->X, h->X);
+
+  silc_fe_mul(h->T, h->X, h->Y);
+  return TRUE;
+}
+
+/* Returns 1 if b == c, 0 otherwise */
+
+static inline SilcUInt64 silc_ge_equal(SilcUInt32 b, SilcUInt32 c)
+{
+  SilcUInt32 x = b ^ c;
+  return (SilcUInt64)((x - 1) >> 31);
+}
+
+/* Selects b * 256 ^ pos * B from the base table, -8 <= b <= 8 */
+
+static void silc_ge_select(Ge25519Niels *t, int pos, signed char b)
+{
+  Ge25519Niels e, minus;
+  SilcUInt32 bneg = ((SilcUInt32)(SilcInt32)b) >> 31;
+  SilcUInt32 babs = b - ((0 - bneg) & ((SilcUInt32)b << 1));
+  const SilcUInt64 *table = silc_c25519_base_table + pos * 8 * 15;
+  int i;
+
+  /* The entry 0 is the point at infinity (1, 1, 0) */
+  silc_fe_1(t->ypx);
+  silc_fe_1(t->ymx);
+  silc_fe_0(t->xy2d);
+
+  for (i = 0; i < 8; i++) {
+    silc_ge_niels_load(&e, table + i * 15);
+    silc_fe_cmov(t->ypx, e.ypx, silc_ge_equal(babs, i + 1));
+    silc_fe_cmov(t->ymx, e.ymx, silc_ge_equal(babs, i + 1));
+    silc_fe_cmov(t->xy2d, e.xy2d, silc_ge_equal(babs, i + 1));
+  }
+
+  /* -(x, y) = (-x, y) */
+  silc_fe_copy(minus.ypx, t->ymx);
+  silc_fe_copy(minus.ymx, t->ypx);
+  silc_fe_neg(minus.xy2d, t->xy2d);
+  silc_fe_cmov(t->ypx, minus.ypx, bneg);
+  silc_fe_cmov(t->ymx, minus.ymx, bneg);
+  silc_fe_cmov(t->xy2d, minus.xy2d, bneg);
+}
+
+/* h = a * B.  The `a' must be less than 2 ^ 255.  This is constant time. */
+
+static void silc_ge_scalarmult_base(Ge25519 *h, const unsigned char *a)
+{
+  signed char e[64], carry;
+  Ge25519P1P1 r;
+  Ge25519P2 s;
+  Ge25519Niels t;
+  int i;
+
+  /* Signed 4 bit digits, -8 <= e[i] <= 8 */
+  for (i = 0; i < 32; i++) {
+    e[2 * i] = a[i] & 15;
+    e[2 * i + 1] = (a[i] >> 4) & 15;
+  }
+  carry = 0;
+  for (i = 0; i < 63; i++) {
+    e[i] += carry;
+    carry = (e[i] + 8) >> 4;
+    e[i] -= carry << 4;
+  }
+  e[63] += carry;
+
+  /* The odd digits, then multiply by 16 and add the even digits */
+  silc_ge_p3_0(h);
+  for (i = 1; i < 64; i += 2) {
+    silc_ge_select(&t, i / 2, e[i]);
+    silc_ge_madd(&r, h, &t);
+    silc_ge_p1p1_to_p3(h, &r);
+  }
+
+  silc_ge_p3_to_p2(&s, h);
+  silc_ge_p2_dbl(&r, &s);
+  silc_ge_p1p1_to_p2(&s, &r);
+  silc_ge_p2_dbl(&r, &s);
+  silc_ge_p1p1_to_p2(&s, &r);
+  silc_ge_p2_dbl(&r, &s);
+  silc_ge_p1p1_to_p2(&s, &r);
+  silc_ge_p2_dbl(&r, &s);
+  silc_ge_p1p1_to_p3(h, &r);
+
+  for (i = 0; i < 64; i += 2) {
+    silc_ge_select(&t, i / 2, e[i]);
+    silc_ge_madd(&r, h, &t);
+    silc_ge_p1p1_to_p3(h, &r);
+  }
+
+  memset(e, 0, sizeof(e));
+  memset(&t, 0, sizeof(t));
+}
+
+/* Computes width `w' NAF of the scalar `a', less than 2 ^ 255.  The
+   digits are odd and less than 2 ^ (w - 1) in absolute value. */
+
+static void silc_ge_naf(signed char *r, const unsigned char *a, int w)
+{
+  SilcUInt64 x[5], bits;
+  SilcUInt32 lo, hi, width = 1 << w, window, carry = 0, pos = 0;
+  int i;
+
+  for (i = 0; i < 4; i++) {
+    SILC_GET32_LSB(lo, a + i * 8);
+    SILC_GET32_LSB(hi, a + i * 8 + 4);
+    x[i] = ((SilcUInt64)hi << 32) | lo;
+  }
+  x[4] = 0;
+
+  memset(r, 0, 256);
+  while (pos < 256) {
+    i = pos >> 6;
+    bits = x[i] >> (pos & 63);
+    if ((int)(pos & 63) > 64 - w)
+      bits |= x[i + 1] << (64 - (pos & 63));
+
+    window = carry + (SilcUInt32)(bits & (width - 1));
+    if (!(window & 1)) {
+      pos++;
+      continue;
+    }
+
+    if (window < width / 2) {
+      carry = 0;
+      r[pos] = (signed char)window;
+    } else {
+      carry = 1;
+      r[pos] = (signed char)((SilcInt32)window - (SilcInt32)width);
+    }
+    pos += w;
+  }
+}
+
+/* r = b * B + sum of k[i] * p[i].  The `tab' must have space for 8 entries
+   and the `naf' for 256 digits of each of the `num' points, and the `naf'
+   for the base point in addition.  This is not constant time. */
+
+static void silc_ge_multi_scalarmult(Ge25519 *r, const unsigned char *b,
+				     const Ge25519 *p,
+				     const unsigned char *k,
+				     SilcUInt32 num, Ge25519Cached *tab,
+				     signed char *naf)
+{
+  Ge25519P1P1 t;
+  Ge25519P2 s;
+  Ge25519 u, p2;
+  Ge25519Niels n;
+  signed char *bnaf = naf + num * 256, d;
+  SilcUInt32 j;
+  int i, top = -1;
+
+  /* tab[8 * j + i] = (2 * i + 1) * p[j] */
+  for (j = 0; j < num; j++) {
+    silc_ge_p3_to_cached(&tab[8 * j], &p[j]);
+    silc_ge_p3_to_p2(&s, &p[j]);
+    silc_ge_p2_dbl(&t, &s);
+    silc_ge_p1p1_to_p3(&p2, &t);
+    for (i = 1; i < 8; i++) {
+      silc_ge_add(&t, &p2, &tab[8 * j + i - 1]);
+      silc_ge_p1p1_to_p3(&u, &t);
+      silc_ge_p3_to_cached(&tab[8 * j + i], &u);
+    }
+
+    silc_ge_naf(naf + j * 256, k + j * SILC_C25519_LEN,
+		SILC_C25519_NAF_WIDTH);
+  }
+  silc_ge_naf(bnaf, b, SILC_C25519_NAF_WIDTH_B);
+
+  /* Find the highest non-zero digit */
+  for (i = 255; i >= 0 && top < 0; i--) {
+    if (bnaf[i])
+      top = i;
+    for (j = 0; j < num && top < 0; j++)
+      if (naf[j * 256 + i])
+	top = i;
+  }
+
+  silc_ge_p3_0(r);
+  silc_ge_p3_to_p2(&s, r);
+
+  for (i = top; i >= 0; i--) {
+    silc_ge_p2_dbl(&t, &s);
+
+    for (j = 0; j < num; j++) {
+      d = naf[j * 256 + i];
+      if (d > 0) {
+	silc_ge_p1p1_to_p3(&u, &t);
+	silc_ge_add(&t, &u, &tab[8 * j + d / 2]);
+      } else if (d < 0) {
+	silc_ge_p1p1_to_p3(&u, &t);
+	silc_ge_sub(&t, &u, &tab[8 * j + (-d) / 2]);
+      }
+    }
+
+    d = bnaf[i];
+    if (d > 0) {
+      silc_ge_niels_load(&n, silc_c25519_odd_table + (d / 2) * 15);
+      silc_ge_p1p1_to_p3(&u, &t);
+      silc_ge_madd(&t, &u, &n);
+    } else if (d < 0) {
+      silc_ge_niels_load(&n, silc_c25519_odd_table + ((-d) / 2) * 15);
+      silc_ge_p1p1_to_p3(&u, &t);
+      silc_ge_msub(&t, &u, &n);
+    }
+
+    if (i > 0)
+      silc_ge_p1p1_to_p2(&s, &t);
+    else
+      silc_ge_p1p1_to_p3(r, &t);
+  }
+}
+
+/* Returns TRUE if 8 * p is the point at infinity */
+
+static SilcBool silc_ge_is_small_order(const Ge25519 *p)
+{
+  Ge25519P1P1 t;
+  Ge25519P2 s;
+  Fe25519 d;
+
+  silc_ge_p3_to_p2(&s, p);
+  silc_ge_p2_dbl(&t, &s);
+  silc_ge_p1p1_to_p2(&s, &t);
+  silc_ge_p2_dbl(&t, &s);
+  silc_ge_p1p1_to_p2(&s, &t);
+  silc_ge_p2_dbl(&t, &s);
+  silc_ge_p1p1_to_p2(&s, &t);
+
+  /* (0 : Z : Z) */
+  silc_fe_sub(d, s.Y, s.Z);
+  return !silc_fe_isnonzero(s.X) && !silc_fe_isnonzero(d);
+}
+
+/**************************** Scalar arithmetic *****************************/
+
+/* Decodes little-endian scalar of `len' bytes */
+
+static void silc_sc_load(SilcUInt32 *r, const unsigned char *s,
+			 SilcUInt32 len)
+{
+  SilcUInt32 i;
+
+  memset(r, 0, SILC_ECP_MAX_DIGITS * sizeof(*r));
+  for (i = 0; i < len; i++)
+    r[i >> 2] |= (SilcUInt32)s[i] << ((i & 3) * 8);
+}
+
+/* Encodes scalar as 32 bytes little-endian */
+
+static void silc_sc_store(unsigned char *s, const SilcUInt32 *a)
+{
+  SilcUInt32 i;
+
+  for (i = 0; i < 32; i++)
+    s[i] = a[i >> 2] >> ((i & 3) * 8);
+}
+
+/* r = a mod l, any `a' less than 2 ^ 256 */
+
+static void silc_sc_mod(SilcUInt32 *r, const SilcUInt32 *a)
+{
+  silc_ecp_mont_to(&silc_c25519_l, r, a);
+  silc_ecp_mont_from(&silc_c25519_l, r, r);
+}
+
+/* r = s mod l, the `s' is 64 bytes */
+
+void silc_c25519_sc_reduce(unsigned char *r, const unsigned char *s)
+{
+  SilcUInt32 lo[SILC_ECP_MAX_DIGITS], hi[SILC_ECP_MAX_DIGITS];
+
+  /* s = lo + hi * R */
+  silc_sc_load(lo, s, 32);
+  silc_sc_load(hi, s + 32, 32);
+  silc_sc_mod(lo, lo);
+  silc_ecp_mont_to(&silc_c25519_l, hi, hi);
+  silc_ecp_mod_add(&silc_c25519_l, lo, lo, hi);
+  silc_sc_store(r, lo);
+
+  memset(lo, 0, sizeof(lo));
+  memset(hi, 0, sizeof(hi));
+}
+
+/* r = a * b + c mod l */
+
+void silc_c25519_sc_muladd(unsigned char *r, const unsigned char *a,
+			   const unsigned char *b, const unsigned char *c)
+{
+  SilcUInt32 x[SILC_ECP_MAX_DIGITS], y[SILC_ECP_MAX_DIGITS];
+  SilcUInt32 z[SILC_ECP_MAX_DIGITS];
+
+  silc_sc_load(x, a, 32);
+  silc_sc_load(y, b, 32);
+  silc_sc_load(z, c, 32);
+  silc_sc_mod(y, y);
+  silc_sc_mod(z, z);
+
+  /* x = a * b * R ^ -1 * R */
+  silc_ecp_mont_mul(&silc_c25519_l, x, x, y);
+  silc_ecp_mont_to(&silc_c25519_l, x, x);
+  silc_ecp_mod_add(&silc_c25519_l, x, x, z);
+  silc_sc_store(r, x);
+
+  memset(x, 0, sizeof(x));
+  memset(y, 0, sizeof(y));
+  memset(z, 0, sizeof(z));
+}
+
+/* Returns TRUE if s < l */
+
+SilcBool silc_c25519_sc_is_canonical(const unsigned char *s)
+{
+  SilcUInt32 a[SILC_ECP_MAX_DIGITS];
+
+  silc_sc_load(a, s, 32);
+  return silc_ecp_num_cmp(a, silc_c25519_l.m, 8) < 0;
+}
+
+/****************************** Ed25519 group *******************************/
+
+/* out = scalar * B, encoded.  The `scalar' must be less than 2 ^ 255. */
+
+void silc_c25519_mul_base(unsigned char *out, const unsigned char *scalar)
+{
+  Ge25519 h;
+
+  silc_ge_scalarmult_base(&h, scalar);
+  silc_ge_tobytes(out, h.X, h.Y, h.Z);
+  memset(&h, 0, sizeof(h));
+}
+
+/* out = scalar * 9, the X25519 public value.  Computed as the Edwards
+   base point multiplication, u = (1 + y) / (1 - y) = (Z + Y) / (Z - Y). */
+
+void silc_c25519_x25519_base(unsigned char *out, const unsigned char *scalar)
+{
+  unsigned char k[32];
+  Fe25519 n, d;
+  Ge25519 h;
+
+  memcpy(k, scalar, sizeof(k));
+  k[0] &= 248;
+  k[31] &= 127;
+  k[31] |= 64;
+
+  silc_ge_scalarmult_base(&h, k);
+  silc_fe_add(n, h.Z, h.Y);
+  silc_fe_sub(d, h.Z, h.Y);
+  silc_fe_invert(d, d);
+  silc_fe_mul(n, n, d);
+  silc_fe_tobytes(out, n);
+
+  memset(k, 0, sizeof(k));
+  memset(&h, 0, sizeof(h));
+  memset(n, 0, sizeof(n));
+}
+
+/* Returns TRUE if `p' is canonical encoding of a point on the curve */
+
+SilcBool silc_c25519_point_check(const unsigned char *p)
+{
+  Ge25519 h;
+  return silc_ge_frombytes_negate(&h, p);
+}
+
+/* Verifies that 8 * (s * B - h * A - R) is the point at infinity.  The
+   `s' and `h' must be less than l. */
+
+SilcBool silc_c25519_verify(const unsigned char *s, const unsigned char *h,
+			    const unsigned char *a, const unsigned char *r)
+{
+  Ge25519Cached tab[8], rc;
+  signed char naf[2 * 256];
+  Ge25519 na, nr, p;
+  Ge25519P1P1 t;
+
+  if (!silc_ge_frombytes_negate(&na, a) ||
+      !silc_ge_frombytes_negate(&nr, r))
+    return FALSE;
+
+  /* p = s * B + h * (-A) + (-R) */
+  silc_ge_multi_scalarmult(&p, s, &na, h, 1, tab, naf);
+  silc_ge_p3_to_cached(&rc, &nr);
+  silc_ge_add(&t, &p, &rc);
+  silc_ge_p1p1_to_p3(&p, &t);
+
+  return silc_ge_is_small_order(&p);
+}
+
+/* Verifies one batch of signatures.  The equation is
+   8 * ((sum z * s) * B - sum z * R - sum (z * h) * A) = 0. */
+
+static SilcBool silc_c25519_verify_batch_one(const C25519Verify *sigs,
+					     SilcUInt32 num_sigs,
+					     Ge25519 *points,
+					     unsigned char *scalars,
+					     Ge25519Cached *tab,
+					     signed char *naf)
+{
+  unsigned char z[SILC_C25519_LEN], b[SILC_C25519_LEN];
+  unsigned char zero[SILC_C25519_LEN];
+  SilcUInt32 i;
+  Ge25519 p;
+
+  memset(b, 0, sizeof(b));
+  memset(z, 0, sizeof(z));
+  memset(zero, 0, sizeof(zero));
+
+  for (i = 0; i < num_sigs; i++) {
+    if (!silc_ge_frombytes_negate(&points[2 * i], sigs[i].r) ||
+	!silc_ge_frombytes_negate(&points[2 * i + 1], sigs[i].a))
+      return FALSE;
+
+    memcpy(z, sigs[i].z, sizeof(sigs[i].z));
+    memcpy(scalars + 2 * i * SILC_C25519_LEN, z, SILC_C25519_LEN);
+    silc_c25519_sc_muladd(scalars + (2 * i + 1) * SILC_C25519_LEN,
+			  z, sigs[i].h, zero);
+    silc_c25519_sc_muladd(b, z, sigs[i].s, b);
+  }
+
+  silc_ge_multi_scalarmult(&p, b, points, scalars, 2 * num_sigs, tab, naf);
+
+  return silc_ge_is_small_order(&p);
+}
+
+/* Verifies the signatures in batches of at most SILC_C25519_BATCH_MAX
+   signatures.  Returns TRUE if all signatures are valid.  If this returns
+   FALSE at least one of them is invalid. */
+
+SilcBool silc_c25519_verify_batch(const C25519Verify *sigs,
+				  SilcUInt32 num_sigs)
+{
+  Ge25519 *points;
+  Ge25519Cached *tab;
+  unsigned char *scalars;
+  signed char *naf;
+  SilcUInt32 n, max;
+  SilcBool ret = TRUE;
+
+  max = num_sigs < SILC_C25519_BATCH_MAX ? num_sigs : SILC_C25519_BATCH_MAX;
+  if (!max)
+    return TRUE;
+
+  points = silc_malloc(2 * max * sizeof(*points));
+  tab = silc_malloc(2 * max * 8 * sizeof(*tab));
+  scalars = silc_malloc(2 * max * SILC_C25519_LEN);
+  naf = silc_malloc((2 * max + 1) * 256);
+  if (!points || !tab || !scalars || !naf) {
+    ret = FALSE;
+    goto out;
+  }
+
+  while (num_sigs > 0 && ret) {
+    n = num_sigs < max ? num_sigs : max;
+    ret = silc_c25519_verify_batch_one(sigs, n, points, scalars, tab, naf);
+    sigs += n;
+    num_sigs -= n;
+  }
+
+ out:
+  silc_free(points);
+  silc_free(tab);
+  silc_free(scalars);
+  silc_free(naf);
+  return ret;
+}
@@ -0,0 +1,55 @@
+/*
+
+  curve25519.h
+
+  Author: Pekka Riikonen <priikone@silcnet.org>
+
+  Copyright (C) 2008 Pekka Riikonen
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; version 2 of the License.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+*/
+
+#ifndef CURVE25519_H
+#define CURVE25519_H
+
+/* Curve25519 (RFC 7748) and the birationally equivalent twisted Edwards
+   curve edwards25519 used by Ed25519 (RFC 8032).  All integers and points
+   are encoded as 32 byte little-endian strings.  The scalars of the
+   Edwards group are integers modulo the group order l. */
+
+/* Length of encoded point and scalar */
+#define SILC_C25519_LEN 32
+
+/* One signature in batch verification, see silc_c25519_verify_batch */
+typedef struct {
+  const unsigned char *a;		/* Public key A */
+  const unsigned char *r;		/* R of the signature */
+  const unsigned char *s;		/* S of the signature, less than l */
+  unsigned char h[SILC_C25519_LEN];	/* H(R || A || M) mod l */
+  unsigned char z[16];			/* Random coefficient */
+} C25519Verify;
+
+void silc_c25519_x25519(unsigned char *out, const unsigned char *scalar,
+			const unsigned char *u);
+void silc_c25519_x25519_base(unsigned char *out,
+			     const unsigned char *scalar);
+void silc_c25519_mul_base(unsigned char *out, const unsigned char *scalar);
+SilcBool silc_c25519_point_check(const unsigned char *p);
+SilcBool silc_c25519_verify(const unsigned char *s, const unsigned char *h,
+			    const unsigned char *a, const unsigned char *r);
+SilcBool silc_c25519_verify_batch(const C25519Verify *sigs,
+				  SilcUInt32 num_sigs);
+void silc_c25519_sc_reduce(unsigned char *r, const unsigned char *s);
+void silc_c25519_sc_muladd(unsigned char *r, const unsigned char *a,
+			   const unsigned char *b, const unsigned char *c);
+SilcBool silc_c25519_sc_is_canonical(const unsigned char *s);
+
+#endif /* CURVE25519_H */
@@ -19,6 +19,7 @@
 
 #include "silccrypto.h"
 #include "dsa.h"
+#include "rfc6979.h"
 
 /************************** DSA PKCS Algorithm API **************************/
 
@@ -143,7 +144,16 @@ silc_dsa_generate_key_int(const struct SilcPKCSAlgorithmStruct *pkcs,
   silc_mp_bin2mp(rnd, q_len, &privkey->x);
 
   /* Generate public key */
-  silc_mp_pow_mod(&privkey->y, &privkey->g, &privkey->x, &privkey->p);
+  privkey->group_order = q_len;
+  silc_dsa_private_key_mont_init(privkey);
+  if (privkey->fixed_g)
+    silc_mp_pow_mod_fixed(&privkey->y, &privkey->x, privkey->fixed_g);
+  else if (privkey->mont)
+    silc_mp_pow_mod_mont_secret(&privkey->y, &privkey->g, &privkey->x,
+				&privkey->mont_p);
+  else
+    silc_mp_pow_mod_secret(&privkey->y, &privkey->g, &privkey->x,
+			   &privkey->p);
 
   /* Now set the integers to public key too */
   silc_mp_set(&pubkey->p, &privkey->p);
@@ -151,10 +161,10 @@ silc_dsa_generate_key_int(const struct SilcPKCSAlgorithmStruct *pkcs,
   silc_mp_set(&pubkey->g, &privkey->g);
   silc_mp_set(&pubkey->y, &privkey->y);
 
-  privkey->group_order = q_len;
   privkey->bits = keylen;
   pubkey->group_order = q_len;
   pubkey->bits = keylen;
+  silc_dsa_public_key_mont_init(pubkey);
 
   silc_mp_uninit(&tmp);
   silc_mp_uninit(&tmp2);
@@ -198,6 +208,55 @@ SILC_PKCS_ALG_GENERATE_KEY(silc_dsa_generate_key)
 				   ret_public_key, ret_private_key);
 }
 
+/* Precomputes the Montgomery context of p.  If this fails the operations
+   compute it in each exponentiation. */
+
+void silc_dsa_public_key_mont_init(DsaPublicKey *key)
+{
+  silc_dsa_public_key_mont_uninit(key);
+  if (silc_mp_mont_init(&key->mont_p, &key->p))
+    key->mont = TRUE;
+}
+
+/* Frees the Montgomery context */
+
+void silc_dsa_public_key_mont_uninit(DsaPublicKey *key)
+{
+  if (!key->mont)
+    return;
+  silc_mp_mont_uninit(&key->mont_p);
+  key->mont = FALSE;
+}
+
+/* Precomputes the Montgomery context of p and the fixed-base table of g
+   for signing.  The random k has group order bytes. */
+
+void silc_dsa_private_key_mont_init(DsaPrivateKey *key)
+{
+  SilcUInt32 exp_bits;
+
+  silc_dsa_private_key_mont_uninit(key);
+  if (!silc_mp_mont_init(&key->mont_p, &key->p))
+    return;
+  key->mont = TRUE;
+
+  exp_bits = key->group_order ? key->group_order * 8 :
+    silc_mp_sizeinbase(&key->q, 2);
+  key->fixed_g = silc_mp_fixed_alloc(&key->g, &key->p, exp_bits, 0);
+}
+
+/* Frees the Montgomery context and the fixed-base table */
+
+void silc_dsa_private_key_mont_uninit(DsaPrivateKey *key)
+{
+  silc_mp_fixed_free(key->fixed_g);
+  key->fixed_g = NULL;
+  if (!key->mont)
+    return;
+  silc_mp_mont_uninit(&key->mont_p);
+  key->mont = FALSE;
+}
+
 /* Import DSA public key */
 
 SILC_PKCS_ALG_IMPORT_PUBLIC_KEY(silc_dsa_import_public_key)
@@ -236,6 +295,8 @@ SILC_PKCS_ALG_IMPORT_PUBLIC_KEY(silc_dsa_import_public_key)
   /* Set key length */
   pubkey->bits = ((silc_mp_sizeinbase(&pubkey->p, 2) + 7) / 8) * 8;
 
+  silc_dsa_public_key_mont_init(pubkey);
+
   silc_asn1_free(asn1);
 
   return key_len;
@@ -307,8 +368,13 @@ SILC_PKCS_ALG_PUBLIC_KEY_COPY(silc_dsa_public_key_copy)
   silc_mp_init(&new_key->q);
   silc_mp_init(&new_key->g);
   silc_mp_init(&new_key->y);
+  silc_mp_set(&new_key->p, &key->p);
+  silc_mp_set(&new_key->q, &key->q);
+  silc_mp_set(&new_key->g, &key->g);
+  silc_mp_set(&new_key->y, &key->y);
   new_key->bits = key->bits;
   new_key->group_order = key->group_order;
+  silc_dsa_public_key_mont_init(new_key);
 
   return new_key;
 }
@@ -341,6 +407,7 @@ SILC_PKCS_ALG_PUBLIC_KEY_FREE(silc_dsa_public_key_free)
 {
   DsaPublicKey *key = public_key;
 
+  silc_dsa_public_key_mont_uninit(key);
   silc_mp_uninit(&key->p);
   silc_mp_uninit(&key->q);
   silc_mp_uninit(&key->g);
@@ -389,6 +456,8 @@ SILC_PKCS_ALG_IMPORT_PRIVATE_KEY(silc_dsa_import_private_key)
   /* Set key length */
   privkey->bits = ((silc_mp_sizeinbase(&privkey->p, 2) + 7) / 8) * 8;
 
+  silc_dsa_private_key_mont_init(privkey);
+
   silc_asn1_free(asn1);
 
   return key_len;
@@ -452,6 +521,7 @@ SILC_PKCS_ALG_PRIVATE_KEY_FREE(silc_dsa_private_key_free)
 {
   DsaPrivateKey *key = private_key;
 
+  silc_dsa_private_key_mont_uninit(key);
   silc_mp_uninit(&key->p);
   silc_mp_uninit(&key->q);
   silc_mp_uninit(&key->g);
@@ -487,38 +557,41 @@ SILC_PKCS_ALG_SIGN(silc_dsa_sign)
   unsigned char kbuf[512], hashr[SILC_HASH_MAXLEN];
   SilcBufferStruct sig;
   SilcMPInt tmp, k, kinv, r, s;
+  Rfc6979Drbg drbg;
+  SilcHash ihash = NULL;
   SilcStack stack;
   SilcAsn1 asn1;
 
   SILC_LOG_DEBUG(("Sign"));
 
-  if (key->group_order > sizeof(kbuf)) {
-    sign_cb(FALSE, NULL, 0, context);
-    return NULL;
-  }
-
-  if (!rng) {
-    SILC_LOG_ERROR(("DSA signing requires random number generator"));
+  /* The nonce is derived with the key's hash if `hash' is not given */
+  if (key->group_order * 2 + 8 > sizeof(kbuf) || (!hash && !key->hash)) {
     sign_cb(FALSE, NULL, 0, context);
     return NULL;
   }
 
-  /* Compute hash if requested */
+  /* Compute hash if requested.  The key's own hash context is not used, as
+     the key may be used in other threads at the same time. */
   if (compute_hash) {
-    if (!hash)
-      hash = key->hash;
-    silc_hash_make(hash, src, src_len, hashr);
+    if (!hash &&
+	!silc_crypto_thread_hash_get(silc_hash_get_name(key->hash), &ihash)) {
+      sign_cb(FALSE, NULL, 0, context);
+      return NULL;
+    }
+    silc_hash_make(ihash ? ihash : hash, src, src_len, hashr);
     src = hashr;
-    src_len = silc_hash_len(hash);
+    src_len = silc_hash_len(ihash ? ihash : hash);
     if (src_len > key->group_order)
       src_len = key->group_order;
+    silc_crypto_thread_hash_put(ihash);
   }
 
-  stack = silc_stack_alloc(2048, silc_crypto_stack());
+  stack = silc_crypto_thread_stack();
+  silc_stack_push(stack, NULL);
 
   asn1 = silc_asn1_alloc(stack);
   if (!asn1) {
-    silc_stack_free(stack);
+    silc_stack_pop(stack);
     sign_cb(FALSE, NULL, 0, context);
     return NULL;
   }
@@ -529,20 +602,50 @@ SILC_PKCS_ALG_SIGN(silc_dsa_sign)
   silc_mp_sinit(stack, &s);
   silc_mp_sinit(stack, &tmp);
 
+  /* Without RNG k is derived from x and the digest as in RFC 6979 */
+  if (!rng) {
+    silc_mp_mp2bin_noalloc(&key->x, kbuf, key->group_order);
+    silc_mp_bin2mp(src, (src_len < key->group_order ? src_len :
+			 key->group_order), &tmp);
+    silc_mp_mod(&tmp, &tmp, &key->q);
+    silc_mp_mp2bin_noalloc(&tmp, kbuf + key->group_order, key->group_order);
+    if (!silc_rfc6979_init(&drbg, hash ? hash : key->hash, kbuf,
+			   key->group_order, kbuf + key->group_order,
+			   key->group_order)) {
+      sign_cb(FALSE, NULL, 0, context);
+      goto out;
+    }
+  }
+
   do {
     do {
-      /* Generate random k */
-      do {
-	silc_rng_get_rn_data(rng, key->group_order, kbuf, sizeof(kbuf));
-	silc_mp_bin2mp(kbuf, key->group_order, &k);
-	silc_mp_gcd(&tmp, &k, &key->q);
-      } while (silc_mp_cmp_ui(&tmp, 1) != 0);
+      if (rng) {
+	/* Generate random k = c mod (q - 1) + 1, where c has 64 bits more
+	   than q, as in FIPS 186-4 B.2.1 */
+	silc_rng_get_rn_data(rng, key->group_order + 8, kbuf, sizeof(kbuf));
+	silc_mp_bin2mp(kbuf, key->group_order + 8, &k);
+	silc_mp_sub_ui(&tmp, &key->q, 1);
+	silc_mp_mod(&k, &k, &tmp);
+	silc_mp_add_ui(&k, &k, 1);
+      } else {
+	/* Generate deterministic k, 0 < k < q */
+	do {
+	  silc_rfc6979_generate(&drbg, kbuf, key->group_order);
+	  silc_mp_bin2mp(kbuf, key->group_order, &k);
+	} while (silc_mp_cmp_ui(&k, 0) == 0 ||
+		 silc_mp_cmp(&k, &key->q) >= 0);
+      }
 
       /* Compute kinv = k^-1 mod q */
       silc_mp_modinv(&kinv, &k, &key->q);
 
       /* Compute signature part r = g^k mod p mod q */
-      silc_mp_pow_mod(&r, &key->g, &k, &key->p);
+      if (key->fixed_g)
+	silc_mp_pow_mod_fixed(&r, &k, key->fixed_g);
+      else if (key->mont)
+	silc_mp_pow_mod_mont_secret(&r, &key->g, &k, &key->mont_p);
+      else
+	silc_mp_pow_mod_secret(&r, &key->g, &k, &key->p);
       silc_mp_mod(&r, &r, &key->q);
     } while (silc_mp_cmp_ui(&r, 0) == 0);
 
@@ -570,6 +673,8 @@ SILC_PKCS_ALG_SIGN(silc_dsa_sign)
 
  out:
   memset(kbuf, 0, sizeof(kbuf));
+  if (!rng)
+    silc_rfc6979_uninit(&drbg);
   if (compute_hash)
     memset(hashr, 0, sizeof(hashr));
   silc_mp_uninit(&k);
@@ -578,7 +683,7 @@ SILC_PKCS_ALG_SIGN(silc_dsa_sign)
   silc_mp_uninit(&s);
   silc_mp_uninit(&tmp);
   silc_asn1_free(asn1);
-  silc_stack_free(stack);
+  silc_stack_pop(stack);
 
   return NULL;
 }
@@ -592,30 +697,31 @@ SILC_PKCS_ALG_VERIFY(silc_dsa_verify)
   SilcBool ret = FALSE;
   SilcBufferStruct sig;
   SilcMPInt r, s, v, w, u1, u2;
+  SilcHash ihash = NULL;
   SilcStack stack;
   SilcAsn1 asn1;
 
   SILC_LOG_DEBUG(("Verify"));
 
-  stack = silc_stack_alloc(2048, silc_crypto_stack());
+  stack = silc_crypto_thread_stack();
+  silc_stack_push(stack, NULL);
 
   asn1 = silc_asn1_alloc(stack);
   if (!asn1) {
-    silc_stack_free(stack);
+    silc_stack_pop(stack);
     verify_cb(FALSE, context);
     return NULL;
   }
 
-  /* Decode the signature */
+  /* Decode the signature.  The integers are allocated from the stack. */
   silc_buffer_set(&sig, signature, signature_len);
   if (!silc_asn1_decode(asn1, &sig,
-			SILC_ASN1_OPTS(SILC_ASN1_ALLOC),
 			SILC_ASN1_SEQUENCE,
 			  SILC_ASN1_INT(&r),
 			  SILC_ASN1_INT(&s),
 			SILC_ASN1_END, SILC_ASN1_END)) {
     silc_asn1_free(asn1);
-    silc_stack_free(stack);
+    silc_stack_pop(stack);
     verify_cb(FALSE, context);
     return NULL;
   }
@@ -624,21 +730,35 @@ SILC_PKCS_ALG_VERIFY(silc_dsa_verify)
       silc_mp_cmp_ui(&s, 0) == 0 ||
       silc_mp_cmp(&r, &key->q) >= 0 ||
       silc_mp_cmp(&s, &key->q) >= 0) {
+    silc_mp_uninit(&r);
+    silc_mp_uninit(&s);
     silc_asn1_free(asn1);
-    silc_stack_free(stack);
+    silc_stack_pop(stack);
     verify_cb(FALSE, context);
     return NULL;
   }
 
-  /* Hash data if requested */
+  /* Hash data if requested.  The key's own hash context is not used, as
+     the key may be used in other threads at the same time. */
   if (compute_hash) {
-    if (!hash)
-      hash = key->hash;
+    if (!hash && (!key->hash ||
+		  !silc_crypto_thread_hash_get(silc_hash_get_name(key->hash),
+					       &ihash))) {
+      silc_mp_uninit(&r);
+      silc_mp_uninit(&s);
+      silc_asn1_free(asn1);
+      silc_stack_pop(stack);
+      verify_cb(FALSE, context);
+      return NULL;
+    }
+    if (ihash)
+      hash = ihash;
     silc_hash_make(hash, data, data_len, hashr);
     data = hashr;
     data_len = silc_hash_len(hash);
     if (data_len > key->group_order)
       data_len = key->group_order;
+    silc_crypto_thread_hash_put(ihash);
   }
 
   silc_mp_sinit(stack, &v);
@@ -659,8 +779,13 @@ SILC_PKCS_ALG_VERIFY(silc_dsa_verify)
   silc_mp_mod(&u2, &u2, &key->q);
 
   /* Compute v = g ^ u1 * y ^ u2 mod p mod q */
-  silc_mp_pow_mod(&u1, &key->g, &u1, &key->p);
-  silc_mp_pow_mod(&u2, &key->y, &u2, &key->p);
+  if (key->mont) {
+    silc_mp_pow_mod_mont(&u1, &key->g, &u1, &key->mont_p);
+    silc_mp_pow_mod_mont(&u2, &key->y, &u2, &key->mont_p);
+  } else {
+    silc_mp_pow_mod(&u1, &key->g, &u1, &key->p);
+    silc_mp_pow_mod(&u2, &key->y, &u2, &key->p);
+  }
   silc_mp_mul(&v, &u1, &u2);
   silc_mp_mod(&v, &v, &key->p);
   silc_mp_mod(&v, &v, &key->q);
@@ -678,8 +803,10 @@ SILC_PKCS_ALG_VERIFY(silc_dsa_verify)
   silc_mp_uninit(&w);
   silc_mp_uninit(&u1);
   silc_mp_uninit(&u2);
+  silc_mp_uninit(&r);
+  silc_mp_uninit(&s);
   silc_asn1_free(asn1);
-  silc_stack_free(stack);
+  silc_stack_pop(stack);
 
   return NULL;
 }
@@ -27,8 +27,10 @@ typedef struct {
   SilcMPInt p;			/* prime */
   SilcMPInt q;			/* prime */
   SilcMPInt y;			/* public key */
+  SilcMPMont mont_p;		/* Montgomery context of p */
   SilcUInt16 bits;		/* bits in key */
   SilcUInt16 group_order;	/* group order (size) */
+  unsigned int mont : 1;	/* Set when Montgomery context is set */
 } DsaPublicKey;
 
 /* DSA Private key */
@@ -39,8 +41,11 @@ typedef struct {
   SilcMPInt q;			/* prime */
   SilcMPInt y;			/* public key */
   SilcMPInt x;			/* private key */
+  SilcMPMont mont_p;		/* Montgomery context of p */
+  SilcMPFixedBase fixed_g;	/* Fixed-base table of g, may be NULL */
   SilcUInt16 bits;		/* bits in key */
   SilcUInt16 group_order;	/* group order (size) */
+  unsigned int mont : 1;	/* Set when Montgomery context is set */
 } DsaPrivateKey;
 
 SILC_PKCS_ALG_GENERATE_KEY(silc_dsa_fips186_2_generate_key);
@@ -59,5 +64,9 @@ SILC_PKCS_ALG_ENCRYPT(silc_dsa_encrypt);
 SILC_PKCS_ALG_DECRYPT(silc_dsa_decrypt);
 SILC_PKCS_ALG_SIGN(silc_dsa_sign);
 SILC_PKCS_ALG_VERIFY(silc_dsa_verify);
+void silc_dsa_public_key_mont_init(DsaPublicKey *key);
+void silc_dsa_public_key_mont_uninit(DsaPublicKey *key);
+void silc_dsa_private_key_mont_init(DsaPrivateKey *key);
+void silc_dsa_private_key_mont_uninit(DsaPrivateKey *key);
 
 #endif /* DSA_H */
@@ -0,0 +1,698 @@
+/*
+
+  ecdsa.c
+
+  Author: Pekka Riikonen <priikone@silcnet.org>
+
+  Copyright (C) 2008 Pekka Riikonen
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; version 2 of the License.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+*/
+
+#include "silccrypto.h"
+#include "ecdsa.h"
+#include "rfc6979.h"
+
+/************************* ECDSA PKCS Algorithm API *************************/
+
+/* Notes about key formats:
+
+   For ECDSA private key we use the format defined in RFC 5915, which is
+   the same as the OpenSSL EC private key format.  The curve is identified
+   by its OID:
+
+   key ::= SEQUENCE {
+     ver        INTEGER,		-- 1
+     privateKey OCTET STRING,
+     curve      [0] EXPLICIT OBJECT IDENTIFIER,
+     publicKey  [1] EXPLICIT BIT STRING OPTIONAL }
+
+   For ECDSA public keys we use our own format, as with DSA, which is the
+   concatenation of the curve OID (the algorithm params) and the public
+   key point in the uncompressed format 0x04 || x || y:
+
+   key ::= SEQUENCE {
+     curve      OBJECT IDENTIFIER,
+     publicKey  BIT STRING }
+
+   Notes about signature format:
+
+   The encoded signature format is compliant with PKIX (X.509):
+
+   sig ::= SEQUENCE {
+     r     INTEGER,
+     s     INTEGER }
+
+*/
+
+/* Generates random integer between 1 and n - 1.  The RNG returns non-zero
+   bytes only, so the random data is hashed with the curve hash function,
+   whose output is at least as long as the curve.  The `hash' must not be
+   used by other threads at the same time. */
+
+static void silc_ecdsa_random(const EcpCurve *curve, SilcHash hash,
+			      SilcRng rng, SilcUInt32 *k)
+{
+  unsigned char rnd[SILC_HASH_MAXLEN], h[SILC_HASH_MAXLEN];
+
+  do {
+    silc_rng_get_rn_data(rng, sizeof(rnd), rnd, sizeof(rnd));
+    silc_hash_make(hash, rnd, sizeof(rnd), h);
+    silc_ecp_bin2num(k, h, curve->bytes);
+  } while (silc_ecp_num_is_zero(k, curve->n.len) ||
+	   silc_ecp_num_cmp(k, curve->n.m, curve->n.len) >= 0);
+
+  memset(rnd, 0, sizeof(rnd));
+  memset(h, 0, sizeof(h));
+}
+
+/* Computes the integer e from the message digest.  The digest is truncated
+   to the length of n. */
+
+static void silc_ecdsa_digest(const EcpCurve *curve, const unsigned char *data,
+			      SilcUInt32 data_len, SilcUInt32 *e)
+{
+  if (data_len > curve->bytes)
+    data_len = curve->bytes;
+  silc_ecp_bin2num(e, data, data_len);
+  silc_ecp_mod_reduce(&curve->n, e, e);
+}
+
+/* Generates ECDSA key pair.  The key length selects the curve. */
+
+SILC_PKCS_ALG_GENERATE_KEY(silc_ecdsa_generate_key)
+{
+  EcdsaPublicKey *pubkey;
+  EcdsaPrivateKey *privkey;
+  const EcpCurve *curve;
+  EcpPoint q;
+
+  curve = silc_ecp_find_curve_bits(keylen);
+  if (!curve) {
+    SILC_LOG_DEBUG(("Unsupported ECDSA key length %d", keylen));
+    return FALSE;
+  }
+
+  pubkey = silc_calloc(1, sizeof(*pubkey));
+  if (!pubkey)
+    return FALSE;
+
+  privkey = silc_calloc(1, sizeof(*privkey));
+  if (!privkey) {
+    silc_free(pubkey);
+    return FALSE;
+  }
+
+  if (!silc_hash_alloc(curve->hash, &pubkey->hash) ||
+      !silc_hash_alloc(curve->hash, &privkey->hash)) {
+    silc_hash_free(pubkey->hash);
+    silc_free(pubkey);
+    silc_free(privkey);
+    return FALSE;
+  }
+  pubkey->curve = privkey->curve = curve;
+
+  /* Generate private key d and public key q = d * G */
+  silc_ecdsa_random(curve, privkey->hash, rng, privkey->d);
+  silc_ecp_mul_base(curve, &q, privkey->d);
+  silc_ecp_to_affine(curve, &privkey->q, &q);
+  pubkey->q = privkey->q;
+
+  if (ret_public_key)
+    *ret_public_key = pubkey;
+  if (ret_private_key)
+    *ret_private_key = privkey;
+
+  return TRUE;
+}
+
+/* Import ECDSA public key */
+
+SILC_PKCS_ALG_IMPORT_PUBLIC_KEY(silc_ecdsa_import_public_key)
+{
+  SilcAsn1 asn1;
+  SilcBufferStruct alg_key;
+  EcdsaPublicKey *pubkey;
+  unsigned char *pt;
+  SilcUInt32 pt_len;
+  char *oid;
+
+  SILC_LOG_DEBUG(("Import public key"));
+
+  if (!ret_public_key)
+    return 0;
+
+  asn1 = silc_asn1_alloc(NULL);
+  if (!asn1)
+    return 0;
+
+  /* Allocate ECDSA public key */
+  *ret_public_key = pubkey = silc_calloc(1, sizeof(*pubkey));
+  if (!pubkey)
+    goto err;
+
+  /* Parse */
+  silc_buffer_set(&alg_key, key, key_len);
+  if (!silc_asn1_decode(asn1, &alg_key,
+			SILC_ASN1_SEQUENCE,
+			  SILC_ASN1_OID(&oid),
+			  SILC_ASN1_BIT_STRING(&pt, &pt_len),
+			SILC_ASN1_END, SILC_ASN1_END))
+    goto err;
+
+  pubkey->curve = silc_ecp_find_curve_oid(oid);
+  if (!pubkey->curve) {
+    SILC_LOG_DEBUG(("Unsupported curve %s", oid));
+    goto err;
+  }
+
+  /* Decode and validate the point */
+  if (!silc_ecp_point_decode(pubkey->curve, pt, pt_len / 8, &pubkey->q)) {
+    SILC_LOG_DEBUG(("Invalid ECDSA public key"));
+    goto err;
+  }
+
+  if (!silc_hash_alloc(pubkey->curve->hash, &pubkey->hash))
+    goto err;
+
+  silc_asn1_free(asn1);
+
+  return key_len;
+
+ err:
+  silc_free(pubkey);
+  silc_asn1_free(asn1);
+  return 0;
+}
+
+/* Export ECDSA public key */
+
+SILC_PKCS_ALG_EXPORT_PUBLIC_KEY(silc_ecdsa_export_public_key)
+{
+  EcdsaPublicKey *key = public_key;
+  unsigned char pt[1 + 2 * SILC_ECP_MAX_DIGITS * 4];
+  SilcAsn1 asn1 = NULL;
+  SilcBufferStruct alg_key;
+  SilcUInt32 pt_len;
+  unsigned char *ret;
+
+  SILC_LOG_DEBUG(("Export public key"));
+
+  asn1 = silc_asn1_alloc(stack);
+  if (!asn1)
+    goto err;
+
+  pt_len = silc_ecp_point_encode(key->curve, &key->q, pt);
+
+  /* Encode public key */
+  memset(&alg_key, 0, sizeof(alg_key));
+  if (!silc_asn1_encode(asn1, &alg_key,
+			SILC_ASN1_OPTS(SILC_ASN1_ALLOC),
+			SILC_ASN1_SEQUENCE,
+			  SILC_ASN1_OID(key->curve->oid),
+			  SILC_ASN1_BIT_STRING(pt, pt_len * 8),
+			SILC_ASN1_END, SILC_ASN1_END))
+    goto err;
+
+  ret = silc_buffer_steal(&alg_key, ret_len);
+  silc_asn1_free(asn1);
+
+  return ret;
+
+ err:
+  if (asn1)
+    silc_asn1_free(asn1);
+  return NULL;
+}
+
+/* Return key length */
+
+SILC_PKCS_ALG_PUBLIC_KEY_BITLEN(silc_ecdsa_public_key_bitlen)
+{
+  EcdsaPublicKey *key = public_key;
+  return key->curve->bits;
+}
+
+/* Copy public key */
+
+SILC_PKCS_ALG_PUBLIC_KEY_COPY(silc_ecdsa_public_key_copy)
+{
+  EcdsaPublicKey *key = public_key, *new_key;
+
+  new_key = silc_calloc(1, sizeof(*new_key));
+  if (!new_key)
+    return NULL;
+
+  if (!silc_hash_alloc(key->curve->hash, &new_key->hash)) {
+    silc_free(new_key);
+    return NULL;
+  }
+  new_key->curve = key->curve;
+  new_key->q = key->q;
+
+  return new_key;
+}
+
+/* Compare public keys */
+
+SILC_PKCS_ALG_PUBLIC_KEY_COMPARE(silc_ecdsa_public_key_compare)
+{
+  EcdsaPublicKey *k1 = key1, *k2 = key2;
+
+  if (k1->curve != k2->curve)
+    return FALSE;
+  if (memcmp(k1->q.x, k2->q.x, sizeof(k1->q.x)))
+    return FALSE;
+  if (memcmp(k1->q.y, k2->q.y, sizeof(k1->q.y)))
+    return FALSE;
+
+  return TRUE;
+}
+
+/* Free public key */
+
+SILC_PKCS_ALG_PUBLIC_KEY_FREE(silc_ecdsa_public_key_free)
+{
+  EcdsaPublicKey *key = public_key;
+
+  silc_hash_free(key->hash);
+  silc_free(key);
+}
+
+/* Import ECDSA private key. */
+
+SILC_PKCS_ALG_IMPORT_PRIVATE_KEY(silc_ecdsa_import_private_key)
+{
+  SilcAsn1 asn1;
+  SilcBufferStruct alg_key;
+  EcdsaPrivateKey *privkey;
+  unsigned char *d, *pub, pt[1 + 2 * SILC_ECP_MAX_DIGITS * 4];
+  SilcUInt32 ver, d_len, pub_len;
+  const EcpCurve *curve;
+  EcpPoint q;
+  char *oid;
+
+  SILC_LOG_DEBUG(("Import private key"));
+
+  if (!ret_private_key)
+    return 0;
+
+  asn1 = silc_asn1_alloc(NULL);
+  if (!asn1)
+    return 0;
+
+  /* Allocate ECDSA private key */
+  *ret_private_key = privkey = silc_calloc(1, sizeof(*privkey));
+  if (!privkey)
+    goto err;
+
+  /* Parse */
+  silc_buffer_set(&alg_key, key, key_len);
+  if (!silc_asn1_decode(asn1, &alg_key,
+			SILC_ASN1_SEQUENCE,
+			  SILC_ASN1_SHORT_INT(&ver),
+			  SILC_ASN1_OCTET_STRING(&d, &d_len),
+			  SILC_ASN1_OID_T(SILC_ASN1_EXPLICIT, 0, &oid),
+			  SILC_ASN1_BIT_STRING_T(SILC_ASN1_EXPLICIT |
+						 SILC_ASN1_OPTIONAL, 1,
+						 &pub, &pub_len),
+			SILC_ASN1_END, SILC_ASN1_END))
+    goto err;
+
+  if (ver != 1)
+    goto err;
+
+  curve = silc_ecp_find_curve_oid(oid);
+  if (!curve) {
+    SILC_LOG_DEBUG(("Unsupported curve %s", oid));
+    goto err;
+  }
+  privkey->curve = curve;
+
+  /* The private key must be between 1 and n - 1 */
+  if (d_len != curve->bytes)
+    goto err;
+  silc_ecp_bin2num(privkey->d, d, d_len);
+  if (silc_ecp_num_is_zero(privkey->d, curve->n.len) ||
+      silc_ecp_num_cmp(privkey->d, curve->n.m, curve->n.len) >= 0)
+    goto err;
+
+  /* Compute the public key, and check it matches if it was present */
+  silc_ecp_mul_base(curve, &q, privkey->d);
+  silc_ecp_to_affine(curve, &privkey->q, &q);
+  if (pub) {
+    if (pub_len / 8 != silc_ecp_point_encode(curve, &privkey->q, pt) ||
+	memcmp(pt, pub, pub_len / 8)) {
+      SILC_LOG_DEBUG(("ECDSA private and public key do not match"));
+      goto err;
+    }
+  }
+
+  if (!silc_hash_alloc(curve->hash, &privkey->hash))
+    goto err;
+
+  silc_asn1_free(asn1);
+
+  return key_len;
+
+ err:
+  if (privkey)
+    memset(privkey, 0, sizeof(*privkey));
+  silc_free(privkey);
+  silc_asn1_free(asn1);
+  return 0;
+}
+
+/* Export ECDSA private key. */
+
+SILC_PKCS_ALG_EXPORT_PRIVATE_KEY(silc_ecdsa_export_private_key)
+{
+  EcdsaPrivateKey *key = private_key;
+  unsigned char d[SILC_ECP_MAX_DIGITS * 4];
+  unsigned char pt[1 + 2 * SILC_ECP_MAX_DIGITS * 4];
+  SilcAsn1 asn1;
+  SilcBufferStruct alg_key;
+  SilcUInt32 pt_len;
+  unsigned char *ret;
+
+  SILC_LOG_DEBUG(("Export private key"));
+
+  asn1 = silc_asn1_alloc(stack);
+  if (!asn1)
+    return NULL;
+
+  silc_ecp_num2bin(d, key->curve->bytes, key->d);
+  pt_len = silc_ecp_point_encode(key->curve, &key->q, pt);
+
+  /* Encode */
+  memset(&alg_key, 0, sizeof(alg_key));
+  if (!silc_asn1_encode(asn1, &alg_key,
+			SILC_ASN1_OPTS(SILC_ASN1_ALLOC),
+			SILC_ASN1_SEQUENCE,
+			  SILC_ASN1_SHORT_INT(1),
+			  SILC_ASN1_OCTET_STRING(d, key->curve->bytes),
+			  SILC_ASN1_OID_T(SILC_ASN1_EXPLICIT, 0,
+					  key->curve->oid),
+			  SILC_ASN1_BIT_STRING_T(SILC_ASN1_EXPLICIT, 1,
+						 pt, pt_len * 8),
+			SILC_ASN1_END, SILC_ASN1_END))
+    goto err;
+
+  memset(d, 0, sizeof(d));
+  ret = silc_buffer_steal(&alg_key, ret_len);
+  silc_asn1_free(asn1);
+
+  return ret;
+
+ err:
+  memset(d, 0, sizeof(d));
+  silc_asn1_free(asn1);
+  return NULL;
+}
+
+/* Return key length */
+
+SILC_PKCS_ALG_PRIVATE_KEY_BITLEN(silc_ecdsa_private_key_bitlen)
+{
+  EcdsaPrivateKey *key = private_key;
+  return key->curve->bits;
+}
+
+/* Free private key */
+
+SILC_PKCS_ALG_PRIVATE_KEY_FREE(silc_ecdsa_private_key_free)
+{
+  EcdsaPrivateKey *key = private_key;
+
+  silc_hash_free(key->hash);
+  memset(key, 0, sizeof(*key));
+  silc_free(key);
+}
+
+/* Encryption.  Not supported */
+
+SILC_PKCS_ALG_ENCRYPT(silc_ecdsa_encrypt)
+{
+  SILC_LOG_WARNING(("ECDSA encryption is not supported"));
+  encrypt_cb(FALSE, NULL, 0, context);
+  return NULL;
+}
+
+/* Decryption.  Not supported */
+
+SILC_PKCS_ALG_DECRYPT(silc_ecdsa_decrypt)
+{
+  SILC_LOG_WARNING(("ECDSA decryption is not supported"));
+  decrypt_cb(FALSE, NULL, 0, context);
+  return NULL;
+}
+
+/* Sign */
+
+SILC_PKCS_ALG_SIGN(silc_ecdsa_sign)
+{
+  EcdsaPrivateKey *key = private_key;
+  const EcpCurve *curve = key->curve;
+  const EcpField *n = &curve->n;
+  unsigned char hashr[SILC_HASH_MAXLEN], buf[SILC_ECP_MAX_DIGITS * 4];
+  unsigned char xh[SILC_ECP_MAX_DIGITS * 8];
+  SilcUInt32 e[SILC_ECP_MAX_DIGITS], k[SILC_ECP_MAX_DIGITS];
+  SilcUInt32 r[SILC_ECP_MAX_DIGITS], s[SILC_ECP_MAX_DIGITS];
+  EcpPoint p;
+  SilcBufferStruct sig;
+  SilcMPInt mr, ms;
+  Rfc6979Drbg drbg;
+  SilcHash ihash = NULL;
+  SilcStack stack;
+  SilcAsn1 asn1;
+
+  SILC_LOG_DEBUG(("Sign"));
+
+  /* The key's own hash context is not used, as the key may be used in
+     other threads at the same time.  The thread's context of the curve's
+     hash is used in computing the hash, if not given, and the random k. */
+  if ((!hash || rng) && !silc_crypto_thread_hash_get(curve->hash, &ihash)) {
+    sign_cb(FALSE, NULL, 0, context);
+    return NULL;
+  }
+  if (!hash)
+    hash = ihash;
+
+  /* Compute hash if requested */
+  if (compute_hash) {
+    silc_hash_make(hash, src, src_len, hashr);
+    src = hashr;
+    src_len = silc_hash_len(hash);
+  }
+  silc_ecdsa_digest(curve, src, src_len, e);
+
+  /* Without RNG k is derived from d and the digest as in RFC 6979.  The
+     length of n of the supported curves is multiple of eight bits. */
+  if (!rng) {
+    silc_ecp_num2bin(xh, curve->bytes, key->d);
+    silc_ecp_num2bin(xh + curve->bytes, curve->bytes, e);
+    if (!silc_rfc6979_init(&drbg, hash, xh, curve->bytes,
+			   xh + curve->bytes, curve->bytes)) {
+      memset(xh, 0, sizeof(xh));
+      silc_crypto_thread_hash_put(ihash);
+      sign_cb(FALSE, NULL, 0, context);
+      return NULL;
+    }
+    memset(xh, 0, sizeof(xh));
+  }
+
+  memset(r, 0, sizeof(r));
+  memset(s, 0, sizeof(s));
+
+  do {
+    do {
+      if (rng) {
+	/* Generate random k */
+	silc_ecdsa_random(curve, ihash, rng, k);
+      } else {
+	/* Generate deterministic k, 0 < k < n */
+	do {
+	  silc_rfc6979_generate(&drbg, buf, curve->bytes);
+	  silc_ecp_bin2num(k, buf, curve->bytes);
+	} while (silc_ecp_num_is_zero(k, n->len) ||
+		 silc_ecp_num_cmp(k, n->m, n->len) >= 0);
+      }
+
+      /* Compute signature part r = x(k * G) mod n */
+      silc_ecp_mul_base(curve, &p, k);
+      silc_ecp_to_affine(curve, &p, &p);
+      silc_ecp_mont_from(&curve->p, r, p.x);
+      silc_ecp_mod_reduce(n, r, r);
+    } while (silc_ecp_num_is_zero(r, n->len));
+
+    /* Compute signature part s = (e + d * r) / k mod n.  The Montgomery
+       product of Montgomery form and normal integer is normal integer. */
+    silc_ecp_mont_to(n, k, k);
+    silc_ecp_mont_inv(n, k, k);
+    silc_ecp_mont_to(n, s, r);
+    silc_ecp_mont_mul(n, s, s, key->d);
+    silc_ecp_mod_add(n, s, s, e);
+    silc_ecp_mont_mul(n, s, k, s);
+  } while (silc_ecp_num_is_zero(s, n->len));
+
+  memset(k, 0, sizeof(k));
+  memset(&p, 0, sizeof(p));
+  if (!rng) {
+    memset(buf, 0, sizeof(buf));
+    silc_rfc6979_uninit(&drbg);
+  }
+  silc_crypto_thread_hash_put(ihash);
+
+  stack = silc_crypto_thread_stack();
+  silc_stack_push(stack, NULL);
+
+  asn1 = silc_asn1_alloc(stack);
+  if (!asn1) {
+    silc_stack_pop(stack);
+    sign_cb(FALSE, NULL, 0, context);
+    return NULL;
+  }
+
+  silc_mp_sinit(stack, &mr);
+  silc_mp_sinit(stack, &ms);
+  silc_ecp_num2bin(buf, curve->bytes, r);
+  silc_mp_bin2mp(buf, curve->bytes, &mr);
+  silc_ecp_num2bin(buf, curve->bytes, s);
+  silc_mp_bin2mp(buf, curve->bytes, &ms);
+
+  /* Encode the signature.  This format is compliant with PKIX. */
+  memset(&sig, 0, sizeof(sig));
+  if (!silc_asn1_encode(asn1, &sig,
+			SILC_ASN1_SEQUENCE,
+			  SILC_ASN1_INT(&mr),
+			  SILC_ASN1_INT(&ms),
+			SILC_ASN1_END, SILC_ASN1_END)) {
+    sign_cb(FALSE, NULL, 0, context);
+    goto out;
+  }
+
+  /* Deliver result */
+  sign_cb(TRUE, silc_buffer_data(&sig), silc_buffer_len(&sig), context);
+
+ out:
+  if (compute_hash)
+    memset(hashr, 0, sizeof(hashr));
+  silc_mp_uninit(&mr);
+  silc_mp_uninit(&ms);
+  silc_asn1_free(asn1);
+  silc_stack_pop(stack);
+
+  return NULL;
+}
+
+/* Verify */
+
+SILC_PKCS_ALG_VERIFY(silc_ecdsa_verify)
+{
+  EcdsaPublicKey *key = public_key;
+  const EcpCurve *curve = key->curve;
+  const EcpField *n = &curve->n;
+  unsigned char hashr[SILC_HASH_MAXLEN], buf[SILC_ECP_MAX_DIGITS * 4];
+  SilcUInt32 e[SILC_ECP_MAX_DIGITS], w[SILC_ECP_MAX_DIGITS];
+  SilcUInt32 r[SILC_ECP_MAX_DIGITS], s[SILC_ECP_MAX_DIGITS];
+  SilcUInt32 u1[SILC_ECP_MAX_DIGITS], u2[SILC_ECP_MAX_DIGITS];
+  SilcBool ret = FALSE;
+  SilcBufferStruct sig;
+  SilcMPInt mr, ms;
+  EcpPoint p;
+  SilcHash ihash = NULL;
+  SilcStack stack;
+  SilcAsn1 asn1;
+
+  SILC_LOG_DEBUG(("Verify"));
+
+  stack = silc_crypto_thread_stack();
+  silc_stack_push(stack, NULL);
+
+  asn1 = silc_asn1_alloc(stack);
+  if (!asn1) {
+    silc_stack_pop(stack);
+    verify_cb(FALSE, context);
+    return NULL;
+  }
+
+  /* Decode the signature.  The integers are allocated from the stack. */
+  silc_buffer_set(&sig, signature, signature_len);
+  if (!silc_asn1_decode(asn1, &sig,
+			SILC_ASN1_SEQUENCE,
+			  SILC_ASN1_INT(&mr),
+			  SILC_ASN1_INT(&ms),
+			SILC_ASN1_END, SILC_ASN1_END)) {
+    silc_asn1_free(asn1);
+    silc_stack_pop(stack);
+    verify_cb(FALSE, context);
+    return NULL;
+  }
+
+  /* The r and s must be between 1 and n - 1 */
+  if (silc_mp_cmp_ui(&mr, 0) <= 0 || silc_mp_cmp_ui(&ms, 0) <= 0 ||
+      silc_mp_sizeinbase(&mr, 2) > curve->bits ||
+      silc_mp_sizeinbase(&ms, 2) > curve->bits)
+    goto out;
+  silc_mp_mp2bin_noalloc(&mr, buf, curve->bytes);
+  silc_ecp_bin2num(r, buf, curve->bytes);
+  silc_mp_mp2bin_noalloc(&ms, buf, curve->bytes);
+  silc_ecp_bin2num(s, buf, curve->bytes);
+  if (silc_ecp_num_cmp(r, n->m, n->len) >= 0 ||
+      silc_ecp_num_cmp(s, n->m, n->len) >= 0)
+    goto out;
+
+  /* Hash data if requested.  The key's own hash context is not used, as
+     the key may be used in other threads at the same time. */
+  if (compute_hash) {
+    if (!hash && !silc_crypto_thread_hash_get(curve->hash, &ihash))
+      goto out;
+    if (ihash)
+      hash = ihash;
+    silc_hash_make(hash, data, data_len, hashr);
+    data = hashr;
+    data_len = silc_hash_len(hash);
+    silc_crypto_thread_hash_put(ihash);
+  }
+  silc_ecdsa_digest(curve, data, data_len, e);
+
+  /* Compute w = s^-1 mod n, u1 = e * w mod n and u2 = r * w mod n */
+  memset(u1, 0, sizeof(u1));
+  memset(u2, 0, sizeof(u2));
+  silc_ecp_mont_to(n, w, s);
+  silc_ecp_mont_inv(n, w, w);
+  silc_ecp_mont_mul(n, u1, w, e);
+  silc_ecp_mont_mul(n, u2, w, r);
+
+  /* Compute x(u1 * G + u2 * q) mod n */
+  silc_ecp_mul_add(curve, &p, u1, &key->q, u2);
+  if (!silc_ecp_to_affine(curve, &p, &p))
+    goto out;
+  silc_ecp_mont_from(&curve->p, w, p.x);
+  silc_ecp_mod_reduce(n, w, w);
+
+  /* Compare */
+  if (silc_ecp_num_cmp(r, w, n->len) == 0)
+    ret = TRUE;
+
+ out:
+  /* Deliver result */
+  verify_cb(ret, context);
+
+  if (compute_hash)
+    memset(hashr, 0, sizeof(hashr));
+  silc_mp_uninit(&mr);
+  silc_mp_uninit(&ms);
+  silc_asn1_free(asn1);
+  silc_stack_pop(stack);
+
+  return NULL;
+}
@@ -0,0 +1,56 @@
+/*
+
+  ecdsa.h
+
+  Author: Pekka Riikonen <priikone@silcnet.org>
+
+  Copyright (C) 2008 Pekka Riikonen
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; version 2 of the License.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+*/
+
+#ifndef ECDSA_H
+#define ECDSA_H
+
+#include "ecp.h"
+
+/* ECDSA Public key */
+typedef struct {
+  const EcpCurve *curve;		/* The curve */
+  SilcHash hash;			/* Default hash function */
+  EcpPoint q;				/* Public key, affine */
+} EcdsaPublicKey;
+
+/* ECDSA Private key */
+typedef struct {
+  const EcpCurve *curve;		/* The curve */
+  SilcHash hash;			/* Default hash function */
+  EcpPoint q;				/* Public key, affine */
+  SilcUInt32 d[SILC_ECP_MAX_DIGITS];	/* Private key */
+} EcdsaPrivateKey;
+
+SILC_PKCS_ALG_GENERATE_KEY(silc_ecdsa_generate_key);
+SILC_PKCS_ALG_IMPORT_PUBLIC_KEY(silc_ecdsa_import_public_key);
+SILC_PKCS_ALG_EXPORT_PUBLIC_KEY(silc_ecdsa_export_public_key);
+SILC_PKCS_ALG_PUBLIC_KEY_BITLEN(silc_ecdsa_public_key_bitlen);
+SILC_PKCS_ALG_PUBLIC_KEY_COPY(silc_ecdsa_public_key_copy);
+SILC_PKCS_ALG_PUBLIC_KEY_COMPARE(silc_ecdsa_public_key_compare);
+SILC_PKCS_ALG_PUBLIC_KEY_FREE(silc_ecdsa_public_key_free);
+SILC_PKCS_ALG_IMPORT_PRIVATE_KEY(silc_ecdsa_import_private_key);
+SILC_PKCS_ALG_EXPORT_PRIVATE_KEY(silc_ecdsa_export_private_key);
+SILC_PKCS_ALG_PRIVATE_KEY_BITLEN(silc_ecdsa_private_key_bitlen);
+SILC_PKCS_ALG_PRIVATE_KEY_FREE(silc_ecdsa_private_key_free);
+SILC_PKCS_ALG_ENCRYPT(silc_ecdsa_encrypt);
+SILC_PKCS_ALG_DECRYPT(silc_ecdsa_decrypt);
+SILC_PKCS_ALG_SIGN(silc_ecdsa_sign);
+SILC_PKCS_ALG_VERIFY(silc_ecdsa_verify);
+
+#endif /* ECDSA_H */
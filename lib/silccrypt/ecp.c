@@ -0,0 +1,1199 @@
+/*
+
+  ecp.c
+
+  Author: Pekka Riikonen <priikone@silcnet.org>
+
+  Copyright (C) 2008 Pekka Riikonen
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; version 2 of the License.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+*/
+
+/* Elliptic curve arithmetic over the NIST prime fields.
+
+   The field arithmetic is fixed size Montgomery arithmetic with 32 bit
+   digits, written separately from the SILC MP API so that the operations
+   do not allocate memory and do not branch or index memory on secret
+   data.  The same routines are used with the group order n.
+
+   The points are in Jacobian coordinates.  The base point multiplication
+   uses the Lim-Lee comb method with precomputed table of 63 affine points
+   (see also lib/silcmath/mpfixed.c), reading all table entries on each
+   step so that the memory access pattern does not depend on the scalar.
+   The multiplication of other points, needed only in verification with
+   public scalars, uses simple 4 bit window. */
+
+#include "silccrypto.h"
+#include "ecp.h"
+
+/* Comb width, rows in scalar */
+#define SILC_ECP_COMB_WIDTH 6
+
+/* Returns bit `bit' of integer */
+#define SILC_ECP_BIT(a, bit) (((a)[(bit) >> 5] >> ((bit) & 31)) & 1)
+
+/********************************* Curves ***********************************/
+
+/* The curve parameters and tables in Montgomery form, R = 2 ^ (32 * len).
+   The comb table entry i, 1 <= i < 64, has the affine x and y of the base
+   point multiplied by the sum of 2 ^ (j * span) for each bit j set in i. */
+
+/* Comb table of the NIST P-256 base point */
+
+static const SilcUInt32 silc_ecp_nistp256_table[] = {
+  0x18a9143c, 0x79e730d4, 0x5fedb601, 0x75ba95fc, 0x77622510, 0x79fb732b,
+  0xa53755c6, 0x18905f76, 0xce95560a, 0xddf25357, 0xba19e45c, 0x8b4ab8e4,
+  0xdd21f325, 0xd2e88688, 0x25885d85, 0x8571ff18, 0x03605c39, 0x89105079,
+  0xa142c96c, 0xf0843d9e, 0x16923684, 0xf3744934, 0xfa0a2893, 0x732caa2f,
+  0x61160170, 0xb2e8c270, 0x437fbaa3, 0xc32788cc, 0xa6eda3ac, 0x39cd818e,
+  0x9e2b2e07, 0xe2e94239, 0xabc3e190, 0xb9c0d276, 0xcb55b9ca, 0x610e3d4d,
+  0x5720f50a, 0xd16dbd02, 0xa607de84, 0xd0ed73dc, 0x49219fb5, 0x3bbde5bf,
+  0x57771843, 0x698e12c0, 0x63470a5e, 0xdb606a97, 0x853635d5, 0x61c71975,
+  0xec7fae9f, 0xeb5ddcb6, 0xefb66e5a, 0x995f2714, 0x69445d52, 0xdee95d8e,
+  0x09e27620, 0x1b6c2d46, 0x8129d716, 0x32621c31, 0x0958c1aa, 0xb03909f1,
+  0x1af4af63, 0x8c468ef9, 0xfba5cdf6, 0x162c429f, 0xc1d85f12, 0x4615d912,
+  0xe1f4e302, 0x1f0880b0, 0x6f1fca13, 0x336bcc89, 0xc70dedbc, 0xda59ad0d,
+  0xb0f62ece, 0x3897efae, 0xf4990cfd, 0xbaed81cd, 0x60321bbb, 0xa3b1c2f2,
+  0xddc84f79, 0x2aefd95a, 0xee9e92e6, 0x2d427e3c, 0x437fe629, 0x43d40da0,
+  0x6ab72b31, 0x0006e4e0, 0x6f5c8e02, 0x21ccfbb4, 0x53e821ec, 0x53a2f1a7,
+  0xe209d591, 0x5d72d201, 0x45e8ad41, 0xfd84a264, 0x4059cc6e, 0x86ee0e68,
+  0x9248fce2, 0x3d8242d0, 0x7f49f33d, 0x32d4bf82, 0x29d41fd1, 0x78807beb,
+  0xf8f562cb, 0xfce48b99, 0x9f38f097, 0x72a7d484, 0xa37059ad, 0x1b482c10,
+  0x472e5ed3, 0xc1aa8284, 0xef23e9c9, 0xc5d6f3bb, 0xb8a24a20, 0x23f949fe,
+  0xf52ca53f, 0x17ebfed1, 0xbcfb4853, 0x9b691bbe, 0x6278a05d, 0x5617ff6b,
+  0xe3c99ebd, 0x241b34c5, 0x1784156a, 0xfc64242e, 0x695d67df, 0x4206482f,
+  0xee27c011, 0xb967ce0e, 0x9fc3df19, 0x569aacdf, 0xc34c6fb2, 0x0c6782c7,
+  0xc4ec873d, 0xbb5f98b2, 0x9fe9e475, 0x5578433b, 0x9ca84821, 0xfa14f386,
+  0x39589501, 0xb8ef658d, 0x07127b8e, 0x4022c48e, 0x5402ea12, 0xcbc4dfe3,
+  0x2ad408a3, 0x092ef96a, 0xcfbc45a3, 0xf1e1a4c4, 0xefeecdee, 0x966b2676,
+  0x3a6216c5, 0xa0e2c671, 0x92c4bf61, 0xcd6e22a2, 0xd830dfc7, 0x56d99a11,
+  0x259de547, 0xb8c612bd, 0xe91f8ff7, 0x3d8e9a72, 0x2352b4ff, 0x0b885e96,
+  0xa6545766, 0x6be320d2, 0xb9a59e72, 0xbd22a444, 0xccc55d7d, 0x2f2d32d6,
+  0xddcec70b, 0xd86e4c4c, 0x7a25c934, 0x19cdb0e9, 0x9ca97e28, 0x542ade06,
+  0x746517f7, 0x58c5927c, 0x8d087091, 0x24abb0f0, 0x51add8de, 0x6aa2c2ef,
+  0xcc2a2134, 0xc3e1cb4c, 0x95589212, 0x35631128, 0x7984344b, 0x3bf17d2a,
+  0xf8a142cc, 0xbcb6f7b2, 0x08ec9266, 0xd6057d8a, 0x2852405a, 0x75c150d2,
+  0xa9fee73e, 0xa8f88eb5, 0x576ea39b, 0x72a84174, 0xe2692e7d, 0x671fa0ad,
+  0x96769f9e, 0x25562885, 0xe850a6b0, 0x254323bc, 0xfff6c89a, 0x74b61c18,
+  0xcfae2690, 0x2e7c563f, 0x164afb0f, 0x2cf454b7, 0x8f10f423, 0xe312a561,
+  0xf2b85df4, 0x59a1f1ff, 0x41c48122, 0x56c59919, 0xae3d175f, 0x74953c1e,
+  0x8859244c, 0x4d767fc7, 0x719a4cc1, 0xc486bc00, 0xdf1c1787, 0xdd282985,
+  0xae93c719, 0x1143301a, 0x1fab7d71, 0x7201a1d6, 0x32cbbee8, 0x65931f54,
+  0xdcb387ee, 0x202955d3, 0xc4678432, 0xa5045ba5, 0xdca85ff6, 0xcfb5ee87,
+  0xdfec0f67, 0xdd25a7c6, 0x356a87c6, 0xfee47169, 0xc3d7ece9, 0x20a8f159,
+  0x070d3aab, 0xe4ac8b33, 0x9a2cd5e5, 0x2643672b, 0x1cfc9173, 0x52eff79b,
+  0x90a7c13f, 0x665ca49b, 0xb3efb998, 0x5a8dda59, 0x052f1341, 0x8a5b922d,
+  0x3cf9a530, 0xae9ebbab, 0xf56da4d7, 0x35986e7b, 0xbc0a70c0, 0x21e07f9a,
+  0x989a0182, 0xecfdb3a2, 0xe40e8125, 0x360682c0, 0x2f837f32, 0x73a63795,
+  0x9c0d326b, 0xf4eb8cef, 0xebf4c7a5, 0xefb97fec, 0xaf3d5d7e, 0xf9352123,
+  0x34e22ab1, 0xb71ef4ef, 0x0d488032, 0xd6bd0d81, 0x71f0b92e, 0x1676df99,
+  0xb6d215ac, 0xa7acdcfc, 0xcd0ff939, 0x82461a26, 0xb635d2e5, 0x827189c0,
+  0xa92f1622, 0x18f3b6dd, 0x05cef325, 0x10d738aa, 0x39bb0aa6, 0x12c2a13f,
+  0xb50b4e82, 0x5f94d8de, 0x34bd93e9, 0xbcd9144e, 0x07c08623, 0x61c33921,
+  0x7e3de8ee, 0xedec947e, 0x2f21b202, 0x9d2da51d, 0x96692a89, 0xc0c885cd,
+  0xa5e7309c, 0x4a613462, 0x0f28dee6, 0x22778855, 0x7695447a, 0x1ff0bd52,
+  0x42ae2627, 0x63534a4a, 0xd0cc09f2, 0xd96af0da, 0x412d3e1a, 0xb59ea545,
+  0x6a759072, 0xd10518cf, 0x10475dfd, 0xffeec37c, 0xb25089c4, 0xacbc29cc,
+  0x21b6d4ee, 0xbf3dfc85, 0x49388995, 0x8f2eacfe, 0x841be9ed, 0x000fc8d4,
+  0x6955c290, 0x2ed8085a, 0x6d8e176f, 0x1929cf60, 0xfd1a09db, 0x2efd26a5,
+  0x6cb626cd, 0x58d767ad, 0xb26c6e05, 0x13a81b95, 0x8f61832b, 0x68fe6107,
+  0x2d85c2f6, 0x4ad7de2e, 0x510101a1, 0xcd552fcb, 0x02acdabf, 0x638d122b,
+  0x50bfd921, 0x117221e8, 0x99a99129, 0x08571ee1, 0xba2f03a9, 0xebd046d1,
+  0xa6f8a181, 0x035ed7ba, 0x3187c6f3, 0x8aabf98d, 0xe3ab5f4e, 0xaf8e65ca,
+  0x7561a69c, 0x8b0b8b89, 0xb17c1e66, 0x37e83aa0, 0xf8d80edc, 0xe894d84c,
+  0xce514e22, 0xf1e465e7, 0xa72340ef, 0xc7fa324c, 0xe7370673, 0x08297fca,
+  0xb119ae5e, 0x4f799682, 0xf180f206, 0x014d6bd8, 0x7ab44f55, 0x56640c8b,
+  0x93f9a5b8, 0x9a39660d, 0x959b68f1, 0xcac069e9, 0x208d9918, 0x2bf6b65e,
+  0x3f943291, 0xb7e45dfb, 0xd439c712, 0xad5770f0, 0x7654d805, 0xfec635e1,
+  0x3f031a88, 0x37221cd1, 0x0b5558d4, 0xe4d53d2f, 0xdafc51cd, 0x2ede8e8f,
+  0xa8a883ea, 0xb587284c, 0x44fa5251, 0xfa376740, 0x5c5e3528, 0x5e5e18f9,
+  0x6e10b958, 0x8af51fac, 0x2c429b30, 0x09be7903, 0x7f29936d, 0x7a468ba4,
+  0x7cfb8176, 0xacbbe365, 0x4db9cd5d, 0xe892c10a, 0xa1aade8b, 0xcb2f29d7,
+  0xefffcb14, 0x3087eef4, 0x2afe8f2e, 0x92a7f3ec, 0x136f29d2, 0x199d89b8,
+  0xb4836623, 0x3131604e, 0x31b5df76, 0xf5cca5da, 0x76a4abc0, 0x94313186,
+  0x1877c7c7, 0x5db8e6f7, 0x6031ac99, 0x3ce3f5f9, 0x7e7cef80, 0x585961d0,
+  0xd424f16a, 0x5ed6e841, 0x56b16a49, 0x18289cd0, 0x2e5770fa, 0x8008d03b,
+  0x254e39de, 0xc8c2af64, 0x8582571c, 0x783cea73, 0xa6edd971, 0x2f2f55f1,
+  0xc86bf30a, 0x7e00cc92, 0x47d7491f, 0xa0db7354, 0xa5b12260, 0xb3eb751c,
+  0x297fb234, 0x3bc39a23, 0xb8b4bfe4, 0xd1330c20, 0x7824d53a, 0xfb776af0,
+  0x422dea35, 0x04709096, 0x5fec3ac7, 0x6f480b6b, 0xe27edda4, 0xdb2b1b62,
+  0xda78b494, 0x0bba904c, 0x91a147f7, 0x37ef59b6, 0x26a4730a, 0xf8805177,
+  0xa8ab368e, 0xecc9d79a, 0x85a4bd0e, 0x628e05c1, 0x00e244e8, 0xebf7b678,
+  0x8b176eeb, 0xf645947b, 0x1641ab35, 0xc92bf830, 0x21be7a6f, 0x7a039c1a,
+  0x2fd4bd92, 0x11e4354d, 0x886fd224, 0x42552422, 0xc44ced37, 0xdbf3194c,
+  0xc56f6b04, 0x832da983, 0x8ef098ae, 0x7aaa84eb, 0xa6a616a2, 0x602e3eef,
+  0xb7b717a3, 0xc2824ddc, 0xddb0a2e9, 0x19f50324, 0x5bedfbbd, 0x04553a28,
+  0xaa1aee0a, 0x37ea8b12, 0x945959a1, 0xc1844e79, 0xe0f222c2, 0x5043dea7,
+  0x72e65142, 0x309d42ac, 0x9216cd30, 0x94fe9ddd, 0x0f87feec, 0xd6539c7d,
+  0x432ac7d7, 0x03c5a57c, 0x327fda10, 0x72692cf0, 0x280698de, 0xec28c85f,
+  0x7ec283b1, 0x2331fb46, 0x43248e67, 0x651cfdeb, 0xee561de8, 0x2c3d72ce,
+  0x443dac8b, 0xa48b8f33, 0x7991f986, 0xe6b042fe, 0xe810bcd2, 0xd091636d,
+  0xa97416d7, 0xfc1e96ae, 0x2892694d, 0x2b6087cb, 0x9985a628, 0x0f8ac245,
+  0x7f2326a2, 0x54e90874, 0xfa9e1131, 0xce43dd44, 0xd3d2d948, 0x4b2c740c,
+  0xa86e8b07, 0x9b0b126a, 0xb77f5af2, 0x228ef320, 0xca07661c, 0x14fc8a01,
+  0xd34f1a3a, 0x1d72509e, 0x29d9086e, 0xd1690317, 0x03c5fe33, 0x13e44acc,
+  0x0105bbc6, 0x13f4374e, 0xcb4451b8, 0x0cba5018, 0xfa29a4e1, 0xa1a38e4a,
+  0xf4403917, 0x063fb9a8, 0x996ea7f2, 0x7afe108f, 0xf93a1f87, 0xec252363,
+  0x7e432609, 0xc029c811, 0x486e548e, 0x25080c29, 0x7868ab32, 0xdaa41132,
+  0xd61d1a3a, 0x46891511, 0x3efc8fac, 0xc87f3f53, 0xf3e31393, 0x984f613f,
+  0x7648f5d2, 0x10bb15f6, 0xdefaa440, 0xe4990f2b, 0xdd51c31d, 0xce647f03,
+  0x9c2c0abf, 0x3161ebdd, 0xf497cf35, 0x48b7ee7b, 0x94dd9c97, 0x9233e31d,
+  0xc5d2988f, 0x4aef9a62, 0xa03e6456, 0x89a54161, 0xc1f02b47, 0x9d25e003,
+  0xc1857782, 0x8784cdbf, 0x0222b49c, 0x7928cafd, 0xecf4ea23, 0x5a591abd,
+  0x80bd9b8a, 0xb2725e8a, 0x29ff348b, 0xf569679f, 0x6f22536a, 0xa28163d3,
+  0x21c43971, 0x89e7a8f6, 0xc4a09567, 0x60cbe4a1, 0x5928b03d, 0x41046c8f,
+  0xef74a95a, 0x646feda7, 0x5d75d310, 0x3aef6bc0, 0x82476e5c, 0xf3e7f03c,
+  0x8419b8a0, 0x9dcf3d50, 0xeaf07f07, 0x221a3885, 0x37bdcb7d, 0x16d533f3,
+  0xbb49550d, 0xd778066b, 0x36c2600c, 0xf6f45409, 0xc1c61709, 0x7544396f,
+  0xde08cd42, 0xf79f556f, 0xe13cadc8, 0x7d0aba1e, 0xd4d81fef, 0x841d9df6,
+  0x602d2043, 0x8f7ae1f2, 0xb57ee181, 0x950c4de4, 0xc55cf490, 0xfe51e045,
+  0x1efdd0a8, 0xdb60b56a, 0xbf0fa497, 0x276bccb3, 0x19e5a603, 0x7926625b,
+  0xe1bf712b, 0xf1b98e93, 0xe33abecc, 0x933ecb52, 0xf826619b, 0x9ebfc506,
+  0xa1692c52, 0xd2965f67, 0xfc4f9564, 0x8ac4012d, 0x6739f003, 0xa8af5703,
+  0xbc715e13, 0x7dd2282d, 0xcf2bb490, 0x3ec01587, 0x3f1ea428, 0x5346082c,
+  0x6739e506, 0xf2c679e2, 0x930c28e4, 0xeab710d6, 0xe043249a, 0xe9947ff8,
+  0xad54b0e6, 0x63640678, 0x1854eaaf, 0x8cde4259, 0x6b25bdce, 0xf1feeaec,
+  0x1bdd2aa2, 0x49f7e899, 0x34e3cae9, 0x88fd2735, 0x82cbfea2, 0x5ac05101,
+  0x4cf84578, 0x324c9d41, 0x19f13061, 0xa2423117, 0x5f3b9932, 0x69d67cf1,
+  0xdde2dfad, 0x32ecdb3c, 0xb916f7a6, 0x2f74d995, 0x3d14bc68, 0x35f7ed42,
+  0x45574f91, 0x32f63a04, 0x5e8801e7, 0xd0410833, 0x1c9c1462, 0x63b6f13c,
+  0x9dc7201f, 0x180dcbcd, 0x360350df, 0xa07b5b2c, 0x4236f5cc, 0x2582b277,
+  0xa7ab06b9, 0x90163924, 0x0767cdf2, 0x35e751b5, 0x9d8e2838, 0x808372e6,
+  0x646914d7, 0xcbad6b30, 0x6c7b3cab, 0x4eeeb1de, 0x8c965004, 0x3ef3af96,
+  0xd281920b, 0xd162290f, 0x181f811b, 0x4626c313, 0xbe61dd14, 0x5fa42f4f,
+  0xa185e98e, 0x1f5a9c53, 0xea9e83c3, 0x13c28277, 0xb693a226, 0xb566e4c0,
+  0x01533e9e, 0x2ea3f1c0, 0x6215a21f, 0xb4dbcc33, 0xcb4e98f0, 0x7df608c3,
+  0xb4dd95dd, 0x677df928, 0xeeed2934, 0x4c1d7142, 0x86a2ee12, 0x30bf236c,
+  0x05ecb4c0, 0x74d5a127, 0x1601cca9, 0x9ef43b0f, 0xac4dd202, 0xbe1b1bf9,
+  0x17b6f93b, 0x84943e47, 0xcd5214b3, 0x6f789757, 0x7f313dfa, 0x5e0db1a9,
+  0xece0b72b, 0x0515efac, 0xa78c3f8b, 0x433a677c, 0xf376a9c1, 0x204a9fea,
+  0x44baeadf, 0xb6bfbea4, 0x2b48a3f4, 0x5a43cafd, 0x67d1d226, 0xe25a7d0b,
+  0xf6837985, 0xb2115844, 0xd87c2b88, 0x8c9cca3e, 0x894772e1, 0xecd4bc73,
+  0x783490e7, 0x368abec6, 0xd925c359, 0xf26da8bd, 0xe8fb0679, 0xf9b643e5,
+  0xb555d175, 0x7ab803d9, 0x4ebae595, 0x1b405999, 0xba417a49, 0x07fbbf25,
+  0xc617957a, 0x02d7cf1c, 0x565c1fbb, 0x79070ea5, 0xd9b028fa, 0x70194602,
+  0x9ff06760, 0x9c49969d, 0x6ad27b42, 0xbf4add81, 0x8651524e, 0x7d1f226d,
+  0xeecd7724, 0xb0779b40, 0x65938707, 0xd3560772, 0xd054b903, 0xe3a61fe5,
+  0x3365136b, 0xd6f5a343, 0xd2970fcf, 0x25c87c76, 0x4d5546a8, 0x7c9f60a0,
+  0x8dd8bf8c, 0x7dab072f, 0xe8ff9f28, 0x3d10907c, 0x34bb2a29, 0xb08d6d0e,
+  0xc3fcfdaf, 0x5dfd4907, 0x47123ba6, 0xe4a2d4b1, 0x42de6d8d, 0x6e9eef0b,
+  0xcbb55f9d, 0x81255af5, 0x5328d39e, 0x579f2705, 0x3e5ae663, 0xa7bfc917,
+  0xa1246e42, 0xe9b55d57, 0x75629188, 0x240ecd94, 0x457bd3c0, 0x8748d297,
+  0x373c361c, 0x50e215ef, 0x18c967b9, 0xaf9d8a86, 0x0a04143f, 0x79a04104,
+  0xc700c616, 0x03f7410f, 0x91108ca6, 0xe8f2a3f2, 0xf5ac679a, 0xa26d67e8,
+  0xb83fbd9a, 0xa15dbfeb, 0x3a0b5587, 0xf1aaebd2, 0xce0ead44, 0x639a97dd,
+  0x71d12ee0, 0xf253b00c, 0x9e35e57c, 0x7baecf4c, 0x6786e3a5, 0x522e26a1,
+  0x8af829a2, 0x600b538b, 0x2c6de44a, 0x19fa80b7, 0xaaf0ff52, 0xb52364f0,
+  0x6714587f, 0x2e4bc21a, 0xc245967d, 0x401377a3, 0xa23cf3eb, 0x65178766,
+  0x923ac000, 0xc1c81838, 0xc4abc0ee, 0x42021f02, 0x47132a20, 0xcde3bc9a,
+  0xc69f55fb, 0x6f52a864, 0xdf89ff6a, 0x0bdfd3e4, 0xc88bd74e, 0x244c943b,
+  0x2612998b, 0x649e0b53, 0xd3413d4a, 0xce61ebc3, 0x2cba5a90, 0xe3162904,
+  0xdb6c224e, 0xa72710ae, 0xd87e44db, 0x51831390, 0x48fe2ef3, 0xa687dc98,
+  0x16a21ca9, 0x857e9855, 0xc9a7bc12, 0xe3428d8e, 0x12b044a2, 0x16d3bcd0,
+  0xe85f6704, 0xe6fa0c69, 0x8fd42692, 0xe4cca34b, 0xe15f3acf, 0xc86d49a6,
+  0xa6b18392, 0xbfe1f263, 0xdcd266f6, 0x0664c933, 0x19399d88, 0x86738cf5,
+  0x749ce6bc, 0x1cbcc8c3, 0xc773b884, 0x28171f7b, 0x01acf19e, 0x306fc957,
+  0xafb6a419, 0x0da7a737, 0x195fbc40, 0x637fc26a, 0x9c64e8e7, 0x0fc8f876,
+  0x208c0626, 0x2a68579b, 0x8628abc3, 0x82e82310, 0xab23ae94, 0xe4e09313,
+  0xe5155cf1, 0x66bf9adb, 0xe8a2dd0c, 0x17909f6c, 0x43d7ad31, 0x767c3596,
+  0x49ccef62, 0x7ba3a1aa, 0x0242bf5a, 0x5261c316, 0x9eb82dfb, 0x85f45219,
+  0x37b42e47, 0x554cb382, 0x4cf66133, 0xc9771ec1, 0x153905a3, 0xde70617a,
+  0xbc61316d, 0x2cab26fc, 0x75c10315, 0x7dababbd, 0xa48df64e, 0x9a8fbe88,
+  0xe1b8f912, 0x2b076fe5, 0xccbd50dc, 0x1a530ce9, 0x6647d225, 0x47361ab7,
+  0x4d636a15, 0xf84e73be, 0x5904a2fa, 0xd58fcaaf, 0x38523a19, 0x73747d4b,
+  0xb6864cc0, 0x6e6b0fb8, 0xab3b623c, 0x5d8a0027, 0x9a1cfc9c, 0x5e666538,
+  0x521e4ff3, 0x816b19de, 0x0bc447f8, 0x56709ad0, 0x8f1464d7, 0x1d46cb1c,
+  0xa949873d, 0x49cef820, 0xd9d3e65f, 0x02804692, 0xad8b5976, 0x1ae0ea28,
+  0x869458fb, 0x4e9ad48e, 0x96cfedf8, 0xe9437ec9, 0x2afa74d9, 0xa4f924a2,
+  0xaaf797c0, 0xcb5b1845, 0xba6f557f, 0xe5d6dd0e, 0x91dc2e7c, 0xa1496fe6,
+  0x8c179fc7, 0xad31edac, 0x44b06ed7, 0xf9c5e9de, 0x4a597159, 0x6ce7c4f7,
+  0x833accb5, 0xd02ec441, 0x6296e8fc, 0xf3020599, 0xc2afbe06, 0x7df6c5c6,
+  0x9c849b09, 0xff429dda, 0xf5dd78d6, 0x42170166, 0x830c388b, 0x2403ea21
+};
+
+/* NIST P-256, secp256r1 */
+
+static const EcpCurve silc_ecp_nistp256 = {
+  "nistp256",
+  "1.2.840.10045.3.1.7",
+  "sha256",
+  {
+    {
+      0xffffffff, 0xffffffff, 0xffffffff, 0x00000000, 0x00000000, 0x00000000,
+      0x00000001, 0xffffffff
+    },
+    {
+      0x00000003, 0x00000000, 0xffffffff, 0xfffffffb, 0xfffffffe, 0xffffffff,
+      0xfffffffd, 0x00000004
+    },
+    {
+      0x00000001, 0x00000000, 0x00000000, 0xffffffff, 0xffffffff, 0xffffffff,
+      0xfffffffe, 0x00000000
+    },
+    0x00000001, 8
+  },
+  {
+    {
+      0xfc632551, 0xf3b9cac2, 0xa7179e84, 0xbce6faad, 0xffffffff, 0xffffffff,
+      0x00000000, 0xffffffff
+    },
+    {
+      0xbe79eea2, 0x83244c95, 0x49bd6fa6, 0x4699799c, 0x2b6bec59, 0x2845b239,
+      0xf3d95620, 0x66e12d94
+    },
+    {
+      0x039cdaaf, 0x0c46353d, 0x58e8617b, 0x43190552, 0x00000000, 0x00000000,
+      0xffffffff, 0x00000000
+    },
+    0xee00bc4f, 8
+  },
+  {
+    0x29c4bddf, 0xd89cdf62, 0x78843090, 0xacf005cd, 0xf7212ed6, 0xe5a220ab,
+    0x04874834, 0xdc30061d
+  },
+  silc_ecp_nistp256_table,
+  32, 256, 43
+};
+
+/* Comb table of the NIST P-384 base point */
+
+static const SilcUInt32 silc_ecp_nistp384_table[] = {
+  0x49c0b528, 0x3dd07566, 0xa0d6ce38, 0x20e378e2, 0x541b4d6e, 0x879c3afc,
+  0x59a30eff, 0x64548684, 0x614ede2b, 0x812ff723, 0x299e1513, 0x4d3aadc2,
+  0x4b03a4fe, 0x23043dad, 0x7bb4a9ac, 0xa1bfa8bf, 0x2e83b050, 0x8bade756,
+  0x68f4ffd9, 0xc6c35219, 0x3969a840, 0xdd800226, 0x5a15c5e9, 0x2b78abc2,
+  0xb1b43eef, 0xa54768da, 0xe14fda22, 0x13e41f47, 0xfaef6863, 0x774df203,
+  0xbd7471b3, 0xf795a034, 0xb47de2e9, 0xf0958718, 0xe1160cff, 0xc92f7888,
+  0x0146c790, 0x86ded97b, 0x480a4b7b, 0x015918f5, 0x424e8459, 0x05588920,
+  0xeecf8b2b, 0x37455914, 0xb968a6fa, 0xe7d3df1f, 0xbad0719f, 0x07a0ffd6,
+  0x5c54db6f, 0xda37cd53, 0x91f06c5c, 0x0e37890a, 0xe7ae7db5, 0x1730ef7b,
+  0xff045f54, 0x2b3dcd51, 0x72cc8451, 0xf5db3c3c, 0xcf0c185c, 0x3165d6ef,
+  0xf5958d78, 0x177c4f6b, 0x8d676a9f, 0xcb29d22f, 0x792ac96d, 0x3bcf0068,
+  0x19df5641, 0x60d1c6b7, 0x68a099f8, 0x426e412a, 0x9f74d52b, 0xf9ca0c5c,
+  0xc88d568a, 0xf186d6bc, 0x528535dd, 0x872bc4c7, 0xdfe64dc3, 0xc9e7432e,
+  0xd795ea57, 0xd9fc4832, 0xc845af2b, 0xf4ffdb81, 0x2b670517, 0x66d7e788,
+  0xd7b7a1c6, 0xa7c1be04, 0xd5b2a249, 0xbed88479, 0x03f2ef6d, 0x62ff8aba,
+  0x20dc701d, 0x60ecaac4, 0x4ff10119, 0x9f4b559f, 0x3cd54fd0, 0x0582c931,
+  0xe86e3f64, 0x394fb84d, 0xff13314e, 0xfe4a36e7, 0xdc261ec2, 0xa1e44b14,
+  0x7420408f, 0x3924e50a, 0x42ed7626, 0x637e3302, 0xfd711ba4, 0xeb657b10,
+  0x340949bb, 0xc16d01c5, 0x7f1f42c7, 0x30e04326, 0xb056d872, 0xe7465819,
+  0x886fb3db, 0x3386f1c6, 0xbe56f774, 0x5be463a5, 0x4694e15a, 0xa96fd3b7,
+  0xa98b4254, 0x95dd5ee5, 0xaa845e67, 0xea328205, 0xa1e36348, 0x98640fb5,
+  0x1add5ee7, 0xd1bc5c25, 0x3d11b799, 0xc3158a42, 0x47c83d54, 0x5feb68ed,
+  0x963a207b, 0x7c5a1204, 0xee4671f8, 0x2f2b2c7e, 0xd42867a6, 0xb63d291c,
+  0x139530f4, 0x0b073620, 0xabb05b99, 0xbe149492, 0x55accd2a, 0x21417da4,
+  0x9e5eba15, 0x9408555e, 0x7b7572c5, 0x41625013, 0xbfff6ea7, 0xfa53ee50,
+  0xe7b178c3, 0x3d682de1, 0xec329f53, 0xb3e8769d, 0x9eb524f4, 0x1ab8c82e,
+  0xde2f1eb9, 0x5bbd538d, 0x2b19c51e, 0x1d1b0bea, 0x8cb06eee, 0xf785f9b9,
+  0xf58f21d5, 0x5cff29c6, 0x45cbaef3, 0x44aaa522, 0x7de40246, 0xd60c1942,
+  0x2f9fbe67, 0x378205de, 0x7f728e44, 0xc4afcb83, 0x682e00f1, 0xdbcec06c,
+  0x114d5423, 0xf2a145c3, 0x7a52463e, 0xa01d9874, 0x7d717b0a, 0xfc0935b1,
+  0xd4d01f95, 0x9653bc4f, 0x9560ad34, 0x9aa83ea8, 0xaf8e3f3f, 0xf77943dc,
+  0xe86fe16e, 0x70774a10, 0xbf9ffdcf, 0x6b62e6f1, 0x588745c9, 0x8a72f39e,
+  0x2341c342, 0x73ade4da, 0xea704422, 0xdd326e54, 0x3741cef3, 0x336c7d98,
+  0x59e61549, 0x1eafa00d, 0xbd9a3efd, 0xcd3ed892, 0xc5c6c7e4, 0x03faf26c,
+  0x3045f8ac, 0x087e2fcf, 0x174f1e73, 0x14a65532, 0xfe0af9a7, 0x2cf84f28,
+  0x2cdc935b, 0xddfd7a84, 0x6929c895, 0x4c0f117b, 0x4c8bcfcc, 0x356572d6,
+  0x6420bc66, 0x984a6aed, 0x896a24a6, 0x6d90e0e0, 0x18713003, 0xe0adb93a,
+  0x1a8369fc, 0xf00d424c, 0x712ae802, 0x636ebf14, 0xbe9d739a, 0xee39ff8e,
+  0x94f6d1dc, 0xb330dd3e, 0xb7731cf8, 0x6ba6780e, 0x198be5a2, 0x4e569408,
+  0x0193a22c, 0x6639523b, 0x91aa1455, 0x6978cc9d, 0x329f9763, 0x62062d8f,
+  0x80efff78, 0x7159107d, 0x8e4c39d5, 0xf8ed5f8e, 0xc15e679c, 0x64a2265c,
+  0xa6d96c81, 0xfc514e17, 0xf093e0a8, 0x59c86545, 0x8b5a336a, 0x804b0a58,
+  0xcb9dcbca, 0x94c32118, 0x5d45251d, 0x2deb0e38, 0x86869572, 0xd1092b09,
+  0xfb2e9f97, 0x073bf838, 0xde700fcb, 0x76b6d7d6, 0xf2ddce5f, 0xd2a6d110,
+  0x229de19e, 0x6da7ccd0, 0xf0aa039d, 0x5050d45d, 0xd9e7a861, 0xf9f01d68,
+  0x00aa05f2, 0x6d8b9f20, 0x742cd4d9, 0xae3d9698, 0xd560c394, 0x43e477ab,
+  0x1cb6dd81, 0x73d59499, 0xfac3f62e, 0x689162b2, 0x64d1d0d5, 0xd6187ca8,
+  0x2f067457, 0xe8421a0d, 0xea7c3a8d, 0x9b266acb, 0x44df5cb3, 0x707e0e6e,
+  0x026511a0, 0x604b2a1a, 0x256f4076, 0xd4f6cf16, 0xb315a642, 0x7d823347,
+  0x786aa438, 0x8f805833, 0xf04bb4b3, 0x9883df85, 0x5bba6d84, 0x02bc1030,
+  0xa72c03ac, 0xfe39a024, 0x5f2dbfd0, 0xa980db63, 0x4f259ec6, 0xcd53149f,
+  0x43f53f97, 0xe969079b, 0x42f9f27c, 0xd3849fdb, 0x42653dc9, 0xd2cfd3f8,
+  0x6abe7d80, 0xbf69fe6a, 0x92bb50e2, 0x49322881, 0x61e8b18d, 0xc9e2f7fb,
+  0xf6c82421, 0x24c74788, 0x11c0b244, 0xe79e5e30, 0xe0484571, 0xd6612c70,
+  0x7ef82d17, 0x7863ff92, 0xb0a1b01c, 0x692790fe, 0xafe51546, 0xa2d6ffb5,
+  0x6cf550c6, 0xacdb43f2, 0xaecfaf8f, 0x3b3243df, 0xc233bcd9, 0x9557335a,
+  0xaff5b387, 0x25e08c8f, 0xd06208ce, 0x112c11e2, 0x65234214, 0x61031c17,
+  0x0514764d, 0xba06f555, 0x9bd197d0, 0xfaacf6f3, 0x1464a57f, 0xe4b03232,
+  0xe35dcd69, 0x00c19adf, 0xa1c2646c, 0x81b75730, 0xe0c50e32, 0x47baa4fe,
+  0xbcaddb3b, 0xe9297832, 0xd712c6cf, 0x1768d2f9, 0xb82e9eea, 0xfcef29fd,
+  0x44ce3ad8, 0xdbe04c30, 0x4ce8aad5, 0x995fbb1b, 0x70911457, 0xdbf8b546,
+  0x3f7a1757, 0x9e683b5b, 0x9c7bd62c, 0x7b89a08a, 0x0b3fc97e, 0x448865a4,
+  0x3bb01e94, 0x0ac9abfc, 0x1e756124, 0xa0776042, 0xd9deed97, 0x0aa6c335,
+  0x72603e08, 0xe270580f, 0x6c783bb2, 0x70857a94, 0xcaa929ae, 0xa0047774,
+  0xa353e889, 0x56211190, 0x190eb198, 0x052917c3, 0x3eee3d12, 0xadfd85b0,
+  0x79fd9c91, 0xde1d7617, 0xbf500159, 0x05be51b7, 0x8fcb87f1, 0x271f0717,
+  0x3a75ac71, 0x02673e27, 0xda12da8d, 0xb1b7246e, 0x8f5fb8c0, 0xb2564792,
+  0x063b1d7f, 0x0a22cbe1, 0x5649976e, 0xb0d7a736, 0x9e96b15d, 0x8f8e6e28,
+  0x8312351c, 0x8fc113f9, 0xc5eff002, 0xe837b9e0, 0x4dad72fc, 0x7cb9ef07,
+  0xb5eb7ee3, 0x18a8d43e, 0x4925efdb, 0x2cf3ae84, 0x7756ec6a, 0x376e9e85,
+  0xa3e3705f, 0xf77a79c8, 0x6c5fbab3, 0x2d590b7d, 0x7a4766c3, 0xa59713e2,
+  0x61544174, 0xb5da6a68, 0xdab1fe76, 0xadb04a8a, 0x375143b4, 0x03b6138d,
+  0xc1bfa043, 0x20d88a80, 0x672583ce, 0x88806999, 0xaea9b605, 0x195a89ea,
+  0x32bac07b, 0x0b9b4e85, 0x83868df6, 0x82799656, 0xb52711a9, 0x83c58afa,
+  0x1c869283, 0xb895c13d, 0x6206dde6, 0x00f98d04, 0x884bf311, 0x76caaa22,
+  0x995b29a5, 0x22b2137f, 0xb098b07b, 0x7f645809, 0x050e2552, 0xa540c8a6,
+  0xe562d904, 0x47980509, 0x031e112c, 0xe736f89d, 0x65d8ae25, 0xbc6bfb07,
+  0xca459646, 0xe9ed4cc4, 0x2fff67ff, 0xf540e90e, 0x1a314e11, 0x836280eb,
+  0x41610627, 0xa710b250, 0x73a9f9a2, 0xefc22b15, 0x456498c0, 0x60f20789,
+  0x8052f4e7, 0x41792043, 0xd5c0e80d, 0x5c850903, 0xbf1d8815, 0x52df5275,
+  0x8ece218d, 0x25539de9, 0xdca420ba, 0xb36574a8, 0x0e0d07fe, 0x9d181268,
+  0xad3ed34f, 0xea79a5f5, 0x7c9277cf, 0x8b739ad5, 0x6ee9a930, 0xd8865988,
+  0x21591a3e, 0xaf07bfb6, 0x08f3524f, 0xe0138c65, 0x97ee315e, 0xd3128f12,
+  0x21045f63, 0x67f8641e, 0x40c73a2d, 0x3e1a96b1, 0x05f51122, 0x8976b703,
+  0x31960db4, 0xdeaf6357, 0x5948d7f7, 0x680b054e, 0xd272bb5c, 0x0841e40f,
+  0x6e36117d, 0x94d37db2, 0x47f63ec8, 0xaf2d0015, 0x47493309, 0x82665cdc,
+  0xabbe3851, 0xfe90e844, 0xfb79bc0c, 0x8357709a, 0xb6bcc044, 0x811a64d2,
+  0x882b3415, 0x1937c988, 0xe267b271, 0xe8b28724, 0xaf89ed33, 0x84d1eed0,
+  0x54c894a7, 0x52b8234f, 0xa2d11b70, 0xfe54146f, 0x0aab6097, 0x6412b5eb,
+  0x6a13a9da, 0xa6249990, 0xadc448ca, 0xd2b1eb50, 0xb115ab92, 0xe7ab51f9,
+  0xe76551d8, 0x4638ee62, 0xafe9c98d, 0x74c3c1e1, 0x60d77322, 0x59000ad0,
+  0xa06adc9a, 0x0a4b105b, 0x96a6f616, 0xcdaeb4a4, 0x864b49dc, 0x8c79c4a1,
+  0xc0b1bf15, 0xc09c32d1, 0x88d74e44, 0x005d510f, 0xfc2c089e, 0x031f9a9a,
+  0x4ba183f0, 0x08aac729, 0xaf2245eb, 0xf227a7ce, 0xb3a864ff, 0xb4ec33cb,
+  0x570a24f3, 0xdb76decd, 0x12283a9e, 0xea59387a, 0x341ef9a4, 0x81b7c569,
+  0x8d77833a, 0xad7c98bd, 0x49ca80ff, 0x2182133b, 0x085802b7, 0x1de1d456,
+  0xe1c02860, 0xeead25b2, 0x4ff42d2e, 0xb2ae4369, 0xfd61c1b0, 0x4b39a2dd,
+  0x968718a5, 0x29c826ea, 0xd9751a0a, 0x877fdf15, 0xb54affdf, 0x00b321df,
+  0xd4d5dbf7, 0x3c7c0778, 0xcfc47423, 0x858a0fdc, 0x185b3063, 0xbd8e6544,
+  0x2da46a04, 0xa22c3ef6, 0x6a6c0ce1, 0x5c2d8401, 0xdd6329ae, 0x260246ed,
+  0x0c6463f6, 0x71753fc0, 0x5c6c9e33, 0x7ec14c01, 0x41ce6153, 0x28b9ab94,
+  0xa6702c8d, 0x3a1ac251, 0x9ed6cb1f, 0x2b124bc4, 0x4fc7383f, 0x7a11c4be,
+  0x09fac991, 0x14149135, 0xcb1ee336, 0xf7c188d3, 0x91c3f406, 0x754bc473,
+  0xcad39500, 0x71d34587, 0xdd0399a1, 0x213dd1a7, 0x71d05899, 0x8457a8f6,
+  0x2e9c06d3, 0xa921ca66, 0x9ba6521f, 0x1d8974e8, 0x5f79f791, 0xbb465c77,
+  0x3a3954c8, 0x8f983f08, 0x8b3935dc, 0x8492f839, 0x90c04426, 0x2b87d9c2,
+  0x03e60a28, 0xcec76ea4, 0xaa631308, 0x648e9830, 0x1eb86b73, 0x7b542f79,
+  0x150d854d, 0xfc8cc9a3, 0xbfcc83fe, 0x2be86940, 0xc88c7585, 0x2e58a13a,
+  0xd1bc237f, 0x19249a8f, 0x63505555, 0xdec1c6a5, 0xbad2a93b, 0xc8256977,
+  0xfc598170, 0x78533659, 0xee7e53cb, 0x888a6578, 0x33766db3, 0x28783b0e,
+  0xe42c28f2, 0xcf791e56, 0xf9c37f4c, 0xfbf8dde8, 0x12c05395, 0xf0ffaf17,
+  0xdaf2f012, 0xd27d21e9, 0x9a7be009, 0xf90432da, 0xa8012f28, 0xa459c036,
+  0xc8b1c6d4, 0x4d99a7ca, 0x25c899c0, 0x80888188, 0x2ebdeb3d, 0xbd27e9be,
+  0x054e77c1, 0x73c3e0aa, 0x98534ce5, 0x180c8484, 0x54ffa9cd, 0x750d52f7,
+  0x6f702f4c, 0x5f26eeb1, 0xcc76d8f4, 0x427fc6e4, 0x026b631d, 0x93126b8d,
+  0x17e145a7, 0x5356b939, 0xc0be7c84, 0xc79ca872, 0x4b615fb7, 0x3fca7cad,
+  0xd0241021, 0xed48fe78, 0x142f7f8e, 0x252b14a0, 0xdb573a09, 0x19ab85c6,
+  0xf3df906f, 0x546c3960, 0x2c810ea8, 0xc688f4b2, 0x5ff9e108, 0xbccf0cca,
+  0x3f2cc69b, 0x34f4609e, 0x14afe4f4, 0xf3b1efe4, 0x37a8ef74, 0x5d809cef,
+  0x176ba328, 0xa8d1978a, 0xdf59ecb9, 0x75dde11f, 0xa9916ee2, 0x34eeeaff,
+  0x48e83c85, 0xe7f603f2, 0xfa581815, 0xa94a539c, 0xdba360b7, 0x5a61a596,
+  0x6a77ef79, 0x6cc51dd1, 0xfdbceb9d, 0x4ff36ae0, 0x3e8a9c07, 0xfcff6532,
+  0x36d4d0b8, 0x0ba0ce54, 0x2464efc2, 0x98087a45, 0xcc1a2ba7, 0xd456843b,
+  0x3853e04c, 0x677384a5, 0x6c7971de, 0x625d32d5, 0xf724b331, 0x86882509,
+  0x1a42e5e7, 0xc20fb911, 0x81d12863, 0x075a678b, 0x5cc0aa89, 0x12bcbc6a,
+  0x4fb9f01e, 0x5279c6ab, 0x11ae1b89, 0xbc8e1789, 0xc290003c, 0xae74a706,
+  0x79df3f45, 0x9949d6ec, 0x96c8d37f, 0xba18e262, 0xdd2275bf, 0x68de6ee2,
+  0xc419f1d5, 0xa9e4fff8, 0xa52b5a40, 0xbc759ca4, 0x63b0996d, 0xff18cbd8,
+  0x92a5eeea, 0x684a6818, 0x42a09264, 0x1f5b1932, 0xd98a2f34, 0x30bd8695,
+  0x9a8601fc, 0x6e775e01, 0x4ca956f8, 0x8126bdc2, 0xe5595daa, 0x149e73d9,
+  0x1f851e83, 0x87642840, 0xd3a7c4a0, 0x4b8863db, 0x8c95d7d9, 0xe1e43b3d,
+  0xa60fd528, 0x7f1e307e, 0x34341610, 0xbf2fa5d1, 0x81c502d3, 0x11ad4a81,
+  0x782dd401, 0xc7df022e, 0xa7bcc543, 0xd15aa9a9, 0xb94df1d0, 0x6aa42774,
+  0x0592a13e, 0xab2660c3, 0x9ffc40c7, 0xaf4e4080, 0x9cd52b10, 0x01152c8d,
+  0x9034a33a, 0x649de1d9, 0xd758abfc, 0x2b9d0ef0, 0xd458addd, 0xdddd0bc2,
+  0xc09837f8, 0xe5366ac9, 0x7b1ae35f, 0xa003abbb, 0x7ab1fdde, 0x88006288,
+  0x5288f1b4, 0x6b6c8f05, 0x033738b4, 0xba05407c, 0x41a955e3, 0x26cac3a9,
+  0x8e0e0601, 0x28f1692f, 0x842c4887, 0x2032cb36, 0x7d76b20f, 0x6adeba45,
+  0x654c6f5c, 0xd282c2ce, 0xbe9ba4f1, 0x30584ca5, 0x1b2c528b, 0x45d766a0,
+  0xc0c6f8cc, 0xe918bad7, 0x0560f070, 0x1e050b2a, 0x2d6dd010, 0x4fc95de1,
+  0x150191d5, 0x2bb26072, 0x8108dcf6, 0xea261761, 0xe6083c63, 0x4dfa1303,
+  0xe2876fb8, 0xfa4e0709, 0xb1668763, 0xf901fed0, 0xb82c967a, 0xf01c53ae,
+  0x9ed827e8, 0xb43e59d3, 0x57774eef, 0xb58e157e, 0x1b83dcee, 0x57ee54e3,
+  0x613aa922, 0x3d896f32, 0xb5c7bfc5, 0x69d40667, 0x77a2c0d8, 0xd402b5cb,
+  0x7d3c9923, 0xabeb7012, 0xd7ecb93a, 0x412ada8d, 0x0b71ae2f, 0xeb64dc91,
+  0xa9ab061a, 0x52ef537a, 0xc1b55fae, 0x0863970f, 0xb1182dbd, 0xfaff5fb9,
+  0xd0abaa17, 0x5551d6fe, 0x72d641f6, 0x7bb3e020, 0xaa9d288c, 0x939d7793,
+  0x9078e2c2, 0x1450f8bf, 0xa086b6ae, 0x24ccd102, 0x6a3f8a5f, 0x57d1796f,
+  0x83ce1f76, 0x10231206, 0x03ee406f, 0xd16d4b9f, 0x83caa4b7, 0x9d39c398,
+  0xce299b93, 0x875732f5, 0x2f121f4a, 0x1e6a425d, 0x5d8c3279, 0x4b1f1d83,
+  0x56dd6a6c, 0xe655f588, 0x5843fd34, 0x23f10647, 0x2bad6ce2, 0x932b7d94,
+  0x6772a52e, 0x70a0580e, 0xc88537af, 0x3240118a, 0xd2407224, 0x9ccb2ca9,
+  0x710f2324, 0xa6a40db8, 0xc2a8a09a, 0xb3567518, 0x41b5650a, 0x88164428,
+  0x7570ba50, 0x2a352ed2, 0x4c85d77e, 0x23ee46b9, 0xd858a8c3, 0x643aceff,
+  0xe3f02e82, 0xe067908d, 0xffb8cf81, 0x8d5869f2, 0x0bc8ad7e, 0x4713f082,
+  0x80057c40, 0xe1ee44c7, 0x7d2cf34e, 0xb3439508, 0x0336a207, 0x4307b0e1,
+  0x46e4d003, 0xe9c1e457, 0x94332057, 0xa23978c3, 0x29575db6, 0x0e2f3008,
+  0x90441e9e, 0x50a51ff4, 0x508d4a07, 0x38ce3ed0, 0xcfd7224e, 0x6a997411,
+  0xda6b1e1d, 0x4d147c31, 0xda8a3547, 0xedf604b2, 0xd5e9ceed, 0x7a1b8cf0,
+  0x13544e6a, 0xd74e5012, 0x4ad968f9, 0xcc49f8da, 0xcc69ada9, 0xfb87e604,
+  0xdf166882, 0xde79409b, 0xd46cc527, 0xd645b836, 0xb6c3eb28, 0xda4a02f3,
+  0x00e7cf86, 0x845e3c59, 0x604c6d80, 0x733bdc9b, 0x847acd97, 0xe3a1244b,
+  0xd128842c, 0x421312d6, 0xa1c598ef, 0x81f71fea, 0x45eaf796, 0xc6194655,
+  0x1f338b6c, 0x1ffb8512, 0x6632f064, 0xe7aed710, 0xf5b6e510, 0xf8d1ffb7,
+  0x3eace851, 0x7d3f031f, 0x25923624, 0xef43ab70, 0x1af6cdec, 0xbae81188,
+  0xea862112, 0xb7e93b49, 0xaf23aba2, 0xe35a4fc6, 0xaecc593e, 0xc52e1fc0,
+  0x28148b99, 0xbffa2924, 0x89e3d795, 0xd08040fc, 0x2db47b3a, 0x7da32003,
+  0xa0eb7aa3, 0xe78b44e5, 0xf0ec090b, 0xd1648ec8, 0x740fe871, 0x4048dba7,
+  0xa00a14ac, 0x6fddb89f, 0x08aa06e7, 0x844f9915, 0xf76aca7d, 0x6d5ac4a9,
+  0xe9fa4d51, 0xfba1ba85, 0xb2ea0fc7, 0x159633bb, 0x76ba2854, 0xa2eb0e4b,
+  0xc11f5398, 0x8a858155, 0x5e8ea044, 0x30a96e53, 0x97e05a47, 0x696210c1,
+  0x15036f4b, 0x86e55f94, 0x6a96d9d7, 0x0c93ea9c, 0x79eba3da, 0xb7ba5061,
+  0xcd94d7b2, 0xd305c733, 0x3e7955b2, 0x9ea33e36, 0xbc73812f, 0x78a98855,
+  0x48a3a9a0, 0xfb1b791d, 0x04014aaf, 0x6e5107ee, 0x0ea07de0, 0x0412b2c0,
+  0xddcaca68, 0xdd3a2408, 0xe3344f29, 0x5d18e69a, 0xf9017408, 0x3ce65481,
+  0x8cbd64fb, 0x50abb456, 0x8916a9eb, 0x442fa509, 0xc538c410, 0x16b3ddc7,
+  0x25e331ab, 0x6757dbfd, 0xa3eaafbc, 0x0efde50b, 0xd531d29c, 0x1cd46222,
+  0x3561cb2b, 0x1b713ca9, 0xfb5bc99d, 0x7d07334b, 0x885a417d, 0x95dba43e,
+  0x77823a59, 0x1c9c3f3f, 0x3220cb7f, 0x43533ba8, 0x82e3e401, 0x1b918bc1,
+  0xcd3fec87, 0x66a039aa, 0x2dad36d5, 0x1d39dbb0, 0x9dc04be4, 0x55402595,
+  0x47744933, 0xdf399208, 0x82524dd6, 0x4264f7ea, 0xe5182c6d, 0xdb57ec08,
+  0x05c5e7bf, 0x2d6778e7, 0x96f53ea2, 0x3f37793f, 0x05c47e48, 0x6472cbae,
+  0xbf78067c, 0x9e6dd60f, 0xcef34088, 0xa2817ec2, 0x168edde9, 0xde4715b8,
+  0x46bf31e1, 0x6c571051, 0xc4272bc0, 0x98113fbb, 0xcc3b90c3, 0x03bb7922,
+  0x57d88fef, 0xe0f23be1, 0x0ca27a01, 0x4125c55b, 0x14a71262, 0xeadf527e,
+  0xcc4e9a04, 0x1f2e803c, 0xd68c4fcf, 0x32e07b47, 0x9db5070b, 0x1577fab7,
+  0x7831990a, 0xd786d6e5, 0x54fbde40, 0xf64ff4b1, 0x4f9450ae, 0x4bac5b03,
+  0x55116af9, 0x06ae25e0, 0xd7b4fcfc, 0x33d84ea2, 0x569c3b9e, 0x44a92e73,
+  0xbad0cb7f, 0xf5bdccba, 0x958edd05, 0x370f43ca, 0x04904a26, 0x3dd8232b,
+  0x2f4458e8, 0x3f810668, 0x9b3ace7e, 0xdfcb67b9, 0x3e1241fc, 0x54e42f2d,
+  0xdb889300, 0xe30f3fb0, 0x483e51fc, 0x4ca0184b, 0xa638dac6, 0x5a32d097,
+  0xc62a1db0, 0x567a2b5e, 0xc446456c, 0x2a756ba3, 0xd9f8d5c0, 0x6919026d,
+  0x4fec874a, 0x7f6493fc, 0xd47a0770, 0x8bb8a674, 0x52bd4f0c, 0x90bad2a6,
+  0xf5733b07, 0x16badbe2, 0x93a1f802, 0x93be07cf, 0x41c395f7, 0x1e37a015,
+  0x216582b3, 0xfe2c0fd6, 0x1627180d, 0xdcd98bc8, 0x8e8c9f1e, 0x41e03726,
+  0xfe8f45af, 0x93dbc22c, 0xff45e059, 0x5728c8a6, 0xca4a98cd, 0x4f2f15cf,
+  0x656e7d76, 0xdbe2ec5d, 0xae2757bb, 0x84ad1b4b, 0x0d4fec75, 0xc9297e7a,
+  0xcad3ba87, 0xfcc673ee, 0xdfd1671a, 0xb0f77621, 0x9704a8c7, 0x5c386e44,
+  0x3e29256d, 0xce78f03f, 0xc3a6ed2f, 0x0b185938, 0x7824819b, 0x7b1e2fae,
+  0xf2d9313c, 0x5a85d7f1, 0x73595b0f, 0x238bd279, 0x5c1cd2dc, 0x5fbf6b67,
+  0x8a3e2412, 0x84d1ffb8, 0x6515f2fe, 0xf0160592, 0x89905340, 0x0e26ea98,
+  0x203bd3d4, 0xbfd7a1b7, 0x88ea0bda, 0x5301273a, 0xb28dd43e, 0x2f424475,
+  0x33c28afa, 0x31014a2b, 0x01e220ea, 0xffbdea0c, 0x460b81d5, 0x681c64e8,
+  0x6a91e1d5, 0xdbe6f728, 0x32619ad5, 0x068bf363, 0x27976c74, 0x4946291f,
+  0x2068e4b0, 0xa081a946, 0x09bfdad0, 0x1a8f5df6, 0xef28dd35, 0x5fbba5bc,
+  0x031ff71e, 0xa3e60d4f, 0x702ca18e, 0x2d47689b, 0xc9b8e66b, 0xd283f247,
+  0x859ea140, 0x63e65dd7, 0x42aacdc3, 0x123da61f, 0x336f680c, 0xa8a9e893,
+  0xc23d43ac, 0x1cc4e12a, 0x86a1fff8, 0x421e80d5, 0x43deecc9, 0x833d60d5,
+  0x29014f8f, 0x3c25b57c, 0x35d8e122, 0xa19fcb1e, 0xeda32ac8, 0x916c0e3c,
+  0xf36b6096, 0x9a23d289, 0x39a39871, 0x50990384, 0x61c64196, 0xdc5b77b6,
+  0x942bf2b6, 0x5a7d9917, 0x4f41cf6d, 0xd2185393, 0xfcc45c2f, 0x90ff1016,
+  0xeb8938aa, 0x9891093d, 0xaac4e6e9, 0xe3c49b1b, 0xd7a8e91e, 0x0f21a1d1,
+  0x6f364b7e, 0x3a808e33, 0xbfa17359, 0x6a96d1b8, 0x52b36545, 0x3387ec85,
+  0xf712180c, 0x2fde350a, 0x703a2183, 0x9219d6f4, 0x86457946, 0x8ba27e00,
+  0xed80a9af, 0x7446bca0, 0x7203637a, 0xbaf78b6f, 0x497c9d0f, 0x0304129d,
+  0x6a883b68, 0x6df1e035, 0xe8018c47, 0x93ea2bb5, 0xdb46443c, 0xc86fd77c,
+  0x55dc2427, 0x8de865d2, 0x6f72d126, 0x74f7f83d, 0x6c7e665a, 0xee111178,
+  0xddf44f12, 0x272a8b3d, 0x9164eb4f, 0xad354644, 0x6859d68f, 0x2ffbdb58,
+  0x09701865, 0xbefd36c5, 0x2c983d01, 0x63c25616, 0x2eb68703, 0x15a7ba0b,
+  0x5bb0fafc, 0x3318a82b, 0xa0804f38, 0x8e930fa9, 0xbe60ed1d, 0xb7459eb6,
+  0x4260b948, 0xace01c51, 0x49210f78, 0x04a6080f, 0x2241b00d, 0x0d1eef6b,
+  0xef63912a, 0x85a25069, 0x13dd8bc2, 0xcc96c4ec, 0x40d7e234, 0x90f14d11,
+  0xa69c8dc3, 0xae33f18c, 0x9adfa431, 0x76921f2a, 0x048c9f49, 0x18158ccf,
+  0xfb8fb345, 0x90bcf7fb, 0x38b3ff5d, 0x0d50b4dc, 0x59ef84a8, 0x3914ea0b,
+  0xd4e37cf3, 0x4929d3f9, 0xb24c24c0, 0x622183d1, 0x5f904d34, 0x65cec067,
+  0x8a6f76fa, 0x65f9931a, 0xe73282f2, 0xeed975b0, 0x5e1625fd, 0xa045552a,
+  0xf8fe8e42, 0xfd6b3e02, 0x6203907c, 0x5f9f4025, 0x42b2c264, 0x8307eedb,
+  0x9f757e92, 0x2fb3ee71, 0xdc157ea8, 0x4502f2ec, 0x5d1cc0d5, 0xd976e775,
+  0x8fe1946e, 0xe46fb9a2, 0x63bdde6e, 0xe91df3ed, 0xe9c28432, 0x2e995306,
+  0x0988235b, 0x7b3a6fe1, 0x77f92a71, 0xc55199f0, 0x53cb7950, 0x47dd0348,
+  0xb727a6d1, 0xead52de2, 0xeea9c8da, 0xb87c9f75, 0x0d944f21, 0xf3e2f328,
+  0xdd751edd, 0xce82734e, 0xe616cedc, 0xfb83225c, 0x4a31eb49, 0x15850e4b,
+  0x0196ad3a, 0x92c4b6d5, 0x4e1205e4, 0x0205ea48, 0x0afc5aff, 0x8e08a97c,
+  0x727827eb, 0xda8687c6, 0x06e398aa, 0x2eace831, 0x6d69e4e8, 0x3a086c0f,
+  0xf286e62a, 0x5ff9b7aa, 0x62aae55e, 0xc4285039, 0xd9530a3f, 0x4ebd4258,
+  0x8afc7fcb, 0x57ea313a, 0x22c18879, 0x6d30a675, 0x94afb659, 0xd3c00cc9,
+  0xdee0d48b, 0x53ee47c5, 0x9dfa2397, 0xbd9e84ad, 0xf81ba5e2, 0x2d581e12,
+  0x132cd325, 0x26269f4f, 0x58860a5f, 0x9e6224df, 0xff55522a, 0x9306c607,
+  0x146950e5, 0xb48af6d4, 0x0436805e, 0x09920ed0, 0xcdce7eae, 0x3a1bc276,
+  0xc39a425e, 0x55ba728a, 0xd961d03e, 0x6a04d4e6, 0x736e684a, 0x13891c66,
+  0x04cd04d6, 0x7c75175a, 0x09c27a17, 0xb76f9bd9, 0x08e5fe36, 0xa0cff6d4,
+  0xdcd5ef90, 0xc9097695, 0x85e28054, 0x26bea245, 0x1580f068, 0x658e03c6,
+  0x811eed27, 0x0da9f75e, 0xaca0d2ee, 0x086e5e04, 0xa53a6787, 0xd4c157fa,
+  0xb40a595c, 0x2e9266d2, 0x98fa0820, 0x8f1cb526, 0xa1aef514, 0x32a74240,
+  0x1ae86e7c, 0xeb42e3d9, 0xe04a5026, 0xd6956c8c, 0x0f4302eb, 0x4c0b8b98,
+  0xb37211fd, 0xde43c938, 0xe7090f80, 0x9fa6a158, 0x73c47fb6, 0x5f3c9afc,
+  0xf850a4d0, 0x2dc4f109, 0x6fd49d6a, 0x56e63a4b, 0x4cbff048, 0x8e80a069,
+  0x2284afb0, 0x18d8b8cf, 0xc89363a1, 0x61dd086d, 0xc37342a4, 0x034c2202,
+  0x1c718580, 0x1ae0c4e1, 0xbf99a0bf, 0x303f48a6, 0x91ae219f, 0xa5551e44,
+  0x55a05287, 0xdc41d9bd, 0x6872b123, 0xd5aa73e3, 0xe6395bf6, 0x6fd94b0c,
+  0xc00afbc1, 0xbb95fdba, 0x497cac10, 0x9cd96208, 0xca51afea, 0x8adbd8c1,
+  0xf3bc5f5f, 0x94fedafb, 0xdf9f5371, 0x29c0217b, 0xd9024634, 0x5c13eb4b
+};
+
+/* NIST P-384, secp384r1 */
+
+static const EcpCurve silc_ecp_nistp384 = {
+  "nistp384",
+  "1.3.132.0.34",
+  "sha384",
+  {
+    {
+      0xffffffff, 0x00000000, 0x00000000, 0xffffffff, 0xfffffffe, 0xffffffff,
+      0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff
+    },
+    {
+      0x00000001, 0xfffffffe, 0x00000000, 0x00000002, 0x00000000, 0xfffffffe,
+      0x00000000, 0x00000002, 0x00000001, 0x00000000, 0x00000000, 0x00000000
+    },
+    {
+      0x00000001, 0xffffffff, 0xffffffff, 0x00000000, 0x00000001, 0x00000000,
+      0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+    },
+    0x00000001, 12
+  },
+  {
+    {
+      0xccc52973, 0xecec196a, 0x48b0a77a, 0x581a0db2, 0xf4372ddf, 0xc7634d81,
+      0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff
+    },
+    {
+      0x19b409a9, 0x2d319b24, 0xdf1aa419, 0xff3d81e5, 0xfcb82947, 0xbc3e483a,
+      0x4aab1cc5, 0xd40d4917, 0x28266895, 0x3fb05b7a, 0x2b39bf21, 0x0c84ee01
+    },
+    {
+      0x333ad68d, 0x1313e695, 0xb74f5885, 0xa7e5f24d, 0x0bc8d220, 0x389cb27e,
+      0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+    },
+    0xe88fdc45, 12
+  },
+  {
+    0x9d412dcc, 0x08118871, 0x7a4c32ec, 0xf729add8, 0x1920022e, 0x77f2209b,
+    0x94938ae2, 0xe3374bee, 0x1f022094, 0xb62b21f4, 0x604fbff9, 0xcd08114b
+  },
+  silc_ecp_nistp384_table,
+  48, 384, 64
+};
+
+static const EcpCurve *silc_ecp_curves[] = {
+  &silc_ecp_nistp256,
+  &silc_ecp_nistp384,
+  NULL
+};
+
+/* Find curve by name */
+
+const EcpCurve *silc_ecp_find_curve(const char *name)
+{
+  int i;
+
+  for (i = 0; silc_ecp_curves[i]; i++)
+    if (!strcmp(silc_ecp_curves[i]->name, name))
+      return silc_ecp_curves[i];
+
+  return NULL;
+}
+
+/* Find curve by OID */
+
+const EcpCurve *silc_ecp_find_curve_oid(const char *oid)
+{
+  int i;
+
+  for (i = 0; silc_ecp_curves[i]; i++)
+    if (!strcmp(silc_ecp_curves[i]->oid, oid))
+      return silc_ecp_curves[i];
+
+  return NULL;
+}
+
+/* Find curve by field size */
+
+const EcpCurve *silc_ecp_find_curve_bits(SilcUInt32 bits)
+{
+  int i;
+
+  for (i = 0; silc_ecp_curves[i]; i++)
+    if (silc_ecp_curves[i]->bits == bits)
+      return silc_ecp_curves[i];
+
+  return NULL;
+}
+
+/**************************** Field arithmetic ******************************/
+
+/* Returns all ones mask if `a' equals `b', zero otherwise */
+
+static inline SilcUInt32 silc_ecp_eq_mask(SilcUInt32 a, SilcUInt32 b)
+{
+  SilcUInt32 x = a ^ b;
+  return ((x | (0 - x)) >> 31) - 1;
+}
+
+/* Returns all ones mask if `a' is zero, zero otherwise */
+
+static inline SilcUInt32 silc_ecp_zero_mask(const SilcUInt32 *a,
+					    SilcUInt32 len)
+{
+  SilcUInt32 i, x = 0;
+
+  for (i = 0; i < len; i++)
+    x |= a[i];
+
+  return silc_ecp_eq_mask(x, 0);
+}
+
+/* Sets `a' to `r' if `mask' is all ones, keeps `r' if `mask' is zero */
+
+static inline void silc_ecp_select(SilcUInt32 *r, const SilcUInt32 *a,
+				   SilcUInt32 mask, SilcUInt32 len)
+{
+  SilcUInt32 i;
+
+  for (i = 0; i < len; i++)
+    r[i] = (r[i] & ~mask) | (a[i] & mask);
+}
+
+/* r = a + b, returns carry */
+
+static inline SilcUInt32 silc_ecp_add_n(SilcUInt32 *r, const SilcUInt32 *a,
+					const SilcUInt32 *b, SilcUInt32 len)
+{
+  SilcUInt64 t = 0;
+  SilcUInt32 i;
+
+  for (i = 0; i < len; i++) {
+    t += (SilcUInt64)a[i] + b[i];
+    r[i] = (SilcUInt32)t;
+    t >>= 32;
+  }
+
+  return (SilcUInt32)t;
+}
+
+/* r = a - b, returns borrow */
+
+static inline SilcUInt32 silc_ecp_sub_n(SilcUInt32 *r, const SilcUInt32 *a,
+					const SilcUInt32 *b, SilcUInt32 len)
+{
+  SilcUInt64 t;
+  SilcUInt32 i, borrow = 0;
+
+  for (i = 0; i < len; i++) {
+    t = (SilcUInt64)a[i] - b[i] - borrow;
+    r[i] = (SilcUInt32)t;
+    borrow = (SilcUInt32)(t >> 32) & 1;
+  }
+
+  return borrow;
+}
+
+/* Decodes big-endian integer.  The `data_len' must not be more than
+   SILC_ECP_MAX_DIGITS * 4 bytes. */
+
+void silc_ecp_bin2num(SilcUInt32 *r, const unsigned char *data,
+		      SilcUInt32 data_len)
+{
+  SilcUInt32 i;
+
+  memset(r, 0, SILC_ECP_MAX_DIGITS * sizeof(*r));
+  for (i = 0; i < data_len; i++)
+    r[i >> 2] |= (SilcUInt32)data[data_len - 1 - i] << ((i & 3) * 8);
+}
+
+/* Encodes integer as big-endian, `data_len' bytes */
+
+void silc_ecp_num2bin(unsigned char *data, SilcUInt32 data_len,
+		      const SilcUInt32 *a)
+{
+  SilcUInt32 i;
+
+  for (i = 0; i < data_len; i++)
+    data[data_len - 1 - i] =
+      (i >> 2) < SILC_ECP_MAX_DIGITS ? a[i >> 2] >> ((i & 3) * 8) : 0;
+}
+
+/* Compares integers.  This is not constant time. */
+
+int silc_ecp_num_cmp(const SilcUInt32 *a, const SilcUInt32 *b,
+		     SilcUInt32 len)
+{
+  while (len-- > 0) {
+    if (a[len] != b[len])
+      return a[len] > b[len] ? 1 : -1;
+  }
+  return 0;
+}
+
+/* Returns TRUE if the integer is zero */
+
+SilcBool silc_ecp_num_is_zero(const SilcUInt32 *a, SilcUInt32 len)
+{
+  return silc_ecp_zero_mask(a, len) & 1;
+}
+
+/* r = a + b mod m.  The `a' and `b' must be less than m. */
+
+void silc_ecp_mod_add(const EcpField *f, SilcUInt32 *r,
+		      const SilcUInt32 *a, const SilcUInt32 *b)
+{
+  SilcUInt32 t[SILC_ECP_MAX_DIGITS], c, borrow;
+
+  c = silc_ecp_add_n(r, a, b, f->len);
+  borrow = silc_ecp_sub_n(t, r, f->m, f->len);
+  silc_ecp_select(r, t, 0 - (c | (borrow ^ 1)), f->len);
+}
+
+/* r = a - b mod m.  The `a' and `b' must be less than m. */
+
+void silc_ecp_mod_sub(const EcpField *f, SilcUInt32 *r,
+		      const SilcUInt32 *a, const SilcUInt32 *b)
+{
+  SilcUInt32 t[SILC_ECP_MAX_DIGITS], mask, i;
+
+  mask = 0 - silc_ecp_sub_n(r, a, b, f->len);
+  for (i = 0; i < f->len; i++)
+    t[i] = f->m[i] & mask;
+  silc_ecp_add_n(r, r, t, f->len);
+}
+
+/* r = a mod m.  The `a' must be less than 2m. */
+
+void silc_ecp_mod_reduce(const EcpField *f, SilcUInt32 *r,
+			 const SilcUInt32 *a)
+{
+  SilcUInt32 t[SILC_ECP_MAX_DIGITS], borrow;
+
+  borrow = silc_ecp_sub_n(t, a, f->m, f->len);
+  if (r != a)
+    memcpy(r, a, f->len * sizeof(*r));
+  silc_ecp_select(r, t, 0 - (borrow ^ 1), f->len);
+}
+
+/* r = a * b * R ^ -1 mod m.  Montgomery multiplication, the coarsely
+   integrated operand scanning (CIOS) method.  The `a' and `b' must be
+   less than m. */
+
+void silc_ecp_mont_mul(const EcpField *f, SilcUInt32 *r,
+		       const SilcUInt32 *a, const SilcUInt32 *b)
+{
+  SilcUInt32 t[SILC_ECP_MAX_DIGITS + 2], u[SILC_ECP_MAX_DIGITS];
+  SilcUInt32 i, j, q, borrow, len = f->len;
+  SilcUInt64 c;
+
+  memset(t, 0, sizeof(t));
+
+  for (i = 0; i < len; i++) {
+    /* t += a * b[i] */
+    c = 0;
+    for (j = 0; j < len; j++) {
+      c += (SilcUInt64)a[j] * b[i] + t[j];
+      t[j] = (SilcUInt32)c;
+      c >>= 32;
+    }
+    c += t[len];
+    t[len] = (SilcUInt32)c;
+    t[len + 1] = (SilcUInt32)(c >> 32);
+
+    /* t = (t + q * m) / 2 ^ 32 */
+    q = t[0] * f->minv;
+    c = ((SilcUInt64)q * f->m[0] + t[0]) >> 32;
+    for (j = 1; j < len; j++) {
+      c += (SilcUInt64)q * f->m[j] + t[j];
+      t[j - 1] = (SilcUInt32)c;
+      c >>= 32;
+    }
+    c += t[len];
+    t[len - 1] = (SilcUInt32)c;
+    t[len] = t[len + 1] + (SilcUInt32)(c >> 32);
+  }
+
+  /* The t is less than 2m, subtract m if t >= m */
+  borrow = silc_ecp_sub_n(u, t, f->m, len);
+  silc_ecp_select(t, u, 0 - (t[len] | (borrow ^ 1)), len);
+  memcpy(r, t, len * sizeof(*r));
+}
+
+/* r = a * R mod m */
+
+void silc_ecp_mont_to(const EcpField *f, SilcUInt32 *r, const SilcUInt32 *a)
+{
+  silc_ecp_mont_mul(f, r, a, f->rr);
+}
+
+/* r = a * R ^ -1 mod m */
+
+void silc_ecp_mont_from(const EcpField *f, SilcUInt32 *r,
+			const SilcUInt32 *a)
+{
+  SilcUInt32 one[SILC_ECP_MAX_DIGITS];
+
+  memset(one, 0, sizeof(one));
+  one[0] = 1;
+  silc_ecp_mont_mul(f, r, a, one);
+}
+
+/* r = a ^ -1 mod m, in Montgomery form.  Computed as a ^ (m - 2) as m is
+   prime.  The exponent is public so the operation is constant time. */
+
+void silc_ecp_mont_inv(const EcpField *f, SilcUInt32 *r,
+		       const SilcUInt32 *a)
+{
+  SilcUInt32 e[SILC_ECP_MAX_DIGITS], t[SILC_ECP_MAX_DIGITS], i;
+
+  memcpy(e, f->m, sizeof(e));
+  e[0] -= 2;
+  memcpy(t, f->one, sizeof(t));
+
+  for (i = f->len * 32; i > 0; i--) {
+    silc_ecp_mont_mul(f, t, t, t);
+    if (SILC_ECP_BIT(e, i - 1))
+      silc_ecp_mont_mul(f, t, t, a);
+  }
+
+  memcpy(r, t, f->len * sizeof(*r));
+}
+
+/**************************** Point arithmetic ******************************/
+
+/* Sets point at infinity */
+
+static void silc_ecp_set_infinity(const EcpCurve *curve, EcpPoint *r)
+{
+  memset(r, 0, sizeof(*r));
+  memcpy(r->x, curve->p.one, sizeof(r->x));
+  memcpy(r->y, curve->p.one, sizeof(r->y));
+}
+
+/* r = 2p.  The "dbl-2001-b" formulas for a = -3.  Doubling the point at
+   infinity gives the point at infinity. */
+
+static void silc_ecp_dbl(const EcpCurve *curve, EcpPoint *r,
+			 const EcpPoint *p)
+{
+  const EcpField *f = &curve->p;
+  SilcUInt32 delta[SILC_ECP_MAX_DIGITS], gamma[SILC_ECP_MAX_DIGITS];
+  SilcUInt32 beta[SILC_ECP_MAX_DIGITS], alpha[SILC_ECP_MAX_DIGITS];
+  SilcUInt32 t1[SILC_ECP_MAX_DIGITS], t2[SILC_ECP_MAX_DIGITS];
+
+  silc_ecp_mont_mul(f, delta, p->z, p->z);
+  silc_ecp_mont_mul(f, gamma, p->y, p->y);
+  silc_ecp_mont_mul(f, beta, p->x, gamma);
+
+  /* alpha = 3 * (x - delta) * (x + delta) */
+  silc_ecp_mod_sub(f, t1, p->x, delta);
+  silc_ecp_mod_add(f, t2, p->x, delta);
+  silc_ecp_mont_mul(f, t1, t1, t2);
+  silc_ecp_mod_add(f, alpha, t1, t1);
+  silc_ecp_mod_add(f, alpha, alpha, t1);
+
+  /* z3 = (y + z) ^ 2 - gamma - delta */
+  silc_ecp_mod_add(f, t1, p->y, p->z);
+  silc_ecp_mont_mul(f, t1, t1, t1);
+  silc_ecp_mod_sub(f, t1, t1, gamma);
+  silc_ecp_mod_sub(f, r->z, t1, delta);
+
+  /* x3 = alpha ^ 2 - 8 * beta */
+  silc_ecp_mod_add(f, beta, beta, beta);
+  silc_ecp_mod_add(f, beta, beta, beta);
+  silc_ecp_mod_add(f, t2, beta, beta);
+  silc_ecp_mont_mul(f, t1, alpha, alpha);
+  silc_ecp_mod_sub(f, r->x, t1, t2);
+
+  /* y3 = alpha * (4 * beta - x3) - 8 * gamma ^ 2 */
+  silc_ecp_mod_sub(f, t1, beta, r->x);
+  silc_ecp_mont_mul(f, t1, alpha, t1);
+  silc_ecp_mont_mul(f, gamma, gamma, gamma);
+  silc_ecp_mod_add(f, gamma, gamma, gamma);
+  silc_ecp_mod_add(f, gamma, gamma, gamma);
+  silc_ecp_mod_add(f, gamma, gamma, gamma);
+  silc_ecp_mod_sub(f, r->y, t1, gamma);
+}
+
+/* r = p + (qx, qy), where q is affine.  The "madd-2007-bl" formulas.  If
+   p is the point at infinity the result is q.  When p equals q the
+   formulas do not work and the doubling is used.  That never happens with
+   the base point multiplication, unless the scalar is chosen to hit it
+   which happens with negligible probability with random scalars, so the
+   branch does not leak anything. */
+
+static void silc_ecp_madd(const EcpCurve *curve, EcpPoint *r,
+			  const EcpPoint *p, const SilcUInt32 *qx,
+			  const SilcUInt32 *qy)
+{
+  const EcpField *f = &curve->p;
+  SilcUInt32 z1z1[SILC_ECP_MAX_DIGITS], h[SILC_ECP_MAX_DIGITS];
+  SilcUInt32 hh[SILC_ECP_MAX_DIGITS], i[SILC_ECP_MAX_DIGITS];
+  SilcUInt32 j[SILC_ECP_MAX_DIGITS], rr[SILC_ECP_MAX_DIGITS];
+  SilcUInt32 v[SILC_ECP_MAX_DIGITS], t[SILC_ECP_MAX_DIGITS];
+  EcpPoint s;
+  SilcUInt32 mask;
+
+  mask = silc_ecp_zero_mask(p->z, f->len);
+
+  /* h = qx * z1z1 - x, rr = 2 * (qy * z * z1z1 - y) */
+  silc_ecp_mont_mul(f, z1z1, p->z, p->z);
+  silc_ecp_mont_mul(f, h, qx, z1z1);
+  silc_ecp_mod_sub(f, h, h, p->x);
+  silc_ecp_mont_mul(f, t, p->z, z1z1);
+  silc_ecp_mont_mul(f, t, qy, t);
+  silc_ecp_mod_sub(f, t, t, p->y);
+  silc_ecp_mod_add(f, rr, t, t);
+
+  if (silc_ecp_zero_mask(h, f->len) & silc_ecp_zero_mask(rr, f->len) &
+      ~mask) {
+    memset(&s, 0, sizeof(s));
+    memcpy(s.x, qx, f->len * sizeof(*qx));
+    memcpy(s.y, qy, f->len * sizeof(*qy));
+    memcpy(s.z, f->one, sizeof(s.z));
+    silc_ecp_dbl(curve, r, &s);
+    return;
+  }
+
+  /* i = 4 * h ^ 2, j = h * i, v = x * i */
+  silc_ecp_mont_mul(f, hh, h, h);
+  silc_ecp_mod_add(f, i, hh, hh);
+  silc_ecp_mod_add(f, i, i, i);
+  silc_ecp_mont_mul(f, j, h, i);
+  silc_ecp_mont_mul(f, v, p->x, i);
+
+  /* x3 = rr ^ 2 - j - 2 * v */
+  silc_ecp_mont_mul(f, t, rr, rr);
+  silc_ecp_mod_sub(f, t, t, j);
+  silc_ecp_mod_sub(f, t, t, v);
+  silc_ecp_mod_sub(f, s.x, t, v);
+
+  /* y3 = rr * (v - x3) - 2 * y * j */
+  silc_ecp_mod_sub(f, t, v, s.x);
+  silc_ecp_mont_mul(f, t, rr, t);
+  silc_ecp_mont_mul(f, j, p->y, j);
+  silc_ecp_mod_add(f, j, j, j);
+  silc_ecp_mod_sub(f, s.y, t, j);
+
+  /* z3 = (z + h) ^ 2 - z1z1 - hh */
+  silc_ecp_mod_add(f, t, p->z, h);
+  silc_ecp_mont_mul(f, t, t, t);
+  silc_ecp_mod_sub(f, t, t, z1z1);
+  silc_ecp_mod_sub(f, s.z, t, hh);
+
+  /* If p was the point at infinity the result is q */
+  silc_ecp_select(s.x, qx, mask, f->len);
+  silc_ecp_select(s.y, qy, mask, f->len);
+  silc_ecp_select(s.z, f->one, mask, f->len);
+
+  memcpy(r->x, s.x, f->len * sizeof(*r->x));
+  memcpy(r->y, s.y, f->len * sizeof(*r->y));
+  memcpy(r->z, s.z, f->len * sizeof(*r->z));
+}
+
+/* r = p + q.  The "add-2007-bl" formulas.  This is not constant time and
+   is used only with public points. */
+
+static void silc_ecp_add(const EcpCurve *curve, EcpPoint *r,
+			 const EcpPoint *p, const EcpPoint *q)
+{
+  const EcpField *f = &curve->p;
+  SilcUInt32 z1z1[SILC_ECP_MAX_DIGITS], z2z2[SILC_ECP_MAX_DIGITS];
+  SilcUInt32 u1[SILC_ECP_MAX_DIGITS], u2[SILC_ECP_MAX_DIGITS];
+  SilcUInt32 s1[SILC_ECP_MAX_DIGITS], s2[SILC_ECP_MAX_DIGITS];
+  SilcUInt32 h[SILC_ECP_MAX_DIGITS], i[SILC_ECP_MAX_DIGITS];
+  SilcUInt32 j[SILC_ECP_MAX_DIGITS], v[SILC_ECP_MAX_DIGITS];
+  SilcUInt32 t[SILC_ECP_MAX_DIGITS];
+
+  if (silc_ecp_num_is_zero(p->z, f->len)) {
+    *r = *q;
+    return;
+  }
+  if (silc_ecp_num_is_zero(q->z, f->len)) {
+    *r = *p;
+    return;
+  }
+
+  silc_ecp_mont_mul(f, z1z1, p->z, p->z);
+  silc_ecp_mont_mul(f, z2z2, q->z, q->z);
+  silc_ecp_mont_mul(f, u1, p->x, z2z2);
+  silc_ecp_mont_mul(f, u2, q->x, z1z1);
+  silc_ecp_mont_mul(f, s1, q->z, z2z2);
+  silc_ecp_mont_mul(f, s1, p->y, s1);
+  silc_ecp_mont_mul(f, s2, p->z, z1z1);
+  silc_ecp_mont_mul(f, s2, q->y, s2);
+
+  /* h = u2 - u1, s2 = 2 * (s2 - s1) */
+  silc_ecp_mod_sub(f, h, u2, u1);
+  silc_ecp_mod_sub(f, s2, s2, s1);
+  if (silc_ecp_num_is_zero(h, f->len)) {
+    if (silc_ecp_num_is_zero(s2, f->len))
+      silc_ecp_dbl(curve, r, p);
+    else
+      silc_ecp_set_infinity(curve, r);
+    return;
+  }
+  silc_ecp_mod_add(f, s2, s2, s2);
+
+  /* i = (2 * h) ^ 2, j = h * i, v = u1 * i */
+  silc_ecp_mod_add(f, i, h, h);
+  silc_ecp_mont_mul(f, i, i, i);
+  silc_ecp_mont_mul(f, j, h, i);
+  silc_ecp_mont_mul(f, v, u1, i);
+
+  /* z3 = ((z1 + z2) ^ 2 - z1z1 - z2z2) * h */
+  silc_ecp_mod_add(f, t, p->z, q->z);
+  silc_ecp_mont_mul(f, t, t, t);
+  silc_ecp_mod_sub(f, t, t, z1z1);
+  silc_ecp_mod_sub(f, t, t, z2z2);
+  silc_ecp_mont_mul(f, r->z, t, h);
+
+  /* x3 = s2 ^ 2 - j - 2 * v */
+  silc_ecp_mont_mul(f, t, s2, s2);
+  silc_ecp_mod_sub(f, t, t, j);
+  silc_ecp_mod_sub(f, t, t, v);
+  silc_ecp_mod_sub(f, r->x, t, v);
+
+  /* y3 = s2 * (v - x3) - 2 * s1 * j */
+  silc_ecp_mod_sub(f, t, v, r->x);
+  silc_ecp_mont_mul(f, t, s2, t);
+  silc_ecp_mont_mul(f, s1, s1, j);
+  silc_ecp_mod_add(f, s1, s1, s1);
+  silc_ecp_mod_sub(f, r->y, t, s1);
+}
+
+/* r = k * G with the comb table.  The `k' must be less than n.  This is
+   constant time. */
+
+void silc_ecp_mul_base(const EcpCurve *curve, EcpPoint *r,
+		       const SilcUInt32 *k)
+{
+  const EcpField *f = &curve->p;
+  const SilcUInt32 *e;
+  SilcUInt32 qx[SILC_ECP_MAX_DIGITS], qy[SILC_ECP_MAX_DIGITS];
+  SilcUInt32 col, idx, mask, i;
+  EcpPoint t;
+
+  silc_ecp_set_infinity(curve, r);
+  memset(qx, 0, sizeof(qx));
+  memset(qy, 0, sizeof(qy));
+
+  for (col = curve->span; col > 0; col--) {
+    silc_ecp_dbl(curve, r, r);
+
+    /* Take the bit of this column from each row */
+    for (i = 0, idx = 0; i < SILC_ECP_COMB_WIDTH; i++)
+      idx |= SILC_ECP_BIT(k, i * curve->span + col - 1) << i;
+
+    /* Read all entries, take the one at idx */
+    for (i = 1; i < 1 << SILC_ECP_COMB_WIDTH; i++) {
+      e = curve->table + (i - 1) * 2 * f->len;
+      mask = silc_ecp_eq_mask(i, idx);
+      silc_ecp_select(qx, e, mask, f->len);
+      silc_ecp_select(qy, e + f->len, mask, f->len);
+    }
+
+    /* The entry 0 is the point at infinity, the sum is ignored */
+    silc_ecp_madd(curve, &t, r, qx, qy);
+    mask = ~silc_ecp_eq_mask(idx, 0);
+    silc_ecp_select(r->x, t.x, mask, f->len);
+    silc_ecp_select(r->y, t.y, mask, f->len);
+    silc_ecp_select(r->z, t.z, mask, f->len);
+  }
+
+  memset(qx, 0, sizeof(qx));
+  memset(qy, 0, sizeof(qy));
+  memset(&t, 0, sizeof(t));
+}
+
+/* r = k1 * G + k2 * p.  This is not constant time and is used only with
+   public scalars. */
+
+void silc_ecp_mul_add(const EcpCurve *curve, EcpPoint *r,
+		      const SilcUInt32 *k1, const EcpPoint *p,
+		      const SilcUInt32 *k2)
+{
+  EcpPoint table[16], t;
+  SilcUInt32 i, w;
+
+  /* table[i] = i * p */
+  silc_ecp_set_infinity(curve, &table[0]);
+  table[1] = *p;
+  silc_ecp_dbl(curve, &table[2], p);
+  for (i = 3; i < 16; i++)
+    silc_ecp_add(curve, &table[i], &table[i - 1], p);
+
+  silc_ecp_set_infinity(curve, &t);
+  for (i = curve->p.len * 8; i > 0; i--) {
+    silc_ecp_dbl(curve, &t, &t);
+    silc_ecp_dbl(curve, &t, &t);
+    silc_ecp_dbl(curve, &t, &t);
+    silc_ecp_dbl(curve, &t, &t);
+    w = (k2[(i - 1) >> 3] >> (((i - 1) & 7) * 4)) & 0x0f;
+    if (w)
+      silc_ecp_add(curve, &t, &t, &table[w]);
+  }
+
+  silc_ecp_mul_base(curve, r, k1);
+  silc_ecp_add(curve, r, r, &t);
+}
+
+/* Converts the point to affine coordinates.  Returns FALSE if the point
+   is the point at infinity. */
+
+SilcBool silc_ecp_to_affine(const EcpCurve *curve, EcpPoint *r,
+			    const EcpPoint *p)
+{
+  const EcpField *f = &curve->p;
+  SilcUInt32 zinv[SILC_ECP_MAX_DIGITS], t[SILC_ECP_MAX_DIGITS];
+
+  if (silc_ecp_num_is_zero(p->z, f->len))
+    return FALSE;
+
+  silc_ecp_mont_inv(f, zinv, p->z);
+  silc_ecp_mont_mul(f, t, zinv, zinv);
+  silc_ecp_mont_mul(f, r->x, p->x, t);
+  silc_ecp_mont_mul(f, t, t, zinv);
+  silc_ecp_mont_mul(f, r->y, p->y, t);
+  memcpy(r->z, f->one, sizeof(r->z));
+
+  return TRUE;
+}
+
+/* Decodes uncompressed point 0x04 || x || y.  Checks that the point is on
+   the curve. */
+
+SilcBool silc_ecp_point_decode(const EcpCurve *curve,
+			       const unsigned char *data, SilcUInt32 data_len,
+			       EcpPoint *r)
+{
+  const EcpField *f = &curve->p;
+  SilcUInt32 t1[SILC_ECP_MAX_DIGITS], t2[SILC_ECP_MAX_DIGITS];
+
+  if (data_len != 1 + 2 * curve->bytes || data[0] != 0x04)
+    return FALSE;
+
+  memset(r, 0, sizeof(*r));
+  silc_ecp_bin2num(r->x, data + 1, curve->bytes);
+  silc_ecp_bin2num(r->y, data + 1 + curve->bytes, curve->bytes);
+  if (silc_ecp_num_cmp(r->x, f->m, f->len) >= 0 ||
+      silc_ecp_num_cmp(r->y, f->m, f->len) >= 0)
+    return FALSE;
+  silc_ecp_mont_to(f, r->x, r->x);
+  silc_ecp_mont_to(f, r->y, r->y);
+  memcpy(r->z, f->one, sizeof(r->z));
+
+  /* y ^ 2 == x ^ 3 - 3x + b */
+  silc_ecp_mont_mul(f, t1, r->x, r->x);
+  silc_ecp_mont_mul(f, t1, t1, r->x);
+  silc_ecp_mod_sub(f, t1, t1, r->x);
+  silc_ecp_mod_sub(f, t1, t1, r->x);
+  silc_ecp_mod_sub(f, t1, t1, r->x);
+  silc_ecp_mod_add(f, t1, t1, curve->b);
+  silc_ecp_mont_mul(f, t2, r->y, r->y);
+
+  return silc_ecp_num_cmp(t1, t2, f->len) == 0;
+}
+
+/* Encodes affine point as uncompressed point 0x04 || x || y.  The `data'
+   must have 1 + 2 * bytes of space.  Returns the length. */
+
+SilcUInt32 silc_ecp_point_encode(const EcpCurve *curve, const EcpPoint *p,
+				 unsigned char *data)
+{
+  const EcpField *f = &curve->p;
+  SilcUInt32 t[SILC_ECP_MAX_DIGITS];
+
+  memset(t, 0, sizeof(t));
+  data[0] = 0x04;
+  silc_ecp_mont_from(f, t, p->x);
+  silc_ecp_num2bin(data + 1, curve->bytes, t);
+  silc_ecp_mont_from(f, t, p->y);
+  silc_ecp_num2bin(data + 1 + curve->bytes, curve->bytes, t);
+
+  return 1 + 2 * curve->bytes;
+}
@@ -0,0 +1,98 @@
+/*
+
+  ecp.h
+
+  Author: Pekka Riikonen <priikone@silcnet.org>
+
+  Copyright (C) 2008 Pekka Riikonen
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; version 2 of the License.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+*/
+
+#ifndef ECP_H
+#define ECP_H
+
+/* Elliptic curves over prime fields.  The curves have a = -3, which is the
+   case with the NIST curves.  The integers are arrays of 32 bit digits,
+   least significant digit first, and are always SILC_ECP_MAX_DIGITS long,
+   the digits above the curve size being zero. */
+
+/* Maximum digits in integer, enough for P-384 */
+#define SILC_ECP_MAX_DIGITS 12
+
+/* Prime field, modulus p or the group order n */
+typedef struct {
+  SilcUInt32 m[SILC_ECP_MAX_DIGITS];	/* Modulus */
+  SilcUInt32 rr[SILC_ECP_MAX_DIGITS];	/* R ^ 2 mod m */
+  SilcUInt32 one[SILC_ECP_MAX_DIGITS];	/* R mod m, one in Montgomery form */
+  SilcUInt32 minv;			/* -m ^ -1 mod 2 ^ 32 */
+  SilcUInt16 len;			/* Digits in modulus */
+} EcpField;
+
+/* Curve y ^ 2 = x ^ 3 - 3x + b */
+typedef struct {
+  const char *name;			/* Curve name, eg. "nistp256" */
+  const char *oid;			/* Curve OID */
+  const char *hash;			/* Default hash function */
+  EcpField p;				/* Prime field */
+  EcpField n;				/* Order of base point */
+  SilcUInt32 b[SILC_ECP_MAX_DIGITS];	/* b, in Montgomery form */
+  const SilcUInt32 *table;		/* Comb table of base point */
+  SilcUInt16 bytes;			/* Bytes in field element */
+  SilcUInt16 bits;			/* Bits in field element */
+  SilcUInt16 span;			/* Bits in each comb row */
+} EcpCurve;
+
+/* Point in Jacobian coordinates, in Montgomery form.  The point at
+   infinity has z zero.  Affine point has z one. */
+typedef struct {
+  SilcUInt32 x[SILC_ECP_MAX_DIGITS];
+  SilcUInt32 y[SILC_ECP_MAX_DIGITS];
+  SilcUInt32 z[SILC_ECP_MAX_DIGITS];
+} EcpPoint;
+
+const EcpCurve *silc_ecp_find_curve(const char *name);
+const EcpCurve *silc_ecp_find_curve_oid(const char *oid);
+const EcpCurve *silc_ecp_find_curve_bits(SilcUInt32 bits);
+void silc_ecp_bin2num(SilcUInt32 *r, const unsigned char *data,
+		      SilcUInt32 data_len);
+void silc_ecp_num2bin(unsigned char *data, SilcUInt32 data_len,
+		      const SilcUInt32 *a);
+int silc_ecp_num_cmp(const SilcUInt32 *a, const SilcUInt32 *b,
+		     SilcUInt32 len);
+SilcBool silc_ecp_num_is_zero(const SilcUInt32 *a, SilcUInt32 len);
+void silc_ecp_mod_add(const EcpField *f, SilcUInt32 *r,
+		      const SilcUInt32 *a, const SilcUInt32 *b);
+void silc_ecp_mod_sub(const EcpField *f, SilcUInt32 *r,
+		      const SilcUInt32 *a, const SilcUInt32 *b);
+void silc_ecp_mod_reduce(const EcpField *f, SilcUInt32 *r,
+			 const SilcUInt32 *a);
+void silc_ecp_mont_mul(const EcpField *f, SilcUInt32 *r,
+		       const SilcUInt32 *a, const SilcUInt32 *b);
+void silc_ecp_mont_to(const EcpField *f, SilcUInt32 *r, const SilcUInt32 *a);
+void silc_ecp_mont_from(const EcpField *f, SilcUInt32 *r,
+			const SilcUInt32 *a);
+void silc_ecp_mont_inv(const EcpField *f, SilcUInt32 *r,
+		       const SilcUInt32 *a);
+void silc_ecp_mul_base(const EcpCurve *curve, EcpPoint *r,
+		       const SilcUInt32 *k);
+void silc_ecp_mul_add(const EcpCurve *curve, EcpPoint *r,
+		      const SilcUInt32 *k1, const EcpPoint *p,
+		      const SilcUInt32 *k2);
+SilcBool silc_ecp_to_affine(const EcpCurve *curve, EcpPoint *r,
+			    const EcpPoint *p);
+SilcBool silc_ecp_point_decode(const EcpCurve *curve,
+			       const unsigned char *data, SilcUInt32 data_len,
+			       EcpPoint *r);
+SilcUInt32 silc_ecp_point_encode(const EcpCurve *curve, const EcpPoint *p,
+				 unsigned char *data);
+
+#endif /* ECP_H */
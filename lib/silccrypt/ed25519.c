@@ -0,0 +1,447 @@
+/*
+
+  ed25519.c
+
+  Author: Pekka Riikonen <priikone@silcnet.org>
+
+  Copyright (C) 2008 Pekka Riikonen
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; version 2 of the License.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+*/
+
+#include "silccrypto.h"
+#include "sha512_internal.h"
+#include "sha512.h"
+#include "ed25519.h"
+
+/************************ Ed25519 PKCS Algorithm API ************************/
+
+/* Notes about key formats:
+
+   The Ed25519 public key is the 32 byte encoded point A as defined in
+   RFC 8032.  The private key is the 32 byte private key (the seed) of
+   RFC 8032.  When importing, the private key may also be followed by the
+   32 byte public key, which is the format used by many other
+   implementations.
+
+   Notes about signature format:
+
+   The signature is the 64 byte R || S as defined in RFC 8032.  The
+   signature is always computed over the data itself (PureEdDSA) and the
+   `compute_hash' and `hash' arguments are ignored.
+
+*/
+
+/* Computes SHA-512 of a || b || data, and reduces it modulo l.  The `b'
+   may be NULL. */
+
+static void silc_ed25519_hash(unsigned char *h, const unsigned char *a,
+			      const unsigned char *b,
+			      const unsigned char *data, SilcUInt32 data_len)
+{
+  unsigned char digest[64];
+  sha512_state md;
+
+  silc_sha512_init(&md);
+  silc_sha512_update(&md, a, SILC_C25519_LEN);
+  if (b)
+    silc_sha512_update(&md, b, SILC_C25519_LEN);
+  silc_sha512_update(&md, data, data_len);
+  silc_sha512_final(&md, digest);
+  silc_c25519_sc_reduce(h, digest);
+
+  memset(digest, 0, sizeof(digest));
+  memset(&md, 0, sizeof(md));
+}
+
+/* Derives the secret scalar, nonce prefix and public key from the seed */
+
+static void silc_ed25519_expand(Ed25519PrivateKey *key)
+{
+  unsigned char digest[64];
+  sha512_state md;
+
+  silc_sha512_init(&md);
+  silc_sha512_update(&md, key->seed, sizeof(key->seed));
+  silc_sha512_final(&md, digest);
+
+  memcpy(key->a, digest, sizeof(key->a));
+  key->a[0] &= 248;
+  key->a[31] &= 127;
+  key->a[31] |= 64;
+  memcpy(key->prefix, digest + 32, sizeof(key->prefix));
+  silc_c25519_mul_base(key->pk, key->a);
+
+  memset(digest, 0, sizeof(digest));
+  memset(&md, 0, sizeof(md));
+}
+
+/* Verifies signature.  The S must be less than l. */
+
+static SilcBool silc_ed25519_verify_sig(const unsigned char *pk,
+					const unsigned char *signature,
+					SilcUInt32 signature_len,
+					const unsigned char *data,
+					SilcUInt32 data_len)
+{
+  unsigned char h[SILC_C25519_LEN];
+
+  if (signature_len != SILC_ED25519_SIG_LEN ||
+      !silc_c25519_sc_is_canonical(signature + SILC_C25519_LEN))
+    return FALSE;
+
+  silc_ed25519_hash(h, signature, pk, data, data_len);
+  return silc_c25519_verify(signature + SILC_C25519_LEN, h, pk, signature);
+}
+
+/* Generates Ed25519 key pair.  The key length is always 256 bits. */
+
+SILC_PKCS_ALG_GENERATE_KEY(silc_ed25519_generate_key)
+{
+  Ed25519PublicKey *pubkey;
+  Ed25519PrivateKey *privkey;
+  unsigned char rnd[64], digest[64];
+  sha512_state md;
+
+  if (keylen != 256) {
+    SILC_LOG_DEBUG(("Unsupported Ed25519 key length %d", keylen));
+    return FALSE;
+  }
+
+  pubkey = silc_calloc(1, sizeof(*pubkey));
+  if (!pubkey)
+    return FALSE;
+
+  privkey = silc_calloc(1, sizeof(*privkey));
+  if (!privkey) {
+    silc_free(pubkey);
+    return FALSE;
+  }
+
+  /* The RNG returns non-zero bytes only, so the private key is hashed
+     from the random data. */
+  silc_rng_get_rn_data(rng, sizeof(rnd), rnd, sizeof(rnd));
+  silc_sha512_init(&md);
+  silc_sha512_update(&md, rnd, sizeof(rnd));
+  silc_sha512_final(&md, digest);
+  memcpy(privkey->seed, digest, sizeof(privkey->seed));
+  silc_ed25519_expand(privkey);
+  memcpy(pubkey->pk, privkey->pk, sizeof(pubkey->pk));
+
+  memset(rnd, 0, sizeof(rnd));
+  memset(digest, 0, sizeof(digest));
+  memset(&md, 0, sizeof(md));
+
+  if (ret_public_key)
+    *ret_public_key = pubkey;
+  else
+    silc_free(pubkey);
+  if (ret_private_key)
+    *ret_private_key = privkey;
+  else
+    silc_ed25519_private_key_free(pkcs, privkey);
+
+  return TRUE;
+}
+
+/* Import Ed25519 public key */
+
+SILC_PKCS_ALG_IMPORT_PUBLIC_KEY(silc_ed25519_import_public_key)
+{
+  Ed25519PublicKey *pubkey;
+
+  SILC_LOG_DEBUG(("Import public key"));
+
+  if (!ret_public_key)
+    return 0;
+
+  if (key_len != SILC_C25519_LEN || !silc_c25519_point_check(key)) {
+    SILC_LOG_DEBUG(("Invalid Ed25519 public key"));
+    return 0;
+  }
+
+  *ret_public_key = pubkey = silc_calloc(1, sizeof(*pubkey));
+  if (!pubkey)
+    return 0;
+  memcpy(pubkey->pk, key, sizeof(pubkey->pk));
+
+  return key_len;
+}
+
+/* Export Ed25519 public key */
+
+SILC_PKCS_ALG_EXPORT_PUBLIC_KEY(silc_ed25519_export_public_key)
+{
+  Ed25519PublicKey *key = public_key;
+  unsigned char *ret;
+
+  SILC_LOG_DEBUG(("Export public key"));
+
+  ret = silc_smalloc(stack, sizeof(key->pk));
+  if (!ret)
+    return NULL;
+  memcpy(ret, key->pk, sizeof(key->pk));
+  *ret_len = sizeof(key->pk);
+
+  return ret;
+}
+
+/* Return key length */
+
+SILC_PKCS_ALG_PUBLIC_KEY_BITLEN(silc_ed25519_public_key_bitlen)
+{
+  return 256;
+}
+
+/* Copy public key */
+
+SILC_PKCS_ALG_PUBLIC_KEY_COPY(silc_ed25519_public_key_copy)
+{
+  Ed25519PublicKey *key = public_key, *new_key;
+
+  new_key = silc_calloc(1, sizeof(*new_key));
+  if (!new_key)
+    return NULL;
+  memcpy(new_key->pk, key->pk, sizeof(key->pk));
+
+  return new_key;
+}
+
+/* Compare public keys */
+
+SILC_PKCS_ALG_PUBLIC_KEY_COMPARE(silc_ed25519_public_key_compare)
+{
+  Ed25519PublicKey *k1 = key1, *k2 = key2;
+  return !memcmp(k1->pk, k2->pk, sizeof(k1->pk));
+}
+
+/* Free public key */
+
+SILC_PKCS_ALG_PUBLIC_KEY_FREE(silc_ed25519_public_key_free)
+{
+  silc_free(public_key);
+}
+
+/* Import Ed25519 private key */
+
+SILC_PKCS_ALG_IMPORT_PRIVATE_KEY(silc_ed25519_import_private_key)
+{
+  Ed25519PrivateKey *privkey;
+  unsigned char *k = key;
+
+  SILC_LOG_DEBUG(("Import private key"));
+
+  if (!ret_private_key)
+    return 0;
+
+  if (key_len != SILC_C25519_LEN && key_len != 2 * SILC_C25519_LEN)
+    return 0;
+
+  *ret_private_key = privkey = silc_calloc(1, sizeof(*privkey));
+  if (!privkey)
+    return 0;
+
+  memcpy(privkey->seed, k, sizeof(privkey->seed));
+  silc_ed25519_expand(privkey);
+
+  /* Check the public key matches if it was present */
+  if (key_len > SILC_C25519_LEN &&
+      memcmp(privkey->pk, k + SILC_C25519_LEN, sizeof(privkey->pk))) {
+    SILC_LOG_DEBUG(("Ed25519 private and public key do not match"));
+    memset(privkey, 0, sizeof(*privkey));
+    silc_free(privkey);
+    *ret_private_key = NULL;
+    return 0;
+  }
+
+  return key_len;
+}
+
+/* Export Ed25519 private key */
+
+SILC_PKCS_ALG_EXPORT_PRIVATE_KEY(silc_ed25519_export_private_key)
+{
+  Ed25519PrivateKey *key = private_key;
+  unsigned char *ret;
+
+  SILC_LOG_DEBUG(("Export private key"));
+
+  ret = silc_smalloc(stack, sizeof(key->seed));
+  if (!ret)
+    return NULL;
+  memcpy(ret, key->seed, sizeof(key->seed));
+  *ret_len = sizeof(key->seed);
+
+  return ret;
+}
+
+/* Return key length */
+
+SILC_PKCS_ALG_PRIVATE_KEY_BITLEN(silc_ed25519_private_key_bitlen)
+{
+  return 256;
+}
+
+/* Free private key */
+
+SILC_PKCS_ALG_PRIVATE_KEY_FREE(silc_ed25519_private_key_free)
+{
+  Ed25519PrivateKey *key = private_key;
+
+  memset(key, 0, sizeof(*key));
+  silc_free(key);
+}
+
+/* Encryption.  Not supported */
+
+SILC_PKCS_ALG_ENCRYPT(silc_ed25519_encrypt)
+{
+  SILC_LOG_WARNING(("Ed25519 encryption is not supported"));
+  encrypt_cb(FALSE, NULL, 0, context);
+  return NULL;
+}
+
+/* Decryption.  Not supported */
+
+SILC_PKCS_ALG_DECRYPT(silc_ed25519_decrypt)
+{
+  SILC_LOG_WARNING(("Ed25519 decryption is not supported"));
+  decrypt_cb(FALSE, NULL, 0, context);
+  return NULL;
+}
+
+/* Sign.  The signature is deterministic and does not need the RNG. */
+
+SILC_PKCS_ALG_SIGN(silc_ed25519_sign)
+{
+  Ed25519PrivateKey *key = private_key;
+  unsigned char sig[SILC_ED25519_SIG_LEN], r[SILC_C25519_LEN];
+  unsigned char h[SILC_C25519_LEN];
+
+  SILC_LOG_DEBUG(("Sign"));
+
+  /* r = H(prefix || M), R = r * B */
+  silc_ed25519_hash(r, key->prefix, NULL, src, src_len);
+  silc_c25519_mul_base(sig, r);
+
+  /* S = r + H(R || A || M) * a */
+  silc_ed25519_hash(h, sig, key->pk, src, src_len);
+  silc_c25519_sc_muladd(sig + SILC_C25519_LEN, h, key->a, r);
+
+  memset(r, 0, sizeof(r));
+
+  /* Deliver result */
+  sign_cb(TRUE, sig, sizeof(sig), context);
+
+  return NULL;
+}
+
+/* Verify */
+
+SILC_PKCS_ALG_VERIFY(silc_ed25519_verify)
+{
+  Ed25519PublicKey *key = public_key;
+
+  SILC_LOG_DEBUG(("Verify"));
+
+  verify_cb(silc_ed25519_verify_sig(key->pk, signature, signature_len,
+				    data, data_len), context);
+
+  return NULL;
+}
+
+/* Verifies many signatures with one batch equation.  The `public_keys'
+   are the Ed25519PublicKey contexts of the entries.  The random
+   coefficients of the batch equation are derived from hash of all the
+   signatures, public keys and messages, so they cannot be known before
+   the signatures are fixed.  If the batch fails the signatures are
+   verified one by one to find the invalid ones.  Sets the `success' of
+   each entry and returns the number of valid signatures. */
+
+SilcUInt32 silc_ed25519_verify_batch(void **public_keys,
+				     SilcPKCSVerifyEntry **entries,
+				     SilcUInt32 num_entries)
+{
+  C25519Verify *sigs;
+  SilcPKCSVerifyEntry **batch;
+  Ed25519PublicKey *key;
+  unsigned char seed[64], digest[64];
+  sha512_state md;
+  SilcUInt32 i, num = 0, valid = 0;
+
+  SILC_LOG_DEBUG(("Verify %d signatures", num_entries));
+
+  sigs = silc_malloc(num_entries * sizeof(*sigs));
+  batch = silc_malloc(num_entries * sizeof(*batch));
+  if (!sigs || !batch) {
+    silc_free(sigs);
+    silc_free(batch);
+    for (i = 0; i < num_entries; i++) {
+      key = public_keys[i];
+      entries[i]->success =
+	silc_ed25519_verify_sig(key->pk, entries[i]->signature,
+				entries[i]->signature_len,
+				entries[i]->data, entries[i]->data_len);
+      if (entries[i]->success)
+	valid++;
+    }
+    return valid;
+  }
+
+  /* Malformed signatures are rejected here, the rest go to the batch */
+  silc_sha512_init(&md);
+  for (i = 0; i < num_entries; i++) {
+    key = public_keys[i];
+    entries[i]->success = FALSE;
+    if (entries[i]->signature_len != SILC_ED25519_SIG_LEN ||
+	!silc_c25519_sc_is_canonical(entries[i]->signature +
+				     SILC_C25519_LEN))
+      continue;
+
+    sigs[num].a = key->pk;
+    sigs[num].r = entries[i]->signature;
+    sigs[num].s = entries[i]->signature + SILC_C25519_LEN;
+    silc_ed25519_hash(sigs[num].h, sigs[num].r, sigs[num].a,
+		      entries[i]->data, entries[i]->data_len);
+    silc_sha512_update(&md, entries[i]->signature, SILC_ED25519_SIG_LEN);
+    silc_sha512_update(&md, sigs[num].h, sizeof(sigs[num].h));
+    batch[num++] = entries[i];
+  }
+  silc_sha512_final(&md, seed);
+
+  /* z_i = H(seed || i) */
+  for (i = 0; i < num; i++) {
+    silc_sha512_init(&md);
+    silc_sha512_update(&md, seed, sizeof(seed));
+    SILC_PUT32_MSB(i, digest);
+    silc_sha512_update(&md, digest, 4);
+    silc_sha512_final(&md, digest);
+    memcpy(sigs[i].z, digest, sizeof(sigs[i].z));
+  }
+
+  if (silc_c25519_verify_batch(sigs, num)) {
+    for (i = 0; i < num; i++)
+      batch[i]->success = TRUE;
+    valid = num;
+  } else {
+    for (i = 0; i < num; i++) {
+      batch[i]->success = silc_c25519_verify(sigs[i].s, sigs[i].h,
+					     sigs[i].a, sigs[i].r);
+      if (batch[i]->success)
+	valid++;
+    }
+  }
+
+  silc_free(sigs);
+  silc_free(batch);
+
+  return valid;
+}
@@ -0,0 +1,61 @@
+/*
+
+  ed25519.h
+
+  Author: Pekka Riikonen <priikone@silcnet.org>
+
+  Copyright (C) 2008 Pekka Riikonen
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; version 2 of the License.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+*/
+
+#ifndef ED25519_H
+#define ED25519_H
+
+#include "curve25519.h"
+
+/* Length of Ed25519 signature */
+#define SILC_ED25519_SIG_LEN (2 * SILC_C25519_LEN)
+
+/* Ed25519 Public key */
+typedef struct {
+  unsigned char pk[SILC_C25519_LEN];	/* Public key, encoded point A */
+} Ed25519PublicKey;
+
+/* Ed25519 Private key */
+typedef struct {
+  unsigned char seed[SILC_C25519_LEN];	/* Private key */
+  unsigned char a[SILC_C25519_LEN];	/* Secret scalar, from seed */
+  unsigned char prefix[SILC_C25519_LEN]; /* Nonce prefix, from seed */
+  unsigned char pk[SILC_C25519_LEN];	/* Public key, encoded point A */
+} Ed25519PrivateKey;
+
+SILC_PKCS_ALG_GENERATE_KEY(silc_ed25519_generate_key);
+SILC_PKCS_ALG_IMPORT_PUBLIC_KEY(silc_ed25519_import_public_key);
+SILC_PKCS_ALG_EXPORT_PUBLIC_KEY(silc_ed25519_export_public_key);
+SILC_PKCS_ALG_PUBLIC_KEY_BITLEN(silc_ed25519_public_key_bitlen);
+SILC_PKCS_ALG_PUBLIC_KEY_COPY(silc_ed25519_public_key_copy);
+SILC_PKCS_ALG_PUBLIC_KEY_COMPARE(silc_ed25519_public_key_compare);
+SILC_PKCS_ALG_PUBLIC_KEY_FREE(silc_ed25519_public_key_free);
+SILC_PKCS_ALG_IMPORT_PRIVATE_KEY(silc_ed25519_import_private_key);
+SILC_PKCS_ALG_EXPORT_PRIVATE_KEY(silc_ed25519_export_private_key);
+SILC_PKCS_ALG_PRIVATE_KEY_BITLEN(silc_ed25519_private_key_bitlen);
+SILC_PKCS_ALG_PRIVATE_KEY_FREE(silc_ed25519_private_key_free);
+SILC_PKCS_ALG_ENCRYPT(silc_ed25519_encrypt);
+SILC_PKCS_ALG_DECRYPT(silc_ed25519_decrypt);
+SILC_PKCS_ALG_SIGN(silc_ed25519_sign);
+SILC_PKCS_ALG_VERIFY(silc_ed25519_verify);
+
+SilcUInt32 silc_ed25519_verify_batch(void **public_keys,
+				     SilcPKCSVerifyEntry **entries,
+				     SilcUInt32 num_entries);
+
+#endif /* ED25519_H */
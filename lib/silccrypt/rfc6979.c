@@ -0,0 +1,149 @@
+/*
+
+  rfc6979.c
+
+  Author: Pekka Riikonen <priikone@silcnet.org>
+
+  Copyright (C) 2008 Pekka Riikonen
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; version 2 of the License.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+*/
+
+#include "silccrypto.h"
+#include "rfc6979.h"
+
+/* Maximum block length of the hash function */
+#define SILC_RFC6979_BLOCK_MAXLEN 128
+
+/* Starts HMAC with the key K.  The key is never longer than the block of
+   the hash function. */
+
+static void silc_rfc6979_hmac_init(Rfc6979Drbg *drbg)
+{
+  unsigned char pad[SILC_RFC6979_BLOCK_MAXLEN];
+  SilcUInt32 block_len = silc_hash_block_len(drbg->hash), i;
+
+  memset(pad, 0x36, block_len);
+  for (i = 0; i < drbg->hash_len; i++)
+    pad[i] ^= drbg->k[i];
+
+  silc_hash_init(drbg->hash);
+  silc_hash_update(drbg->hash, pad, block_len);
+
+  memset(pad, 0, sizeof(pad));
+}
+
+/* Finishes HMAC into `mac', which may be K or V */
+
+static void silc_rfc6979_hmac_final(Rfc6979Drbg *drbg, unsigned char *mac)
+{
+  unsigned char pad[SILC_RFC6979_BLOCK_MAXLEN], inner[SILC_HASH_MAXLEN];
+  SilcUInt32 block_len = silc_hash_block_len(drbg->hash), i;
+
+  silc_hash_final(drbg->hash, inner);
+
+  memset(pad, 0x5c, block_len);
+  for (i = 0; i < drbg->hash_len; i++)
+    pad[i] ^= drbg->k[i];
+
+  silc_hash_init(drbg->hash);
+  silc_hash_update(drbg->hash, pad, block_len);
+  silc_hash_update(drbg->hash, inner, drbg->hash_len);
+  silc_hash_final(drbg->hash, mac);
+
+  memset(pad, 0, sizeof(pad));
+  memset(inner, 0, sizeof(inner));
+}
+
+/* Updates K and V: K = HMAC_K(V || sep || x || h), V = HMAC_K(V).  The
+   `x' and `h' are omitted when `x' is NULL. */
+
+static void silc_rfc6979_update(Rfc6979Drbg *drbg, unsigned char sep,
+				const unsigned char *x, SilcUInt32 x_len,
+				const unsigned char *h, SilcUInt32 h_len)
+{
+  silc_rfc6979_hmac_init(drbg);
+  silc_hash_update(drbg->hash, drbg->v, drbg->hash_len);
+  silc_hash_update(drbg->hash, &sep, 1);
+  if (x) {
+    silc_hash_update(drbg->hash, x, x_len);
+    silc_hash_update(drbg->hash, h, h_len);
+  }
+  silc_rfc6979_hmac_final(drbg, drbg->k);
+
+  silc_rfc6979_hmac_init(drbg);
+  silc_hash_update(drbg->hash, drbg->v, drbg->hash_len);
+  silc_rfc6979_hmac_final(drbg, drbg->v);
+}
+
+/* Initializes the generator with the private key `x' and the digest
+   `h', which are int2octets(x) and bits2octets(h1) of RFC 6979.  The
+   generator takes the thread's context of the hash function of `hash',
+   so the `hash' may be the context of the key shared by many threads. */
+
+SilcBool silc_rfc6979_init(Rfc6979Drbg *drbg, SilcHash hash,
+			   const unsigned char *x, SilcUInt32 x_len,
+			   const unsigned char *h, SilcUInt32 h_len)
+{
+  drbg->hash = NULL;
+
+  if (!hash || silc_hash_block_len(hash) > SILC_RFC6979_BLOCK_MAXLEN)
+    return FALSE;
+  if (!silc_crypto_thread_hash_get(silc_hash_get_name(hash), &drbg->hash))
+    return FALSE;
+
+  drbg->hash_len = silc_hash_len(hash);
+  drbg->reseed = FALSE;
+
+  /* K = 0x00 0x00 ..., V = 0x01 0x01 ... */
+  memset(drbg->k, 0x00, sizeof(drbg->k));
+  memset(drbg->v, 0x01, sizeof(drbg->v));
+
+  silc_rfc6979_update(drbg, 0x00, x, x_len, h, h_len);
+  silc_rfc6979_update(drbg, 0x01, x, x_len, h, h_len);
+
+  return TRUE;
+}
+
+/* Generates next nonce candidate into `k' of `k_len' bytes.  If the
+   caller rejects the candidate this is called again. */
+
+void silc_rfc6979_generate(Rfc6979Drbg *drbg, unsigned char *k,
+			   SilcUInt32 k_len)
+{
+  SilcUInt32 len;
+
+  /* K = HMAC_K(V || 0x00), V = HMAC_K(V) after rejected candidate */
+  if (drbg->reseed)
+    silc_rfc6979_update(drbg, 0x00, NULL, 0, NULL, 0);
+  drbg->reseed = TRUE;
+
+  while (k_len > 0) {
+    silc_rfc6979_hmac_init(drbg);
+    silc_hash_update(drbg->hash, drbg->v, drbg->hash_len);
+    silc_rfc6979_hmac_final(drbg, drbg->v);
+
+    len = k_len < drbg->hash_len ? k_len : drbg->hash_len;
+    memcpy(k, drbg->v, len);
+    k += len;
+    k_len -= len;
+  }
+}
+
+/* Clears the generator state */
+
+void silc_rfc6979_uninit(Rfc6979Drbg *drbg)
+{
+  silc_crypto_thread_hash_put(drbg->hash);
+  drbg->hash = NULL;
+  memset(drbg->k, 0, sizeof(drbg->k));
+  memset(drbg->v, 0, sizeof(drbg->v));
+}
@@ -0,0 +1,45 @@
+/*
+
+  rfc6979.h
+
+  Author: Pekka Riikonen <priikone@silcnet.org>
+
+  Copyright (C) 2008 Pekka Riikonen
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; version 2 of the License.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+*/
+
+#ifndef RFC6979_H
+#define RFC6979_H
+
+/* Deterministic nonce generation of DSA and ECDSA, RFC 6979.  The nonce
+   is generated with HMAC_DRBG from the private key and the message
+   digest, using the hash function of the message digest.  The caller
+   converts the private key and the digest into octet strings as defined
+   in RFC 6979 and checks that the generated nonce is in range. */
+
+/* HMAC_DRBG state */
+typedef struct {
+  SilcHash hash;			/* Thread's hash context of HMAC */
+  SilcUInt32 hash_len;
+  unsigned char k[SILC_HASH_MAXLEN];	/* Key K */
+  unsigned char v[SILC_HASH_MAXLEN];	/* Value V */
+  unsigned int reseed : 1;		/* Set when K and V must be updated */
+} Rfc6979Drbg;
+
+SilcBool silc_rfc6979_init(Rfc6979Drbg *drbg, SilcHash hash,
+			   const unsigned char *x, SilcUInt32 x_len,
+			   const unsigned char *h, SilcUInt32 h_len);
+void silc_rfc6979_generate(Rfc6979Drbg *drbg, unsigned char *k,
+			   SilcUInt32 k_len);
+void silc_rfc6979_uninit(Rfc6979Drbg *drbg);
+
+#endif /* RFC6979_H */
@@ -35,7 +35,8 @@
  	Decryption:
  	m = c ^ d mod n
 
-  Supports CRT (Chinese Remainder Theorem) for private key operations.
+  Supports CRT (Chinese Remainder Theorem) for private key operations,
+  also with multi-prime keys of PKCS #1 v2.1.
 
   The SSH's (Secure Shell), PGP's (Pretty Good Privacy) and RSAREF
   Toolkit were used as reference when coding this implementation. They
@@ -76,18 +77,27 @@
 #include "silccrypto.h"
 #include "rsa.h"
 
-/* Generates RSA public and private keys. Primes p and q that are used
-   to compute the modulus n has to be generated before calling this. They
-   are then sent as argument for the function. */
+/* Generates RSA public and private keys. The `num_primes' primes, of
+   which the first two are p and q, that are used to compute the modulus
+   n has to be generated before calling this. They are then sent as
+   argument for the function.  With more than two primes this generates
+   multi-prime RSA key as defined in PKCS #1 v2.1. */
 
-SilcBool silc_rsa_generate_keys(SilcUInt32 bits, SilcMPInt *p, SilcMPInt *q,
+SilcBool silc_rsa_generate_keys(SilcUInt32 bits, SilcMPInt *primes,
+				SilcUInt32 num_primes,
 				void **ret_public_key, void **ret_private_key)
 {
   RsaPublicKey *pubkey;
   RsaPrivateKey *privkey;
+  RsaOtherPrime *other;
+  SilcMPInt *p = &primes[0], *q = &primes[1];
   SilcMPInt phi, hlp;
   SilcMPInt div, lcm;
-  SilcMPInt pm1, qm1;
+  SilcMPInt rm1, prod;
+  SilcUInt32 prime_bits, i;
+
+  if (num_primes < 2 || num_primes > SILC_RSA_MAX_PRIMES)
+    return FALSE;
 
   *ret_public_key = pubkey = silc_calloc(1, sizeof(*pubkey));
   if (!pubkey)
@@ -97,34 +107,58 @@ SilcBool silc_rsa_generate_keys(SilcUInt32 bits, SilcMPInt *p, SilcMPInt *q,
   if (!privkey)
     return FALSE;
 
+  if (num_primes > 2) {
+    privkey->other = silc_calloc(num_primes - 2, sizeof(*privkey->other));
+    if (!privkey->other)
+      return FALSE;
+    privkey->num_other = num_primes - 2;
+  }
+
   /* Default hash shall be sha1 */
   silc_hash_alloc("sha1", &pubkey->hash);
   silc_hash_alloc("sha1", &privkey->hash);
 
-  /* Initialize variables */
-  silc_mp_init(&privkey->n);
-  silc_mp_init(&privkey->e);
-  silc_mp_init(&privkey->d);
-  silc_mp_init(&privkey->dP);
-  silc_mp_init(&privkey->dQ);
-  silc_mp_init(&privkey->qP);
-  silc_mp_init(&phi);
+  /* Initialize variables to their final size */
+  prime_bits = silc_mp_sizeinbase(q, 2);
+  silc_mp_init_size(&privkey->n, bits);
+  silc_mp_init_size(&privkey->e, 32);
+  silc_mp_init_size(&privkey->d, bits);
+  silc_mp_init_size(&privkey->dP, prime_bits);
+  silc_mp_init_size(&privkey->dQ, prime_bits);
+  silc_mp_init_size(&privkey->qP, prime_bits);
+  silc_mp_init_size(&privkey->p, prime_bits);
+  silc_mp_init_size(&privkey->q, prime_bits);
+  for (i = 0; i < privkey->num_other; i++) {
+    other = &privkey->other[i];
+    prime_bits = silc_mp_sizeinbase(&primes[i + 2], 2);
+    silc_mp_init_size(&other->r, prime_bits);
+    silc_mp_init_size(&other->d, prime_bits);
+    silc_mp_init_size(&other->t, prime_bits);
+  }
+  silc_mp_init_size(&phi, bits);
+  silc_mp_init_size(&lcm, bits);
+  silc_mp_init_size(&prod, bits);
   silc_mp_init(&hlp);
   silc_mp_init(&div);
-  silc_mp_init(&lcm);
-  silc_mp_init(&pm1);
-  silc_mp_init(&qm1);
+  silc_mp_init(&rm1);
 
   /* Set modulus length */
   privkey->bits = bits;
 
-  /* Compute modulus, n = p * q */
-  silc_mp_mul(&privkey->n, p, q);
-
-  /* phi = (p - 1) * (q - 1) */
-  silc_mp_sub_ui(&pm1, p, 1);
-  silc_mp_sub_ui(&qm1, q, 1);
-  silc_mp_mul(&phi, &pm1, &qm1);
+  /* Compute modulus, n = p * q * r_3 * ... * r_u,
+     phi = (p - 1) * (q - 1) * ... * (r_u - 1) and
+     lcm = lcm(p - 1, q - 1, ..., r_u - 1). */
+  silc_mp_set_ui(&privkey->n, 1);
+  silc_mp_set_ui(&phi, 1);
+  silc_mp_set_ui(&lcm, 1);
+  for (i = 0; i < num_primes; i++) {
+    silc_mp_mul(&privkey->n, &privkey->n, &primes[i]);
+    silc_mp_sub_ui(&rm1, &primes[i], 1);
+    silc_mp_mul(&phi, &phi, &rm1);
+    silc_mp_gcd(&div, &lcm, &rm1);
+    silc_mp_mul(&lcm, &lcm, &rm1);
+    silc_mp_div(&lcm, &lcm, &div);
+  }
 
   /* Set e, the public exponent. We try to use same public exponent
      for all keys. Also, to make encryption faster we use small
@@ -140,58 +174,254 @@ SilcBool silc_rsa_generate_keys(SilcUInt32 bits, SilcMPInt *p, SilcMPInt *q,
   }
 
   /* Find d, the private exponent, e ^ -1 mod lcm(phi). */
-  silc_mp_gcd(&div, &pm1, &qm1);
-  silc_mp_div(&lcm, &phi, &div);
   silc_mp_modinv(&privkey->d, &privkey->e, &lcm);
 
   /* Optimize d with CRT. */
-  silc_mp_mod(&privkey->dP, &privkey->d, &pm1);
-  silc_mp_mod(&privkey->dQ, &privkey->d, &qm1);
+  silc_mp_sub_ui(&rm1, p, 1);
+  silc_mp_mod(&privkey->dP, &privkey->d, &rm1);
+  silc_mp_sub_ui(&rm1, q, 1);
+  silc_mp_mod(&privkey->dQ, &privkey->d, &rm1);
   silc_mp_modinv(&privkey->qP, q, p);
   silc_mp_set(&privkey->p, p);
   silc_mp_set(&privkey->q, q);
 
+  /* CRT of the other primes, d_i = d mod (r_i - 1) and
+     t_i = (p * q * ... * r_i-1) ^ -1 mod r_i. */
+  silc_mp_mul(&prod, p, q);
+  for (i = 0; i < privkey->num_other; i++) {
+    other = &privkey->other[i];
+    silc_mp_set(&other->r, &primes[i + 2]);
+    silc_mp_sub_ui(&rm1, &other->r, 1);
+    silc_mp_mod(&other->d, &privkey->d, &rm1);
+    silc_mp_mod(&hlp, &prod, &other->r);
+    silc_mp_modinv(&other->t, &hlp, &other->r);
+    silc_mp_mul(&prod, &prod, &other->r);
+  }
+
   silc_mp_uninit(&phi);
   silc_mp_uninit(&hlp);
   silc_mp_uninit(&div);
   silc_mp_uninit(&lcm);
-  silc_mp_uninit(&pm1);
-  silc_mp_uninit(&qm1);
+  silc_mp_uninit(&rm1);
+  silc_mp_uninit(&prod);
 
   /* Set public key */
-  silc_mp_init(&pubkey->n);
-  silc_mp_init(&pubkey->e);
+  silc_mp_init_size(&pubkey->n, bits);
+  silc_mp_init_size(&pubkey->e, 32);
   pubkey->bits = privkey->bits;
   silc_mp_set(&pubkey->n, &privkey->n);
   silc_mp_set(&pubkey->e, &privkey->e);
 
+  silc_rsa_public_key_mont_init(pubkey);
+  silc_rsa_private_key_mont_init(privkey);
+
   return TRUE;
 }
 
-/* RSA public key operation */
+/* Frees the other primes of multi-prime key */
+
+void silc_rsa_private_key_other_free(RsaPrivateKey *key)
+{
+  SilcUInt32 i;
+
+  for (i = 0; i < key->num_other; i++) {
+    silc_mp_uninit(&key->other[i].r);
+    silc_mp_uninit(&key->other[i].d);
+    silc_mp_uninit(&key->other[i].t);
+  }
+  silc_free(key->other);
+  key->other = NULL;
+  key->num_other = 0;
+}
+
+/* Precomputes the Montgomery context of the modulus.  If this fails the
+   public key operation computes it in each exponentiation. */
 
-SilcBool silc_rsa_public_operation(RsaPublicKey *key, SilcMPInt *src,
-				   SilcMPInt *dst)
+void silc_rsa_public_key_mont_init(RsaPublicKey *key)
+{
+  silc_rsa_public_key_mont_uninit(key);
+  if (!silc_mp_mont_init(&key->mont_n, &key->n))
+    return;
+  key->mont = TRUE;
+  key->small_e = (silc_mp_cmp_ui(&key->e, 1) > 0 &&
+		  silc_mp_sizeinbase(&key->e, 2) <= 32);
+}
+
+/* Frees the Montgomery context */
+
+void silc_rsa_public_key_mont_uninit(RsaPublicKey *key)
+{
+  if (!key->mont)
+    return;
+  silc_mp_mont_uninit(&key->mont_n);
+  key->mont = FALSE;
+  key->small_e = FALSE;
+}
+
+/* Precomputes the Montgomery contexts of the CRT primes */
+
+void silc_rsa_private_key_mont_init(RsaPrivateKey *key)
+{
+  SilcUInt32 i;
+
+  silc_rsa_private_key_mont_uninit(key);
+  if (!silc_mp_mont_init(&key->mont_p, &key->p))
+    return;
+  if (!silc_mp_mont_init(&key->mont_q, &key->q)) {
+    silc_mp_mont_uninit(&key->mont_p);
+    return;
+  }
+  for (i = 0; i < key->num_other; i++) {
+    if (!silc_mp_mont_init(&key->other[i].mont, &key->other[i].r)) {
+      while (i-- > 0)
+	silc_mp_mont_uninit(&key->other[i].mont);
+      silc_mp_mont_uninit(&key->mont_p);
+      silc_mp_mont_uninit(&key->mont_q);
+      return;
+    }
+  }
+  key->mont = TRUE;
+}
+
+/* Frees the Montgomery contexts */
+
+void silc_rsa_private_key_mont_uninit(RsaPrivateKey *key)
+{
+  SilcUInt32 i;
+
+  if (!key->mont)
+    return;
+  silc_mp_mont_uninit(&key->mont_p);
+  silc_mp_mont_uninit(&key->mont_q);
+  for (i = 0; i < key->num_other; i++)
+    silc_mp_mont_uninit(&key->other[i].mont);
+  key->mont = FALSE;
+}
+
+/* Computes dst = src ^ e mod n for small e, such as 65537, with binary
+   exponentiation.  The window table of the generic exponentiation costs
+   more than it saves with so few bits. */
+
+static SilcBool silc_rsa_pow_mod_small(SilcStack stack, SilcMPInt *dst,
+				       SilcMPInt *src, SilcUInt32 e,
+				       SilcMPMont *mont)
+{
+  SilcMPInt b, r;
+  SilcBool ret = FALSE;
+  int i;
+
+  silc_mp_sinit(stack, &b);
+  silc_mp_sinit(stack, &r);
+
+  if (!silc_mp_mont_to(&b, src, mont) || !silc_mp_set(&r, &b))
+    goto out;
+
+  for (i = 31; !(e & (1UL << i)); i--);
+  for (i--; i >= 0; i--) {
+    if (!silc_mp_mont_mul(&r, &r, &r, mont))
+      goto out;
+    if ((e & (1UL << i)) && !silc_mp_mont_mul(&r, &r, &b, mont))
+      goto out;
+  }
+
+  ret = silc_mp_mont_from(dst, &r, mont);
+
+ out:
+  silc_mp_uninit(&b);
+  silc_mp_uninit(&r);
+  return ret;
+}
+
+/* RSA public key operation.  The temporary integers are allocated from
+   `stack' if it is non-NULL. */
+
+SilcBool silc_rsa_public_operation(SilcStack stack, RsaPublicKey *key,
+				   SilcMPInt *src, SilcMPInt *dst)
 {
   /* dst = src ^ e mod n */
-  silc_mp_pow_mod(dst, src, &key->e, &key->n);
+  if (key->small_e)
+    silc_rsa_pow_mod_small(stack, dst, src, silc_mp_get_ui(&key->e),
+			   &key->mont_n);
+  else if (key->mont)
+    silc_mp_pow_mod_mont(dst, src, &key->e, &key->mont_n);
+  else
+    silc_mp_pow_mod(dst, src, &key->e, &key->n);
   return TRUE;
 }
 
-/* RSA private key operation */
+/* Generates random blinding value `b' and its inverse `binv' modulo n.
+   The global RNG is used if `rng' is NULL.  Returns FALSE if random data
+   is not available. */
+
+static SilcBool silc_rsa_blinding(SilcStack stack, RsaPrivateKey *key,
+				  SilcRng rng, SilcMPInt *b, SilcMPInt *binv)
+{
+  SilcUInt32 len = (key->bits + 7) / 8;
+  unsigned char *buf;
+  SilcBool ret = FALSE;
+  int i;
+
+  buf = silc_smalloc(stack, len);
+  if (!buf)
+    return FALSE;
+
+  /* The value is not invertible only if it shares a prime with n */
+  for (i = 0; i < 8 && !ret; i++) {
+    if (rng ? !silc_rng_get_rn_data(rng, len, buf, len) :
+	!silc_rng_global_get_rn_data(NULL, len, buf, len))
+      break;
+    silc_mp_bin2mp(buf, len, b);
+    silc_mp_mod(b, b, &key->n);
+    ret = silc_mp_modinv(binv, b, &key->n);
+  }
+
+  memset(buf, 0, len);
+  silc_sfree(stack, buf);
+  return ret;
+}
+
+/* RSA private key operation.  The base is blinded with random value from
+   `rng', or from the global RNG if it is NULL, so that the time of the
+   operation does not depend on `src'.  The temporary integers are
+   allocated from `stack' if it is non-NULL. */
 
-SilcBool silc_rsa_private_operation(RsaPrivateKey *key, SilcMPInt *src,
+SilcBool silc_rsa_private_operation(SilcStack stack, RsaPrivateKey *key,
+				    SilcRng rng, SilcMPInt *src,
 				    SilcMPInt *dst)
 {
-  SilcMPInt tmp;
+  RsaOtherPrime *other;
+  SilcMPInt tmp, r, b, binv, bsrc;
+  SilcBool blind;
+  SilcUInt32 i;
+
+  silc_mp_sinit(stack, &tmp);
+  silc_mp_sinit(stack, &b);
+  silc_mp_sinit(stack, &binv);
+  silc_mp_sinit(stack, &bsrc);
+
+  /* src = src * b ^ e mod n, the result is multiplied by b ^ -1.  The
+     operation is not blinded if random data is not available. */
+  blind = silc_rsa_blinding(stack, key, rng, &b, &binv);
+  if (blind) {
+    silc_mp_pow_mod(&b, &b, &key->e, &key->n);
+    silc_mp_mul(&bsrc, src, &b);
+    silc_mp_mod(&bsrc, &bsrc, &key->n);
+    src = &bsrc;
+  }
 
-  silc_mp_init(&tmp);
+  if (key->mont) {
+    /* dst = (src ^ dP mod p) */
+    silc_mp_pow_mod_mont_secret(dst, src, &key->dP, &key->mont_p);
 
-  /* dst = (src ^ dP mod p) */
-  silc_mp_pow_mod(dst, src, &key->dP, &key->p);
+    /* tmp = (src ^ dQ mod q) */
+    silc_mp_pow_mod_mont_secret(&tmp, src, &key->dQ, &key->mont_q);
+  } else {
+    /* dst = (src ^ dP mod p) */
+    silc_mp_pow_mod_secret(dst, src, &key->dP, &key->p);
 
-  /* tmp = (src ^ dQ mod q) */
-  silc_mp_pow_mod(&tmp, src, &key->dQ, &key->q);
+    /* tmp = (src ^ dQ mod q) */
+    silc_mp_pow_mod_secret(&tmp, src, &key->dQ, &key->q);
+  }
 
   /* dst = (dst - tmp) * qP mod p */
   silc_mp_sub(dst, dst, &tmp);
@@ -202,7 +432,47 @@ SilcBool silc_rsa_private_operation(RsaPrivateKey *key, SilcMPInt *src,
   silc_mp_mul(dst, dst, &key->q);
   silc_mp_add(dst, dst, &tmp);
 
+  if (key->num_other) {
+    /* Multi-prime key, combine rest of the primes as in PKCS #1 v2.1 */
+    silc_mp_sinit(stack, &r);
+    silc_mp_mul(&r, &key->p, &key->q);
+
+    for (i = 0; i < key->num_other; i++) {
+      other = &key->other[i];
+
+      /* tmp = (src ^ d_i mod r_i) */
+      if (key->mont)
+	silc_mp_pow_mod_mont_secret(&tmp, src, &other->d, &other->mont);
+      else
+	silc_mp_pow_mod_secret(&tmp, src, &other->d, &other->r);
+
+      /* tmp = (tmp - dst) * t_i mod r_i */
+      silc_mp_sub(&tmp, &tmp, dst);
+      silc_mp_mul(&tmp, &tmp, &other->t);
+      silc_mp_mod(&tmp, &tmp, &other->r);
+
+      /* dst = dst + r * tmp, r = r * r_i */
+      silc_mp_mul(&tmp, &tmp, &r);
+      silc_mp_add(dst, dst, &tmp);
+      silc_mp_mul(&r, &r, &other->r);
+    }
+
+    silc_mp_uninit(&r);
+  }
+
+  /* Unblind */
+  if (blind) {
+    silc_mp_mul(dst, dst, &binv);
+    silc_mp_mod(dst, dst, &key->n);
+  }
+
+  silc_mp_set_ui(&b, 0);
+  silc_mp_set_ui(&binv, 0);
+  silc_mp_set_ui(&bsrc, 0);
   silc_mp_uninit(&tmp);
+  silc_mp_uninit(&b);
+  silc_mp_uninit(&binv);
+  silc_mp_uninit(&bsrc);
 
   return TRUE;
 }
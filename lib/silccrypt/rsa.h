@@ -20,12 +20,26 @@
 #ifndef RSA_H
 #define RSA_H
 
+/* Maximum number of primes in multi-prime RSA key */
+#define SILC_RSA_MAX_PRIMES 4
+
+/* Additional prime of multi-prime RSA key, OtherPrimeInfo of PKCS #1 */
+typedef struct {
+  SilcMPInt r;			/* prime */
+  SilcMPInt d;			/* CRT, d mod r - 1 */
+  SilcMPInt t;			/* CRT, (p * q * ... * r_i-1) ^ -1 mod r */
+  SilcMPMont mont;		/* Montgomery context of r */
+} RsaOtherPrime;
+
 /* RSA Public Key */
 typedef struct {
   SilcHash hash;		/* Default hash */
   SilcMPInt n;			/* modulus */
   SilcMPInt e;			/* public exponent */
+  SilcMPMont mont_n;		/* Montgomery context of n */
   int bits;			/* bits in key */
+  unsigned int mont : 1;	/* Set when Montgomery context is set */
+  unsigned int small_e : 1;	/* Set when e fits in 32 bits */
 } RsaPublicKey;
 
 /* RSA Private Key */
@@ -39,14 +53,26 @@ typedef struct {
   SilcMPInt dP;			/* CRT, d mod p - 1 */
   SilcMPInt dQ;			/* CRT, d mod q - 1 */
   SilcMPInt qP;			/* CRT, q ^ -1 mod p (aka u, aka qInv) */
+  SilcMPMont mont_p;		/* Montgomery context of p */
+  SilcMPMont mont_q;		/* Montgomery context of q */
+  RsaOtherPrime *other;		/* Additional primes of multi-prime key */
+  SilcUInt32 num_other;		/* Number of additional primes */
   int bits;			/* bits in key */
+  unsigned int mont : 1;	/* Set when Montgomery contexts are set */
 } RsaPrivateKey;
 
-SilcBool silc_rsa_generate_keys(SilcUInt32 bits, SilcMPInt *p, SilcMPInt *q,
+SilcBool silc_rsa_generate_keys(SilcUInt32 bits, SilcMPInt *primes,
+				SilcUInt32 num_primes,
 				void **ret_public_key, void **ret_private_key);
-SilcBool silc_rsa_public_operation(RsaPublicKey *key, SilcMPInt *src,
-				   SilcMPInt *dst);
-SilcBool silc_rsa_private_operation(RsaPrivateKey *key, SilcMPInt *src,
+SilcBool silc_rsa_public_operation(SilcStack stack, RsaPublicKey *key,
+				   SilcMPInt *src, SilcMPInt *dst);
+SilcBool silc_rsa_private_operation(SilcStack stack, RsaPrivateKey *key,
+				    SilcRng rng, SilcMPInt *src,
 				    SilcMPInt *dst);
+void silc_rsa_public_key_mont_init(RsaPublicKey *key);
+void silc_rsa_public_key_mont_uninit(RsaPublicKey *key);
+void silc_rsa_private_key_mont_init(RsaPrivateKey *key);
+void silc_rsa_private_key_mont_uninit(RsaPrivateKey *key);
+void silc_rsa_private_key_other_free(RsaPrivateKey *key);
 
 #endif /* RSA_H */
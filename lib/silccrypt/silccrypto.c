@@ -19,8 +19,32 @@
 
 #include "silccrypto.h"
 
+/* Number of hash contexts cached in each thread */
+#define SILC_CRYPTO_THREAD_HASHES 4
+
+/* Cached hash context of a thread */
+typedef struct {
+  SilcHash hash;
+  SilcBool busy;			/* Set when taken by caller */
+} SilcCryptoThreadHash;
+
+/* Per-thread resources, freed by silc_crypto_uninit */
+typedef struct {
+  SilcStack stack;			/* Thread's stack */
+  SilcCryptoThreadHash hash[SILC_CRYPTO_THREAD_HASHES];
+} *SilcCryptoThreadContext;
+
+/* Per-thread context, see silc_crypto_thread_stack */
+typedef struct {
+  SilcCryptoThreadContext ctx;		/* Thread's resources */
+  SilcUInt32 generation;		/* Init generation of the resources */
+} SilcCryptoThreadStruct;
+
 #ifndef SILC_SYMBIAN
 SilcStack crypto_stack = NULL;		/* Crypto Toolkit's global stack */
+SilcUInt32 crypto_generation = 0;	/* Incremented on each init */
+SilcMutex crypto_thread_lock = NULL;	/* Lock for crypto_threads */
+SilcDList crypto_threads = NULL;	/* Resources of all threads */
 #endif /* SILC_SYMBIAN */
 
 /* Init crypto */
@@ -32,6 +56,11 @@ SilcBool silc_crypto_init(SilcStack stack)
 #ifndef SILC_SYMBIAN
   /* Stack allocation is allowed to fail */
   crypto_stack = silc_stack_alloc(0, stack);
+
+  /* The thread resources of earlier init are not used after this */
+  crypto_generation++;
+  if (silc_mutex_alloc(&crypto_thread_lock))
+    crypto_threads = silc_dlist_init();
 #endif /* SILC_SYMBIAN */
 
   /* Init crypto library */
@@ -73,6 +102,30 @@ void silc_crypto_uninit(void)
   /* Uninit accelerator library */
 #endif /* SILC_DIST_ACC */
 
+  silc_global_del_var("silc_crypto_thread", TRUE);
+
+#ifndef SILC_SYMBIAN
+  /* Free the resources of all threads.  The stacks are freed before their
+     parent and the hashes before the hash functions are unregistered. */
+  if (crypto_threads) {
+    SilcCryptoThreadContext ctx;
+    int i;
+
+    silc_dlist_start(crypto_threads);
+    while ((ctx = silc_dlist_get(crypto_threads))) {
+      for (i = 0; i < SILC_CRYPTO_THREAD_HASHES; i++)
+	silc_hash_free(ctx->hash[i].hash);
+      silc_stack_free(ctx->stack);
+      silc_free(ctx);
+    }
+    silc_dlist_uninit(crypto_threads);
+    crypto_threads = NULL;
+  }
+  if (crypto_thread_lock)
+    silc_mutex_free(crypto_thread_lock);
+  crypto_thread_lock = NULL;
+#endif /* SILC_SYMBIAN */
+
   /* Uninit crypto library */
   silc_pkcs_unregister_all();
   silc_mac_unregister_all();
@@ -81,6 +134,7 @@ void silc_crypto_uninit(void)
 
 #ifndef SILC_SYMBIAN
   silc_stack_free(crypto_stack);
+  crypto_stack = NULL;
 #endif /* SILC_SYMBIAN */
 }
 
@@ -94,3 +148,122 @@ SilcStack silc_crypto_stack(void)
   return NULL;
 #endif /* SILC_SYMBIAN */
 }
+
+/* Returns the calling thread's resources, allocating them on first call
+   since initialization */
+
+static SilcCryptoThreadContext silc_crypto_thread(void)
+{
+#ifndef SILC_SYMBIAN
+  SilcCryptoThreadStruct *thread;
+  SilcCryptoThreadContext ctx;
+
+  thread = silc_global_get_var("silc_crypto_thread", TRUE);
+  if (!thread) {
+    thread = silc_global_set_var("silc_crypto_thread", sizeof(*thread),
+				 NULL, TRUE);
+    if (!thread)
+      return NULL;
+    memset(thread, 0, sizeof(*thread));
+  }
+
+  /* Allocate new resources if the crypto library has been initialized
+     again.  The old ones were freed in silc_crypto_uninit. */
+  if (thread->generation != crypto_generation) {
+    thread->ctx = NULL;
+    if (!crypto_threads)
+      return NULL;
+
+    ctx = silc_calloc(1, sizeof(*ctx));
+    if (!ctx)
+      return NULL;
+    ctx->stack = silc_stack_alloc(2048, crypto_stack);
+
+    /* Register the resources so that silc_crypto_uninit frees them also
+       when this thread has exited */
+    silc_mutex_lock(crypto_thread_lock);
+    if (!silc_dlist_add(crypto_threads, ctx)) {
+      silc_mutex_unlock(crypto_thread_lock);
+      silc_stack_free(ctx->stack);
+      silc_free(ctx);
+      return NULL;
+    }
+    silc_mutex_unlock(crypto_thread_lock);
+
+    thread->ctx = ctx;
+    thread->generation = crypto_generation;
+  }
+
+  return thread->ctx;
+#else
+  return NULL;
+#endif /* SILC_SYMBIAN */
+}
+
+/* Return thread's stack */
+
+SilcStack silc_crypto_thread_stack(void)
+{
+  SilcCryptoThreadContext ctx = silc_crypto_thread();
+  return ctx ? ctx->stack : NULL;
+}
+
+/* Takes hash context from the calling thread's cache, or allocates new
+   one if there is no free context of the hash function `name' */
+
+SilcBool silc_crypto_thread_hash_get(const char *name, SilcHash *ret_hash)
+{
+  SilcCryptoThreadContext ctx = silc_crypto_thread();
+  SilcCryptoThreadHash *free_slot = NULL, *h;
+  int i;
+
+  if (ctx) {
+    for (i = 0; i < SILC_CRYPTO_THREAD_HASHES; i++) {
+      h = &ctx->hash[i];
+      if (!h->hash) {
+	if (!free_slot)
+	  free_slot = h;
+	continue;
+      }
+      if (!h->busy && !strcmp(silc_hash_get_name(h->hash), name)) {
+	h->busy = TRUE;
+	*ret_hash = h->hash;
+	return TRUE;
+      }
+    }
+  }
+
+  if (!silc_hash_alloc(name, ret_hash))
+    return FALSE;
+
+  /* Cache it if there is room */
+  if (free_slot) {
+    free_slot->hash = *ret_hash;
+    free_slot->busy = TRUE;
+  }
+
+  return TRUE;
+}
+
+/* Returns hash context taken with silc_crypto_thread_hash_get */
+
+void silc_crypto_thread_hash_put(SilcHash hash)
+{
+  SilcCryptoThreadContext ctx;
+  int i;
+
+  if (!hash)
+    return;
+
+  ctx = silc_crypto_thread();
+  if (ctx) {
+    for (i = 0; i < SILC_CRYPTO_THREAD_HASHES; i++) {
+      if (ctx->hash[i].hash == hash) {
+	ctx->hash[i].busy = FALSE;
+	return;
+      }
+    }
+  }
+
+  silc_hash_free(hash);
+}
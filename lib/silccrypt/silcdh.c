@@ -0,0 +1,479 @@
+/*
+
+  silcdh.c
+
+  Author: Pekka Riikonen <priikone@silcnet.org>
+
+  Copyright (C) 2001 - 2008 Pekka Riikonen
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; version 2 of the License.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+*/
+
+#include "silccrypto.h"
+#include "curve25519.h"
+
+/************************** Types and definitions ***************************/
+
+static SILC_DH_POW_MOD(silc_dh_modp_pow_mod);
+static SILC_DH_POW_MOD(silc_dh_x25519_pow_mod);
+
+/* Default software Diffie Hellman operations */
+const SilcDHObject silc_default_dh[] =
+{
+  { "modp", silc_dh_modp_pow_mod },
+  { "x25519", silc_dh_x25519_pow_mod },
+
+  { NULL, NULL }
+};
+
+/*************************** Software DH operations *************************/
+
+/* Computes base ^ exp mod mod synchronously */
+
+static SILC_DH_POW_MOD(silc_dh_modp_pow_mod)
+{
+  SilcMPInt r;
+  SilcBool ret;
+
+  silc_mp_init(&r);
+  ret = silc_mp_pow_mod_secret(&r, base, exp, mod);
+  callback(ret, ret ? &r : NULL, context);
+  silc_mp_set_ui(&r, 0);
+  silc_mp_uninit(&r);
+
+  return NULL;
+}
+
+/* Computes r = X25519(exp, base), or the public value if `base' is NULL.
+   The integers are the 32 byte encodings as big-endian integers.  Returns
+   FALSE if the result is zero, ie. the `base' was a point of small
+   order. */
+
+static SilcBool silc_dh_x25519(SilcMPInt *r, SilcMPInt *base, SilcMPInt *exp)
+{
+  unsigned char k[SILC_C25519_LEN], u[SILC_C25519_LEN];
+  unsigned char z[SILC_C25519_LEN], zero = 0;
+  int i;
+
+  silc_mp_mp2bin_noalloc(exp, k, sizeof(k));
+  if (base) {
+    silc_mp_mp2bin_noalloc(base, u, sizeof(u));
+    silc_c25519_x25519(z, k, u);
+  } else {
+    silc_c25519_x25519_base(z, k);
+  }
+
+  for (i = 0; i < sizeof(z); i++)
+    zero |= z[i];
+  silc_mp_bin2mp(z, sizeof(z), r);
+
+  memset(k, 0, sizeof(k));
+  memset(z, 0, sizeof(z));
+
+  return zero != 0;
+}
+
+/* Computes X25519 synchronously.  The `mod' is not used. */
+
+static SILC_DH_POW_MOD(silc_dh_x25519_pow_mod)
+{
+  SilcMPInt r;
+  SilcBool ret;
+
+  silc_mp_init(&r);
+  ret = silc_dh_x25519(&r, base, exp);
+  callback(ret, ret ? &r : NULL, context);
+  silc_mp_set_ui(&r, 0);
+  silc_mp_uninit(&r);
+
+  return NULL;
+}
+
+/******************************* Internal API *******************************/
+
+/* Allocates and initializes MP integer */
+
+static SilcMPInt *silc_dh_mp_alloc(void)
+{
+  SilcMPInt *mp;
+
+  mp = silc_calloc(1, sizeof(*mp));
+  if (!mp)
+    return NULL;
+
+  if (!silc_mp_init(mp)) {
+    silc_free(mp);
+    return NULL;
+  }
+
+  return mp;
+}
+
+/* Uninitializes and frees MP integer */
+
+static void silc_dh_mp_free(SilcMPInt *mp)
+{
+  if (!mp)
+    return;
+  silc_mp_uninit(mp);
+  silc_free(mp);
+}
+
+/* Public value completion */
+
+static void silc_dh_public_cb(SilcBool success, const SilcMPInt *value,
+			      void *context)
+{
+  SilcDH dh = context;
+
+  if (success) {
+    if (!dh->my_y)
+      dh->my_y = silc_dh_mp_alloc();
+    if (!dh->my_y || !silc_mp_set(dh->my_y, (SilcMPInt *)value))
+      success = FALSE;
+  }
+
+  dh->callback(success, success ? dh->my_y : NULL, dh->context);
+}
+
+/* Secret key completion */
+
+static void silc_dh_key_cb(SilcBool success, const SilcMPInt *value,
+			   void *context)
+{
+  SilcDH dh = context;
+
+  if (success) {
+    if (!dh->z)
+      dh->z = silc_dh_mp_alloc();
+    if (!dh->z || !silc_mp_set(dh->z, (SilcMPInt *)value))
+      success = FALSE;
+  }
+
+  dh->callback(success, success ? dh->z : NULL, dh->context);
+}
+
+/****************************** Public DH API *******************************/
+
+/* Allocate DH context */
+
+SilcDH silc_dh_alloc(SilcMPInt *g, SilcMPInt *p, SilcMPInt *lpf)
+{
+  SilcDH dh;
+
+  if (!g || !p)
+    return NULL;
+
+  SILC_LOG_DEBUG(("Allocating new DH context"));
+
+  dh = silc_calloc(1, sizeof(*dh));
+  if (!dh)
+    return NULL;
+
+  dh->ops = &silc_default_dh[0];
+  dh->g = g;
+  dh->p = p;
+  dh->lpf = lpf;
+
+  return dh;
+}
+
+/* Allocate X25519 DH context */
+
+SilcDH silc_dh_alloc_x25519(void)
+{
+  SilcDH dh;
+
+  SILC_LOG_DEBUG(("Allocating new X25519 DH context"));
+
+  dh = silc_calloc(1, sizeof(*dh));
+  if (!dh)
+    return NULL;
+
+  dh->ops = &silc_default_dh[1];
+  dh->x25519 = TRUE;
+
+  return dh;
+}
+
+/* Set fixed-base table of the generator */
+
+void silc_dh_set_fixed_base(SilcDH dh, SilcMPFixedBase fixed)
+{
+  dh->fixed = fixed;
+}
+
+/* Free DH context */
+
+void silc_dh_free(SilcDH dh)
+{
+  if (!dh)
+    return;
+
+  SILC_LOG_DEBUG(("Freeing DH context"));
+
+  /* Clear the private value and the shared secret */
+  if (dh->my_x)
+    silc_mp_set_ui(dh->my_x, 0);
+  if (dh->z)
+    silc_mp_set_ui(dh->z, 0);
+
+  silc_dh_mp_free(dh->my_x);
+  silc_dh_mp_free(dh->my_y);
+  silc_dh_mp_free(dh->your_y);
+  silc_dh_mp_free(dh->z);
+  silc_free(dh);
+}
+
+/* Generates random private value 0 < x < lpf, or 0 < x < p - 1 if lpf
+   was not given. */
+
+SilcBool silc_dh_generate_private(SilcDH dh, const SilcMPInt **x)
+{
+  SilcMPInt max;
+  unsigned char *buf;
+  SilcUInt32 bits, len;
+  SilcBool ret = FALSE;
+
+  SILC_LOG_DEBUG(("Generating private value"));
+
+  /* X25519 private value is any 32 byte string */
+  if (dh->x25519) {
+    unsigned char k[SILC_C25519_LEN];
+
+    if (!dh->my_x) {
+      dh->my_x = silc_dh_mp_alloc();
+      if (!dh->my_x)
+	return FALSE;
+    }
+    if (!silc_rng_global_get_rn_data(NULL, sizeof(k), k, sizeof(k)))
+      return FALSE;
+    silc_mp_bin2mp(k, sizeof(k), dh->my_x);
+    memset(k, 0, sizeof(k));
+
+    if (x)
+      *x = dh->my_x;
+    return TRUE;
+  }
+
+  silc_mp_init(&max);
+  if (dh->lpf)
+    silc_mp_set(&max, dh->lpf);
+  else
+    silc_mp_sub_ui(&max, dh->p, 1);
+
+  bits = silc_mp_sizeinbase(&max, 2);
+  len = (bits + 7) / 8;
+  buf = silc_malloc(len);
+  if (!buf)
+    goto out;
+
+  if (!dh->my_x) {
+    dh->my_x = silc_dh_mp_alloc();
+    if (!dh->my_x)
+      goto out;
+  }
+
+  /* Take random value of the bit length of the maximum, and try again
+     until it is in range. */
+  do {
+    if (!silc_rng_global_get_rn_data(NULL, len, buf, len))
+      goto out;
+    if (bits % 8)
+      buf[0] &= (1 << (bits % 8)) - 1;
+    silc_mp_bin2mp(buf, len, dh->my_x);
+  } while (silc_mp_cmp_ui(dh->my_x, 0) == 0 ||
+	   silc_mp_cmp(dh->my_x, &max) >= 0);
+
+  if (x)
+    *x = dh->my_x;
+  ret = TRUE;
+
+ out:
+  if (buf) {
+    memset(buf, 0, len);
+    silc_free(buf);
+  }
+  silc_mp_uninit(&max);
+  return ret;
+}
+
+/* Computes the public value y = g ^ x mod p */
+
+SilcBool silc_dh_compute_public(SilcDH dh, const SilcMPInt **y)
+{
+  SILC_LOG_DEBUG(("Computing public value"));
+
+  if (!dh->my_x)
+    return FALSE;
+
+  if (!dh->my_y) {
+    dh->my_y = silc_dh_mp_alloc();
+    if (!dh->my_y)
+      return FALSE;
+  }
+
+  if (dh->x25519) {
+    silc_dh_x25519(dh->my_y, NULL, dh->my_x);
+  } else if (dh->fixed) {
+    if (!silc_mp_pow_mod_fixed(dh->my_y, dh->my_x, dh->fixed))
+      return FALSE;
+  } else if (!silc_mp_pow_mod_secret(dh->my_y, dh->g, dh->my_x, dh->p)) {
+    return FALSE;
+  }
+
+  if (y)
+    *y = dh->my_y;
+
+  return TRUE;
+}
+
+/* Computes the public value asynchronously */
+
+SilcAsyncOperation silc_dh_compute_public_async(SilcDH dh,
+						SilcDHCb callback,
+						void *context)
+{
+  const SilcMPInt *y;
+  SilcBool ret;
+
+  SILC_LOG_DEBUG(("Computing public value"));
+
+  if (!dh->my_x) {
+    callback(FALSE, NULL, context);
+    return NULL;
+  }
+
+  /* The software operation completes synchronously anyway, so use the
+     fixed-base table when we have it, or the faster X25519 public value
+     computation. */
+  if ((dh->fixed && dh->ops == &silc_default_dh[0]) ||
+      (dh->x25519 && dh->ops == &silc_default_dh[1])) {
+    ret = silc_dh_compute_public(dh, &y);
+    callback(ret, ret ? y : NULL, context);
+    return NULL;
+  }
+
+  dh->callback = callback;
+  dh->context = context;
+
+  return dh->ops->pow_mod(dh->ops, dh->g, dh->my_x, dh->p,
+			  silc_dh_public_cb, dh);
+}
+
+/* Sets the remote end's public value */
+
+SilcBool silc_dh_set_remote_public(SilcDH dh, SilcMPInt *y)
+{
+  SilcMPInt tmp;
+  SilcBool ret;
+
+  if (dh->x25519) {
+    /* Value must be 32 bytes.  Points of small order are detected when
+       computing the key. */
+    ret = silc_mp_sizeinbase(y, 2) <= SILC_C25519_LEN * 8;
+  } else {
+    /* Value must be 1 < y' < p - 1 */
+    silc_mp_init(&tmp);
+    silc_mp_sub_ui(&tmp, dh->p, 1);
+    ret = (silc_mp_cmp_ui(y, 1) > 0 && silc_mp_cmp(y, &tmp) < 0);
+    silc_mp_uninit(&tmp);
+  }
+  if (!ret) {
+    SILC_LOG_DEBUG(("Invalid remote public value"));
+    return FALSE;
+  }
+
+  if (!dh->your_y) {
+    dh->your_y = silc_dh_mp_alloc();
+    if (!dh->your_y)
+      return FALSE;
+  }
+
+  return silc_mp_set(dh->your_y, y);
+}
+
+/* Computes the secret key z = y' ^ x mod p */
+
+SilcBool silc_dh_compute_key(SilcDH dh, const SilcMPInt **z)
+{
+  SILC_LOG_DEBUG(("Computing secret key"));
+
+  if (!dh->my_x || !dh->your_y)
+    return FALSE;
+
+  if (!dh->z) {
+    dh->z = silc_dh_mp_alloc();
+    if (!dh->z)
+      return FALSE;
+  }
+
+  if (dh->x25519) {
+    if (!silc_dh_x25519(dh->z, dh->your_y, dh->my_x)) {
+      SILC_LOG_DEBUG(("Invalid remote public value"));
+      return FALSE;
+    }
+  } else if (!silc_mp_pow_mod_secret(dh->z, dh->your_y, dh->my_x, dh->p)) {
+    return FALSE;
+  }
+
+  if (z)
+    *z = dh->z;
+
+  return TRUE;
+}
+
+/* Computes the secret key asynchronously */
+
+SilcAsyncOperation silc_dh_compute_key_async(SilcDH dh,
+					     SilcDHCb callback,
+					     void *context)
+{
+  SILC_LOG_DEBUG(("Computing secret key"));
+
+  if (!dh->my_x || !dh->your_y) {
+    callback(FALSE, NULL, context);
+    return NULL;
+  }
+
+  dh->callback = callback;
+  dh->context = context;
+
+  return dh->ops->pow_mod(dh->ops, dh->your_y, dh->my_x, dh->p,
+			  silc_dh_key_cb, dh);
+}
+
+/* Computes the secret key and returns it as binary data */
+
+SilcBool silc_dh_compute_key_data(SilcDH dh, unsigned char **z,
+				  SilcUInt32 *z_len)
+{
+  const SilcMPInt *key;
+
+  if (!silc_dh_compute_key(dh, &key))
+    return FALSE;
+
+  /* X25519 key is always 32 bytes */
+  if (dh->x25519) {
+    *z = silc_malloc(SILC_C25519_LEN);
+    if (!*z)
+      return FALSE;
+    silc_mp_mp2bin_noalloc((SilcMPInt *)key, *z, SILC_C25519_LEN);
+    *z_len = SILC_C25519_LEN;
+    return TRUE;
+  }
+
+  *z = silc_mp_mp2bin((SilcMPInt *)key, 0, z_len);
+  if (!*z)
+    return FALSE;
+
+  return TRUE;
+}
@@ -24,6 +24,13 @@
  * PKCS #3 compliant Diffie Hellman key agreement protocol implementation.
  * This is used as part of SKE (SILC Key Exchange) protocol.
  *
+ * The X25519 elliptic curve key agreement of RFC 7748 is also supported
+ * with the same interface, see silc_dh_alloc_x25519.
+ *
+ * The public value and the secret key can be computed synchronously or
+ * asynchronously.  The asynchronous computation may be offloaded to an
+ * accelerator by accelerating the SilcDH context with silc_acc_dh.
+ *
  ***/
 
 #ifndef SILCDH_H
@@ -45,18 +52,66 @@
  ***/
 typedef struct SilcDHStruct *SilcDH;
 
-/* XXX Move to source file */
-/* Diffie Hellman context. This includes the DH parameters including the
-   negotiated key material. */
-struct SilcDHStruct {
-  SilcMPInt *g;		     /* Global base (generator) */
-  SilcMPInt *p;		     /* Global prime (modulus, prime) */
-  SilcMPInt *lpf;	     /* Largest prime factor (prime) */
-  SilcMPInt *my_x;	     /* x, My private value (random) */
-  SilcMPInt *my_y;	     /* y, My public value (y = g ^ x mod p) */
-  SilcMPInt *your_y;	     /* y', Your public value (y' = g ^ x' mod p) */
-  SilcMPInt *z;		     /* The computed secret key (z = y' ^ x mod p) */
-};
+/****f* silccrypt/SilcDHCb
+ *
+ * SYNOPSIS
+ *
+ *    typedef void (*SilcDHCb)(SilcBool success, const SilcMPInt *value,
+ *                             void *context);
+ *
+ * DESCRIPTION
+ *
+ *    The Diffie Hellman completion callback given as argument to
+ *    silc_dh_compute_public_async and silc_dh_compute_key_async.  If
+ *    `success' is TRUE the `value' is the computed public value or the
+ *    computed secret key.  The `value' is also saved into the SilcDH
+ *    context and must not be freed by the caller.
+ *
+ ***/
+typedef void (*SilcDHCb)(SilcBool success, const SilcMPInt *value,
+			 void *context);
+
+/****s* silccrypt/SilcDHObject
+ *
+ * NAME
+ *
+ *    typedef struct SilcDHObjectStruct { ... } SilcDHObject;
+ *
+ * DESCRIPTION
+ *
+ *    The Diffie Hellman operations.  The `name' is the name of the
+ *    DH group type, "modp" for the modular exponentiation groups,
+ *    "x25519" for X25519, or "any".  The `pow_mod' computes `base' ^ `exp'
+ *    mod `mod', or with X25519 the X25519 function of `exp' and `base',
+ *    the `base' being NULL for the base point and `mod' always NULL, and
+ *    delivers the result to `callback'.  The result given to the
+ *    callback is valid only for the duration of the callback.  The
+ *    operation may complete asynchronously, in which case the `base',
+ *    `exp' and `mod' need not remain valid after `pow_mod' returns.  The
+ *    SILC_DH_POW_MOD macro can be used to declare the `pow_mod' operation.
+ *
+ *    The default software operations are used unless the SilcDH context
+ *    is accelerated with silc_acc_dh.
+ *
+ ***/
+typedef struct SilcDHObjectStruct {
+  const char *name;			    /* DH group type or "any" */
+  SilcAsyncOperation (*pow_mod)(const struct SilcDHObjectStruct *ops,
+				SilcMPInt *base, SilcMPInt *exp,
+				SilcMPInt *mod, SilcDHCb callback,
+				void *context);
+} SilcDHObject;
+
+#define SILC_DH_POW_MOD(name)						\
+  SilcAsyncOperation name(const struct SilcDHObjectStruct *ops,		\
+			  SilcMPInt *base, SilcMPInt *exp,		\
+			  SilcMPInt *mod, SilcDHCb callback,		\
+			  void *context)
+
+/* The default software Diffie Hellman operations */
+extern DLLAPI const SilcDHObject silc_default_dh[];
+
+#include "silcdh_i.h"
 
 /****f* silccrypt/silc_dh_alloc
  *
@@ -77,6 +132,59 @@ struct SilcDHStruct {
  ***/
 SilcDH silc_dh_alloc(SilcMPInt *g, SilcMPInt *p, SilcMPInt *lpf);
 
+/****f* silccrypt/silc_dh_alloc_x25519
+ *
+ * SYNOPSIS
+ *
+ *    SilcDH silc_dh_alloc_x25519(void);
+ *
+ * DESCRIPTION
+ *
+ *    Allocate SilcDH context for X25519 key agreement (RFC 7748).  The
+ *    context is used with the same functions as the modular exponentiation
+ *    DH.  The private value, the public values and the secret key are
+ *    32 byte strings, which are given and returned as SilcMPInt integers
+ *    in big-endian byte order.  The silc_mp_mp2bin_noalloc with 32 byte
+ *    buffer returns the string in the encoding of RFC 7748, and the
+ *    silc_mp_bin2mp returns the integer of the received public value.
+ *    The silc_dh_compute_key_data always returns 32 bytes.  Computing the
+ *    secret key fails if the remote public value is a point of small
+ *    order.  Returns NULL on error.
+ *
+ ***/
+SilcDH silc_dh_alloc_x25519(void);
+
+/****f* silccrypt/silc_dh_set_fixed_base
+ *
+ * SYNOPSIS
+ *
+ *    void silc_dh_set_fixed_base(SilcDH dh, SilcMPFixedBase fixed);
+ *
+ * DESCRIPTION
+ *
+ *    Sets the precomputed fixed-base table of the generator to the `dh'.
+ *    The public value is then computed with silc_mp_pow_mod_fixed, which
+ *    is several times faster than the generic exponentiation.  The table
+ *    must have been allocated with silc_mp_fixed_alloc for the same `g'
+ *    and `p' given to silc_dh_alloc.  The exponent bits should be the bit
+ *    length of the `lpf', or of `p' if the `lpf' was not given.  The
+ *    table is usually computed once per group and shared by all SilcDH
+ *    contexts of that group.  It must remain valid until the `dh' is
+ *    freed.  If the `dh' is accelerated the asynchronous computation is
+ *    done by the accelerator and the table is not used.
+ *
+ * EXAMPLE
+ *
+ *    // Once per group
+ *    fixed = silc_mp_fixed_alloc(&g, &p, silc_mp_sizeinbase(&lpf, 2), 0);
+ *
+ *    // For each key exchange
+ *    dh = silc_dh_alloc(&g, &p, &lpf);
+ *    silc_dh_set_fixed_base(dh, fixed);
+ *
+ ***/
+void silc_dh_set_fixed_base(SilcDH dh, SilcMPFixedBase fixed);
+
 /****f* silccrypt/silc_dh_free
  *
  * SYNOPSIS
@@ -103,6 +211,7 @@ void silc_dh_free(SilcDH dh);
  *    length of lpf. Returns FALSE if the random number could not be generated.
  *    Returns the generated value into `x' pointer sent as argument, unless
  *    the `x' is NULL. The returned `x' must not be freed by the caller.
+ *    With X25519 the private value is random 32 byte string.
  *
  ***/
 SilcBool silc_dh_generate_private(SilcDH dh, const SilcMPInt **x);
@@ -123,17 +232,42 @@ SilcBool silc_dh_generate_private(SilcDH dh, const SilcMPInt **x);
  ***/
 SilcBool silc_dh_compute_public(SilcDH dh, const SilcMPInt **y);
 
+/****f* silccrypt/silc_dh_compute_public_async
+ *
+ * SYNOPSIS
+ *
+ *    SilcAsyncOperation
+ *    silc_dh_compute_public_async(SilcDH dh, SilcDHCb callback,
+ *                                 void *context);
+ *
+ * DESCRIPTION
+ *
+ *    Asynchronous version of silc_dh_compute_public.  Computes the public
+ *    key y = g ^ x mod p and delivers it to `callback'.  If the `dh' is
+ *    not accelerated the `callback' is called before this function
+ *    returns.  Returns NULL if the operation was completed synchronously,
+ *    or the asynchronous operation context that can be used to abort the
+ *    operation.  The `dh' must not be freed or used in other DH
+ *    operations until the `callback' has been called or the operation
+ *    has been aborted.
+ *
+ ***/
+SilcAsyncOperation silc_dh_compute_public_async(SilcDH dh,
+						SilcDHCb callback,
+						void *context);
+
 /****f* silccrypt/silc_dh_remote_public
  *
  * SYNOPSIS
  *
- *    SilcBool silc_dh_compute_public(SilcDH dh, SilcMPInt *y);
+ *    SilcBool silc_dh_set_remote_public(SilcDH dh, SilcMPInt *y);
  *
  * DESCRIPTION
  *
  *    Sets the remote end's public value y' into the SilcDH context.
- *    This must be done before computing the secret key. Returns FALSE
- *    on error.
+ *    This must be done before computing the secret key.  The value is
+ *    copied.  Returns FALSE on error or if the value is not in range
+ *    1 < y' < p - 1.  With X25519 the value must be at most 32 bytes.
  *
  ***/
 SilcBool silc_dh_set_remote_public(SilcDH dh, SilcMPInt *y);
@@ -154,6 +288,30 @@ SilcBool silc_dh_set_remote_public(SilcDH dh, SilcMPInt *y);
  ***/
 SilcBool silc_dh_compute_key(SilcDH dh, const SilcMPInt **z);
 
+/****f* silccrypt/silc_dh_compute_key_async
+ *
+ * SYNOPSIS
+ *
+ *    SilcAsyncOperation
+ *    silc_dh_compute_key_async(SilcDH dh, SilcDHCb callback,
+ *                              void *context);
+ *
+ * DESCRIPTION
+ *
+ *    Asynchronous version of silc_dh_compute_key.  Computes the secret
+ *    key z = y' ^ x mod p and delivers it to `callback'.  If the `dh' is
+ *    not accelerated the `callback' is called before this function
+ *    returns.  Returns NULL if the operation was completed synchronously,
+ *    or the asynchronous operation context that can be used to abort the
+ *    operation.  The `dh' must not be freed or used in other DH
+ *    operations until the `callback' has been called or the operation
+ *    has been aborted.
+ *
+ ***/
+SilcAsyncOperation silc_dh_compute_key_async(SilcDH dh,
+					     SilcDHCb callback,
+					     void *context);
+
 /****f* silccrypt/silc_dh_compute_key_data
  *
  * SYNOPSIS
@@ -170,4 +328,4 @@ SilcBool silc_dh_compute_key(SilcDH dh, const SilcMPInt **z);
 SilcBool silc_dh_compute_key_data(SilcDH dh, unsigned char **z,
 			      SilcUInt32 *z_len);
 
-#endif
+#endif /* SILCDH_H */
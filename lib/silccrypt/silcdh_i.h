@@ -0,0 +1,45 @@
+/*
+
+  silcdh_i.h
+
+  Author: Pekka Riikonen <priikone@silcnet.org>
+
+  Copyright (C) 2008 Pekka Riikonen
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; version 2 of the License.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+*/
+
+#ifndef SILCDH_I_H
+#define SILCDH_I_H
+
+#ifndef SILCDH_H
+#error "Do not include this header directly"
+#endif
+
+/* Diffie Hellman context. This includes the DH parameters including the
+   negotiated key material.  This is not visible to application programmer.
+   It is accessible from the DH operation implementations. */
+struct SilcDHStruct {
+  const SilcDHObject *ops;   /* DH operations */
+  SilcMPInt *g;		     /* Global base (generator) */
+  SilcMPInt *p;		     /* Global prime (modulus, prime) */
+  SilcMPInt *lpf;	     /* Largest prime factor (prime) */
+  SilcMPFixedBase fixed;     /* Fixed-base table of g, optional */
+  SilcMPInt *my_x;	     /* x, My private value (random) */
+  SilcMPInt *my_y;	     /* y, My public value (y = g ^ x mod p) */
+  SilcMPInt *your_y;	     /* y', Your public value (y' = g ^ x' mod p) */
+  SilcMPInt *z;		     /* The computed secret key (z = y' ^ x mod p) */
+  SilcDHCb callback;	     /* Pending asynchronous operation callback */
+  void *context;	     /* Pending asynchronous operation context */
+  unsigned int x25519 : 1;   /* X25519 key agreement */
+};
+
+#endif /* SILCDH_I_H */
@@ -24,12 +24,6 @@
 #include "sha256.h"
 #include "sha512.h"
 
-/* The main SILC hash structure. */
-struct SilcHashStruct {
-  SilcHashObject *hash;
-  void *context;
-};
-
 #ifndef SILC_SYMBIAN
 /* List of dynamically registered hash functions. */
 SilcDList silc_hash_list = NULL;
@@ -0,0 +1,34 @@
+/*
+
+  silchash_i.h
+
+  Author: Pekka Riikonen <priikone@silcnet.org>
+
+  Copyright (C) 2008 Pekka Riikonen
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; version 2 of the License.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+*/
+
+#ifndef SILCHASH_I_H
+#define SILCHASH_I_H
+
+#ifndef SILCHASH_H
+#error "Do not include this header directly"
+#endif
+
+/* The SilcHash context.  This is not visible to application programmer.
+   It is accessible from the algorithm implementations and accelerators. */
+struct SilcHashStruct {
+  SilcHashObject *hash;				/* Hash operations */
+  void *context;				/* Algorithm context */
+};
+
+#endif /* SILCHASH_I_H */
@@ -19,17 +19,6 @@
 
 #include "silccrypto.h"
 
-/* MAC context */
-struct SilcMacStruct {
-  SilcMacObject *mac;
-  SilcHash hash;
-  unsigned char inner_pad[64];
-  unsigned char outer_pad[64];
-  unsigned char *key;
-  unsigned int key_len        : 31;
-  unsigned int allocated_hash : 1;   /* TRUE if the hash was allocated */
-};
-
 #ifndef SILC_SYMBIAN
 /* List of dynamically registered MACs. */
 SilcDList silc_mac_list = NULL;
@@ -129,6 +129,8 @@ typedef struct {
    to unregister all MACs at once. */
 #define SILC_ALL_MACS ((SilcMacObject *)1)
 
+#include "silcmac_i.h"
+
 /* Default MACs for silc_mac_register_default(). */
 extern DLLAPI const SilcMacObject silc_default_macs[];
 
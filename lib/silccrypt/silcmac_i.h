@@ -0,0 +1,39 @@
+/*
+
+  silcmac_i.h
+
+  Author: Pekka Riikonen <priikone@silcnet.org>
+
+  Copyright (C) 2008 Pekka Riikonen
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; version 2 of the License.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+*/
+
+#ifndef SILCMAC_I_H
+#define SILCMAC_I_H
+
+#ifndef SILCMAC_H
+#error "Do not include this header directly"
+#endif
+
+/* The SilcMac context.  This is not visible to application programmer.
+   It is accessible from the accelerators. */
+struct SilcMacStruct {
+  SilcMacObject *mac;				/* MAC operations */
+  SilcHash hash;				/* Hash function */
+  unsigned char inner_pad[64];
+  unsigned char outer_pad[64];
+  unsigned char *key;
+  unsigned int key_len        : 31;
+  unsigned int allocated_hash : 1;   /* TRUE if the hash was allocated */
+};
+
+#endif /* SILCMAC_I_H */
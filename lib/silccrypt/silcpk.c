@@ -19,6 +19,7 @@
 
 #include "silccrypto.h"
 #include "silcpk_i.h"
+#include "silcpkcs1_i.h"
 
 /****************************** Key generation *******************************/
 
@@ -62,8 +63,11 @@ SilcBool silc_pkcs_silc_generate_key(const char *algorithm,
     version = 1;
 
   /* Allocate algorithm */
-  alg = silc_pkcs_find_algorithm(algorithm, (version == 1 ? "pkcs1-no-oid" :
-					     "pkcs1"));
+  if (!strcmp(algorithm, "ecdsa") || !strcmp(algorithm, "ed25519"))
+    alg = silc_pkcs_find_algorithm(algorithm, algorithm);
+  else
+    alg = silc_pkcs_find_algorithm(algorithm, (version == 1 ?
+					       "pkcs1-no-oid" : "pkcs1"));
   if (!alg) {
     silc_free(pubkey);
     return FALSE;
@@ -111,6 +115,8 @@ SilcBool silc_pkcs_silc_generate_key(const char *algorithm,
     return FALSE;
   }
 
+  silc_pkcs_public_key_compute_digest(*ret_public_key);
+
   return TRUE;
 }
 
@@ -283,6 +289,89 @@ char *silc_pkcs_silc_encode_identifier(SilcStack stack,
   return identifier;
 }
 
+/* Finds the field `tag', eg. "V=", from the encoded identifier `ident'
+   that is not NULL terminated.  Returns pointer to the value and its
+   length to `ret_len', or NULL if the field is not present. */
+
+static const unsigned char *
+silc_pkcs_silc_ident_find(const unsigned char *ident, SilcUInt32 ident_len,
+			  const char *tag, SilcUInt32 *ret_len)
+{
+  SilcUInt32 i, len, tag_len = strlen(tag);
+
+  for (i = 0; i + tag_len <= ident_len; i++) {
+    if (i && ident[i - 1] != ',' && ident[i - 1] != ' ')
+      continue;
+    if (memcmp(ident + i, tag, tag_len))
+      continue;
+
+    i += tag_len;
+    for (len = 0; i + len < ident_len && ident[i + len] != ','; len++);
+    *ret_len = len;
+    return ident + i;
+  }
+
+  return NULL;
+}
+
+/* Returns the version of the encoded identifier `ident' */
+
+static int silc_pkcs_silc_ident_version(const unsigned char *ident,
+					SilcUInt32 ident_len)
+{
+  const unsigned char *v;
+  SilcUInt32 v_len;
+
+  /* If version identifier is not present it is version 1. */
+  v = silc_pkcs_silc_ident_find(ident, ident_len, "V=", &v_len);
+  if (!v || !v_len || !isdigit(v[0]))
+    return 1;
+
+  return v[0] - '0';
+}
+
+/* Frees the identifier fields */
+
+static void silc_pkcs_silc_ident_free(SilcPublicKeyIdentifier ident)
+{
+  silc_free(ident->username);
+  silc_free(ident->host);
+  silc_free(ident->realname);
+  silc_free(ident->email);
+  silc_free(ident->org);
+  silc_free(ident->country);
+  silc_free(ident->version);
+  memset(ident, 0, sizeof(*ident));
+}
+
+/* Returns the `identifier' of the public key if it is not borrowed.
+   Otherwise decodes the borrowed identifier into `tmp' and returns it.
+   The caller must free the `tmp' with silc_pkcs_silc_ident_free. */
+
+static SilcPublicKeyIdentifier
+silc_pkcs_silc_get_ident(SilcSILCPublicKey silc_pubkey,
+			 SilcPublicKeyIdentifier tmp)
+{
+  char *ident;
+  SilcBool ret;
+
+  memset(tmp, 0, sizeof(*tmp));
+  if (!silc_pubkey->ident)
+    return &silc_pubkey->identifier;
+
+  ident = silc_memdup(silc_pubkey->ident, silc_pubkey->ident_len);
+  if (!ident)
+    return NULL;
+  ret = silc_pkcs_silc_decode_identifier(ident, tmp);
+  silc_free(ident);
+  if (!ret) {
+    silc_pkcs_silc_ident_free(tmp);
+    return NULL;
+  }
+
+  return tmp;
+}
+
 /* Return SILC public key version */
 
 int silc_pkcs_silc_public_key_version(SilcPublicKey public_key)
@@ -294,6 +383,10 @@ int silc_pkcs_silc_public_key_version(SilcPublicKey public_key)
 
   silc_pubkey = public_key->public_key;
 
+  if (silc_pubkey->ident)
+    return silc_pkcs_silc_ident_version(silc_pubkey->ident,
+					silc_pubkey->ident_len);
+
   /* If version identifire is not present it is version 1. */
   if (!silc_pubkey->identifier.version)
     return 1;
@@ -359,17 +452,23 @@ SILC_PKCS_IMPORT_PUBLIC_KEY_FILE(silc_pkcs_silc_import_public_key_file)
   return ret ? TRUE : FALSE;
 }
 
-/* Imports SILC protocol style public key */
+/* Imports SILC protocol style public key.  If `borrow' is TRUE the
+   identifier is not decoded and the key refers to the `key' buffer. */
 
-SILC_PKCS_IMPORT_PUBLIC_KEY(silc_pkcs_silc_import_public_key)
+static int silc_pkcs_silc_import(const SilcPKCSAlgorithm *alg,
+				 unsigned char *key, SilcUInt32 key_len,
+				 SilcBool borrow, void **ret_public_key,
+				 const SilcPKCSAlgorithm **ret_alg)
 {
   SilcBufferStruct buf, alg_key;
   SilcSILCPublicKey silc_pubkey = NULL;
   SilcAsn1 asn1 = NULL;
-  SilcUInt32 totlen, keydata_len;
+  SilcUInt32 totlen, keydata_len, e_len, n_len, len;
   SilcUInt16 pkcs_len, identifier_len;
   unsigned char *pkcs_name = NULL, *ident = NULL, *key_data = NULL;
-  int ret;
+  char *ident_copy = NULL;
+  const char *name;
+  int ret, version;
 
   SILC_LOG_DEBUG(("Parsing SILC public key"));
 
@@ -397,8 +496,8 @@ SILC_PKCS_IMPORT_PUBLIC_KEY(silc_pkcs_silc_import_public_key)
   ret =
     silc_buffer_unformat(&buf,
 			 SILC_STR_ADVANCE,
-			 SILC_STR_UI16_NSTRING_ALLOC(&pkcs_name, &pkcs_len),
-			 SILC_STR_UI16_NSTRING_ALLOC(&ident, &identifier_len),
+			 SILC_STR_UI16_NSTRING(&pkcs_name, &pkcs_len),
+			 SILC_STR_UI16_NSTRING(&ident, &identifier_len),
 			 SILC_STR_END);
   if (ret == -1)
     goto err;
@@ -420,32 +519,47 @@ SILC_PKCS_IMPORT_PUBLIC_KEY(silc_pkcs_silc_import_public_key)
   if (!silc_pubkey)
     goto err;
 
-  /* Decode SILC identifier */
-  if (!silc_pkcs_silc_decode_identifier(ident, &silc_pubkey->identifier))
-    goto err;
-
-  asn1 = silc_asn1_alloc(NULL);
-  if (!asn1)
-    goto err;
+  if (borrow) {
+    /* Protocol says that at least UN and HN must be provided as
+       identifier */
+    if (!silc_pkcs_silc_ident_find(ident, identifier_len, "UN=", &len) ||
+	!silc_pkcs_silc_ident_find(ident, identifier_len, "HN=", &len)) {
+      SILC_LOG_DEBUG(("The public does not have the required UN= and HN= "
+		      "identifiers"));
+      goto err;
+    }
+    silc_pubkey->ident = ident;
+    silc_pubkey->ident_len = identifier_len;
+    version = silc_pkcs_silc_ident_version(ident, identifier_len);
+  } else {
+    /* Decode SILC identifier.  The `ident' points to the `key', so it is
+       decoded from a copy. */
+    ident_copy = silc_memdup(ident, identifier_len);
+    if (!ident_copy)
+      goto err;
+    if (!silc_pkcs_silc_decode_identifier(ident_copy,
+					  &silc_pubkey->identifier))
+      goto err;
+    silc_free(ident_copy);
+    ident_copy = NULL;
+    version = (!silc_pubkey->identifier.version ? 1 :
+	       atoi(silc_pubkey->identifier.version));
+  }
 
-  SILC_LOG_DEBUG(("Public key version %s",
-		  (!silc_pubkey->identifier.version ? "1" :
-		   silc_pubkey->identifier.version)));
+  SILC_LOG_DEBUG(("Public key version %d", version));
 
-  if (!strcmp(pkcs_name, "rsa")) {
+  if (pkcs_len == 3 && !memcmp(pkcs_name, "rsa", 3)) {
     /* Parse the SILC RSA public key */
-    SilcUInt32 e_len, n_len;
     SilcMPInt n, e;
 
     /* Get PKCS object.  Different PKCS #1 scheme is used with different
        versions. */
-    if (!silc_pubkey->identifier.version ||
-	atoi(silc_pubkey->identifier.version) <= 1) {
+    if (version <= 1) {
       /* Version 1 */
-      alg = silc_pkcs_find_algorithm(pkcs_name, "pkcs1-no-oid");
+      alg = silc_pkcs_find_algorithm("rsa", "pkcs1-no-oid");
     } else {
       /* Version 2 and newer */
-      alg = silc_pkcs_find_algorithm(pkcs_name, "pkcs1");
+      alg = silc_pkcs_find_algorithm("rsa", "pkcs1");
     }
     if (!alg) {
       SILC_LOG_DEBUG(("Unsupported PKCS algorithm: rsa"));
@@ -458,17 +572,29 @@ SILC_PKCS_IMPORT_PUBLIC_KEY(silc_pkcs_silc_import_public_key)
     SILC_GET32_MSB(e_len, key_data);
     if (!e_len || e_len + 4 > keydata_len)
       goto err;
-    silc_mp_init(&e);
-    silc_mp_bin2mp(key_data + 4, e_len, &e);
-    if (keydata_len < 4 + e_len + 4) {
-      silc_mp_uninit(&e);
+    if (keydata_len < 4 + e_len + 4)
       goto err;
-    }
     SILC_GET32_MSB(n_len, key_data + 4 + e_len);
-    if (!n_len || e_len + 4 + n_len + 4 > keydata_len) {
-      silc_mp_uninit(&e);
+    if (!n_len || e_len + 4 + n_len + 4 > keydata_len)
       goto err;
+
+    /* With our own PKCS #1 the key is allocated directly without
+       encoding it first to PKCS #1 format. */
+    if (alg->import_public_key == silc_pkcs1_import_public_key) {
+      silc_pubkey->public_key =
+	silc_pkcs1_public_key_alloc(key_data + 4, e_len,
+				    key_data + 4 + e_len + 4, n_len);
+      if (!silc_pubkey->public_key)
+	goto err;
+      goto out;
     }
+
+    asn1 = silc_asn1_alloc(NULL);
+    if (!asn1)
+      goto err;
+
+    silc_mp_init(&e);
+    silc_mp_bin2mp(key_data + 4, e_len, &e);
     silc_mp_init(&n);
     silc_mp_bin2mp(key_data + 4 + e_len + 4, n_len, &n);
 
@@ -487,10 +613,24 @@ SILC_PKCS_IMPORT_PUBLIC_KEY(silc_pkcs_silc_import_public_key)
     silc_mp_uninit(&e);
     silc_mp_uninit(&n);
 
-  } else if (!strcmp(pkcs_name, "dsa")) {
+  } else if (pkcs_len == 3 && !memcmp(pkcs_name, "dsa", 3)) {
     SILC_NOT_IMPLEMENTED("DSA SILC Public Key");
     goto err;
 
+  } else if ((pkcs_len == 5 && !memcmp(pkcs_name, "ecdsa", 5)) ||
+	     (pkcs_len == 7 && !memcmp(pkcs_name, "ed25519", 7))) {
+    /* The SILC ECDSA and Ed25519 public key is the algorithm public key
+       as is */
+    name = pkcs_len == 5 ? "ecdsa" : "ed25519";
+    alg = silc_pkcs_find_algorithm(name, name);
+    if (!alg) {
+      SILC_LOG_DEBUG(("Unsupported PKCS algorithm: %s", name));
+      goto err;
+    }
+    silc_pubkey->pkcs = alg;
+
+    silc_buffer_set(&alg_key, key_data, keydata_len);
+
   } else {
     SILC_LOG_DEBUG(("Unsupported PKCS algorithm"));
     goto err;
@@ -501,9 +641,9 @@ SILC_PKCS_IMPORT_PUBLIC_KEY(silc_pkcs_silc_import_public_key)
 			      &silc_pubkey->public_key))
     goto err;
 
-  silc_free(pkcs_name);
-  silc_free(ident);
-  silc_asn1_free(asn1);
+ out:
+  if (asn1)
+    silc_asn1_free(asn1);
 
   *ret_public_key = silc_pubkey;
   *ret_alg = alg;
@@ -511,14 +651,31 @@ SILC_PKCS_IMPORT_PUBLIC_KEY(silc_pkcs_silc_import_public_key)
   return key_len;
 
  err:
-  silc_free(pkcs_name);
-  silc_free(ident);
+  silc_free(ident_copy);
+  if (silc_pubkey)
+    silc_pkcs_silc_ident_free(&silc_pubkey->identifier);
   silc_free(silc_pubkey);
   if (asn1)
     silc_asn1_free(asn1);
   return 0;
 }
 
+/* Imports SILC protocol style public key */
+
+SILC_PKCS_IMPORT_PUBLIC_KEY(silc_pkcs_silc_import_public_key)
+{
+  return silc_pkcs_silc_import(alg, key, key_len, FALSE, ret_public_key,
+			       ret_alg);
+}
+
+/* Imports SILC protocol style public key that borrows the `key' */
+
+SILC_PKCS_IMPORT_PUBLIC_KEY(silc_pkcs_silc_import_public_key_view)
+{
+  return silc_pkcs_silc_import(alg, key, key_len, TRUE, ret_public_key,
+			       ret_alg);
+}
+
 /* Exports public key as SILC protocol style public key file */
 
 SILC_PKCS_EXPORT_PUBLIC_KEY_FILE(silc_pkcs_silc_export_public_key_file)
@@ -584,8 +741,9 @@ SILC_PKCS_EXPORT_PUBLIC_KEY(silc_pkcs_silc_export_public_key)
   SilcBuffer buf = NULL;
   SilcAsn1 asn1 = NULL;
   unsigned char *pk = NULL, *key = NULL, *ret;
-  SilcUInt32 pk_len, key_len, totlen;
-  char *identifier;
+  const unsigned char *ident;
+  SilcUInt32 pk_len, key_len, totlen, ident_len;
+  char *identifier = NULL;
 
   SILC_LOG_DEBUG(("Encoding SILC public key"));
 
@@ -598,19 +756,26 @@ SILC_PKCS_EXPORT_PUBLIC_KEY(silc_pkcs_silc_export_public_key)
   }
   silc_buffer_set(&alg_key, pk, pk_len);
 
-  /* Encode identifier */
-  identifier =
-    silc_pkcs_silc_encode_identifier(stack,
-				     silc_pubkey->identifier.username,
-				     silc_pubkey->identifier.host,
-				     silc_pubkey->identifier.realname,
-				     silc_pubkey->identifier.email,
-				     silc_pubkey->identifier.org,
-				     silc_pubkey->identifier.country,
-				     silc_pubkey->identifier.version);
-  if (!identifier) {
-    SILC_LOG_ERROR(("Error encoding SILC public key identifier"));
-    goto err;
+  /* Encode identifier, borrowed identifier is used as is */
+  if (silc_pubkey->ident) {
+    ident = silc_pubkey->ident;
+    ident_len = silc_pubkey->ident_len;
+  } else {
+    identifier =
+      silc_pkcs_silc_encode_identifier(stack,
+				       silc_pubkey->identifier.username,
+				       silc_pubkey->identifier.host,
+				       silc_pubkey->identifier.realname,
+				       silc_pubkey->identifier.email,
+				       silc_pubkey->identifier.org,
+				       silc_pubkey->identifier.country,
+				       silc_pubkey->identifier.version);
+    if (!identifier) {
+      SILC_LOG_ERROR(("Error encoding SILC public key identifier"));
+      goto err;
+    }
+    ident = (const unsigned char *)identifier;
+    ident_len = strlen(identifier);
   }
 
   asn1 = silc_asn1_alloc(stack);
@@ -659,13 +824,22 @@ SILC_PKCS_EXPORT_PUBLIC_KEY(silc_pkcs_silc_export_public_key)
     SILC_NOT_IMPLEMENTED("SILC DSA Public Key");
     goto err;
 
+  } else if (!strcmp(alg->name, "ecdsa") || !strcmp(alg->name, "ed25519")) {
+    /* The SILC ECDSA and Ed25519 public key is the algorithm public key
+       as is */
+    key_len = pk_len;
+    key = silc_smalloc(stack, key_len);
+    if (!key)
+      goto err;
+    memcpy(key, pk, key_len);
+
   } else {
     SILC_LOG_ERROR(("Unsupported PKCS algorithm: %s", alg->name));
     goto err;
   }
 
   /* Encode SILC Public Key */
-  totlen = 2 + strlen(alg->name) + 2 + strlen(identifier) + key_len;
+  totlen = 2 + strlen(alg->name) + 2 + ident_len + key_len;
   buf = silc_buffer_salloc_size(stack, totlen + 4);
   if (!buf)
     goto err;
@@ -673,8 +847,8 @@ SILC_PKCS_EXPORT_PUBLIC_KEY(silc_pkcs_silc_export_public_key)
 			  SILC_STR_UI_INT(totlen),
 			  SILC_STR_UI_SHORT(strlen(alg->name)),
 			  SILC_STR_UI32_STRING(alg->name),
-			  SILC_STR_UI_SHORT(strlen(identifier)),
-			  SILC_STR_UI32_STRING(identifier),
+			  SILC_STR_UI_SHORT(ident_len),
+			  SILC_STR_UI_XNSTRING(ident, ident_len),
 			  SILC_STR_UI_XNSTRING(key, key_len),
 			  SILC_STR_END) < 0)
     goto err;
@@ -712,21 +886,35 @@ SILC_PKCS_PUBLIC_KEY_BITLEN(silc_pkcs_silc_public_key_bitlen)
 SILC_PKCS_PUBLIC_KEY_COPY(silc_pkcs_silc_public_key_copy)
 {
   SilcSILCPublicKey silc_pubkey = public_key, new_pubkey;
-  SilcPublicKeyIdentifier ident = &silc_pubkey->identifier;
+  SilcPublicKeyIdentifierStruct tmp;
+  SilcPublicKeyIdentifier ident;
 
   new_pubkey = silc_calloc(1, sizeof(*new_pubkey));
   if (!new_pubkey)
     return NULL;
   new_pubkey->pkcs = silc_pubkey->pkcs;
 
+  /* Borrowed identifier is decoded directly to the copy */
+  ident = silc_pkcs_silc_get_ident(silc_pubkey, &tmp);
+  if (!ident) {
+    silc_free(new_pubkey);
+    return NULL;
+  }
+
   new_pubkey->public_key =
     silc_pubkey->pkcs->public_key_copy(silc_pubkey->pkcs,
 				       silc_pubkey->public_key);
   if (!new_pubkey->public_key) {
+    silc_pkcs_silc_ident_free(&tmp);
     silc_free(new_pubkey);
     return NULL;
   }
 
+  if (ident == &tmp) {
+    new_pubkey->identifier = tmp;
+    return new_pubkey;
+  }
+
   if (ident->username)
     new_pubkey->identifier.username =
       silc_memdup(ident->username, strlen(ident->username));
@@ -752,55 +940,82 @@ SILC_PKCS_PUBLIC_KEY_COPY(silc_pkcs_silc_public_key_copy)
   return new_pubkey;
 }
 
-/* Compares public keys */
+/* Compares public key identifiers */
 
-SILC_PKCS_PUBLIC_KEY_COMPARE(silc_pkcs_silc_public_key_compare)
+static SilcBool silc_pkcs_silc_ident_compare(SilcPublicKeyIdentifier i1,
+					     SilcPublicKeyIdentifier i2)
 {
-  SilcSILCPublicKey k1 = key1, k2 = key2;
+  if ((i1->username && !i2->username) ||
+      (!i1->username && i2->username) ||
+      (i1->username && i2->username &&
+       strcmp(i1->username, i2->username)))
+    return FALSE;
 
-  if (strcmp(k1->pkcs->name, k2->pkcs->name))
+  if ((i1->host && !i2->host) ||
+      (!i1->host && i2->host) ||
+      (i1->host && i2->host &&
+       strcmp(i1->host, i2->host)))
     return FALSE;
 
-  if ((k1->identifier.username && !k2->identifier.username) ||
-      (!k1->identifier.username && k2->identifier.username) ||
-      (k1->identifier.username && k2->identifier.username &&
-       strcmp(k1->identifier.username, k2->identifier.username)))
+  if ((i1->realname && !i2->realname) ||
+      (!i1->realname && i2->realname) ||
+      (i1->realname && i2->realname &&
+       strcmp(i1->realname, i2->realname)))
     return FALSE;
 
-  if ((k1->identifier.host && !k2->identifier.host) ||
-      (!k1->identifier.host && k2->identifier.host) ||
-      (k1->identifier.host && k2->identifier.host &&
-       strcmp(k1->identifier.host, k2->identifier.host)))
+  if ((i1->email && !i2->email) ||
+      (!i1->email && i2->email) ||
+      (i1->email && i2->email &&
+       strcmp(i1->email, i2->email)))
     return FALSE;
 
-  if ((k1->identifier.realname && !k2->identifier.realname) ||
-      (!k1->identifier.realname && k2->identifier.realname) ||
-      (k1->identifier.realname && k2->identifier.realname &&
-       strcmp(k1->identifier.realname, k2->identifier.realname)))
+  if ((i1->org && !i2->org) ||
+      (!i1->org && i2->org) ||
+      (i1->org && i2->org &&
+       strcmp(i1->org, i2->org)))
     return FALSE;
 
-  if ((k1->identifier.email && !k2->identifier.email) ||
-      (!k1->identifier.email && k2->identifier.email) ||
-      (k1->identifier.email && k2->identifier.email &&
-       strcmp(k1->identifier.email, k2->identifier.email)))
+  if ((i1->country && !i2->country) ||
+      (!i1->country && i2->country) ||
+      (i1->country && i2->country &&
+       strcmp(i1->country, i2->country)))
     return FALSE;
 
-  if ((k1->identifier.org && !k2->identifier.org) ||
-      (!k1->identifier.org && k2->identifier.org) ||
-      (k1->identifier.org && k2->identifier.org &&
-       strcmp(k1->identifier.org, k2->identifier.org)))
+  if ((i1->version && !i2->version) ||
+      (!i1->version && i2->version) ||
+      (i1->version && i2->version &&
+       strcmp(i1->version, i2->version)))
     return FALSE;
 
-  if ((k1->identifier.country && !k2->identifier.country) ||
-      (!k1->identifier.country && k2->identifier.country) ||
-      (k1->identifier.country && k2->identifier.country &&
-       strcmp(k1->identifier.country, k2->identifier.country)))
+  return TRUE;
+}
+
+/* Compares public keys */
+
+SILC_PKCS_PUBLIC_KEY_COMPARE(silc_pkcs_silc_public_key_compare)
+{
+  SilcSILCPublicKey k1 = key1, k2 = key2;
+  SilcPublicKeyIdentifierStruct tmp1, tmp2;
+  SilcPublicKeyIdentifier i1, i2;
+  SilcBool ret;
+
+  if (strcmp(k1->pkcs->name, k2->pkcs->name))
     return FALSE;
 
-  if ((k1->identifier.version && !k2->identifier.version) ||
-      (!k1->identifier.version && k2->identifier.version) ||
-      (k1->identifier.version && k2->identifier.version &&
-       strcmp(k1->identifier.version, k2->identifier.version)))
+  /* Identical borrowed identifiers need not be decoded */
+  if (k1->ident && k2->ident) {
+    if (k1->ident_len == k2->ident_len &&
+	!memcmp(k1->ident, k2->ident, k1->ident_len))
+      return k1->pkcs->public_key_compare(k1->pkcs, k1->public_key,
+					  k2->public_key);
+  }
+
+  i1 = silc_pkcs_silc_get_ident(k1, &tmp1);
+  i2 = silc_pkcs_silc_get_ident(k2, &tmp2);
+  ret = i1 && i2 && silc_pkcs_silc_ident_compare(i1, i2);
+  silc_pkcs_silc_ident_free(&tmp1);
+  silc_pkcs_silc_ident_free(&tmp2);
+  if (!ret)
     return FALSE;
 
   return k1->pkcs->public_key_compare(k1->pkcs, k1->public_key, k2->public_key);
@@ -815,13 +1030,7 @@ SILC_PKCS_PUBLIC_KEY_FREE(silc_pkcs_silc_public_key_free)
   silc_pubkey->pkcs->public_key_free(silc_pubkey->pkcs,
 				     silc_pubkey->public_key);
 
-  silc_free(silc_pubkey->identifier.username);
-  silc_free(silc_pubkey->identifier.host);
-  silc_free(silc_pubkey->identifier.realname);
-  silc_free(silc_pubkey->identifier.email);
-  silc_free(silc_pubkey->identifier.org);
-  silc_free(silc_pubkey->identifier.country);
-  silc_free(silc_pubkey->identifier.version);
+  silc_pkcs_silc_ident_free(&silc_pubkey->identifier);
   silc_free(silc_pubkey);
 }
 
@@ -1250,6 +1459,18 @@ SILC_PKCS_IMPORT_PRIVATE_KEY(silc_pkcs_silc_import_private_key)
     SILC_NOT_IMPLEMENTED("DSA SILC Private Key");
     goto err;
 
+  } else if (!strcmp(pkcs_name, "ecdsa") || !strcmp(pkcs_name, "ed25519")) {
+    /* The SILC ECDSA and Ed25519 private key is the algorithm private key
+       as is */
+    alg = silc_pkcs_find_algorithm(pkcs_name, pkcs_name);
+    if (!alg) {
+      SILC_LOG_DEBUG(("Unsupported PKCS algorithm"));
+      goto err;
+    }
+    silc_privkey->pkcs = alg;
+
+    silc_buffer_set(&alg_key, key_data, keydata_len);
+
   } else {
     SILC_LOG_DEBUG(("Unsupported PKCS algorithm"));
     goto err;
@@ -1468,12 +1689,12 @@ SILC_PKCS_EXPORT_PRIVATE_KEY(silc_pkcs_silc_export_private_key)
     /* Parse the PKCS #1 private key */
     SilcMPInt n, e, d, dp, dq, qp, p, q;
     SilcUInt32 e_len, n_len, d_len, dp_len, dq_len,
-      qp_len, p_len, q_len, len = 0;
+      qp_len, p_len, q_len, ver, len = 0;
     unsigned char *nb, *eb, *db, *dpb, *dqb, *qpb, *pb, *qb;
 
     if (!silc_asn1_decode(asn1, &alg_key,
 			  SILC_ASN1_SEQUENCE,
-			    SILC_ASN1_INT(NULL),
+			    SILC_ASN1_SHORT_INT(&ver),
 			    SILC_ASN1_INT(&n),
 			    SILC_ASN1_INT(&e),
 			    SILC_ASN1_INT(&d),
@@ -1485,6 +1706,12 @@ SILC_PKCS_EXPORT_PRIVATE_KEY(silc_pkcs_silc_export_private_key)
 			  SILC_ASN1_END, SILC_ASN1_END))
       goto err;
 
+    /* Multi-prime key cannot be encoded as SILC private key */
+    if (ver != 0) {
+      SILC_LOG_DEBUG(("Cannot export multi-prime RSA key"));
+      goto err;
+    }
+
     /* Encode to SILC RSA private key */
     eb = silc_mp_mp2bin(&e, 0, &e_len);
     nb = silc_mp_mp2bin(&n, 0, &n_len);
@@ -1536,6 +1763,15 @@ SILC_PKCS_EXPORT_PRIVATE_KEY(silc_pkcs_silc_export_private_key)
     SILC_NOT_IMPLEMENTED("SILC DSA Private Key");
     goto err;
 
+  } else if (!strcmp(alg->name, "ecdsa") || !strcmp(alg->name, "ed25519")) {
+    /* The SILC ECDSA and Ed25519 private key is the algorithm private key
+       as is */
+    key_len = prv_len;
+    key = silc_smalloc(stack, key_len);
+    if (!key)
+      goto err;
+    memcpy(key, prv, key_len);
+
   } else {
     SILC_LOG_DEBUG(("Unsupported PKCS algorithm"));
     goto err;
@@ -67,12 +67,18 @@ typedef struct SilcPublicKeyIdentifierObject {
  *    the identifier is required.  The silc_pkcs_public_key_get_pkcs for the
  *    PKCS type SILC_PKCS_SILC returns this context.
  *
+ *    If the key was allocated with silc_pkcs_public_key_view the `ident'
+ *    points to the encoded identifier in the borrowed key data and the
+ *    `identifier' fields are NULL.
+ *
  * SOURCE
  */
 typedef struct SilcSILCPublicKeyStruct {
   SilcPublicKeyIdentifierStruct identifier;
   const SilcPKCSAlgorithm *pkcs;   /* PKCS algorithm */
   void *public_key;	           /* PKCS algorithm specific public key */
+  const unsigned char *ident;	   /* Borrowed encoded identifier */
+  SilcUInt16 ident_len;		   /* Length of `ident' */
 } *SilcSILCPublicKey;
 /***/
 
@@ -109,8 +115,9 @@ typedef struct SilcSILCPrivateKeyStruct {
  * DESCRIPTION
  *
  *    Generate a new SILC key pair of the algorithm type `algorithm' with
- *    the key length in bits of `bits_key_len'.  Returns FALSE if key
- *    generation failed.
+ *    the key length in bits of `bits_key_len'.  The `algorithm' is "rsa",
+ *    "ecdsa" or "ed25519".  With "ecdsa" the key length is 256 or 384 and
+ *    with "ed25519" it is 256.  Returns FALSE if key generation failed.
  *
  * EXAMPLE
  *
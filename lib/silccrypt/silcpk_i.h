@@ -29,6 +29,7 @@
 SILC_PKCS_GET_ALGORITHM(silc_pkcs_silc_get_algorithm);
 SILC_PKCS_IMPORT_PUBLIC_KEY_FILE(silc_pkcs_silc_import_public_key_file);
 SILC_PKCS_IMPORT_PUBLIC_KEY(silc_pkcs_silc_import_public_key);
+SILC_PKCS_IMPORT_PUBLIC_KEY(silc_pkcs_silc_import_public_key_view);
 SILC_PKCS_EXPORT_PUBLIC_KEY_FILE(silc_pkcs_silc_export_public_key_file);
 SILC_PKCS_EXPORT_PUBLIC_KEY(silc_pkcs_silc_export_public_key);
 SILC_PKCS_PUBLIC_KEY_BITLEN(silc_pkcs_silc_public_key_bitlen);
@@ -21,6 +21,9 @@
 #include "silcpk_i.h"
 #include "silcpkcs1_i.h"
 #include "dsa.h"
+#include "ecdsa.h"
+#include "ed25519.h"
+#include "sha256_internal.h"
 #ifdef SILC_DIST_SSH
 #include "silcssh_pkcs.h"
 #endif /* SILC_DIST_SSH */
@@ -171,6 +174,94 @@ const SilcPKCSAlgorithm silc_default_pkcs_alg[] =
     silc_pkcs1_verify
   },
 
+  /* PKCS #1, Version 2.1 multi-prime key with three primes */
+  {
+    "rsa",
+    "pkcs1-mp3",
+    "sha1,md5",
+    silc_pkcs1_generate_key_mp3,
+    silc_pkcs1_import_public_key,
+    silc_pkcs1_export_public_key,
+    silc_pkcs1_public_key_bitlen,
+    silc_pkcs1_public_key_copy,
+    silc_pkcs1_public_key_compare,
+    silc_pkcs1_public_key_free,
+    silc_pkcs1_import_private_key,
+    silc_pkcs1_export_private_key,
+    silc_pkcs1_private_key_bitlen,
+    silc_pkcs1_private_key_free,
+    silc_pkcs1_encrypt,
+    silc_pkcs1_decrypt,
+    silc_pkcs1_sign,
+    silc_pkcs1_verify
+  },
+
+  /* PKCS #1, Version 2.1 multi-prime key with four primes */
+  {
+    "rsa",
+    "pkcs1-mp4",
+    "sha1,md5",
+    silc_pkcs1_generate_key_mp4,
+    silc_pkcs1_import_public_key,
+    silc_pkcs1_export_public_key,
+    silc_pkcs1_public_key_bitlen,
+    silc_pkcs1_public_key_copy,
+    silc_pkcs1_public_key_compare,
+    silc_pkcs1_public_key_free,
+    silc_pkcs1_import_private_key,
+    silc_pkcs1_export_private_key,
+    silc_pkcs1_private_key_bitlen,
+    silc_pkcs1_private_key_free,
+    silc_pkcs1_encrypt,
+    silc_pkcs1_decrypt,
+    silc_pkcs1_sign,
+    silc_pkcs1_verify
+  },
+
+  /* PKCS #1, Version 2.1 RSASSA-PSS signatures */
+  {
+    "rsa",
+    "pkcs1-pss",
+    "sha1,sha256,sha384,sha512",
+    silc_pkcs1_generate_key,
+    silc_pkcs1_import_public_key,
+    silc_pkcs1_export_public_key,
+    silc_pkcs1_public_key_bitlen,
+    silc_pkcs1_public_key_copy,
+    silc_pkcs1_public_key_compare,
+    silc_pkcs1_public_key_free,
+    silc_pkcs1_import_private_key,
+    silc_pkcs1_export_private_key,
+    silc_pkcs1_private_key_bitlen,
+    silc_pkcs1_private_key_free,
+    silc_pkcs1_encrypt,
+    silc_pkcs1_decrypt,
+    silc_pkcs1_sign_pss,
+    silc_pkcs1_verify_pss
+  },
+
+  /* PKCS #1, Version 2.1 RSAES-OAEP encryption */
+  {
+    "rsa",
+    "pkcs1-oaep",
+    "sha1,sha256,sha384,sha512",
+    silc_pkcs1_generate_key,
+    silc_pkcs1_import_public_key,
+    silc_pkcs1_export_public_key,
+    silc_pkcs1_public_key_bitlen,
+    silc_pkcs1_public_key_copy,
+    silc_pkcs1_public_key_compare,
+    silc_pkcs1_public_key_free,
+    silc_pkcs1_import_private_key,
+    silc_pkcs1_export_private_key,
+    silc_pkcs1_private_key_bitlen,
+    silc_pkcs1_private_key_free,
+    silc_pkcs1_encrypt_oaep,
+    silc_pkcs1_decrypt_oaep,
+    silc_pkcs1_sign,
+    silc_pkcs1_verify
+  },
+
   /* DSS, FIPS186-3 */
   {
     "dsa",
@@ -215,6 +306,50 @@ const SilcPKCSAlgorithm silc_default_pkcs_alg[] =
     silc_dsa_verify
   },
 
+  /* ECDSA, FIPS186-3, NIST P-256 and P-384 */
+  {
+    "ecdsa",
+    "ecdsa",
+    "sha256,sha384,sha512,sha1",
+    silc_ecdsa_generate_key,
+    silc_ecdsa_import_public_key,
+    silc_ecdsa_export_public_key,
+    silc_ecdsa_public_key_bitlen,
+    silc_ecdsa_public_key_copy,
+    silc_ecdsa_public_key_compare,
+    silc_ecdsa_public_key_free,
+    silc_ecdsa_import_private_key,
+    silc_ecdsa_export_private_key,
+    silc_ecdsa_private_key_bitlen,
+    silc_ecdsa_private_key_free,
+    silc_ecdsa_encrypt,
+    silc_ecdsa_decrypt,
+    silc_ecdsa_sign,
+    silc_ecdsa_verify
+  },
+
+  /* Ed25519, RFC 8032 */
+  {
+    "ed25519",
+    "ed25519",
+    "sha512",
+    silc_ed25519_generate_key,
+    silc_ed25519_import_public_key,
+    silc_ed25519_export_public_key,
+    silc_ed25519_public_key_bitlen,
+    silc_ed25519_public_key_copy,
+    silc_ed25519_public_key_compare,
+    silc_ed25519_public_key_free,
+    silc_ed25519_import_private_key,
+    silc_ed25519_export_private_key,
+    silc_ed25519_private_key_bitlen,
+    silc_ed25519_private_key_free,
+    silc_ed25519_encrypt,
+    silc_ed25519_decrypt,
+    silc_ed25519_sign,
+    silc_ed25519_verify
+  },
+
 #ifdef SILC_DIST_SSH
   /* PKCS #1, SSH2 style public keys */
   {
@@ -259,6 +394,50 @@ const SilcPKCSAlgorithm silc_default_pkcs_alg[] =
     silc_dsa_sign,
     silc_dsa_verify
   },
+
+  /* ECDSA, SSH2 style public keys */
+  {
+    "ecdsa",
+    "ssh",
+    "sha256,sha384",
+    silc_ecdsa_generate_key,
+    silc_ssh_ecdsa_import_public_key,
+    silc_ssh_ecdsa_export_public_key,
+    silc_ecdsa_public_key_bitlen,
+    silc_ecdsa_public_key_copy,
+    silc_ecdsa_public_key_compare,
+    silc_ecdsa_public_key_free,
+    silc_ecdsa_import_private_key,
+    silc_ecdsa_export_private_key,
+    silc_ecdsa_private_key_bitlen,
+    silc_ecdsa_private_key_free,
+    silc_ecdsa_encrypt,
+    silc_ecdsa_decrypt,
+    silc_ecdsa_sign,
+    silc_ecdsa_verify
+  },
+
+  /* Ed25519, SSH2 style public keys */
+  {
+    "ed25519",
+    "ssh",
+    "sha512",
+    silc_ed25519_generate_key,
+    silc_ssh_ed25519_import_public_key,
+    silc_ssh_ed25519_export_public_key,
+    silc_ed25519_public_key_bitlen,
+    silc_ed25519_public_key_copy,
+    silc_ed25519_public_key_compare,
+    silc_ed25519_public_key_free,
+    silc_ed25519_import_private_key,
+    silc_ed25519_export_private_key,
+    silc_ed25519_private_key_bitlen,
+    silc_ed25519_private_key_free,
+    silc_ed25519_encrypt,
+    silc_ed25519_decrypt,
+    silc_ed25519_sign,
+    silc_ed25519_verify
+  },
 #endif /* SILC_DIST_SSH */
 
 #ifdef SILC_DIST_PGP
@@ -495,6 +674,7 @@ SilcBool silc_pkcs_unregister_all(void)
     }
   }
 
+  silc_pkcs_verify_cache_set(0, FALSE);
 #endif /* SILC_SYMBIAN */
   return TRUE;
 }
@@ -670,6 +850,7 @@ SilcBool silc_pkcs_public_key_alloc(SilcPKCSType type,
 				  &public_key->public_key,
 				  &public_key->alg)) {
 	public_key->pkcs = (SilcPKCSObject *)pkcs;
+	silc_pkcs_public_key_compute_digest(public_key);
 	*ret_public_key = public_key;
 	return TRUE;
       }
@@ -686,6 +867,7 @@ SilcBool silc_pkcs_public_key_alloc(SilcPKCSType type,
     if (pkcs->import_public_key(pkcs, NULL, key, key_len,
 				&public_key->public_key,
 				&public_key->alg)) {
+      silc_pkcs_public_key_compute_digest(public_key);
       *ret_public_key = public_key;
       return TRUE;
     }
@@ -695,6 +877,45 @@ SilcBool silc_pkcs_public_key_alloc(SilcPKCSType type,
   return FALSE;
 }
 
+/* Allocates new public key that borrows the key data */
+
+SilcBool silc_pkcs_public_key_view(SilcPKCSType type,
+				   unsigned char *key,
+				   SilcUInt32 key_len,
+				   SilcPublicKey *ret_public_key)
+{
+  const SilcPKCSObject *pkcs;
+  SilcPublicKey public_key;
+
+  if (!ret_public_key)
+    return FALSE;
+
+  /* Only the default SILC PKCS supports borrowing */
+  pkcs = silc_pkcs_find_pkcs(SILC_PKCS_SILC);
+  if ((type != SILC_PKCS_SILC && type != SILC_PKCS_ANY) || !pkcs ||
+      pkcs->import_public_key != silc_pkcs_silc_import_public_key)
+    return silc_pkcs_public_key_alloc(type, key, key_len, ret_public_key);
+
+  public_key = silc_calloc(1, sizeof(*public_key));
+  if (!public_key)
+    return FALSE;
+
+  if (silc_pkcs_silc_import_public_key_view(pkcs, NULL, key, key_len,
+					    &public_key->public_key,
+					    &public_key->alg)) {
+    public_key->pkcs = (SilcPKCSObject *)pkcs;
+    *ret_public_key = public_key;
+    return TRUE;
+  }
+
+  silc_free(public_key);
+
+  if (type == SILC_PKCS_ANY)
+    return silc_pkcs_public_key_alloc(type, key, key_len, ret_public_key);
+
+  return FALSE;
+}
+
 /* Frees the public key */
 
 void silc_pkcs_public_key_free(SilcPublicKey public_key)
@@ -713,6 +934,86 @@ unsigned char *silc_pkcs_public_key_encode(SilcStack stack,
 					     public_key->public_key, ret_len);
 }
 
+/* Computes the digest of the encoded public key into `digest' */
+
+static SilcBool silc_pkcs_public_key_digest(SilcPublicKey public_key,
+					    unsigned char *digest)
+{
+  unsigned char *pk;
+  SilcUInt32 pk_len;
+  SilcStack stack;
+  sha256_state md;
+
+  stack = silc_crypto_thread_stack();
+  silc_stack_push(stack, NULL);
+
+  pk = silc_pkcs_public_key_encode(stack, public_key, &pk_len);
+  if (!pk) {
+    silc_stack_pop(stack);
+    return FALSE;
+  }
+
+  sha256_init(&md);
+  sha256_process(&md, pk, pk_len);
+  sha256_done(&md, digest);
+
+  silc_sfree(stack, pk);
+  silc_stack_pop(stack);
+
+  return TRUE;
+}
+
+/* Computes the digest of the encoded public key into the `public_key' */
+
+SilcBool silc_pkcs_public_key_compute_digest(SilcPublicKey public_key)
+{
+  silc_atomic_set_int32(&public_key->digest_state, SILC_PKCS_DIGEST_NONE);
+  if (!silc_pkcs_public_key_digest(public_key, public_key->digest))
+    return FALSE;
+  silc_atomic_set_int32(&public_key->digest_state, SILC_PKCS_DIGEST_SET);
+  return TRUE;
+}
+
+/* Returns the digest of the encoded public key, computing it on first
+   call.  Threads racing on the first call all compute the digest but only
+   the first one stores it, and the others wait until it is stored. */
+
+const unsigned char *silc_pkcs_public_key_get_digest(SilcPublicKey public_key)
+{
+  unsigned char digest[SILC_PKCS_DIGEST_LEN];
+
+  if (silc_atomic_get_int32(&public_key->digest_state) ==
+      SILC_PKCS_DIGEST_SET)
+    return public_key->digest;
+
+  if (!silc_pkcs_public_key_digest(public_key, digest))
+    return NULL;
+
+  if (silc_atomic_cas32(&public_key->digest_state, SILC_PKCS_DIGEST_NONE,
+			SILC_PKCS_DIGEST_BUSY)) {
+    memcpy(public_key->digest, digest, sizeof(digest));
+    silc_atomic_set_int32(&public_key->digest_state, SILC_PKCS_DIGEST_SET);
+  } else {
+    while (silc_atomic_get_int32(&public_key->digest_state) !=
+	   SILC_PKCS_DIGEST_SET)
+      ;
+  }
+
+  return public_key->digest;
+}
+
+/* Returns the fingerprint of the public key digest */
+
+char *silc_pkcs_public_key_get_fingerprint(SilcPublicKey public_key)
+{
+  const unsigned char *digest;
+
+  digest = silc_pkcs_public_key_get_digest(public_key);
+  if (!digest)
+    return NULL;
+  return silc_fingerprint(digest, SILC_PKCS_DIGEST_LEN);
+}
+
 /* Return key length */
 
 SilcUInt32 silc_pkcs_public_key_get_len(SilcPublicKey public_key)
@@ -940,6 +1241,320 @@ SilcAsyncOperation silc_pkcs_sign_async(SilcPrivateKey private_key,
 				 compute_hash, hash, rng, sign_cb, context);
 }
 
+/* Generates signature of the digest in `hash' */
+
+SilcBool silc_pkcs_sign_hash(SilcPrivateKey private_key,
+			     SilcHash hash,
+			     unsigned char *dst, SilcUInt32 dst_size,
+			     SilcUInt32 *dst_len, SilcRng rng)
+{
+  unsigned char digest[SILC_HASH_MAXLEN];
+  SilcBool ret;
+
+  silc_hash_final(hash, digest);
+  ret = silc_pkcs_sign(private_key, digest, silc_hash_len(hash),
+		       dst, dst_size, dst_len, FALSE, hash, rng);
+  memset(digest, 0, sizeof(digest));
+
+  return ret;
+}
+
+/**************************** Verification cache *****************************/
+
+/* Verification cache entry */
+typedef struct SilcPKCSVerifyCacheEntryStruct {
+  struct SilcPKCSVerifyCacheEntryStruct *next;
+  struct SilcPKCSVerifyCacheEntryStruct *prev;
+  unsigned char digest[SILC_PKCS_DIGEST_LEN];	/* Cache key */
+} *SilcPKCSVerifyCacheEntry;
+
+/* Verification cache of successful verifications */
+typedef struct {
+  SilcMutex lock;
+  SilcHashTable entries;		/* Entries by digest */
+  SilcList lru;				/* Least recently used first */
+  SilcUInt32 size;			/* Maximum number of entries */
+  SilcUInt64 hits;
+  SilcUInt64 misses;
+  unsigned int all_keys : 1;		/* Cache for all public keys */
+} SilcPKCSVerifyCacheStruct;
+
+/* Asynchronous verification with cache */
+typedef struct {
+  SilcAsyncOperationStruct op;		/* Operation for aborting */
+  SilcAsyncOperation pkcs_op;		/* PKCS verify operation */
+  SilcPKCSVerifyCb verify_cb;
+  void *context;
+  unsigned char digest[SILC_PKCS_DIGEST_LEN];
+  unsigned int async : 1;		/* Set when verify is asynchronous */
+} *SilcPKCSVerifyCacheOp;
+
+#ifndef SILC_SYMBIAN
+static SilcPKCSVerifyCacheStruct silc_pkcs_verify_cache;
+#endif /* SILC_SYMBIAN */
+
+/* Hash table hash function for cache entries */
+
+static SilcUInt32 silc_pkcs_verify_cache_hash(void *key, void *user_context)
+{
+  SilcUInt32 hash;
+  SILC_GET32_MSB(hash, (unsigned char *)key);
+  return hash;
+}
+
+/* Hash table comparison function for cache entries */
+
+static SilcBool silc_pkcs_verify_cache_compare(void *key1, void *key2,
+					       void *user_context)
+{
+  return !memcmp(key1, key2, SILC_PKCS_DIGEST_LEN);
+}
+
+/* Removes least recently used entries until there are at most `size'
+   entries.  Called with the lock held. */
+
+static void silc_pkcs_verify_cache_evict(SilcPKCSVerifyCacheStruct *cache,
+					 SilcUInt32 size)
+{
+  SilcPKCSVerifyCacheEntry entry;
+
+  while (silc_list_count(cache->lru) > size) {
+    silc_list_start(cache->lru);
+    entry = silc_list_get(cache->lru);
+    silc_list_del(cache->lru, entry);
+    silc_hash_table_del(cache->entries, entry->digest);
+    silc_free(entry);
+  }
+}
+
+/* Computes the cache key for the verification into `digest'.  Returns
+   FALSE if the cache is not used with `public_key'. */
+
+static SilcBool silc_pkcs_verify_cache_digest(SilcPublicKey public_key,
+					      unsigned char *signature,
+					      SilcUInt32 signature_len,
+					      unsigned char *data,
+					      SilcUInt32 data_len,
+					      SilcBool compute_hash,
+					      SilcHash hash,
+					      unsigned char *digest)
+{
+#ifndef SILC_SYMBIAN
+  SilcPKCSVerifyCacheStruct *cache = &silc_pkcs_verify_cache;
+  const unsigned char *key_digest;
+  const char *hash_name = "";
+  unsigned char tmp[9];
+  sha256_state md;
+  SilcBool use;
+
+  if (!cache->lock)
+    return FALSE;
+
+  /* The size may be changed while verifying in other threads */
+  silc_mutex_lock(cache->lock);
+  use = cache->size && (cache->all_keys || public_key->verify_cache);
+  silc_mutex_unlock(cache->lock);
+  if (!use)
+    return FALSE;
+
+  key_digest = silc_pkcs_public_key_get_digest(public_key);
+  if (!key_digest)
+    return FALSE;
+  if (hash)
+    hash_name = silc_hash_get_name(hash);
+
+  /* The signed data is part of the key.  The same signature may be
+     valid over different data when the data is not hashed by us. */
+  tmp[0] = compute_hash;
+  SILC_PUT32_MSB(signature_len, tmp + 1);
+  SILC_PUT32_MSB(data_len, tmp + 5);
+
+  sha256_init(&md);
+  sha256_process(&md, key_digest, SILC_PKCS_DIGEST_LEN);
+  sha256_process(&md, tmp, sizeof(tmp));
+  sha256_process(&md, (unsigned char *)hash_name, strlen(hash_name) + 1);
+  sha256_process(&md, signature, signature_len);
+  sha256_process(&md, data, data_len);
+  sha256_done(&md, digest);
+
+  return TRUE;
+#else
+  return FALSE;
+#endif /* SILC_SYMBIAN */
+}
+
+/* Returns TRUE if `digest' is in the cache */
+
+static SilcBool silc_pkcs_verify_cache_find(const unsigned char *digest)
+{
+#ifndef SILC_SYMBIAN
+  SilcPKCSVerifyCacheStruct *cache = &silc_pkcs_verify_cache;
+  SilcPKCSVerifyCacheEntry entry;
+  SilcBool found;
+
+  silc_mutex_lock(cache->lock);
+
+  found = silc_hash_table_find(cache->entries, (void *)digest, NULL,
+			       (void *)&entry);
+  if (found) {
+    /* Move to the end of LRU list */
+    silc_list_del(cache->lru, entry);
+    silc_list_add(cache->lru, entry);
+    cache->hits++;
+  } else {
+    cache->misses++;
+  }
+
+  silc_mutex_unlock(cache->lock);
+
+  return found;
+#else
+  return FALSE;
+#endif /* SILC_SYMBIAN */
+}
+
+/* Adds `digest' of successful verification to the cache */
+
+static void silc_pkcs_verify_cache_add(const unsigned char *digest)
+{
+#ifndef SILC_SYMBIAN
+  SilcPKCSVerifyCacheStruct *cache = &silc_pkcs_verify_cache;
+  SilcPKCSVerifyCacheEntry entry;
+
+  silc_mutex_lock(cache->lock);
+
+  if (!cache->size ||
+      silc_hash_table_find(cache->entries, (void *)digest, NULL, NULL)) {
+    silc_mutex_unlock(cache->lock);
+    return;
+  }
+
+  silc_pkcs_verify_cache_evict(cache, cache->size - 1);
+
+  entry = silc_calloc(1, sizeof(*entry));
+  if (!entry) {
+    silc_mutex_unlock(cache->lock);
+    return;
+  }
+  memcpy(entry->digest, digest, sizeof(entry->digest));
+
+  if (!silc_hash_table_add(cache->entries, entry->digest, entry)) {
+    silc_free(entry);
+    silc_mutex_unlock(cache->lock);
+    return;
+  }
+  silc_list_add(cache->lru, entry);
+
+  silc_mutex_unlock(cache->lock);
+#endif /* SILC_SYMBIAN */
+}
+
+/* Sets verification cache size */
+
+SilcBool silc_pkcs_verify_cache_set(SilcUInt32 size, SilcBool all_keys)
+{
+#ifndef SILC_SYMBIAN
+  SilcPKCSVerifyCacheStruct *cache = &silc_pkcs_verify_cache;
+
+  if (!size) {
+    /* Disable and free the cache */
+    if (!cache->lock)
+      return TRUE;
+
+    silc_mutex_lock(cache->lock);
+    silc_pkcs_verify_cache_evict(cache, 0);
+    silc_mutex_unlock(cache->lock);
+
+    silc_hash_table_free(cache->entries);
+    silc_mutex_free(cache->lock);
+    memset(cache, 0, sizeof(*cache));
+    return TRUE;
+  }
+
+  if (!cache->lock) {
+    if (!silc_mutex_alloc(&cache->lock))
+      return FALSE;
+
+    cache->entries =
+      silc_hash_table_alloc(NULL, 0, silc_pkcs_verify_cache_hash, NULL,
+			    silc_pkcs_verify_cache_compare, NULL,
+			    NULL, NULL, TRUE);
+    if (!cache->entries) {
+      silc_mutex_free(cache->lock);
+      cache->lock = NULL;
+      return FALSE;
+    }
+
+    silc_list_init_prev(cache->lru, struct SilcPKCSVerifyCacheEntryStruct,
+			next, prev);
+  }
+
+  silc_mutex_lock(cache->lock);
+  silc_pkcs_verify_cache_evict(cache, size);
+  cache->size = size;
+  cache->all_keys = all_keys;
+  silc_mutex_unlock(cache->lock);
+
+  return TRUE;
+#else
+  return FALSE;
+#endif /* SILC_SYMBIAN */
+}
+
+/* Returns verification cache statistics */
+
+void silc_pkcs_verify_cache_get_stats(SilcPKCSVerifyCacheStats *stats)
+{
+  memset(stats, 0, sizeof(*stats));
+
+#ifndef SILC_SYMBIAN
+  if (!silc_pkcs_verify_cache.lock)
+    return;
+
+  silc_mutex_lock(silc_pkcs_verify_cache.lock);
+  stats->size = silc_pkcs_verify_cache.size;
+  stats->count = silc_list_count(silc_pkcs_verify_cache.lru);
+  stats->hits = silc_pkcs_verify_cache.hits;
+  stats->misses = silc_pkcs_verify_cache.misses;
+  silc_mutex_unlock(silc_pkcs_verify_cache.lock);
+#endif /* SILC_SYMBIAN */
+}
+
+/* Enables or disables verification cache for the public key */
+
+void silc_pkcs_public_key_set_verify_cache(SilcPublicKey public_key,
+					   SilcBool enable)
+{
+  public_key->verify_cache = enable;
+}
+
+/* Asynchronous verification completion */
+
+static void silc_pkcs_verify_cache_cb(SilcBool success, void *context)
+{
+  SilcPKCSVerifyCacheOp op = context;
+
+  if (success)
+    silc_pkcs_verify_cache_add(op->digest);
+
+  op->verify_cb(success, op->context);
+
+  /* Synchronous operation is freed by silc_pkcs_verify_async */
+  if (op->async)
+    silc_free(op);
+}
+
+/* Aborts asynchronous verification */
+
+static void silc_pkcs_verify_cache_abort(SilcAsyncOperation op,
+					 void *context)
+{
+  SilcPKCSVerifyCacheOp vop = context;
+
+  silc_async_abort(vop->pkcs_op, NULL, NULL);
+  silc_free(vop);
+}
+
 /* Verifies signature */
 
 SilcBool silc_pkcs_verify(SilcPublicKey public_key,
@@ -951,6 +1566,14 @@ SilcBool silc_pkcs_verify(SilcPublicKey public_key,
 			  SilcHash hash)
 {
   SilcPKCSOperation ctx;
+  unsigned char digest[SILC_PKCS_DIGEST_LEN];
+  SilcBool cache;
+
+  cache = silc_pkcs_verify_cache_digest(public_key, signature, signature_len,
+					data, data_len, compute_hash, hash,
+					digest);
+  if (cache && silc_pkcs_verify_cache_find(digest))
+    return TRUE;
 
   public_key->pkcs->verify(public_key->pkcs,
 			   public_key->public_key, signature,
@@ -958,6 +1581,9 @@ SilcBool silc_pkcs_verify(SilcPublicKey public_key,
 			   compute_hash, hash, NULL,
 			   silc_pkcs_verify_cb, &ctx);
 
+  if (cache && ctx.result)
+    silc_pkcs_verify_cache_add(digest);
+
   return ctx.result;
 }
 
@@ -973,11 +1599,277 @@ SilcAsyncOperation silc_pkcs_verify_async(SilcPublicKey public_key,
 					  SilcPKCSVerifyCb verify_cb,
 					  void *context)
 {
-  return public_key->pkcs->verify(public_key->pkcs,
-				  public_key->public_key, signature,
-				  signature_len, data, data_len,
-				  compute_hash, hash, NULL,
-				  verify_cb, context);
+  SilcPKCSVerifyCacheOp op;
+  unsigned char digest[SILC_PKCS_DIGEST_LEN];
+
+  if (!silc_pkcs_verify_cache_digest(public_key, signature, signature_len,
+				     data, data_len, compute_hash, hash,
+				     digest))
+    return public_key->pkcs->verify(public_key->pkcs,
+				    public_key->public_key, signature,
+				    signature_len, data, data_len,
+				    compute_hash, hash, NULL,
+				    verify_cb, context);
+
+  if (silc_pkcs_verify_cache_find(digest)) {
+    verify_cb(TRUE, context);
+    return NULL;
+  }
+
+  op = silc_calloc(1, sizeof(*op));
+  if (!op) {
+    verify_cb(FALSE, context);
+    return NULL;
+  }
+  memcpy(op->digest, digest, sizeof(op->digest));
+  op->verify_cb = verify_cb;
+  op->context = context;
+
+  op->pkcs_op = public_key->pkcs->verify(public_key->pkcs,
+					 public_key->public_key, signature,
+					 signature_len, data, data_len,
+					 compute_hash, hash, NULL,
+					 silc_pkcs_verify_cache_cb, op);
+  if (!op->pkcs_op) {
+    /* Verified synchronously */
+    silc_free(op);
+    return NULL;
+  }
+
+  op->async = TRUE;
+  silc_async_init(&op->op, silc_pkcs_verify_cache_abort, NULL, op);
+
+  return &op->op;
+}
+
+/* Verifies signature of the digest in `hash' */
+
+SilcBool silc_pkcs_verify_hash(SilcPublicKey public_key,
+			       unsigned char *signature,
+			       SilcUInt32 signature_len,
+			       SilcHash hash)
+{
+  unsigned char digest[SILC_HASH_MAXLEN];
+
+  silc_hash_final(hash, digest);
+  return silc_pkcs_verify(public_key, signature, signature_len,
+			  digest, silc_hash_len(hash), FALSE, hash);
+}
+
+/* Minimum number of signatures verified in one thread in batch
+   verification, and maximum number of chunks */
+#define SILC_PKCS_VERIFY_BATCH_CHUNK 16
+#define SILC_PKCS_VERIFY_BATCH_MAX_CHUNKS 16
+
+typedef struct SilcPKCSVerifyBatchStruct *SilcPKCSVerifyBatch;
+
+/* Batch verification chunk */
+typedef struct {
+  SilcPKCSVerifyBatch batch;
+  SilcPKCSVerifyEntry *entries;
+  SilcUInt32 num_entries;
+  SilcHash hash;			/* Hash of this chunk, may be NULL */
+  SilcUInt32 valid;			/* Number of valid signatures */
+  unsigned int thread : 1;		/* Set when run in thread */
+} SilcPKCSVerifyBatchChunk;
+
+/* Batch verification context */
+struct SilcPKCSVerifyBatchStruct {
+  SilcMutex lock;
+  SilcCond cond;
+  SilcPKCSVerifyBatchChunk *chunks;
+  SilcUInt32 done;			/* Number of chunks done */
+  SilcBool compute_hash;
+};
+
+/* Cache key of signature verified in Ed25519 batch */
+typedef struct {
+  unsigned char digest[SILC_PKCS_DIGEST_LEN];
+  SilcBool cache;			/* Set when cache is used */
+} SilcPKCSVerifyBatchDigest;
+
+/* Returns the Ed25519 algorithm public key if the `public_key' is SILC
+   Ed25519 public key, which can be verified in Ed25519 batch. */
+
+static void *silc_pkcs_verify_batch_ed25519(SilcPublicKey public_key)
+{
+  if (public_key->pkcs->type != SILC_PKCS_SILC ||
+      public_key->alg->verify != silc_ed25519_verify)
+    return NULL;
+  return ((SilcSILCPublicKey)public_key->public_key)->public_key;
+}
+
+/* Verifies signatures.  The Ed25519 signatures are verified with one batch
+   equation and the rest one by one.  The Ed25519 signatures found in the
+   verification cache are not verified again, and the valid ones are added
+   to the cache.  Returns number of valid signatures. */
+
+static SilcUInt32 silc_pkcs_verify_entries(SilcPKCSVerifyEntry *entries,
+					   SilcUInt32 num_entries,
+					   SilcBool compute_hash,
+					   SilcHash hash)
+{
+  SilcPKCSVerifyEntry *entry, **ed_entries;
+  SilcPKCSVerifyBatchDigest *ed_digests;
+  SilcUInt32 i, num_ed = 0, valid = 0;
+  void **ed_keys, *key;
+
+  ed_entries = silc_malloc(num_entries * sizeof(*ed_entries));
+  ed_keys = silc_malloc(num_entries * sizeof(*ed_keys));
+  ed_digests = silc_malloc(num_entries * sizeof(*ed_digests));
+
+  for (i = 0; i < num_entries; i++) {
+    entry = &entries[i];
+
+    key = silc_pkcs_verify_batch_ed25519(entry->public_key);
+    if (key && ed_entries && ed_keys && ed_digests) {
+      ed_digests[num_ed].cache =
+	silc_pkcs_verify_cache_digest(entry->public_key, entry->signature,
+				      entry->signature_len, entry->data,
+				      entry->data_len, compute_hash, hash,
+				      ed_digests[num_ed].digest);
+      if (ed_digests[num_ed].cache &&
+	  silc_pkcs_verify_cache_find(ed_digests[num_ed].digest)) {
+	entry->success = TRUE;
+	valid++;
+	continue;
+      }
+
+      ed_entries[num_ed] = entry;
+      ed_keys[num_ed++] = key;
+      continue;
+    }
+
+    entry->success = silc_pkcs_verify(entry->public_key,
+				      entry->signature, entry->signature_len,
+				      entry->data, entry->data_len,
+				      compute_hash, hash);
+    if (entry->success)
+      valid++;
+  }
+
+  if (num_ed) {
+    valid += silc_ed25519_verify_batch(ed_keys, ed_entries, num_ed);
+
+    for (i = 0; i < num_ed; i++)
+      if (ed_digests[i].cache && ed_entries[i]->success)
+	silc_pkcs_verify_cache_add(ed_digests[i].digest);
+  }
+
+  silc_free(ed_entries);
+  silc_free(ed_keys);
+  silc_free(ed_digests);
+
+  return valid;
+}
+
+/* Verifies the signatures of one chunk */
+
+static void silc_pkcs_verify_batch_thread(SilcSchedule schedule,
+					  void *context)
+{
+  SilcPKCSVerifyBatchChunk *chunk = context;
+  SilcPKCSVerifyBatch batch = chunk->batch;
+
+  chunk->valid = silc_pkcs_verify_entries(chunk->entries, chunk->num_entries,
+					  batch->compute_hash, chunk->hash);
+
+  silc_mutex_lock(batch->lock);
+  batch->done++;
+  silc_cond_signal(batch->cond);
+  silc_mutex_unlock(batch->lock);
+}
+
+/* Verifies many signatures */
+
+SilcUInt32 silc_pkcs_verify_batch(SilcPKCSVerifyEntry *entries,
+				  SilcUInt32 num_entries,
+				  SilcBool compute_hash,
+				  SilcHash hash,
+				  SilcThreadPool tp)
+{
+  struct SilcPKCSVerifyBatchStruct batch;
+  SilcPKCSVerifyBatchChunk *chunk;
+  SilcUInt32 num_chunks, valid = 0, i, n;
+
+  memset(&batch, 0, sizeof(batch));
+  batch.compute_hash = compute_hash;
+
+  num_chunks = num_entries / SILC_PKCS_VERIFY_BATCH_CHUNK;
+  if (num_chunks > SILC_PKCS_VERIFY_BATCH_MAX_CHUNKS)
+    num_chunks = SILC_PKCS_VERIFY_BATCH_MAX_CHUNKS;
+
+  if (tp && num_chunks > 1) {
+    batch.chunks = silc_calloc(num_chunks, sizeof(*batch.chunks));
+    if (batch.chunks && (!silc_mutex_alloc(&batch.lock) ||
+			 !silc_cond_alloc(&batch.cond))) {
+      if (batch.lock)
+	silc_mutex_free(batch.lock);
+      silc_free(batch.chunks);
+      batch.chunks = NULL;
+    }
+  }
+
+  /* Small batch is verified in this thread */
+  if (!batch.chunks)
+    return silc_pkcs_verify_entries(entries, num_entries, compute_hash, hash);
+
+  SILC_LOG_DEBUG(("Verify %d signatures in %d chunks", num_entries,
+		  num_chunks));
+
+  /* Divide the signatures evenly to the chunks */
+  for (i = 0; i < num_chunks; i++) {
+    chunk = &batch.chunks[i];
+    n = num_entries / num_chunks + (i < num_entries % num_chunks);
+    chunk->batch = &batch;
+    chunk->entries = entries;
+    chunk->num_entries = n;
+    chunk->hash = hash;
+    entries += n;
+  }
+
+  /* Run the chunks in threads.  The hash context cannot be shared between
+     threads, so each thread gets its own.  If there are no free threads,
+     the chunk is verified in this thread.  The first chunk is always
+     verified in this thread. */
+  for (i = 1; i < num_chunks; i++) {
+    chunk = &batch.chunks[i];
+    if (hash && !silc_hash_alloc(silc_hash_get_name(hash), &chunk->hash)) {
+      chunk->hash = hash;
+      continue;
+    }
+    chunk->thread = TRUE;
+    if (!silc_thread_pool_run(tp, FALSE, NULL,
+			      silc_pkcs_verify_batch_thread,
+			      chunk, NULL, NULL)) {
+      if (hash)
+	silc_hash_free(chunk->hash);
+      chunk->hash = hash;
+      chunk->thread = FALSE;
+    }
+  }
+  for (i = 0; i < num_chunks; i++)
+    if (!batch.chunks[i].thread)
+      silc_pkcs_verify_batch_thread(NULL, &batch.chunks[i]);
+
+  /* Wait for all chunks */
+  silc_mutex_lock(batch.lock);
+  while (batch.done < num_chunks)
+    silc_cond_wait(batch.cond, batch.lock);
+  silc_mutex_unlock(batch.lock);
+
+  for (i = 0; i < num_chunks; i++) {
+    chunk = &batch.chunks[i];
+    if (chunk->thread && hash)
+      silc_hash_free(chunk->hash);
+    valid += chunk->valid;
+  }
+
+  silc_cond_free(batch.cond);
+  silc_mutex_free(batch.lock);
+  silc_free(batch.chunks);
+
+  return valid;
 }
 
 /* Compares two public keys and returns TRUE if they are same key, and
@@ -988,6 +1880,11 @@ SilcBool silc_pkcs_public_key_compare(SilcPublicKey key1, SilcPublicKey key2)
   if (key1->pkcs->type != key2->pkcs->type)
     return FALSE;
 
+  /* Use cached digests if both have them */
+  if (silc_atomic_get_int32(&key1->digest_state) == SILC_PKCS_DIGEST_SET &&
+      silc_atomic_get_int32(&key2->digest_state) == SILC_PKCS_DIGEST_SET)
+    return !memcmp(key1->digest, key2->digest, sizeof(key1->digest));
+
   return key1->pkcs->public_key_compare(key1->pkcs,
 					key1->public_key, key2->public_key);
 }
@@ -1002,6 +1899,8 @@ SilcPublicKey silc_pkcs_public_key_copy(SilcPublicKey public_key)
     return NULL;
 
   key->pkcs = public_key->pkcs;
+  key->alg = public_key->alg;
+  key->verify_cache = public_key->verify_cache;
   key->public_key = public_key->pkcs->public_key_copy(public_key->pkcs,
 						      public_key->public_key);
   if (!key->public_key) {
@@ -1009,6 +1908,12 @@ SilcPublicKey silc_pkcs_public_key_copy(SilcPublicKey public_key)
     return NULL;
   }
 
+  if (silc_atomic_get_int32(&public_key->digest_state) ==
+      SILC_PKCS_DIGEST_SET) {
+    memcpy(key->digest, public_key->digest, sizeof(key->digest));
+    silc_atomic_set_int32(&key->digest_state, SILC_PKCS_DIGEST_SET);
+  }
+
   return key;
 }
 
@@ -1053,6 +1958,7 @@ SilcBool silc_pkcs_load_public_key(const char *filename,
 						   &public_key->public_key,
 						   &public_key->alg)) {
 	silc_free(data);
+	silc_pkcs_public_key_compute_digest(public_key);
 	return TRUE;
       }
 
@@ -1062,6 +1968,7 @@ SilcBool silc_pkcs_load_public_key(const char *filename,
 						   &public_key->public_key,
 						   &public_key->alg)) {
 	silc_free(data);
+	silc_pkcs_public_key_compute_digest(public_key);
 	return TRUE;
       }
     }
@@ -1082,6 +1989,7 @@ SilcBool silc_pkcs_load_public_key(const char *filename,
 						 &public_key->public_key,
 						 &public_key->alg)) {
       silc_free(data);
+      silc_pkcs_public_key_compute_digest(public_key);
       return TRUE;
     }
 
@@ -1091,6 +1999,7 @@ SilcBool silc_pkcs_load_public_key(const char *filename,
 						 &public_key->public_key,
 						 &public_key->alg)) {
       silc_free(data);
+      silc_pkcs_public_key_compute_digest(public_key);
       return TRUE;
     }
   }
@@ -1281,25 +2190,14 @@ SilcBool silc_pkcs_save_private_key(const char *filename,
 
 SilcUInt32 silc_hash_public_key(void *key, void *user_context)
 {
-  SilcPublicKey public_key = key;
-  unsigned char *pk;
-  SilcUInt32 pk_len;
-  SilcUInt32 hash = 0;
-  SilcStack stack = NULL;
-
-  if (silc_crypto_stack())
-    stack = silc_stack_alloc(2048, silc_crypto_stack());
+  const unsigned char *digest;
+  SilcUInt32 hash;
 
-  pk = silc_pkcs_public_key_encode(stack, public_key, &pk_len);
-  if (!pk) {
-    silc_stack_free(stack);
-    return hash;
-  }
+  digest = silc_pkcs_public_key_get_digest(key);
+  if (!digest)
+    return 0;
 
-  hash = silc_hash_data(pk, SILC_32_TO_PTR(pk_len));
-
-  silc_sfree(stack, pk);
-  silc_stack_free(stack);
+  SILC_GET32_MSB(hash, digest);
 
   return hash;
 }
@@ -1310,5 +2208,16 @@ SilcUInt32 silc_hash_public_key(void *key, void *user_context)
 SilcBool silc_hash_public_key_compare(void *key1, void *key2,
 				      void *user_context)
 {
-  return silc_pkcs_public_key_compare(key1, key2);
+  SilcPublicKey public_key1 = key1, public_key2 = key2;
+  const unsigned char *d1, *d2;
+
+  if (public_key1->pkcs->type != public_key2->pkcs->type)
+    return FALSE;
+
+  d1 = silc_pkcs_public_key_get_digest(public_key1);
+  d2 = silc_pkcs_public_key_get_digest(public_key2);
+  if (!d1 || !d2)
+    return silc_pkcs_public_key_compare(public_key1, public_key2);
+
+  return !memcmp(d1, d2, SILC_PKCS_DIGEST_LEN);
 }
@@ -100,6 +100,8 @@ typedef enum {
  */
 #define SILC_PKCS_ALG_RSA    "rsa"         /* RSA algorithm */
 #define SILC_PKCS_ALG_DSA    "dsa"	   /* DSA algorithm */
+#define SILC_PKCS_ALG_ECDSA  "ecdsa"	   /* ECDSA algorithm */
+#define SILC_PKCS_ALG_ED25519 "ed25519"	   /* Ed25519 algorithm */
 /***/
 
 /****d* silccrypt/PKCS-Schemes
@@ -129,6 +131,31 @@ typedef enum {
    SILC_PKCS_ALG_RSA.  Default hash function used with signatures is SHA-1. */
 #define SILC_PKCS_SCHEME_PKCS1_NO_OID   "pkcs1-no-oid"
 
+/* PKCS #1 version 2.1 multi-prime RSA.  Same as SILC_PKCS_SCHEME_PKCS1 but
+   the generated key has three primes, which makes the private key
+   operations faster.  The key length must be at least 4096 bits.  This can
+   be used with SILC_PKCS_ALG_RSA.  Multi-prime keys cannot be saved in
+   SILC or OpenPGP key formats. */
+#define SILC_PKCS_SCHEME_PKCS1_MP3      "pkcs1-mp3"
+
+/* PKCS #1 version 2.1 multi-prime RSA.  Same as SILC_PKCS_SCHEME_PKCS1_MP3
+   but the generated key has four primes.  The key length must be at least
+   8192 bits. */
+#define SILC_PKCS_SCHEME_PKCS1_MP4      "pkcs1-mp4"
+
+/* PKCS #1 version 2.1 RSASSA-PSS.  Signatures are computed with the
+   probabilistic signature scheme with MGF1 and salt as long as the digest.
+   Any salt length is accepted in verification.  Encryption is done as with
+   SILC_PKCS_SCHEME_PKCS1.  This can be used with SILC_PKCS_ALG_RSA.
+   Default hash function used with signatures is SHA-1. */
+#define SILC_PKCS_SCHEME_PKCS1_PSS      "pkcs1-pss"
+
+/* PKCS #1 version 2.1 RSAES-OAEP.  Encryption is done with optimal
+   asymmetric encryption padding with MGF1, SHA-1 and empty label.
+   Signatures are computed as with SILC_PKCS_SCHEME_PKCS1.  This can be
+   used with SILC_PKCS_ALG_RSA. */
+#define SILC_PKCS_SCHEME_PKCS1_OAEP     "pkcs1-oaep"
+
 /* The Digital Signature Standard, FIPS 186-3.  The latest DSS standard
    version.  The key parameters and hash function used are derived
    automatically by the key length and the signature length is variable.
@@ -143,10 +170,22 @@ typedef enum {
    necessarily create compatible signature. */
 #define SILC_PKCS_SCHEME_DSS_FIPS186_2  "dss-fips186-2"
 
+/* The Elliptic Curve Digital Signature Algorithm, FIPS 186-3, with the
+   NIST P-256 and P-384 curves.  The curve is selected by the key length,
+   256 or 384 bits.  The default hash function is SHA-256 with P-256 and
+   SHA-384 with P-384.  This can be used with SILC_PKCS_ALG_ECDSA. */
+#define SILC_PKCS_SCHEME_ECDSA          "ecdsa"
+
+/* The Edwards-curve Digital Signature Algorithm Ed25519, RFC 8032.  The
+   key length is always 256 bits.  The signature is computed over the data
+   itself with SHA-512 and the hash function given to the signature
+   functions is ignored.  This can be used with SILC_PKCS_ALG_ED25519. */
+#define SILC_PKCS_SCHEME_ED25519        "ed25519"
+
 #ifdef SILC_DIST_SSH
-/* The SSH2 protocol scheme.  This can be used with SILC_PKCS_ALG_RSA and
-   SILC_PKCS_ALG_DSA.  When used the algorithms behave as defined in the
-   SSH2 protocol. */
+/* The SSH2 protocol scheme.  This can be used with SILC_PKCS_ALG_RSA,
+   SILC_PKCS_ALG_DSA, SILC_PKCS_ALG_ECDSA and SILC_PKCS_ALG_ED25519.  When
+   used the algorithms behave as defined in the SSH2 protocol. */
 #define SILC_PKCS_SCHEME_SSH            "ssh"
 #endif /* SILC_DIST_SSH */
 
@@ -158,6 +197,22 @@ typedef enum {
 #endif /* SILC_DIST_PGP */
 /***/
 
+/****d* silccrypt/SILC_PKCS_DIGEST_LEN
+ *
+ * NAME
+ *
+ *    #define SILC_PKCS_DIGEST_LEN 32
+ *
+ * DESCRIPTION
+ *
+ *    Length of the public key digest.  The digest is SHA-256 of the
+ *    encoded public key.
+ *
+ * SOURCE
+ */
+#define SILC_PKCS_DIGEST_LEN 32
+/***/
+
 /****s* silccrypt/SilcPublicKey
  *
  * NAME
@@ -167,10 +222,14 @@ typedef enum {
  * DESCRIPTION
  *
  *    This context represents any kind of PKCS public key.  It can be
- *    allocated by silc_pkcs_public_key_alloc or silc_pkcs_load_public_key
- *    and is freed by the silc_pkcs_public_key_free.  The PKCS specific
- *    public key context can be retrieved by calling
- *    silc_pkcs_public_key_get_pkcs.
+ *    allocated by silc_pkcs_public_key_alloc, silc_pkcs_public_key_view
+ *    or silc_pkcs_load_public_key and is freed by the
+ *    silc_pkcs_public_key_free.  The PKCS specific public key context can
+ *    be retrieved by calling silc_pkcs_public_key_get_pkcs.  The `digest'
+ *    is the cached digest of the encoded public key, see
+ *    silc_pkcs_public_key_get_digest.  The `digest_state' is one of
+ *    SILC_PKCS_DIGEST_NONE, SILC_PKCS_DIGEST_BUSY or SILC_PKCS_DIGEST_SET
+ *    and is zero when the context is allocated with silc_calloc.
  *
  * SOURCE
  */
@@ -178,9 +237,17 @@ typedef struct SilcPublicKeyStruct {
   SilcPKCSObject *pkcs;		/* PKCS */
   const SilcPKCSAlgorithm *alg;	/* PKCS algorithm */
   void *public_key;		/* PKCS specific public key */
+  unsigned char digest[SILC_PKCS_DIGEST_LEN]; /* Digest of encoded key */
+  SilcAtomic32 digest_state;	/* State of `digest' */
+  unsigned int verify_cache : 1;	/* Use verification cache */
 } *SilcPublicKey;
 /***/
 
+/* Public key digest states */
+#define SILC_PKCS_DIGEST_NONE 0	/* Not computed */
+#define SILC_PKCS_DIGEST_BUSY 1	/* Being stored */
+#define SILC_PKCS_DIGEST_SET  2	/* Computed */
+
 /****s* silccrypt/SilcPrivateKey
  *
  * NAME
@@ -518,6 +585,40 @@ SilcBool silc_pkcs_public_key_alloc(SilcPKCSType type,
 				    SilcUInt32 key_len,
 				    SilcPublicKey *ret_public_key);
 
+/****f* silccrypt/silc_pkcs_public_key_view
+ *
+ * SYNOPSIS
+ *
+ *    SilcBool silc_pkcs_public_key_view(SilcPKCSType type,
+ *                                       unsigned char *key,
+ *                                       SilcUInt32 key_len
+ *                                       SilcPublicKey *ret_public_key);
+ *
+ * DESCRIPTION
+ *
+ *    Same as silc_pkcs_public_key_alloc but the returned public key
+ *    borrows the `key' buffer instead of duplicating its contents.  Only
+ *    the algorithm key needed by the public key operations, such as the
+ *    RSA modulus and exponent, is decoded.  This is intended for keys
+ *    that are used once, for example to verify a signature, and then
+ *    freed.
+ *
+ *    The `key' must remain valid and unmodified until the returned key
+ *    is freed by silc_pkcs_public_key_free.  The SILC public key identifier
+ *    of a borrowed key is not decoded and the identifier fields of the
+ *    SilcSILCPublicKey are NULL.  Use silc_pkcs_public_key_copy to get a
+ *    key that owns all of its data and has the identifier decoded, for
+ *    example before adding the key to a key repository.
+ *
+ *    Currently only SILC_PKCS_SILC keys are borrowed.  With other types
+ *    this is equivalent to silc_pkcs_public_key_alloc.
+ *
+ ***/
+SilcBool silc_pkcs_public_key_view(SilcPKCSType type,
+				   unsigned char *key,
+				   SilcUInt32 key_len,
+				   SilcPublicKey *ret_public_key);
+
 /****f* silccrypt/silc_pkcs_public_key_free
  *
  * SYNOPSIS
@@ -568,6 +669,62 @@ unsigned char *silc_pkcs_public_key_encode(SilcStack stack,
  ***/
 SilcUInt32 silc_pkcs_public_key_get_len(SilcPublicKey public_key);
 
+/****f* silccrypt/silc_pkcs_public_key_get_digest
+ *
+ * SYNOPSIS
+ *
+ *    const unsigned char *
+ *    silc_pkcs_public_key_get_digest(SilcPublicKey public_key);
+ *
+ * DESCRIPTION
+ *
+ *    Returns the digest of the encoded public key.  The digest is
+ *    SILC_PKCS_DIGEST_LEN bytes long.  Returns NULL if the key could not
+ *    be encoded.  Two public keys of same PKCS type are equal if their
+ *    digests are equal.
+ *
+ *    The digest is computed when the public key is allocated, generated
+ *    or loaded.  With keys from silc_pkcs_public_key_view, which does not
+ *    encode the key, it is computed and cached on first call.  This is
+ *    safe to call from multiple threads with a shared key.  The
+ *    silc_hash_public_key and silc_hash_public_key_compare use the digest.
+ *
+ ***/
+const unsigned char *silc_pkcs_public_key_get_digest(SilcPublicKey public_key);
+
+/****f* silccrypt/silc_pkcs_public_key_compute_digest
+ *
+ * SYNOPSIS
+ *
+ *    SilcBool silc_pkcs_public_key_compute_digest(SilcPublicKey public_key);
+ *
+ * DESCRIPTION
+ *
+ *    Computes the digest of the encoded public key and caches it in the
+ *    `public_key'.  Returns FALSE if the key could not be encoded.  The
+ *    library calls this when it creates public keys.  Applications that
+ *    modify the underlying key after creation must call this before the
+ *    key is shared.
+ *
+ ***/
+SilcBool silc_pkcs_public_key_compute_digest(SilcPublicKey public_key);
+
+/****f* silccrypt/silc_pkcs_public_key_get_fingerprint
+ *
+ * SYNOPSIS
+ *
+ *    char *silc_pkcs_public_key_get_fingerprint(SilcPublicKey public_key);
+ *
+ * DESCRIPTION
+ *
+ *    Returns the textual fingerprint of the public key digest, as returned
+ *    by silc_pkcs_public_key_get_digest.  The key is not encoded or hashed
+ *    again once the digest is cached.  Returns NULL if the key could not
+ *    be encoded.  The caller must free the returned string.
+ *
+ ***/
+char *silc_pkcs_public_key_get_fingerprint(SilcPublicKey public_key);
+
 /****f* silccrypt/silc_pkcs_public_key_compare
  *
  * SYNOPSIS
@@ -767,6 +924,11 @@ silc_pkcs_decrypt_async(SilcPrivateKey private_key,
  *    should always be provided.  The length of the signature is returned
  *    to `dst_len' is it is non-NULL.
  *
+ *    With DSA and ECDSA the `rng' may be NULL.  In this case the
+ *    signature nonce is derived from the private key and the message
+ *    digest as defined in RFC 6979, and the same data always results in
+ *    the same signature.
+ *
  *    This call cannot be used if `public_key' is accelerated.  All
  *    accelerators are usually asynchronous and the function will return
  *    before the signagture has been done.  In this case the
@@ -798,9 +960,10 @@ SilcBool silc_pkcs_sign(SilcPrivateKey private_key,
  *    to deliver the signature data.  If `compute_hash' is TRUE the `hash'
  *    will be used to compute a message digest over the `src'.  The `hash'
  *    is NULL the default hash function is used.  The `rng' should always
- *    be provided.  The signature operation may be asynchronous if the
- *    `private_key' is accelerated private key.  If this returns NULL the
- *    asynchronous operation cannot be controlled.
+ *    be provided, except with DSA and ECDSA, see silc_pkcs_sign.  The
+ *    signature operation may be asynchronous if the `private_key' is
+ *    accelerated private key.  If this returns NULL the asynchronous
+ *    operation cannot be controlled.
  *
  ***/
 SilcAsyncOperation silc_pkcs_sign_async(SilcPrivateKey private_key,
@@ -812,6 +975,43 @@ SilcAsyncOperation silc_pkcs_sign_async(SilcPrivateKey private_key,
 					SilcPKCSSignCb sign_cb,
 					void *context);
 
+/****f* silccrypt/silc_pkcs_sign_hash
+ *
+ * SYNOPSIS
+ *
+ *    SilcBool silc_pkcs_sign_hash(SilcPrivateKey private_key,
+ *                                 SilcHash hash,
+ *                                 unsigned char *dst, SilcUInt32 dst_size,
+ *                                 SilcUInt32 *dst_len, SilcRng rng);
+ *
+ * DESCRIPTION
+ *
+ *    Computes signature of the message digest in `hash' with the private
+ *    key.  The data to be signed must have been added to the `hash' with
+ *    silc_hash_init and silc_hash_update.  This function finalizes the
+ *    digest and signs it.  This way data that does not fit in memory can
+ *    be signed by adding it to the `hash' in pieces.  The signature is
+ *    same as with silc_pkcs_sign when `compute_hash' is TRUE and the same
+ *    `hash' is used, except with Ed25519 which signs the digest.  The
+ *    `rng' should always be provided, except with DSA and ECDSA, see
+ *    silc_pkcs_sign.  The length of the signature is returned to
+ *    `dst_len' if it is non-NULL.
+ *
+ *    This call cannot be used if `private_key' is accelerated.
+ *
+ * EXAMPLE
+ *
+ *    silc_hash_init(hash);
+ *    while ((len = read(fd, buf, sizeof(buf))) > 0)
+ *      silc_hash_update(hash, buf, len);
+ *    silc_pkcs_sign_hash(private_key, hash, sig, sizeof(sig), &sig_len, rng);
+ *
+ ***/
+SilcBool silc_pkcs_sign_hash(SilcPrivateKey private_key,
+			     SilcHash hash,
+			     unsigned char *dst, SilcUInt32 dst_size,
+			     SilcUInt32 *dst_len, SilcRng rng);
+
 /****f* silccrypt/silc_pkcs_verify
  *
  * SYNOPSIS
@@ -882,6 +1082,172 @@ SilcAsyncOperation silc_pkcs_verify_async(SilcPublicKey public_key,
 					  SilcPKCSVerifyCb verify_cb,
 					  void *context);
 
+/****f* silccrypt/silc_pkcs_verify_hash
+ *
+ * SYNOPSIS
+ *
+ *    SilcBool silc_pkcs_verify_hash(SilcPublicKey public_key,
+ *                                   unsigned char *signature,
+ *                                   SilcUInt32 signature_len,
+ *                                   SilcHash hash);
+ *
+ * DESCRIPTION
+ *
+ *    Verifies signature of the message digest in `hash'.  The signed data
+ *    must have been added to the `hash' with silc_hash_init and
+ *    silc_hash_update.  This function finalizes the digest and verifies
+ *    the `signature' against it.  This is the counterpart of
+ *    silc_pkcs_sign_hash.
+ *
+ *    This call cannot be used if `public_key' is accelerated.
+ *
+ ***/
+SilcBool silc_pkcs_verify_hash(SilcPublicKey public_key,
+			       unsigned char *signature,
+			       SilcUInt32 signature_len,
+			       SilcHash hash);
+
+/****s* silccrypt/SilcPKCSVerifyEntry
+ *
+ * NAME
+ *
+ *    typedef struct { ... } SilcPKCSVerifyEntry;
+ *
+ * DESCRIPTION
+ *
+ *    One signature to be verified with silc_pkcs_verify_batch.  The
+ *    `success' is set by silc_pkcs_verify_batch to the result of the
+ *    verification.
+ *
+ * SOURCE
+ */
+typedef struct SilcPKCSVerifyEntryStruct {
+  SilcPublicKey public_key;	/* Public key */
+  unsigned char *signature;	/* Signature */
+  SilcUInt32 signature_len;	/* Signature length */
+  unsigned char *data;		/* Signed data */
+  SilcUInt32 data_len;		/* Data length */
+  SilcBool success;		/* Set to the result of verification */
+} SilcPKCSVerifyEntry;
+/***/
+
+/****s* silccrypt/SilcPKCSVerifyCacheStats
+ *
+ * NAME
+ *
+ *    typedef struct { ... } SilcPKCSVerifyCacheStats;
+ *
+ * DESCRIPTION
+ *
+ *    Statistics of the signature verification cache, returned by
+ *    silc_pkcs_verify_cache_get_stats.
+ *
+ * SOURCE
+ */
+typedef struct SilcPKCSVerifyCacheStatsStruct {
+  SilcUInt32 size;		/* Maximum number of entries */
+  SilcUInt32 count;		/* Current number of entries */
+  SilcUInt64 hits;		/* Verifications found in cache */
+  SilcUInt64 misses;		/* Verifications not found in cache */
+} SilcPKCSVerifyCacheStats;
+/***/
+
+/****f* silccrypt/silc_pkcs_verify_batch
+ *
+ * SYNOPSIS
+ *
+ *    SilcUInt32 silc_pkcs_verify_batch(SilcPKCSVerifyEntry *entries,
+ *                                      SilcUInt32 num_entries,
+ *                                      SilcBool compute_hash,
+ *                                      SilcHash hash,
+ *                                      SilcThreadPool tp);
+ *
+ * DESCRIPTION
+ *
+ *    Verifies `num_entries' signatures in the `entries' array.  The
+ *    `compute_hash' and `hash' are used as in silc_pkcs_verify for each
+ *    signature.  The result of each verification is set to the `success'
+ *    of its entry.  Returns the number of valid signatures.
+ *
+ *    If `tp' is non-NULL large batches are split into chunks that are
+ *    verified in parallel in the threads of the thread pool.  If there are
+ *    no free threads the chunk is verified in the calling thread.  This
+ *    returns after all signatures have been verified.
+ *
+ *    Ed25519 signatures of SILC public keys are verified together with
+ *    one batch equation, which is several times faster than verifying
+ *    them one by one.  The other signatures are verified one by one.  All
+ *    signatures use the verification cache, see silc_pkcs_verify_cache_set.
+ *
+ *    This call cannot be used if any of the public keys is accelerated.
+ *
+ ***/
+SilcUInt32 silc_pkcs_verify_batch(SilcPKCSVerifyEntry *entries,
+				  SilcUInt32 num_entries,
+				  SilcBool compute_hash,
+				  SilcHash hash,
+				  SilcThreadPool tp);
+
+/****f* silccrypt/silc_pkcs_verify_cache_set
+ *
+ * SYNOPSIS
+ *
+ *    SilcBool silc_pkcs_verify_cache_set(SilcUInt32 size,
+ *                                        SilcBool all_keys);
+ *
+ * DESCRIPTION
+ *
+ *    Enables the signature verification cache.  The cache remembers at
+ *    most `size' recent successful verifications.  When it is full, the
+ *    least recently used entry is removed.  A cached verification is
+ *    identified by the public key digest, the signature, the signed data
+ *    and the hash arguments.  The silc_pkcs_verify and
+ *    silc_pkcs_verify_async return success for a cached verification
+ *    without verifying the signature again.  Failed verifications are
+ *    not cached.
+ *
+ *    If `all_keys' is TRUE the cache is used with all public keys.
+ *    Otherwise it is used only with keys for which it has been enabled by
+ *    silc_pkcs_public_key_set_verify_cache.  If `size' is 0 the cache is
+ *    disabled and freed.  The cache may be used from many threads.  The
+ *    size of an enabled cache may be changed while verifications are in
+ *    progress, but the cache must not be enabled or disabled then.
+ *    Returns FALSE on error.
+ *
+ ***/
+SilcBool silc_pkcs_verify_cache_set(SilcUInt32 size, SilcBool all_keys);
+
+/****f* silccrypt/silc_pkcs_verify_cache_get_stats
+ *
+ * SYNOPSIS
+ *
+ *    void silc_pkcs_verify_cache_get_stats(SilcPKCSVerifyCacheStats *stats);
+ *
+ * DESCRIPTION
+ *
+ *    Returns the statistics of the signature verification cache into
+ *    `stats'.  All values are zero if the cache is not enabled.
+ *
+ ***/
+void silc_pkcs_verify_cache_get_stats(SilcPKCSVerifyCacheStats *stats);
+
+/****f* silccrypt/silc_pkcs_public_key_set_verify_cache
+ *
+ * SYNOPSIS
+ *
+ *    void silc_pkcs_public_key_set_verify_cache(SilcPublicKey public_key,
+ *                                               SilcBool enable);
+ *
+ * DESCRIPTION
+ *
+ *    Enables or disables the signature verification cache for the
+ *    `public_key'.  This has effect only when the cache has been enabled
+ *    with silc_pkcs_verify_cache_set.
+ *
+ ***/
+void silc_pkcs_public_key_set_verify_cache(SilcPublicKey public_key,
+					   SilcBool enable);
+
 /****f* silccrypt/silc_pkcs_public_key_get_pkcs
  *
  * SYNOPSIS
@@ -171,51 +171,508 @@ SilcBool silc_pkcs1_decode(SilcPkcs1BlockType bt,
   return TRUE;
 }
 
+/* Returns the hash function used in signatures and RSAES-OAEP.  The
+   `hash' is used if it is set.  Otherwise context of the default hash of
+   the key, or SHA-1 if the key has none, is taken from the thread's cache
+   into `ihash', which the caller must return with
+   silc_crypto_thread_hash_put.  The context of the key is not used as the
+   key may be used in many threads at the same time. */
+
+static SilcHash silc_pkcs1_get_hash(SilcHash hash, SilcHash key_hash,
+				    SilcHash *ihash)
+{
+  *ihash = NULL;
+
+  if (hash)
+    return hash;
+  if (!silc_crypto_thread_hash_get(key_hash ?
+				   silc_hash_get_name(key_hash) : "sha1",
+				   ihash))
+    return NULL;
+
+  return *ihash;
+}
+
+/* MGF1 mask generation function.  Generates mask from the `seed' with
+   `hash' and XORs it to the `data'. */
+
+static void silc_pkcs1_mgf1(SilcHash hash, const unsigned char *seed,
+			    SilcUInt32 seed_len, unsigned char *data,
+			    SilcUInt32 data_len)
+{
+  unsigned char mask[SILC_HASH_MAXLEN], counter[4];
+  SilcUInt32 hash_len = silc_hash_len(hash), i, k, c, len;
+
+  for (c = 0, i = 0; i < data_len; c++, i += len) {
+    SILC_PUT32_MSB(c, counter);
+    silc_hash_init(hash);
+    silc_hash_update(hash, seed, seed_len);
+    silc_hash_update(hash, counter, sizeof(counter));
+    silc_hash_final(hash, mask);
+
+    len = data_len - i < hash_len ? data_len - i : hash_len;
+    for (k = 0; k < len; k++)
+      data[i + k] ^= mask[k];
+  }
+
+  memset(mask, 0, sizeof(mask));
+}
+
+/* Computes H = Hash(0x00 x 8 || mHash || salt) of EMSA-PSS */
+
+static void silc_pkcs1_pss_hash(SilcHash hash, const unsigned char *mhash,
+				const unsigned char *salt,
+				SilcUInt32 salt_len, unsigned char *h)
+{
+  static const unsigned char zero[8] = { 0 };
+
+  silc_hash_init(hash);
+  silc_hash_update(hash, zero, sizeof(zero));
+  silc_hash_update(hash, mhash, silc_hash_len(hash));
+  silc_hash_update(hash, salt, salt_len);
+  silc_hash_final(hash, h);
+}
+
+/* EMSA-PSS encoding of RSASSA-PSS signature.  Encodes the message digest
+   `mhash' computed with `hash' into `em' which is (`em_bits' + 7) / 8
+   bytes long.  The `em_bits' is one less than the bit length of the
+   modulus.  The salt is as long as the digest. */
+
+static SilcBool silc_pkcs1_pss_encode(SilcHash hash,
+				      const unsigned char *mhash,
+				      SilcUInt32 mhash_len,
+				      unsigned char *em, SilcUInt32 em_bits,
+				      SilcRng rng)
+{
+  SilcUInt32 em_len = (em_bits + 7) / 8, hash_len = silc_hash_len(hash);
+  SilcUInt32 salt_len = hash_len, db_len, i;
+  unsigned char *salt, *h;
+
+  SILC_LOG_DEBUG(("EMSA-PSS encoding"));
+
+  if (!rng) {
+    SILC_LOG_ERROR(("Cannot sign: random number generator not provided"));
+    return FALSE;
+  }
+
+  if (mhash_len != hash_len || em_len < hash_len + salt_len + 2) {
+    SILC_LOG_DEBUG(("Data to be encoded is too long"));
+    return FALSE;
+  }
+  db_len = em_len - hash_len - 1;
+  salt = em + db_len - salt_len;
+  h = em + db_len;
+
+  /* DB = PS || 0x01 || salt */
+  memset(em, 0, db_len - salt_len - 1);
+  em[db_len - salt_len - 1] = 0x01;
+  for (i = 0; i < salt_len; i++)
+    salt[i] = silc_rng_get_byte_fast(rng);
+
+  /* H = Hash(M'), maskedDB = DB xor MGF1(H) */
+  silc_pkcs1_pss_hash(hash, mhash, salt, salt_len, h);
+  silc_pkcs1_mgf1(hash, h, hash_len, em, db_len);
+
+  em[0] &= 0xff >> (8 * em_len - em_bits);
+  em[em_len - 1] = 0xbc;
+
+  return TRUE;
+}
+
+/* EMSA-PSS verification of RSASSA-PSS signature.  Verifies that the
+   encoded message `em', which is (`em_bits' + 7) / 8 bytes long, matches
+   the message digest `mhash' computed with `hash'.  Any salt length is
+   accepted.  The `em' is modified. */
+
+static SilcBool silc_pkcs1_pss_verify(SilcHash hash,
+				      const unsigned char *mhash,
+				      SilcUInt32 mhash_len,
+				      unsigned char *em, SilcUInt32 em_bits)
+{
+  SilcUInt32 em_len = (em_bits + 7) / 8, hash_len = silc_hash_len(hash);
+  SilcUInt32 db_len, i;
+  unsigned char h[SILC_HASH_MAXLEN], mask;
+
+  SILC_LOG_DEBUG(("EMSA-PSS verification"));
+
+  if (mhash_len != hash_len || em_len < hash_len + 2) {
+    SILC_LOG_DEBUG(("Malformed block"));
+    return FALSE;
+  }
+  db_len = em_len - hash_len - 1;
+  mask = 0xff >> (8 * em_len - em_bits);
+
+  if (em[em_len - 1] != 0xbc || (em[0] & ~mask)) {
+    SILC_LOG_DEBUG(("Malformed block"));
+    return FALSE;
+  }
+
+  /* DB = maskedDB xor MGF1(H) */
+  silc_pkcs1_mgf1(hash, em + db_len, hash_len, em, db_len);
+  em[0] &= mask;
+
+  /* DB = PS || 0x01 || salt */
+  for (i = 0; i < db_len; i++)
+    if (em[i] != 0x00)
+      break;
+  if (i >= db_len || em[i++] != 0x01) {
+    SILC_LOG_DEBUG(("Malformed block"));
+    return FALSE;
+  }
+
+  /* Compare H */
+  silc_pkcs1_pss_hash(hash, mhash, em + i, db_len - i, h);
+  if (memcmp(h, em + db_len, hash_len))
+    return FALSE;
+
+  return TRUE;
+}
+
+/* EME-OAEP encoding of RSAES-OAEP encryption block with empty label.
+   Encodes the `data' into `em' which is `em_len' bytes long. */
+
+static SilcBool silc_pkcs1_oaep_encode(SilcHash hash,
+				       const unsigned char *data,
+				       SilcUInt32 data_len,
+				       unsigned char *em, SilcUInt32 em_len,
+				       SilcRng rng)
+{
+  SilcUInt32 hash_len = silc_hash_len(hash), db_len, i;
+  unsigned char *seed, *db;
+
+  SILC_LOG_DEBUG(("EME-OAEP encoding"));
+
+  if (!rng) {
+    SILC_LOG_ERROR(("Cannot encrypt: random number generator not provided"));
+    return FALSE;
+  }
+
+  if (em_len < 2 * hash_len + 2 || data_len > em_len - 2 * hash_len - 2) {
+    SILC_LOG_DEBUG(("Data to be encoded is too long"));
+    return FALSE;
+  }
+  seed = em + 1;
+  db = em + 1 + hash_len;
+  db_len = em_len - hash_len - 1;
+
+  /* DB = lHash || PS || 0x01 || M */
+  silc_hash_init(hash);
+  silc_hash_final(hash, db);
+  memset(db + hash_len, 0, db_len - hash_len - data_len - 1);
+  db[db_len - data_len - 1] = 0x01;
+  memcpy(db + db_len - data_len, data, data_len);
+
+  /* maskedDB = DB xor MGF1(seed), maskedSeed = seed xor MGF1(maskedDB) */
+  for (i = 0; i < hash_len; i++)
+    seed[i] = silc_rng_get_byte_fast(rng);
+  silc_pkcs1_mgf1(hash, seed, hash_len, db, db_len);
+  silc_pkcs1_mgf1(hash, db, db_len, seed, hash_len);
+
+  em[0] = 0x00;
+
+  return TRUE;
+}
+
+/* EME-OAEP decoding of RSAES-OAEP encryption block with empty label.
+   Decodes the `em' of `em_len' bytes into `dest_data'.  The padding is
+   checked without revealing which part of it is invalid.  The `em' is
+   modified. */
+
+static SilcBool silc_pkcs1_oaep_decode(SilcHash hash,
+				       unsigned char *em, SilcUInt32 em_len,
+				       unsigned char *dest_data,
+				       SilcUInt32 dest_data_size,
+				       SilcUInt32 *dest_len)
+{
+  SilcUInt32 hash_len = silc_hash_len(hash), db_len, i;
+  SilcUInt32 index = 0, found = 0, one, zero, bad;
+  unsigned char lhash[SILC_HASH_MAXLEN], *seed, *db;
+
+  SILC_LOG_DEBUG(("EME-OAEP decoding"));
+
+  if (em_len < 2 * hash_len + 2) {
+    SILC_LOG_DEBUG(("Malformed block"));
+    return FALSE;
+  }
+  seed = em + 1;
+  db = em + 1 + hash_len;
+  db_len = em_len - hash_len - 1;
+
+  /* seed = maskedSeed xor MGF1(maskedDB), DB = maskedDB xor MGF1(seed) */
+  silc_pkcs1_mgf1(hash, db, db_len, seed, hash_len);
+  silc_pkcs1_mgf1(hash, seed, hash_len, db, db_len);
+
+  /* Check Y and lHash */
+  silc_hash_init(hash);
+  silc_hash_final(hash, lhash);
+  bad = em[0];
+  for (i = 0; i < hash_len; i++)
+    bad |= db[i] ^ lhash[i];
+
+  /* Find the 0x01 after PS */
+  for (i = hash_len; i < db_len; i++) {
+    one = (db[i] == 0x01);
+    zero = (db[i] == 0x00);
+    index |= (i + 1) & (0 - (one & ~found & 1));
+    bad |= ~found & ~one & ~zero & 1;
+    found |= one;
+  }
+  bad |= ~found & 1;
+
+  if (bad) {
+    SILC_LOG_DEBUG(("Malformed block"));
+    return FALSE;
+  }
+  if (dest_data_size < db_len - index) {
+    SILC_LOG_DEBUG(("Destination buffer too small"));
+    return FALSE;
+  }
+
+  /* Copy the data */
+  memcpy(dest_data, db + index, db_len - index);
+
+  /* Return data length */
+  if (dest_len)
+    *dest_len = db_len - index;
+
+  return TRUE;
+}
+
 
 /***************************** PKCS #1 PKCS API ******************************/
 
-/* Generates RSA key pair. */
+typedef struct SilcPkcs1KeygenStruct *SilcPkcs1Keygen;
+
+/* Search of one prime in key generation */
+typedef struct {
+  SilcPkcs1Keygen keygen;
+  SilcMPInt *prime;
+  SilcRng rng;				/* RNG of this search */
+  SilcUInt32 bits;
+  SilcBool success;
+  unsigned int thread : 1;		/* Set when run in thread */
+} SilcPkcs1PrimeSearch;
+
+/* Key generation context */
+struct SilcPkcs1KeygenStruct {
+  SilcMutex lock;
+  SilcCond cond;
+  SilcThreadPool tp;
+  SilcUInt32 threads;			/* Threads for each prime search */
+  SilcUInt32 done;			/* Number of searches done */
+};
+
+/* Finds one prime of the key */
+
+static void silc_pkcs1_prime_search(SilcSchedule schedule, void *context)
+{
+  SilcPkcs1PrimeSearch *search = context;
+  SilcPkcs1Keygen keygen = search->keygen;
+
+  search->success = silc_math_gen_prime_ext(search->prime, search->bits, 0,
+					    search->rng, keygen->tp,
+					    keygen->threads, NULL, NULL);
+
+  silc_mutex_lock(keygen->lock);
+  keygen->done++;
+  if (keygen->cond)
+    silc_cond_signal(keygen->cond);
+  silc_mutex_unlock(keygen->lock);
+}
 
-SILC_PKCS_ALG_GENERATE_KEY(silc_pkcs1_generate_key)
+/* Finds the primes `primes' of the key.  If the software accelerator is
+   initialized the primes are searched in parallel in its thread pool,
+   each with its own RNG seeded from `rng', as RNG cannot be shared
+   between threads.  The first prime is searched in this thread. */
+
+static SilcBool silc_pkcs1_generate_primes(SilcMPInt *primes,
+					   SilcUInt32 num_primes,
+					   SilcUInt32 keylen, SilcRng rng)
 {
-  SilcUInt32 prime_bits = keylen / 2;
-  SilcMPInt p, q;
-  SilcBool found = FALSE;
+  struct SilcPkcs1KeygenStruct keygen;
+  SilcPkcs1PrimeSearch searches[SILC_RSA_MAX_PRIMES], *search;
+  unsigned char seed[64];
+  SilcUInt32 i;
+  SilcBool ret = TRUE;
+
+  memset(&keygen, 0, sizeof(keygen));
+  memset(searches, 0, sizeof(searches));
+  keygen.threads = 1;
+
+#ifdef SILC_DIST_SOFTACC
+  keygen.tp = silc_softacc_get_thread_pool(&keygen.threads);
+  if (keygen.tp && (!silc_mutex_alloc(&keygen.lock) ||
+		    !silc_cond_alloc(&keygen.cond))) {
+    if (keygen.lock)
+      silc_mutex_free(keygen.lock);
+    keygen.lock = NULL;
+    keygen.tp = NULL;
+  }
+  if (!keygen.tp)
+    keygen.threads = 1;
+  keygen.threads /= num_primes;
+  if (!keygen.threads)
+    keygen.threads = 1;
+#endif /* SILC_DIST_SOFTACC */
+
+  SILC_LOG_DEBUG(("Searching %d primes, %d threads each", num_primes,
+		  keygen.threads));
+
+  /* Split the key length to the primes, last one gets the remainder */
+  for (i = 0; i < num_primes; i++) {
+    search = &searches[i];
+    search->keygen = &keygen;
+    search->prime = &primes[i];
+    search->rng = rng;
+    search->bits = keylen / num_primes;
+    if (i == num_primes - 1)
+      search->bits += keylen % num_primes;
+  }
+
+  /* Run the searches in threads.  If there are no free threads, the
+     search is run in this thread. */
+  for (i = 1; keygen.tp && i < num_primes; i++) {
+    search = &searches[i];
+    search->rng = silc_rng_alloc();
+    if (!search->rng) {
+      search->rng = rng;
+      continue;
+    }
+    silc_rng_init(search->rng);
+    if (rng)
+      silc_rng_get_rn_data(rng, sizeof(seed), seed, sizeof(seed));
+    else
+      silc_rng_global_get_rn_data(NULL, sizeof(seed), seed, sizeof(seed));
+    silc_rng_add_noise(search->rng, seed, sizeof(seed));
+
+    search->thread = TRUE;
+    if (!silc_thread_pool_run(keygen.tp, FALSE, NULL,
+			      silc_pkcs1_prime_search,
+			      search, NULL, NULL)) {
+      silc_rng_free(search->rng);
+      search->rng = rng;
+      search->thread = FALSE;
+    }
+  }
+  memset(seed, 0, sizeof(seed));
+  for (i = 0; i < num_primes; i++)
+    if (!searches[i].thread)
+      silc_pkcs1_prime_search(NULL, &searches[i]);
+
+  /* Wait for all searches */
+  silc_mutex_lock(keygen.lock);
+  while (keygen.done < num_primes)
+    silc_cond_wait(keygen.cond, keygen.lock);
+  silc_mutex_unlock(keygen.lock);
+
+  for (i = 0; i < num_primes; i++) {
+    if (searches[i].thread)
+      silc_rng_free(searches[i].rng);
+    if (!searches[i].success)
+      ret = FALSE;
+  }
+
+  if (keygen.lock) {
+    silc_cond_free(keygen.cond);
+    silc_mutex_free(keygen.lock);
+  }
+
+  return ret;
+}
+
+/* Generates RSA key pair with `num_primes' primes. */
+
+static SilcBool silc_pkcs1_generate(SilcUInt32 keylen, SilcUInt32 num_primes,
+				    SilcRng rng, void **ret_public_key,
+				    void **ret_private_key)
+{
+  SilcMPInt primes[SILC_RSA_MAX_PRIMES], n;
+  SilcUInt32 i, k;
+  SilcBool found = FALSE, ret = FALSE;
 
   if (keylen < 768 || keylen > 16384)
     return FALSE;
 
-  silc_mp_init(&p);
-  silc_mp_init(&q);
+  /* Multi-prime key must not have primes so small that they could be
+     found more easily than the primes of two-prime key. */
+  if ((num_primes > 2 && keylen < 4096) || (num_primes > 3 && keylen < 8192))
+    return FALSE;
+
+  for (i = 0; i < num_primes; i++)
+    silc_mp_init_size(&primes[i], keylen / num_primes + num_primes);
+  silc_mp_init_size(&n, keylen + num_primes);
+
+  /* Find the primes */
+  if (!silc_pkcs1_generate_primes(primes, num_primes, keylen, rng))
+    goto out;
 
-  /* Find p and q */
   while (!found) {
-    silc_math_gen_prime(&p, prime_bits, FALSE, rng);
-    silc_math_gen_prime(&q, prime_bits, FALSE, rng);
-    if ((silc_mp_cmp(&p, &q)) != 0)
-      found = TRUE;
+    found = TRUE;
+
+    /* The primes must be different */
+    for (i = 0; i < num_primes - 1 && found; i++)
+      for (k = i + 1; k < num_primes && found; k++)
+	if (silc_mp_cmp(&primes[i], &primes[k]) == 0)
+	  found = FALSE;
+
+    /* With more than two primes the modulus may be shorter than the key */
+    if (found) {
+      silc_mp_set(&n, &primes[0]);
+      for (i = 1; i < num_primes; i++)
+	silc_mp_mul(&n, &n, &primes[i]);
+      if (silc_mp_sizeinbase(&n, 2) != keylen)
+	found = FALSE;
+    }
+
+    /* Find new last prime */
+    if (!found && !silc_math_gen_prime_ext(&primes[num_primes - 1],
+					   keylen / num_primes +
+					   keylen % num_primes, 0, rng,
+					   NULL, 0, NULL, NULL))
+      goto out;
   }
 
   /* If p is smaller than q, switch them */
-  if ((silc_mp_cmp(&p, &q)) > 0) {
-    SilcMPInt hlp;
-    silc_mp_init(&hlp);
-
-    silc_mp_set(&hlp, &p);
-    silc_mp_set(&p, &q);
-    silc_mp_set(&q, &hlp);
-
-    silc_mp_uninit(&hlp);
+  if ((silc_mp_cmp(&primes[0], &primes[1])) > 0) {
+    silc_mp_set(&n, &primes[0]);
+    silc_mp_set(&primes[0], &primes[1]);
+    silc_mp_set(&primes[1], &n);
   }
 
   /* Generate the actual keys */
-  if (!silc_rsa_generate_keys(keylen, &p, &q, ret_public_key, ret_private_key))
-    return FALSE;
+  ret = silc_rsa_generate_keys(keylen, primes, num_primes,
+			       ret_public_key, ret_private_key);
 
-  silc_mp_uninit(&p);
-  silc_mp_uninit(&q);
+ out:
+  for (i = 0; i < num_primes; i++)
+    silc_mp_uninit(&primes[i]);
+  silc_mp_uninit(&n);
 
-  return TRUE;
+  return ret;
+}
+
+/* Generates RSA key pair. */
+
+SILC_PKCS_ALG_GENERATE_KEY(silc_pkcs1_generate_key)
+{
+  return silc_pkcs1_generate(keylen, 2, rng, ret_public_key,
+			     ret_private_key);
+}
+
+/* Generates three-prime RSA key pair. */
+
+SILC_PKCS_ALG_GENERATE_KEY(silc_pkcs1_generate_key_mp3)
+{
+  return silc_pkcs1_generate(keylen, 3, rng, ret_public_key,
+			     ret_private_key);
+}
+
+/* Generates four-prime RSA key pair. */
+
+SILC_PKCS_ALG_GENERATE_KEY(silc_pkcs1_generate_key_mp4)
+{
+  return silc_pkcs1_generate(keylen, 4, rng, ret_public_key,
+			     ret_private_key);
 }
 
 /* Import PKCS #1 compliant public key */
@@ -251,6 +708,8 @@ SILC_PKCS_ALG_IMPORT_PUBLIC_KEY(silc_pkcs1_import_public_key)
   /* Set key length */
   pubkey->bits = ((silc_mp_sizeinbase(&pubkey->n, 2) + 7) / 8) * 8;
 
+  silc_rsa_public_key_mont_init(pubkey);
+
   silc_asn1_free(asn1);
 
   return key_len;
@@ -261,6 +720,32 @@ SILC_PKCS_ALG_IMPORT_PUBLIC_KEY(silc_pkcs1_import_public_key)
   return 0;
 }
 
+/* Allocates RSA public key directly from the big-endian encoded public
+   exponent `e' and modulus `n', without the PKCS #1 encoding.  Returns
+   the RsaPublicKey context that can be used with the PKCS #1 routines. */
+
+void *silc_pkcs1_public_key_alloc(const unsigned char *e, SilcUInt32 e_len,
+				  const unsigned char *n, SilcUInt32 n_len)
+{
+  RsaPublicKey *pubkey;
+
+  pubkey = silc_calloc(1, sizeof(*pubkey));
+  if (!pubkey)
+    return NULL;
+
+  silc_mp_init(&pubkey->n);
+  silc_mp_init(&pubkey->e);
+  silc_mp_bin2mp((unsigned char *)n, n_len, &pubkey->n);
+  silc_mp_bin2mp((unsigned char *)e, e_len, &pubkey->e);
+
+  /* Set key length */
+  pubkey->bits = ((silc_mp_sizeinbase(&pubkey->n, 2) + 7) / 8) * 8;
+
+  silc_rsa_public_key_mont_init(pubkey);
+
+  return pubkey;
+}
+
 /* Export PKCS #1 compliant public key */
 
 SILC_PKCS_ALG_EXPORT_PUBLIC_KEY(silc_pkcs1_export_public_key)
@@ -318,6 +803,7 @@ SILC_PKCS_ALG_PUBLIC_KEY_COPY(silc_pkcs1_public_key_copy)
   silc_mp_set(&new_key->n, &key->n);
   silc_mp_set(&new_key->e, &key->e);
   new_key->bits = key->bits;
+  silc_rsa_public_key_mont_init(new_key);
 
   return new_key;
 }
@@ -344,12 +830,83 @@ SILC_PKCS_ALG_PUBLIC_KEY_FREE(silc_pkcs1_public_key_free)
 {
   RsaPublicKey *key = public_key;
 
+  silc_rsa_public_key_mont_uninit(key);
   silc_mp_uninit(&key->n);
   silc_mp_uninit(&key->e);
   silc_hash_free(key->hash);
   silc_free(key);
 }
 
+/* Decodes the other prime infos of multi-prime private key */
+
+static SilcBool silc_pkcs1_import_other_primes(SilcAsn1 asn1,
+					       SilcBuffer alg_key,
+					       RsaPrivateKey *privkey)
+{
+  SilcBufferStruct *infos, ri, di, ti;
+  SilcUInt32 count, i;
+
+  if (!silc_asn1_decode(asn1, alg_key,
+			SILC_ASN1_OPTS(SILC_ASN1_ACCUMUL),
+			SILC_ASN1_SEQUENCE,
+			  SILC_ASN1_INT(NULL),
+			  SILC_ASN1_INT(NULL),
+			  SILC_ASN1_INT(NULL),
+			  SILC_ASN1_INT(NULL),
+			  SILC_ASN1_INT(NULL),
+			  SILC_ASN1_INT(NULL),
+			  SILC_ASN1_INT(NULL),
+			  SILC_ASN1_INT(NULL),
+			  SILC_ASN1_INT(NULL),
+			  SILC_ASN1_SEQUENCE_OF(&infos, &count),
+			    SILC_ASN1_TAG_SEQUENCE,
+			  SILC_ASN1_END,
+			SILC_ASN1_END, SILC_ASN1_END))
+    return FALSE;
+
+  if (count < 1 || count > SILC_RSA_MAX_PRIMES - 2) {
+    SILC_LOG_DEBUG(("Unsupported number of primes %d", count + 2));
+    return FALSE;
+  }
+
+  privkey->other = silc_calloc(count, sizeof(*privkey->other));
+  if (!privkey->other)
+    return FALSE;
+
+  /* The integers are decoded as data first, so that a failed decoding
+     does not leave partly initialized integers to the key */
+  for (i = 0; i < count; i++) {
+    if (!silc_asn1_decode(asn1, &infos[i],
+			  SILC_ASN1_OPTS(SILC_ASN1_ACCUMUL),
+			  SILC_ASN1_SEQUENCE,
+			    SILC_ASN1_ANY_PRIMITIVE(SILC_ASN1_TAG_INTEGER,
+						    &ri),
+			    SILC_ASN1_ANY_PRIMITIVE(SILC_ASN1_TAG_INTEGER,
+						    &di),
+			    SILC_ASN1_ANY_PRIMITIVE(SILC_ASN1_TAG_INTEGER,
+						    &ti),
+			  SILC_ASN1_END, SILC_ASN1_END))
+      return FALSE;
+    if (!silc_buffer_len(&ri) || !silc_buffer_len(&di) ||
+	!silc_buffer_len(&ti) || (silc_buffer_data(&ri)[0] & 0x80) ||
+	(silc_buffer_data(&di)[0] & 0x80) || (silc_buffer_data(&ti)[0] & 0x80))
+      return FALSE;
+
+    silc_mp_init(&privkey->other[i].r);
+    silc_mp_init(&privkey->other[i].d);
+    silc_mp_init(&privkey->other[i].t);
+    silc_mp_bin2mp(silc_buffer_data(&ri), silc_buffer_len(&ri),
+		   &privkey->other[i].r);
+    silc_mp_bin2mp(silc_buffer_data(&di), silc_buffer_len(&di),
+		   &privkey->other[i].d);
+    silc_mp_bin2mp(silc_buffer_data(&ti), silc_buffer_len(&ti),
+		   &privkey->other[i].t);
+    privkey->num_other++;
+  }
+
+  return TRUE;
+}
+
 /* Import PKCS #1 compliant private key */
 
 SILC_PKCS_ALG_IMPORT_PRIVATE_KEY(silc_pkcs1_import_private_key)
@@ -388,17 +945,27 @@ SILC_PKCS_ALG_IMPORT_PRIVATE_KEY(silc_pkcs1_import_private_key)
 			SILC_ASN1_END, SILC_ASN1_END))
     goto err;
 
-  if (ver != 0)
+  /* Version 1 is multi-prime key */
+  if (ver != 0 && ver != 1)
     goto err;
+  if (ver == 1) {
+    silc_buffer_set(&alg_key, key, key_len);
+    if (!silc_pkcs1_import_other_primes(asn1, &alg_key, privkey))
+      goto err;
+  }
 
   /* Set key length */
   privkey->bits = ((silc_mp_sizeinbase(&privkey->n, 2) + 7) / 8) * 8;
 
+  silc_rsa_private_key_mont_init(privkey);
+
   silc_asn1_free(asn1);
 
   return key_len;
 
  err:
+  if (privkey)
+    silc_rsa_private_key_other_free(privkey);
   silc_free(privkey);
   silc_asn1_free(asn1);
   return 0;
@@ -409,20 +976,52 @@ SILC_PKCS_ALG_IMPORT_PRIVATE_KEY(silc_pkcs1_import_private_key)
 SILC_PKCS_ALG_EXPORT_PRIVATE_KEY(silc_pkcs1_export_private_key)
 {
   RsaPrivateKey *key = private_key;
+  RsaOtherPrime *o = key->other;
   SilcAsn1 asn1;
-  SilcBufferStruct alg_key;
+  SilcBufferStruct alg_key, other;
   unsigned char *ret;
 
   asn1 = silc_asn1_alloc(stack);
   if (!asn1)
     return FALSE;
 
+  /* Encode the other prime infos of multi-prime key */
+  memset(&other, 0, sizeof(other));
+  if (key->num_other == 1) {
+    if (!silc_asn1_encode(asn1, &other,
+			  SILC_ASN1_OPTS(SILC_ASN1_ACCUMUL),
+			  SILC_ASN1_SEQUENCE,
+			    SILC_ASN1_SEQUENCE,
+			      SILC_ASN1_INT(&o[0].r),
+			      SILC_ASN1_INT(&o[0].d),
+			      SILC_ASN1_INT(&o[0].t),
+			    SILC_ASN1_END,
+			  SILC_ASN1_END, SILC_ASN1_END))
+      goto err;
+  } else if (key->num_other == 2) {
+    if (!silc_asn1_encode(asn1, &other,
+			  SILC_ASN1_OPTS(SILC_ASN1_ACCUMUL),
+			  SILC_ASN1_SEQUENCE,
+			    SILC_ASN1_SEQUENCE,
+			      SILC_ASN1_INT(&o[0].r),
+			      SILC_ASN1_INT(&o[0].d),
+			      SILC_ASN1_INT(&o[0].t),
+			    SILC_ASN1_END,
+			    SILC_ASN1_SEQUENCE,
+			      SILC_ASN1_INT(&o[1].r),
+			      SILC_ASN1_INT(&o[1].d),
+			      SILC_ASN1_INT(&o[1].t),
+			    SILC_ASN1_END,
+			  SILC_ASN1_END, SILC_ASN1_END))
+      goto err;
+  }
+
   /* Encode to PKCS #1 private key */
   memset(&alg_key, 0, sizeof(alg_key));
   if (!silc_asn1_encode(asn1, &alg_key,
 			SILC_ASN1_OPTS(SILC_ASN1_ALLOC),
 			SILC_ASN1_SEQUENCE,
-			  SILC_ASN1_SHORT_INT(0),
+			  SILC_ASN1_SHORT_INT(key->num_other ? 1 : 0),
 			  SILC_ASN1_INT(&key->n),
 			  SILC_ASN1_INT(&key->e),
 			  SILC_ASN1_INT(&key->d),
@@ -431,6 +1030,7 @@ SILC_PKCS_ALG_EXPORT_PRIVATE_KEY(silc_pkcs1_export_private_key)
 			  SILC_ASN1_INT(&key->dP),
 			  SILC_ASN1_INT(&key->dQ),
 			  SILC_ASN1_INT(&key->qP),
+			  SILC_ASN1_ANY(key->num_other ? &other : NULL),
 			SILC_ASN1_END, SILC_ASN1_END))
     goto err;
 
@@ -458,6 +1058,7 @@ SILC_PKCS_ALG_PRIVATE_KEY_FREE(silc_pkcs1_private_key_free)
 {
   RsaPrivateKey *key = private_key;
 
+  silc_rsa_private_key_mont_uninit(key);
   silc_mp_uninit(&key->n);
   silc_mp_uninit(&key->e);
   silc_mp_uninit(&key->d);
@@ -466,6 +1067,7 @@ SILC_PKCS_ALG_PRIVATE_KEY_FREE(silc_pkcs1_private_key_free)
   silc_mp_uninit(&key->qP);
   silc_mp_uninit(&key->p);
   silc_mp_uninit(&key->q);
+  silc_rsa_private_key_other_free(key);
   silc_hash_free(key->hash);
   silc_free(key);
 }
@@ -493,7 +1095,8 @@ SILC_PKCS_ALG_ENCRYPT(silc_pkcs1_encrypt)
     return NULL;
   }
 
-  stack = silc_stack_alloc(2048, silc_crypto_stack());
+  stack = silc_crypto_thread_stack();
+  silc_stack_push(stack, NULL);
 
   silc_mp_sinit(stack, &mp_tmp);
   silc_mp_sinit(stack, &mp_dst);
@@ -502,7 +1105,7 @@ SILC_PKCS_ALG_ENCRYPT(silc_pkcs1_encrypt)
   silc_mp_bin2mp(padded, len, &mp_tmp);
 
   /* Encrypt */
-  silc_rsa_public_operation(key, &mp_tmp, &mp_dst);
+  silc_rsa_public_operation(stack, key, &mp_tmp, &mp_dst);
 
   /* MP to data */
   silc_mp_mp2bin_noalloc(&mp_dst, padded, len);
@@ -513,7 +1116,7 @@ SILC_PKCS_ALG_ENCRYPT(silc_pkcs1_encrypt)
   memset(padded, 0, sizeof(padded));
   silc_mp_uninit(&mp_tmp);
   silc_mp_uninit(&mp_dst);
-  silc_stack_free(stack);
+  silc_stack_pop(stack);
 
   return NULL;
 }
@@ -523,16 +1126,17 @@ SILC_PKCS_ALG_DECRYPT(silc_pkcs1_decrypt)
   RsaPrivateKey *key = private_key;
   SilcMPInt mp_tmp;
   SilcMPInt mp_dst;
-  unsigned char *padded, unpadded[2048 + 1];
-  SilcUInt32 padded_len, dst_len;
+  unsigned char padded[2048 + 1], unpadded[2048 + 1];
+  SilcUInt32 padded_len = (key->bits + 7) / 8, dst_len;
   SilcStack stack;
 
-  if (sizeof(unpadded) < (key->bits + 7) / 8) {
+  if (sizeof(unpadded) < padded_len) {
     decrypt_cb(FALSE, NULL, 0, context);
     return NULL;
   }
 
-  stack = silc_stack_alloc(2048, silc_crypto_stack());
+  stack = silc_crypto_thread_stack();
+  silc_stack_push(stack, NULL);
 
   silc_mp_sinit(stack, &mp_tmp);
   silc_mp_sinit(stack, &mp_dst);
@@ -541,18 +1145,18 @@ SILC_PKCS_ALG_DECRYPT(silc_pkcs1_decrypt)
   silc_mp_bin2mp(src, src_len, &mp_tmp);
 
   /* Decrypt */
-  silc_rsa_private_operation(key, &mp_tmp, &mp_dst);
+  silc_rsa_private_operation(stack, key, NULL, &mp_tmp, &mp_dst);
 
   /* MP to data */
-  padded = silc_mp_mp2bin(&mp_dst, (key->bits + 7) / 8, &padded_len);
+  silc_mp_mp2bin_noalloc(&mp_dst, padded, padded_len);
 
   /* Unpad data */
   if (!silc_pkcs1_decode(SILC_PKCS1_BT_PUB, padded, padded_len,
 			 unpadded, sizeof(unpadded), &dst_len)) {
     memset(padded, 0, padded_len);
-    silc_free(padded);
     silc_mp_uninit(&mp_tmp);
     silc_mp_uninit(&mp_dst);
+    silc_stack_pop(stack);
     decrypt_cb(FALSE, NULL, 0, context);
     return NULL;
   }
@@ -562,10 +1166,9 @@ SILC_PKCS_ALG_DECRYPT(silc_pkcs1_decrypt)
 
   memset(padded, 0, padded_len);
   memset(unpadded, 0, sizeof(unpadded));
-  silc_free(padded);
   silc_mp_uninit(&mp_tmp);
   silc_mp_uninit(&mp_dst);
-  silc_stack_free(stack);
+  silc_stack_pop(stack);
 
   return NULL;
 }
@@ -581,6 +1184,7 @@ SILC_PKCS_ALG_SIGN(silc_pkcs1_sign)
   SilcBufferStruct di;
   SilcUInt32 len = (key->bits + 7) / 8;
   const char *oid;
+  SilcHash ihash;
   SilcStack stack;
   SilcAsn1 asn1;
 
@@ -591,28 +1195,36 @@ SILC_PKCS_ALG_SIGN(silc_pkcs1_sign)
     return NULL;
   }
 
-  oid = silc_hash_get_oid(hash);
+  oid = silc_hash_get_oid(hash ? hash : key->hash);
   if (!oid) {
     sign_cb(FALSE, NULL, 0, context);
     return NULL;
   }
 
-  stack = silc_stack_alloc(2048, silc_crypto_stack());
+  stack = silc_crypto_thread_stack();
+  silc_stack_push(stack, NULL);
 
   asn1 = silc_asn1_alloc(stack);
   if (!asn1) {
-    silc_stack_free(stack);
+    silc_stack_pop(stack);
     sign_cb(FALSE, NULL, 0, context);
     return NULL;
   }
 
   /* Compute hash */
   if (compute_hash) {
-    if (!hash)
-      hash = key->hash;
+    hash = silc_pkcs1_get_hash(hash, key->hash, &ihash);
+    if (!hash) {
+      silc_asn1_free(asn1);
+      silc_stack_pop(stack);
+      sign_cb(FALSE, NULL, 0, context);
+      return NULL;
+    }
     silc_hash_make(hash, src, src_len, hashr);
     src = hashr;
     src_len = silc_hash_len(hash);
+    if (ihash)
+      silc_crypto_thread_hash_put(ihash);
   }
 
   /* Encode digest info */
@@ -626,7 +1238,7 @@ SILC_PKCS_ALG_SIGN(silc_pkcs1_sign)
 			  SILC_ASN1_OCTET_STRING(src, src_len),
 			SILC_ASN1_END, SILC_ASN1_END)) {
     silc_asn1_free(asn1);
-    silc_stack_free(stack);
+    silc_stack_pop(stack);
     sign_cb(FALSE, NULL, 0, context);
     return NULL;
   }
@@ -637,7 +1249,7 @@ SILC_PKCS_ALG_SIGN(silc_pkcs1_sign)
   if (!silc_pkcs1_encode(SILC_PKCS1_BT_PRV1, silc_buffer_data(&di),
 			 silc_buffer_len(&di), padded, len, NULL)) {
     silc_asn1_free(asn1);
-    silc_stack_free(stack);
+    silc_stack_pop(stack);
     sign_cb(FALSE, NULL, 0, context);
     return NULL;
   }
@@ -649,7 +1261,7 @@ SILC_PKCS_ALG_SIGN(silc_pkcs1_sign)
   silc_mp_bin2mp(padded, len, &mp_tmp);
 
   /* Sign */
-  silc_rsa_private_operation(key, &mp_tmp, &mp_dst);
+  silc_rsa_private_operation(stack, key, rng, &mp_tmp, &mp_dst);
 
   /* MP to data */
   silc_mp_mp2bin_noalloc(&mp_dst, padded, len);
@@ -663,7 +1275,7 @@ SILC_PKCS_ALG_SIGN(silc_pkcs1_sign)
   silc_mp_uninit(&mp_tmp);
   silc_mp_uninit(&mp_dst);
   silc_asn1_free(asn1);
-  silc_stack_free(stack);
+  silc_stack_pop(stack);
 
   return NULL;
 }
@@ -676,8 +1288,9 @@ SILC_PKCS_ALG_VERIFY(silc_pkcs1_verify)
   SilcBool ret = FALSE;
   SilcMPInt mp_tmp2;
   SilcMPInt mp_dst;
-  unsigned char *verify, unpadded[2048 + 1], hashr[SILC_HASH_MAXLEN];
-  SilcUInt32 verify_len, len = (key->bits + 7) / 8;
+  unsigned char verify[2048 + 1], unpadded[2048 + 1];
+  unsigned char hashr[SILC_HASH_MAXLEN];
+  SilcUInt32 verify_len = (key->bits + 7) / 8, len;
   SilcBufferStruct di, ldi;
   SilcBool has_null = TRUE;
   SilcHash ihash = NULL;
@@ -687,10 +1300,17 @@ SILC_PKCS_ALG_VERIFY(silc_pkcs1_verify)
 
   SILC_LOG_DEBUG(("Verify signature"));
 
-  stack = silc_stack_alloc(2048, silc_crypto_stack());
+  if (sizeof(verify) < verify_len) {
+    verify_cb(FALSE, context);
+    return NULL;
+  }
+
+  stack = silc_crypto_thread_stack();
+  silc_stack_push(stack, NULL);
 
   asn1 = silc_asn1_alloc(stack);
   if (!asn1) {
+    silc_stack_pop(stack);
     verify_cb(FALSE, context);
     return NULL;
   }
@@ -702,10 +1322,10 @@ SILC_PKCS_ALG_VERIFY(silc_pkcs1_verify)
   silc_mp_bin2mp(signature, signature_len, &mp_tmp2);
 
   /* Verify */
-  silc_rsa_public_operation(key, &mp_tmp2, &mp_dst);
+  silc_rsa_public_operation(stack, key, &mp_tmp2, &mp_dst);
 
   /* MP to data */
-  verify = silc_mp_mp2bin(&mp_dst, len, &verify_len);
+  silc_mp_mp2bin_noalloc(&mp_dst, verify, verify_len);
 
   /* Unpad data */
   if (!silc_pkcs1_decode(SILC_PKCS1_BT_PRV1, verify, verify_len,
@@ -713,35 +1333,40 @@ SILC_PKCS_ALG_VERIFY(silc_pkcs1_verify)
     goto err;
   silc_buffer_set(&di, unpadded, len);
 
-  /* If hash isn't given, allocate the one given in digest info */
-  if (compute_hash) {
-    if (!hash) {
-      has_null = FALSE;
+  /* If hash isn't given, use the one given in digest info */
+  if (!hash) {
+    has_null = FALSE;
 
-      /* Decode digest info */
-      if (!silc_asn1_decode(asn1, &di,
-			    SILC_ASN1_OPTS(SILC_ASN1_ACCUMUL),
+    /* Decode digest info */
+    if (!silc_asn1_decode(asn1, &di,
+			  SILC_ASN1_OPTS(SILC_ASN1_ACCUMUL),
+			  SILC_ASN1_SEQUENCE,
 			    SILC_ASN1_SEQUENCE,
-			      SILC_ASN1_SEQUENCE,
-			        SILC_ASN1_OID(&oid),
-			        SILC_ASN1_NULL_T(SILC_ASN1_OPTIONAL,
-						 SILC_ASN1_TAG_NULL, &has_null),
-			      SILC_ASN1_END,
-			    SILC_ASN1_END, SILC_ASN1_END))
-	goto err;
-
+			      SILC_ASN1_OID(&oid),
+			      SILC_ASN1_NULL_T(SILC_ASN1_OPTIONAL,
+					       SILC_ASN1_TAG_NULL, &has_null),
+			    SILC_ASN1_END,
+			  SILC_ASN1_END, SILC_ASN1_END))
+      goto err;
+
+    if (compute_hash) {
       if (!silc_hash_alloc_by_oid(oid, &ihash)) {
 	SILC_LOG_DEBUG(("Unknown OID %s", oid));
 	goto err;
       }
       hash = ihash;
     }
+  } else {
+    oid = (char *)silc_hash_get_oid(hash);
+    if (!oid)
+      goto err;
+  }
 
-    /* Hash the data */
+  /* Hash the data */
+  if (compute_hash) {
     silc_hash_make(hash, data, data_len, hashr);
     data = hashr;
     data_len = silc_hash_len(hash);
-    oid = (char *)silc_hash_get_oid(hash);
   }
 
   /* Encode digest info for comparison */
@@ -773,7 +1398,6 @@ SILC_PKCS_ALG_VERIFY(silc_pkcs1_verify)
 
   memset(verify, 0, verify_len);
   memset(unpadded, 0, sizeof(unpadded));
-  silc_free(verify);
   silc_mp_uninit(&mp_tmp2);
   silc_mp_uninit(&mp_dst);
   if (compute_hash)
@@ -781,19 +1405,18 @@ SILC_PKCS_ALG_VERIFY(silc_pkcs1_verify)
   if (ihash)
     silc_hash_free(ihash);
   silc_asn1_free(asn1);
-  silc_stack_free(stack);
+  silc_stack_pop(stack);
 
   return NULL;
 
  err:
   memset(verify, 0, verify_len);
-  silc_free(verify);
   silc_mp_uninit(&mp_tmp2);
   silc_mp_uninit(&mp_dst);
   if (ihash)
     silc_hash_free(ihash);
   silc_asn1_free(asn1);
-  silc_stack_free(stack);
+  silc_stack_pop(stack);
 
   verify_cb(FALSE, context);
   return NULL;
@@ -808,6 +1431,7 @@ SILC_PKCS_ALG_SIGN(silc_pkcs1_sign_no_oid)
   SilcMPInt mp_dst;
   unsigned char padded[2048 + 1], hashr[SILC_HASH_MAXLEN];
   SilcUInt32 len = (key->bits + 7) / 8;
+  SilcHash ihash;
   SilcStack stack;
 
   SILC_LOG_DEBUG(("Sign"));
@@ -819,11 +1443,16 @@ SILC_PKCS_ALG_SIGN(silc_pkcs1_sign_no_oid)
 
   /* Compute hash if requested */
   if (compute_hash) {
-    if (!hash)
-      hash = key->hash;
+    hash = silc_pkcs1_get_hash(hash, key->hash, &ihash);
+    if (!hash) {
+      sign_cb(FALSE, NULL, 0, context);
+      return NULL;
+    }
     silc_hash_make(hash, src, src_len, hashr);
     src = hashr;
     src_len = silc_hash_len(hash);
+    if (ihash)
+      silc_crypto_thread_hash_put(ihash);
   }
 
   /* Pad data */
@@ -833,7 +1462,8 @@ SILC_PKCS_ALG_SIGN(silc_pkcs1_sign_no_oid)
     return NULL;
   }
 
-  stack = silc_stack_alloc(2048, silc_crypto_stack());
+  stack = silc_crypto_thread_stack();
+  silc_stack_push(stack, NULL);
 
   silc_mp_sinit(stack, &mp_tmp);
   silc_mp_sinit(stack, &mp_dst);
@@ -842,7 +1472,7 @@ SILC_PKCS_ALG_SIGN(silc_pkcs1_sign_no_oid)
   silc_mp_bin2mp(padded, len, &mp_tmp);
 
   /* Sign */
-  silc_rsa_private_operation(key, &mp_tmp, &mp_dst);
+  silc_rsa_private_operation(stack, key, rng, &mp_tmp, &mp_dst);
 
   /* MP to data */
   silc_mp_mp2bin_noalloc(&mp_dst, padded, len);
@@ -855,7 +1485,7 @@ SILC_PKCS_ALG_SIGN(silc_pkcs1_sign_no_oid)
     memset(hashr, 0, sizeof(hashr));
   silc_mp_uninit(&mp_tmp);
   silc_mp_uninit(&mp_dst);
-  silc_stack_free(stack);
+  silc_stack_pop(stack);
 
   return NULL;
 }
@@ -868,13 +1498,21 @@ SILC_PKCS_ALG_VERIFY(silc_pkcs1_verify_no_oid)
   SilcBool ret = FALSE;
   SilcMPInt mp_tmp2;
   SilcMPInt mp_dst;
-  unsigned char *verify, unpadded[2048 + 1], hashr[SILC_HASH_MAXLEN];
-  SilcUInt32 verify_len, len = (key->bits + 7) / 8;
+  unsigned char verify[2048 + 1], unpadded[2048 + 1];
+  unsigned char hashr[SILC_HASH_MAXLEN];
+  SilcUInt32 verify_len = (key->bits + 7) / 8, len;
+  SilcHash ihash;
   SilcStack stack;
 
   SILC_LOG_DEBUG(("Verify signature"));
 
-  stack = silc_stack_alloc(2048, silc_crypto_stack());
+  if (sizeof(verify) < verify_len) {
+    verify_cb(FALSE, context);
+    return NULL;
+  }
+
+  stack = silc_crypto_thread_stack();
+  silc_stack_push(stack, NULL);
 
   silc_mp_sinit(stack, &mp_tmp2);
   silc_mp_sinit(stack, &mp_dst);
@@ -883,30 +1521,38 @@ SILC_PKCS_ALG_VERIFY(silc_pkcs1_verify_no_oid)
   silc_mp_bin2mp(signature, signature_len, &mp_tmp2);
 
   /* Verify */
-  silc_rsa_public_operation(key, &mp_tmp2, &mp_dst);
+  silc_rsa_public_operation(stack, key, &mp_tmp2, &mp_dst);
 
   /* MP to data */
-  verify = silc_mp_mp2bin(&mp_dst, len, &verify_len);
+  silc_mp_mp2bin_noalloc(&mp_dst, verify, verify_len);
 
   /* Unpad data */
   if (!silc_pkcs1_decode(SILC_PKCS1_BT_PRV1, verify, verify_len,
 			 unpadded, sizeof(unpadded), &len)) {
     memset(verify, 0, verify_len);
-    silc_free(verify);
     silc_mp_uninit(&mp_tmp2);
     silc_mp_uninit(&mp_dst);
-    silc_stack_free(stack);
+    silc_stack_pop(stack);
     verify_cb(FALSE, context);
     return NULL;
   }
 
   /* Hash data if requested */
   if (compute_hash) {
-    if (!hash)
-      hash = key->hash;
+    hash = silc_pkcs1_get_hash(hash, key->hash, &ihash);
+    if (!hash) {
+      memset(verify, 0, verify_len);
+      silc_mp_uninit(&mp_tmp2);
+      silc_mp_uninit(&mp_dst);
+      silc_stack_pop(stack);
+      verify_cb(FALSE, context);
+      return NULL;
+    }
     silc_hash_make(hash, data, data_len, hashr);
     data = hashr;
     data_len = silc_hash_len(hash);
+    if (ihash)
+      silc_crypto_thread_hash_put(ihash);
   }
 
   /* Compare */
@@ -920,10 +1566,283 @@ SILC_PKCS_ALG_VERIFY(silc_pkcs1_verify_no_oid)
   memset(unpadded, 0, sizeof(unpadded));
   if (compute_hash)
     memset(hashr, 0, sizeof(hashr));
-  silc_free(verify);
   silc_mp_uninit(&mp_tmp2);
   silc_mp_uninit(&mp_dst);
-  silc_stack_free(stack);
+  silc_stack_pop(stack);
+
+  return NULL;
+}
+
+/* PKCS #1 RSAES-OAEP encryption */
+
+SILC_PKCS_ALG_ENCRYPT(silc_pkcs1_encrypt_oaep)
+{
+  RsaPublicKey *key = public_key;
+  SilcMPInt mp_tmp;
+  SilcMPInt mp_dst;
+  unsigned char padded[2048 + 1];
+  SilcUInt32 len = (key->bits + 7) / 8;
+  SilcHash hash, ihash;
+  SilcStack stack;
+
+  if (sizeof(padded) < len) {
+    encrypt_cb(FALSE, NULL, 0, context);
+    return NULL;
+  }
+
+  hash = silc_pkcs1_get_hash(NULL, key->hash, &ihash);
+  if (!hash) {
+    encrypt_cb(FALSE, NULL, 0, context);
+    return NULL;
+  }
+
+  /* Pad data */
+  if (!silc_pkcs1_oaep_encode(hash, src, src_len, padded, len, rng)) {
+    if (ihash)
+      silc_crypto_thread_hash_put(ihash);
+    encrypt_cb(FALSE, NULL, 0, context);
+    return NULL;
+  }
+  if (ihash)
+    silc_crypto_thread_hash_put(ihash);
+
+  stack = silc_crypto_thread_stack();
+  silc_stack_push(stack, NULL);
+
+  silc_mp_sinit(stack, &mp_tmp);
+  silc_mp_sinit(stack, &mp_dst);
+
+  /* Data to MP */
+  silc_mp_bin2mp(padded, len, &mp_tmp);
+
+  /* Encrypt */
+  silc_rsa_public_operation(stack, key, &mp_tmp, &mp_dst);
+
+  /* MP to data */
+  silc_mp_mp2bin_noalloc(&mp_dst, padded, len);
+
+  /* Deliver result */
+  encrypt_cb(TRUE, padded, len, context);
+
+  memset(padded, 0, sizeof(padded));
+  silc_mp_uninit(&mp_tmp);
+  silc_mp_uninit(&mp_dst);
+  silc_stack_pop(stack);
+
+  return NULL;
+}
+
+/* PKCS #1 RSAES-OAEP decryption */
+
+SILC_PKCS_ALG_DECRYPT(silc_pkcs1_decrypt_oaep)
+{
+  RsaPrivateKey *key = private_key;
+  SilcMPInt mp_tmp;
+  SilcMPInt mp_dst;
+  unsigned char padded[2048 + 1], unpadded[2048 + 1];
+  SilcUInt32 padded_len = (key->bits + 7) / 8, dst_len;
+  SilcHash hash, ihash;
+  SilcStack stack;
+  SilcBool ret;
+
+  if (sizeof(unpadded) < padded_len) {
+    decrypt_cb(FALSE, NULL, 0, context);
+    return NULL;
+  }
+
+  hash = silc_pkcs1_get_hash(NULL, key->hash, &ihash);
+  if (!hash) {
+    decrypt_cb(FALSE, NULL, 0, context);
+    return NULL;
+  }
+
+  stack = silc_crypto_thread_stack();
+  silc_stack_push(stack, NULL);
+
+  silc_mp_sinit(stack, &mp_tmp);
+  silc_mp_sinit(stack, &mp_dst);
+
+  /* Data to MP */
+  silc_mp_bin2mp(src, src_len, &mp_tmp);
+
+  /* Decrypt */
+  silc_rsa_private_operation(stack, key, NULL, &mp_tmp, &mp_dst);
+
+  /* MP to data */
+  silc_mp_mp2bin_noalloc(&mp_dst, padded, padded_len);
+
+  /* Unpad data */
+  ret = silc_pkcs1_oaep_decode(hash, padded, padded_len,
+			       unpadded, sizeof(unpadded), &dst_len);
+
+  memset(padded, 0, padded_len);
+  silc_mp_uninit(&mp_tmp);
+  silc_mp_uninit(&mp_dst);
+  silc_stack_pop(stack);
+  if (ihash)
+    silc_crypto_thread_hash_put(ihash);
+
+  if (!ret) {
+    decrypt_cb(FALSE, NULL, 0, context);
+    return NULL;
+  }
+
+  /* Deliver result */
+  decrypt_cb(TRUE, unpadded, dst_len, context);
+
+  memset(unpadded, 0, sizeof(unpadded));
+
+  return NULL;
+}
+
+/* PKCS #1 RSASSA-PSS sign */
+
+SILC_PKCS_ALG_SIGN(silc_pkcs1_sign_pss)
+{
+  RsaPrivateKey *key = private_key;
+  SilcMPInt mp_tmp;
+  SilcMPInt mp_dst;
+  unsigned char padded[2048 + 1], hashr[SILC_HASH_MAXLEN];
+  SilcUInt32 len = (key->bits + 7) / 8, em_bits, em_len;
+  SilcHash ihash;
+  SilcStack stack;
+
+  SILC_LOG_DEBUG(("Sign"));
+
+  /* The `bits' is rounded up to full bytes, the encoded message is one bit
+     shorter than the actual modulus. */
+  em_bits = silc_mp_sizeinbase(&key->n, 2) - 1;
+  em_len = (em_bits + 7) / 8;
+
+  if (sizeof(padded) < len || em_len > len) {
+    sign_cb(FALSE, NULL, 0, context);
+    return NULL;
+  }
+
+  hash = silc_pkcs1_get_hash(hash, key->hash, &ihash);
+  if (!hash) {
+    sign_cb(FALSE, NULL, 0, context);
+    return NULL;
+  }
+
+  /* Compute hash if requested */
+  if (compute_hash) {
+    silc_hash_make(hash, src, src_len, hashr);
+    src = hashr;
+    src_len = silc_hash_len(hash);
+  }
+
+  /* Encode, the encoded message is one byte shorter than the modulus if
+     the modulus length is multiple of eight plus one bits. */
+  memset(padded, 0, len - em_len);
+  if (!silc_pkcs1_pss_encode(hash, src, src_len, padded + len - em_len,
+			     em_bits, rng)) {
+    if (ihash)
+      silc_crypto_thread_hash_put(ihash);
+    sign_cb(FALSE, NULL, 0, context);
+    return NULL;
+  }
+  if (ihash)
+    silc_crypto_thread_hash_put(ihash);
+
+  stack = silc_crypto_thread_stack();
+  silc_stack_push(stack, NULL);
+
+  silc_mp_sinit(stack, &mp_tmp);
+  silc_mp_sinit(stack, &mp_dst);
+
+  /* Data to MP */
+  silc_mp_bin2mp(padded, len, &mp_tmp);
+
+  /* Sign */
+  silc_rsa_private_operation(stack, key, rng, &mp_tmp, &mp_dst);
+
+  /* MP to data */
+  silc_mp_mp2bin_noalloc(&mp_dst, padded, len);
+
+  /* Deliver result */
+  sign_cb(TRUE, padded, len, context);
+
+  memset(padded, 0, sizeof(padded));
+  if (compute_hash)
+    memset(hashr, 0, sizeof(hashr));
+  silc_mp_uninit(&mp_tmp);
+  silc_mp_uninit(&mp_dst);
+  silc_stack_pop(stack);
+
+  return NULL;
+}
+
+/* PKCS #1 RSASSA-PSS verify */
+
+SILC_PKCS_ALG_VERIFY(silc_pkcs1_verify_pss)
+{
+  RsaPublicKey *key = public_key;
+  SilcBool ret = FALSE;
+  SilcMPInt mp_tmp2;
+  SilcMPInt mp_dst;
+  unsigned char verify[2048 + 1], hashr[SILC_HASH_MAXLEN];
+  SilcUInt32 verify_len = (key->bits + 7) / 8, em_bits, em_len;
+  SilcHash ihash;
+  SilcStack stack;
+
+  SILC_LOG_DEBUG(("Verify signature"));
+
+  /* The `bits' is rounded up to full bytes, the encoded message is one bit
+     shorter than the actual modulus. */
+  em_bits = silc_mp_sizeinbase(&key->n, 2) - 1;
+  em_len = (em_bits + 7) / 8;
+
+  if (sizeof(verify) < verify_len || em_len > verify_len) {
+    verify_cb(FALSE, context);
+    return NULL;
+  }
+
+  hash = silc_pkcs1_get_hash(hash, key->hash, &ihash);
+  if (!hash) {
+    verify_cb(FALSE, context);
+    return NULL;
+  }
+
+  stack = silc_crypto_thread_stack();
+  silc_stack_push(stack, NULL);
+
+  silc_mp_sinit(stack, &mp_tmp2);
+  silc_mp_sinit(stack, &mp_dst);
+
+  /* Format the signature into MP int */
+  silc_mp_bin2mp(signature, signature_len, &mp_tmp2);
+
+  /* Verify */
+  silc_rsa_public_operation(stack, key, &mp_tmp2, &mp_dst);
+
+  /* MP to data */
+  silc_mp_mp2bin_noalloc(&mp_dst, verify, verify_len);
+
+  /* Hash data if requested */
+  if (compute_hash) {
+    silc_hash_make(hash, data, data_len, hashr);
+    data = hashr;
+    data_len = silc_hash_len(hash);
+  }
+
+  /* Verify the encoded message */
+  if ((verify_len == em_len || verify[0] == 0x00) &&
+      silc_pkcs1_pss_verify(hash, data, data_len,
+			    verify + verify_len - em_len, em_bits))
+    ret = TRUE;
+
+  memset(verify, 0, verify_len);
+  if (compute_hash)
+    memset(hashr, 0, sizeof(hashr));
+  silc_mp_uninit(&mp_tmp2);
+  silc_mp_uninit(&mp_dst);
+  silc_stack_pop(stack);
+  if (ihash)
+    silc_crypto_thread_hash_put(ihash);
+
+  /* Deliver result */
+  verify_cb(ret, context);
 
   return NULL;
 }
@@ -21,6 +21,8 @@
 #define SILCPKCS1_I_H
 
 SILC_PKCS_ALG_GENERATE_KEY(silc_pkcs1_generate_key);
+SILC_PKCS_ALG_GENERATE_KEY(silc_pkcs1_generate_key_mp3);
+SILC_PKCS_ALG_GENERATE_KEY(silc_pkcs1_generate_key_mp4);
 SILC_PKCS_ALG_IMPORT_PUBLIC_KEY(silc_pkcs1_import_public_key);
 SILC_PKCS_ALG_EXPORT_PUBLIC_KEY(silc_pkcs1_export_public_key);
 SILC_PKCS_ALG_PUBLIC_KEY_BITLEN(silc_pkcs1_public_key_bitlen);
@@ -37,5 +39,12 @@ SILC_PKCS_ALG_SIGN(silc_pkcs1_sign);
 SILC_PKCS_ALG_VERIFY(silc_pkcs1_verify);
 SILC_PKCS_ALG_SIGN(silc_pkcs1_sign_no_oid);
 SILC_PKCS_ALG_VERIFY(silc_pkcs1_verify_no_oid);
+SILC_PKCS_ALG_ENCRYPT(silc_pkcs1_encrypt_oaep);
+SILC_PKCS_ALG_DECRYPT(silc_pkcs1_decrypt_oaep);
+SILC_PKCS_ALG_SIGN(silc_pkcs1_sign_pss);
+SILC_PKCS_ALG_VERIFY(silc_pkcs1_verify_pss);
+
+void *silc_pkcs1_public_key_alloc(const unsigned char *e, SilcUInt32 e_len,
+				  const unsigned char *n, SilcUInt32 n_len);
 
 #endif /* SILCPKCS1_I_H */
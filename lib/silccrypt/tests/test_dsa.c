@@ -25,7 +25,8 @@ int main(int argc, char **argv)
   SilcRng rng;
   void *public_key, *private_key;
   SilcHash hash;
-  unsigned char tmp[20];
+  unsigned char tmp[20], *sig;
+  SilcUInt32 sig_len;
 
   if (argc > 1 && !strcmp(argv[1], "-d")) {
     silc_log_debug(TRUE);
@@ -54,7 +55,27 @@ int main(int argc, char **argv)
 
   SILC_LOG_DEBUG(("Verify"));
   silc_dsa_verify(alg, public_key, signature, signature_len,
-		  tmp, sizeof(tmp), hash, rng, verify_cb, NULL);
+		  tmp, sizeof(tmp), TRUE, hash, rng, verify_cb, NULL);
+  if (!success)
+    goto err;
+  silc_free(signature);
+
+  SILC_LOG_DEBUG(("Sign twice without RNG"));
+  silc_dsa_sign(alg, private_key, tmp, sizeof(tmp), TRUE, hash, NULL,
+		sign_cb, NULL);
+  sig = signature;
+  sig_len = signature_len;
+  silc_dsa_sign(alg, private_key, tmp, sizeof(tmp), TRUE, hash, NULL,
+		sign_cb, NULL);
+  success = (sig_len == signature_len && !memcmp(sig, signature, sig_len));
+  silc_free(sig);
+  if (!success)
+    goto err;
+
+  SILC_LOG_DEBUG(("Verify"));
+  success = FALSE;
+  silc_dsa_verify(alg, public_key, signature, signature_len,
+		  tmp, sizeof(tmp), TRUE, hash, rng, verify_cb, NULL);
 
   silc_rng_free(rng);
   silc_free(signature);
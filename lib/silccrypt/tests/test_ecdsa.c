@@ -0,0 +1,169 @@
+#include "silc.h"
+#include "ecdsa.h"
+
+unsigned char *signature = NULL;
+SilcUInt32 signature_len;
+SilcBool success = FALSE;
+
+static void sign_cb(SilcBool success, const unsigned char *sig,
+		    SilcUInt32 sig_len, void *context)
+{
+  SILC_LOG_HEXDUMP(("Signature"), sig, sig_len);
+  silc_free(signature);
+  signature = silc_memdup(sig, sig_len);
+  signature_len = sig_len;
+}
+
+static void verify_cb(SilcBool s, void *context)
+{
+  SILC_LOG_DEBUG(("Verify %s", s ? "success" : "failed"));
+  success = s;
+}
+
+/* Generates key, signs, verifies and verifies with wrong data */
+
+static SilcBool test_curve(const SilcPKCSAlgorithm *alg, SilcUInt32 bits,
+			   SilcRng rng)
+{
+  void *public_key, *private_key, *pk2 = NULL, *prv2 = NULL;
+  unsigned char tmp[20], *pk, *prv;
+  SilcUInt32 pk_len, prv_len;
+  SilcBool ret = FALSE;
+
+  SILC_LOG_DEBUG(("Generate ECDSA keypair, %d bits", bits));
+  if (!silc_ecdsa_generate_key(alg, bits, rng, &public_key, &private_key))
+    return FALSE;
+
+  SILC_LOG_DEBUG(("Key length: %d",
+		  silc_ecdsa_public_key_bitlen(alg, public_key)));
+  if (silc_ecdsa_public_key_bitlen(alg, public_key) != bits)
+    goto err;
+
+  SILC_LOG_DEBUG(("Export and import keys"));
+  pk = silc_ecdsa_export_public_key(alg, NULL, public_key, &pk_len);
+  prv = silc_ecdsa_export_private_key(alg, NULL, private_key, &prv_len);
+  if (!pk || !prv)
+    goto err;
+  if (!silc_ecdsa_import_public_key(alg, pk, pk_len, &pk2))
+    goto err;
+  if (!silc_ecdsa_import_private_key(alg, prv, prv_len, &prv2))
+    goto err;
+  silc_free(pk);
+  silc_free(prv);
+  if (!silc_ecdsa_public_key_compare(alg, public_key, pk2))
+    goto err;
+
+  SILC_LOG_DEBUG(("Sign"));
+  memset(tmp, 0, sizeof(tmp));
+  silc_ecdsa_sign(alg, prv2, tmp, sizeof(tmp), TRUE, NULL, rng,
+		  sign_cb, NULL);
+  if (!signature)
+    goto err;
+
+  SILC_LOG_DEBUG(("Verify"));
+  success = FALSE;
+  silc_ecdsa_verify(alg, public_key, signature, signature_len,
+		    tmp, sizeof(tmp), TRUE, NULL, rng, verify_cb, NULL);
+  if (!success)
+    goto err;
+
+  SILC_LOG_DEBUG(("Verify with wrong data"));
+  tmp[0] ^= 1;
+  silc_ecdsa_verify(alg, public_key, signature, signature_len,
+		    tmp, sizeof(tmp), TRUE, NULL, rng, verify_cb, NULL);
+  if (success)
+    goto err;
+
+  ret = TRUE;
+
+ err:
+  silc_free(signature);
+  signature = NULL;
+  silc_ecdsa_public_key_free(alg, public_key);
+  silc_ecdsa_private_key_free(alg, private_key);
+  if (pk2)
+    silc_ecdsa_public_key_free(alg, pk2);
+  if (prv2)
+    silc_ecdsa_private_key_free(alg, prv2);
+  return ret;
+}
+
+/* RFC 6979 A.2.5, P-256 private key and signature of "sample" with
+   SHA-256 */
+static const unsigned char rfc6979_key[] =
+  "\x30\x31\x02\x01\x01\x04\x20\xc9\xaf\xa9\xd8\x45\xba\x75\x16\x6b"
+  "\x5c\x21\x57\x67\xb1\xd6\x93\x4e\x50\xc3\xdb\x36\xe8\x9b\x12\x7b"
+  "\x8a\x62\x2b\x12\x0f\x67\x21\xa0\x0a\x06\x08\x2a\x86\x48\xce\x3d"
+  "\x03\x01\x07";
+static const unsigned char rfc6979_sig[] =
+  "\x30\x46\x02\x21\x00\xef\xd4\x8b\x2a\xac\xb6\xa8\xfd\x11\x40\xdd"
+  "\x9c\xd4\x5e\x81\xd6\x9d\x2c\x87\x7b\x56\xaa\xf9\x91\xc3\x4d\x0e"
+  "\xa8\x4e\xaf\x37\x16\x02\x21\x00\xf7\xcb\x1c\x94\x2d\x65\x7c\x41"
+  "\xd4\x36\xc7\xa1\xb6\xe2\x9f\x65\xf3\xe9\x00\xdb\xb9\xaf\xf4\x06"
+  "\x4d\xc4\xab\x2f\x84\x3a\xcd\xa8";
+
+/* Signs with deterministic nonce without RNG */
+
+static SilcBool test_rfc6979(const SilcPKCSAlgorithm *alg)
+{
+  void *private_key = NULL;
+  SilcBool ret = FALSE;
+
+  SILC_LOG_DEBUG(("Import RFC 6979 private key"));
+  if (!silc_ecdsa_import_private_key(alg, (unsigned char *)rfc6979_key,
+				     sizeof(rfc6979_key) - 1, &private_key))
+    goto err;
+
+  SILC_LOG_DEBUG(("Sign without RNG"));
+  silc_ecdsa_sign(alg, private_key, (unsigned char *)"sample", 6, TRUE,
+		  NULL, NULL, sign_cb, NULL);
+  if (!signature || signature_len != sizeof(rfc6979_sig) - 1 ||
+      memcmp(signature, rfc6979_sig, signature_len))
+    goto err;
+
+  ret = TRUE;
+
+ err:
+  silc_free(signature);
+  signature = NULL;
+  if (private_key)
+    silc_ecdsa_private_key_free(alg, private_key);
+  return ret;
+}
+
+int main(int argc, char **argv)
+{
+  const SilcPKCSAlgorithm *alg;
+  SilcRng rng;
+
+  if (argc > 1 && !strcmp(argv[1], "-d")) {
+    silc_log_debug(TRUE);
+    silc_log_debug_hexdump(TRUE);
+    silc_log_set_debug_string("*ecdsa*,*ecp*,*pkcs*");
+  }
+
+  silc_crypto_init(NULL);
+
+  rng = silc_rng_alloc();
+  silc_rng_init(rng);
+
+  alg = silc_pkcs_find_algorithm("ecdsa", "ecdsa");
+  if (!alg)
+    goto err;
+
+  if (!test_curve(alg, 256, rng))
+    goto err;
+  if (!test_curve(alg, 384, rng))
+    goto err;
+  if (!test_rfc6979(alg))
+    goto err;
+
+  success = TRUE;
+
+ err:
+  silc_rng_free(rng);
+  SILC_LOG_DEBUG(("Testing was %s", success ? "SUCCESS" : "FAILURE"));
+  fprintf(stderr, "Testing was %s\n", success ? "SUCCESS" : "FAILURE");
+
+  return !success;
+}
@@ -0,0 +1,315 @@
+#include "silc.h"
+#include "ed25519.h"
+
+unsigned char *signature = NULL;
+SilcUInt32 signature_len;
+SilcBool success = FALSE;
+
+/* RFC 8032, 7.1, TEST 3 */
+const unsigned char sk[] =
+  "\xc5\xaa\x8d\xf4\x3f\x9f\x83\x7b\xed\xb7\x44\x2f\x31\xdc\xb7\xb1"
+  "\x66\xd3\x85\x35\x07\x6f\x09\x4b\x85\xce\x3a\x2e\x0b\x44\x58\xf7";
+const unsigned char pk[] =
+  "\xfc\x51\xcd\x8e\x62\x18\xa1\xa3\x8d\xa4\x7e\xd0\x02\x30\xf0\x58"
+  "\x08\x16\xed\x13\xba\x33\x03\xac\x5d\xeb\x91\x15\x48\x90\x80\x25";
+const unsigned char msg[] = "\xaf\x82";
+const unsigned char sig[] =
+  "\x62\x91\xd6\x57\xde\xec\x24\x02\x48\x27\xe6\x9c\x3a\xbe\x01\xa3"
+  "\x0c\xe5\x48\xa2\x84\x74\x3a\x44\x5e\x36\x80\xd7\xdb\x5a\xc3\xac"
+  "\x18\xff\x9b\x53\x8d\x16\xf2\x90\xae\x67\xf7\x60\x98\x4d\xc6\x59"
+  "\x4a\x7c\x15\xe9\x71\x6e\xd2\x8d\xc0\x27\xbe\xce\xea\x1e\xc4\x0a";
+
+/* RFC 7748, 6.1 */
+const unsigned char alice[] =
+  "\x77\x07\x6d\x0a\x73\x18\xa5\x7d\x3c\x16\xc1\x72\x51\xb2\x66\x45"
+  "\xdf\x4c\x2f\x87\xeb\xc0\x99\x2a\xb1\x77\xfb\xa5\x1d\xb9\x2c\x2a";
+const unsigned char bob_pub[] =
+  "\xde\x9e\xdb\x7d\x7b\x7d\xc1\xb4\xd3\x5b\x61\xc2\xec\xe4\x35\x37"
+  "\x3f\x83\x43\xc8\x5b\x78\x67\x4d\xad\xfc\x7e\x14\x6f\x88\x2b\x4f";
+const unsigned char shared[] =
+  "\x4a\x5d\x9d\x5b\xa4\xce\x2d\xe1\x72\x8e\x3b\xf4\x80\x35\x0f\x25"
+  "\xe0\x7e\x21\xc9\x47\xd1\x9e\x33\x76\xf0\x9b\x3c\x1e\x16\x17\x42";
+#define SHARED_LEN 32
+
+static void sign_cb(SilcBool success, const unsigned char *sig,
+		    SilcUInt32 sig_len, void *context)
+{
+  SILC_LOG_HEXDUMP(("Signature"), sig, sig_len);
+  silc_free(signature);
+  signature = silc_memdup(sig, sig_len);
+  signature_len = sig_len;
+}
+
+static void verify_cb(SilcBool s, void *context)
+{
+  SILC_LOG_DEBUG(("Verify %s", s ? "success" : "failed"));
+  success = s;
+}
+
+/* Signs and verifies the RFC 8032 test vector */
+
+static SilcBool test_vector(const SilcPKCSAlgorithm *alg)
+{
+  void *public_key = NULL, *private_key = NULL;
+  SilcBool ret = FALSE;
+
+  SILC_LOG_DEBUG(("Import test vector keys"));
+  if (!silc_ed25519_import_private_key(alg, (void *)sk, 32, &private_key))
+    goto err;
+  if (!silc_ed25519_import_public_key(alg, (void *)pk, 32, &public_key))
+    goto err;
+
+  SILC_LOG_DEBUG(("Sign test vector"));
+  silc_ed25519_sign(alg, private_key, (unsigned char *)msg, 2, FALSE, NULL,
+		    NULL, sign_cb, NULL);
+  if (!signature || signature_len != 64 || memcmp(signature, sig, 64))
+    goto err;
+
+  SILC_LOG_DEBUG(("Verify test vector"));
+  success = FALSE;
+  silc_ed25519_verify(alg, public_key, (unsigned char *)sig, 64,
+		      (unsigned char *)msg, 2, FALSE, NULL, NULL,
+		      verify_cb, NULL);
+  if (!success)
+    goto err;
+
+  ret = TRUE;
+
+ err:
+  silc_free(signature);
+  signature = NULL;
+  if (public_key)
+    silc_ed25519_public_key_free(alg, public_key);
+  if (private_key)
+    silc_ed25519_private_key_free(alg, private_key);
+  return ret;
+}
+
+/* Generates key, signs, verifies and verifies with wrong data */
+
+static SilcBool test_sign(const SilcPKCSAlgorithm *alg, SilcRng rng)
+{
+  void *public_key, *private_key, *pk2 = NULL, *prv2 = NULL;
+  unsigned char tmp[20], *pk, *prv;
+  SilcUInt32 pk_len, prv_len;
+  SilcBool ret = FALSE;
+
+  SILC_LOG_DEBUG(("Generate Ed25519 keypair"));
+  if (!silc_ed25519_generate_key(alg, 256, rng, &public_key, &private_key))
+    return FALSE;
+
+  SILC_LOG_DEBUG(("Export and import keys"));
+  pk = silc_ed25519_export_public_key(alg, NULL, public_key, &pk_len);
+  prv = silc_ed25519_export_private_key(alg, NULL, private_key, &prv_len);
+  if (!pk || !prv)
+    goto err;
+  if (!silc_ed25519_import_public_key(alg, pk, pk_len, &pk2))
+    goto err;
+  if (!silc_ed25519_import_private_key(alg, prv, prv_len, &prv2))
+    goto err;
+  silc_free(pk);
+  silc_free(prv);
+  if (!silc_ed25519_public_key_compare(alg, public_key, pk2))
+    goto err;
+
+  SILC_LOG_DEBUG(("Sign"));
+  memset(tmp, 0, sizeof(tmp));
+  silc_ed25519_sign(alg, prv2, tmp, sizeof(tmp), TRUE, NULL, rng,
+		    sign_cb, NULL);
+  if (!signature)
+    goto err;
+
+  SILC_LOG_DEBUG(("Verify"));
+  success = FALSE;
+  silc_ed25519_verify(alg, public_key, signature, signature_len,
+		      tmp, sizeof(tmp), TRUE, NULL, rng, verify_cb, NULL);
+  if (!success)
+    goto err;
+
+  SILC_LOG_DEBUG(("Verify with wrong data"));
+  tmp[0] ^= 1;
+  silc_ed25519_verify(alg, public_key, signature, signature_len,
+		      tmp, sizeof(tmp), TRUE, NULL, rng, verify_cb, NULL);
+  if (success)
+    goto err;
+
+  ret = TRUE;
+
+ err:
+  silc_free(signature);
+  signature = NULL;
+  silc_ed25519_public_key_free(alg, public_key);
+  silc_ed25519_private_key_free(alg, private_key);
+  if (pk2)
+    silc_ed25519_public_key_free(alg, pk2);
+  if (prv2)
+    silc_ed25519_private_key_free(alg, prv2);
+  return ret;
+}
+
+/* Verifies batch of signatures with one invalid signature */
+
+static SilcBool test_batch(SilcRng rng)
+{
+  SilcPublicKey public_key[4];
+  SilcPrivateKey private_key[4];
+  SilcPKCSVerifyEntry entries[40];
+  unsigned char sigs[40][64], data[40][8];
+  SilcUInt32 i, sig_len;
+  SilcBool ret = FALSE;
+
+  SILC_LOG_DEBUG(("Generate SILC Ed25519 keypairs"));
+  memset(public_key, 0, sizeof(public_key));
+  memset(private_key, 0, sizeof(private_key));
+  for (i = 0; i < 4; i++)
+    if (!silc_pkcs_silc_generate_key("ed25519", 256,
+				     "UN=foo, HN=bar, RN=Foo Bar", rng,
+				     &public_key[i], &private_key[i]))
+      goto err;
+
+  SILC_LOG_DEBUG(("Sign"));
+  for (i = 0; i < 40; i++) {
+    memset(data[i], i, sizeof(data[i]));
+    if (!silc_pkcs_sign(private_key[i % 4], data[i], sizeof(data[i]),
+			sigs[i], sizeof(sigs[i]), &sig_len, FALSE, NULL, rng))
+      goto err;
+    entries[i].public_key = public_key[i % 4];
+    entries[i].signature = sigs[i];
+    entries[i].signature_len = sig_len;
+    entries[i].data = data[i];
+    entries[i].data_len = sizeof(data[i]);
+  }
+
+  SILC_LOG_DEBUG(("Verify batch"));
+  if (silc_pkcs_verify_batch(entries, 40, FALSE, NULL, NULL) != 40)
+    goto err;
+
+  SILC_LOG_DEBUG(("Verify batch with wrong data"));
+  data[17][0] ^= 1;
+  if (silc_pkcs_verify_batch(entries, 40, FALSE, NULL, NULL) != 39)
+    goto err;
+  if (entries[17].success || !entries[16].success)
+    goto err;
+
+  ret = TRUE;
+
+ err:
+  for (i = 0; i < 4; i++) {
+    if (public_key[i])
+      silc_pkcs_public_key_free(public_key[i]);
+    if (private_key[i])
+      silc_pkcs_private_key_free(private_key[i]);
+  }
+  return ret;
+}
+
+/* Computes the RFC 7748 X25519 test vector and key agreement */
+
+static SilcBool test_x25519(void)
+{
+  SilcDH dh1 = NULL, dh2 = NULL;
+  const SilcMPInt *y1, *y2;
+  unsigned char *z1 = NULL, *z2 = NULL;
+  SilcUInt32 z1_len, z2_len;
+  SilcMPInt x, y;
+  SilcBool ret = FALSE;
+
+  silc_mp_init(&x);
+  silc_mp_init(&y);
+
+  SILC_LOG_DEBUG(("X25519 test vector"));
+  dh1 = silc_dh_alloc_x25519();
+  if (!dh1)
+    goto err;
+  if (!silc_dh_generate_private(dh1, NULL))
+    goto err;
+  silc_mp_bin2mp((unsigned char *)alice, 32, &x);
+  silc_mp_set(dh1->my_x, &x);
+  silc_mp_bin2mp((unsigned char *)bob_pub, 32, &y);
+  if (!silc_dh_set_remote_public(dh1, &y))
+    goto err;
+  if (!silc_dh_compute_key_data(dh1, &z1, &z1_len))
+    goto err;
+  if (z1_len != SHARED_LEN || memcmp(z1, shared, SHARED_LEN))
+    goto err;
+  silc_free(z1);
+  z1 = NULL;
+  silc_dh_free(dh1);
+
+  SILC_LOG_DEBUG(("X25519 key agreement"));
+  dh1 = silc_dh_alloc_x25519();
+  dh2 = silc_dh_alloc_x25519();
+  if (!dh1 || !dh2)
+    goto err;
+  if (!silc_dh_generate_private(dh1, NULL) ||
+      !silc_dh_generate_private(dh2, NULL))
+    goto err;
+  if (!silc_dh_compute_public(dh1, &y1) ||
+      !silc_dh_compute_public(dh2, &y2))
+    goto err;
+  if (!silc_dh_set_remote_public(dh1, (SilcMPInt *)y2) ||
+      !silc_dh_set_remote_public(dh2, (SilcMPInt *)y1))
+    goto err;
+  if (!silc_dh_compute_key_data(dh1, &z1, &z1_len) ||
+      !silc_dh_compute_key_data(dh2, &z2, &z2_len))
+    goto err;
+  if (z1_len != z2_len || memcmp(z1, z2, z1_len))
+    goto err;
+
+  SILC_LOG_DEBUG(("X25519 with zero public value"));
+  silc_mp_set_ui(&y, 0);
+  if (!silc_dh_set_remote_public(dh1, &y))
+    goto err;
+  if (silc_dh_compute_key(dh1, NULL))
+    goto err;
+
+  ret = TRUE;
+
+ err:
+  silc_free(z1);
+  silc_free(z2);
+  silc_dh_free(dh1);
+  silc_dh_free(dh2);
+  silc_mp_uninit(&x);
+  silc_mp_uninit(&y);
+  return ret;
+}
+
+int main(int argc, char **argv)
+{
+  const SilcPKCSAlgorithm *alg;
+  SilcRng rng;
+
+  if (argc > 1 && !strcmp(argv[1], "-d")) {
+    silc_log_debug(TRUE);
+    silc_log_debug_hexdump(TRUE);
+    silc_log_set_debug_string("*ed25519*,*c25519*,*pkcs*,*dh*");
+  }
+
+  silc_crypto_init(NULL);
+
+  rng = silc_rng_alloc();
+  silc_rng_init(rng);
+
+  alg = silc_pkcs_find_algorithm("ed25519", "ed25519");
+  if (!alg)
+    goto err;
+
+  if (!test_vector(alg))
+    goto err;
+  if (!test_sign(alg, rng))
+    goto err;
+  if (!test_batch(rng))
+    goto err;
+  if (!test_x25519())
+    goto err;
+
+  success = TRUE;
+
+ err:
+  silc_rng_free(rng);
+  SILC_LOG_DEBUG(("Testing was %s", success ? "SUCCESS" : "FAILURE"));
+  fprintf(stderr, "Testing was %s\n", success ? "SUCCESS" : "FAILURE");
+
+  return !success;
+}
@@ -0,0 +1,290 @@
+/* Tests SILC public key routines in silcpkcs.h */
+#include "silc.h"
+
+SilcBool success = FALSE;
+
+/* Verifies with public key that borrows the encoded key */
+
+static SilcBool test_view(SilcRng rng)
+{
+  SilcPublicKey public_key = NULL, view = NULL, copy = NULL;
+  SilcPrivateKey private_key = NULL;
+  SilcSILCPublicKey silc_pubkey;
+  SilcPKCSVerifyCacheStats stats;
+  unsigned char *pk = NULL, *pk2 = NULL, sig[64], data[32];
+  char *fp = NULL, *fp2 = NULL;
+  SilcUInt32 pk_len, pk2_len, sig_len;
+  SilcBool ret = FALSE;
+
+  SILC_LOG_DEBUG(("Generate SILC Ed25519 keypair"));
+  if (!silc_pkcs_silc_generate_key("ed25519", 256,
+				   "UN=foo, HN=bar, RN=Foo Bar, V=2", rng,
+				   &public_key, &private_key))
+    goto err;
+  pk = silc_pkcs_public_key_encode(NULL, public_key, &pk_len);
+  if (!pk)
+    goto err;
+
+  SILC_LOG_DEBUG(("Borrow encoded public key"));
+  if (!silc_pkcs_public_key_view(SILC_PKCS_SILC, pk, pk_len, &view))
+    goto err;
+  silc_pubkey = silc_pkcs_public_key_get_pkcs(SILC_PKCS_SILC, view);
+  if (!silc_pubkey || !silc_pubkey->ident || silc_pubkey->identifier.username)
+    goto err;
+  if (silc_pkcs_silc_public_key_version(view) != 2)
+    goto err;
+  if (!silc_pkcs_public_key_compare(public_key, view))
+    goto err;
+
+  SILC_LOG_DEBUG(("Compare public key digests"));
+  if (!silc_pkcs_public_key_get_digest(public_key) ||
+      !silc_pkcs_public_key_get_digest(view) ||
+      memcmp(silc_pkcs_public_key_get_digest(public_key),
+	     silc_pkcs_public_key_get_digest(view), SILC_PKCS_DIGEST_LEN))
+    goto err;
+  if (silc_hash_public_key(public_key, NULL) !=
+      silc_hash_public_key(view, NULL) ||
+      !silc_hash_public_key_compare(public_key, view, NULL))
+    goto err;
+  fp = silc_pkcs_public_key_get_fingerprint(view);
+  if (!fp)
+    goto err;
+  SILC_LOG_DEBUG(("Fingerprint %s", fp));
+  fp2 = silc_fingerprint(silc_pkcs_public_key_get_digest(public_key),
+			 SILC_PKCS_DIGEST_LEN);
+  if (!fp2 || strcmp(fp, fp2))
+    goto err;
+
+  SILC_LOG_DEBUG(("Verify with borrowed key"));
+  memset(data, 'a', sizeof(data));
+  if (!silc_pkcs_sign(private_key, data, sizeof(data), sig, sizeof(sig),
+		      &sig_len, FALSE, NULL, rng))
+    goto err;
+  if (!silc_pkcs_verify(view, sig, sig_len, data, sizeof(data), FALSE, NULL))
+    goto err;
+
+  SILC_LOG_DEBUG(("Verify with verification cache"));
+  if (!silc_pkcs_verify_cache_set(2, FALSE))
+    goto err;
+  silc_pkcs_public_key_set_verify_cache(public_key, TRUE);
+  if (!silc_pkcs_verify(public_key, sig, sig_len, data, sizeof(data),
+			FALSE, NULL) ||
+      !silc_pkcs_verify(public_key, sig, sig_len, data, sizeof(data),
+			FALSE, NULL))
+    goto err;
+  data[0] ^= 1;
+  if (silc_pkcs_verify(public_key, sig, sig_len, data, sizeof(data),
+		       FALSE, NULL))
+    goto err;
+  data[0] ^= 1;
+  silc_pkcs_verify_cache_get_stats(&stats);
+  SILC_LOG_DEBUG(("Cache count %d, hits %d, misses %d", stats.count,
+		  (int)stats.hits, (int)stats.misses));
+  if (stats.size != 2 || stats.count != 1 || stats.hits != 1 ||
+      stats.misses != 2)
+    goto err;
+  silc_pkcs_verify_cache_set(0, FALSE);
+
+  SILC_LOG_DEBUG(("Encode borrowed key"));
+  pk2 = silc_pkcs_public_key_encode(NULL, view, &pk2_len);
+  if (!pk2 || pk2_len != pk_len || memcmp(pk, pk2, pk_len))
+    goto err;
+
+  SILC_LOG_DEBUG(("Copy borrowed key"));
+  copy = silc_pkcs_public_key_copy(view);
+  if (!copy)
+    goto err;
+  silc_pubkey = silc_pkcs_public_key_get_pkcs(SILC_PKCS_SILC, copy);
+  if (silc_pubkey->ident || !silc_pubkey->identifier.username ||
+      strcmp(silc_pubkey->identifier.username, "foo"))
+    goto err;
+  if (!silc_pkcs_public_key_compare(copy, view))
+    goto err;
+  if (!silc_pkcs_public_key_get_digest(copy) ||
+      memcmp(silc_pkcs_public_key_get_digest(copy),
+	     silc_pkcs_public_key_get_digest(view), SILC_PKCS_DIGEST_LEN))
+    goto err;
+
+  ret = TRUE;
+
+ err:
+  if (view)
+    silc_pkcs_public_key_free(view);
+  if (copy)
+    silc_pkcs_public_key_free(copy);
+  if (public_key)
+    silc_pkcs_public_key_free(public_key);
+  if (private_key)
+    silc_pkcs_private_key_free(private_key);
+  silc_free(pk);
+  silc_free(pk2);
+  silc_free(fp);
+  silc_free(fp2);
+  return ret;
+}
+
+/* Imports malformed SILC public keys */
+
+static SilcBool test_malformed(SilcRng rng)
+{
+  SilcPublicKey public_key = NULL, key = NULL;
+  SilcPrivateKey private_key = NULL;
+  unsigned char *pk = NULL, *bad = NULL;
+  SilcUInt32 pk_len, pkcs_len;
+  SilcBool ret = FALSE;
+
+  SILC_LOG_DEBUG(("Generate SILC RSA keypair"));
+  if (!silc_pkcs_silc_generate_key("rsa", 1024,
+				   "UN=foo, HN=bar, RN=Foo Bar, V=2", rng,
+				   &public_key, &private_key))
+    goto err;
+  pk = silc_pkcs_public_key_encode(NULL, public_key, &pk_len);
+  if (!pk)
+    goto err;
+  bad = silc_memdup(pk, pk_len);
+  if (!bad)
+    goto err;
+
+  SILC_LOG_DEBUG(("Import truncated public key"));
+  if (silc_pkcs_public_key_alloc(SILC_PKCS_SILC, bad, pk_len - 1, &key) ||
+      silc_pkcs_public_key_view(SILC_PKCS_SILC, bad, pk_len - 1, &key))
+    goto err;
+
+  SILC_LOG_DEBUG(("Import public key with too short identifier"));
+  SILC_GET16_MSB(pkcs_len, bad + 4);
+  SILC_PUT16_MSB(2, bad + 6 + pkcs_len);
+  if (silc_pkcs_public_key_alloc(SILC_PKCS_SILC, bad, pk_len, &key) ||
+      silc_pkcs_public_key_view(SILC_PKCS_SILC, bad, pk_len, &key))
+    goto err;
+
+  SILC_LOG_DEBUG(("Import public key with too long identifier"));
+  SILC_PUT16_MSB(pk_len, bad + 6 + pkcs_len);
+  if (silc_pkcs_public_key_alloc(SILC_PKCS_SILC, bad, pk_len, &key) ||
+      silc_pkcs_public_key_view(SILC_PKCS_SILC, bad, pk_len, &key))
+    goto err;
+
+  SILC_LOG_DEBUG(("Import public key with truncated key data"));
+  memcpy(bad, pk, pk_len);
+  SILC_PUT32_MSB(pk_len - 8 - 4, bad);
+  if (silc_pkcs_public_key_alloc(SILC_PKCS_SILC, bad, pk_len - 8, &key) ||
+      silc_pkcs_public_key_view(SILC_PKCS_SILC, bad, pk_len - 8, &key))
+    goto err;
+
+  SILC_LOG_DEBUG(("Import original public key"));
+  if (!silc_pkcs_public_key_alloc(SILC_PKCS_SILC, pk, pk_len, &key))
+    goto err;
+  if (!silc_pkcs_public_key_compare(public_key, key))
+    goto err;
+
+  ret = TRUE;
+
+ err:
+  if (key)
+    silc_pkcs_public_key_free(key);
+  if (public_key)
+    silc_pkcs_public_key_free(public_key);
+  if (private_key)
+    silc_pkcs_private_key_free(private_key);
+  silc_free(pk);
+  silc_free(bad);
+  return ret;
+}
+
+/* Verifies Ed25519 batch with verification cache */
+
+static SilcBool test_batch_cache(SilcRng rng)
+{
+  SilcPublicKey public_key = NULL;
+  SilcPrivateKey private_key = NULL;
+  SilcPKCSVerifyEntry entries[8];
+  SilcPKCSVerifyCacheStats stats;
+  unsigned char sigs[8][64], data[8][8];
+  SilcUInt32 i, sig_len;
+  SilcBool ret = FALSE;
+
+  SILC_LOG_DEBUG(("Generate SILC Ed25519 keypair"));
+  if (!silc_pkcs_silc_generate_key("ed25519", 256,
+				   "UN=foo, HN=bar, RN=Foo Bar", rng,
+				   &public_key, &private_key))
+    goto err;
+
+  for (i = 0; i < 8; i++) {
+    memset(data[i], i, sizeof(data[i]));
+    if (!silc_pkcs_sign(private_key, data[i], sizeof(data[i]),
+			sigs[i], sizeof(sigs[i]), &sig_len, FALSE, NULL, rng))
+      goto err;
+    entries[i].public_key = public_key;
+    entries[i].signature = sigs[i];
+    entries[i].signature_len = sig_len;
+    entries[i].data = data[i];
+    entries[i].data_len = sizeof(data[i]);
+  }
+
+  SILC_LOG_DEBUG(("Verify batch with verification cache"));
+  if (!silc_pkcs_verify_cache_set(16, TRUE))
+    goto err;
+  data[3][0] ^= 1;
+  if (silc_pkcs_verify_batch(entries, 8, FALSE, NULL, NULL) != 7)
+    goto err;
+  silc_pkcs_verify_cache_get_stats(&stats);
+  if (stats.count != 7 || stats.hits != 0 || stats.misses != 8)
+    goto err;
+
+  SILC_LOG_DEBUG(("Verify batch again from cache"));
+  if (silc_pkcs_verify_batch(entries, 8, FALSE, NULL, NULL) != 7 ||
+      entries[3].success || !entries[4].success)
+    goto err;
+  silc_pkcs_verify_cache_get_stats(&stats);
+  if (stats.count != 7 || stats.hits != 7 || stats.misses != 9)
+    goto err;
+
+  SILC_LOG_DEBUG(("Verify cached signature one by one"));
+  if (!silc_pkcs_verify(public_key, sigs[0], sig_len, data[0],
+			sizeof(data[0]), FALSE, NULL))
+    goto err;
+  silc_pkcs_verify_cache_get_stats(&stats);
+  if (stats.hits != 8)
+    goto err;
+
+  ret = TRUE;
+
+ err:
+  silc_pkcs_verify_cache_set(0, FALSE);
+  if (public_key)
+    silc_pkcs_public_key_free(public_key);
+  if (private_key)
+    silc_pkcs_private_key_free(private_key);
+  return ret;
+}
+
+int main(int argc, char **argv)
+{
+  SilcRng rng;
+
+  if (argc > 1 && !strcmp(argv[1], "-d")) {
+    silc_log_debug(TRUE);
+    silc_log_debug_hexdump(TRUE);
+    silc_log_set_debug_string("*pkcs*,*silcpk*");
+  }
+
+  silc_crypto_init(NULL);
+
+  rng = silc_rng_alloc();
+  silc_rng_init(rng);
+
+  if (!test_view(rng))
+    goto err;
+  if (!test_malformed(rng))
+    goto err;
+  if (!test_batch_cache(rng))
+    goto err;
+
+  success = TRUE;
+
+ err:
+  silc_rng_free(rng);
+  SILC_LOG_DEBUG(("Testing was %s", success ? "SUCCESS" : "FAILURE"));
+  fprintf(stderr, "Testing was %s\n", success ? "SUCCESS" : "FAILURE");
+
+  return !success;
+}
@@ -0,0 +1,325 @@
+#include "silc.h"
+
+unsigned char *result = NULL;
+SilcUInt32 result_len;
+SilcBool success = FALSE;
+
+static void data_cb(SilcBool s, const unsigned char *data,
+		    SilcUInt32 data_len, void *context)
+{
+  silc_free(result);
+  result = NULL;
+  if (!s)
+    return;
+  SILC_LOG_HEXDUMP(("Data"), (unsigned char *)data, data_len);
+  result = silc_memdup(data, data_len);
+  result_len = data_len;
+}
+
+static void verify_cb(SilcBool s, void *context)
+{
+  SILC_LOG_DEBUG(("Verify %s", s ? "success" : "failed"));
+  success = s;
+}
+
+/* Signs and verifies with RSASSA-PSS, encrypts and decrypts with
+   RSAES-OAEP */
+
+static SilcBool test_key(SilcUInt32 bits, SilcRng rng)
+{
+  const SilcPKCSAlgorithm *pss, *oaep, *pkcs1;
+  void *public_key = NULL, *private_key = NULL;
+  unsigned char data[32], *sig = NULL;
+  SilcUInt32 sig_len;
+  SilcHash sha256 = NULL;
+  SilcBool ret = FALSE;
+
+  pss = silc_pkcs_find_algorithm("rsa", "pkcs1-pss");
+  oaep = silc_pkcs_find_algorithm("rsa", "pkcs1-oaep");
+  pkcs1 = silc_pkcs_find_algorithm("rsa", "pkcs1");
+  if (!pss || !oaep || !pkcs1)
+    return FALSE;
+  if (!silc_hash_alloc("sha256", &sha256))
+    return FALSE;
+
+  SILC_LOG_DEBUG(("Generate RSA keypair, %d bits", bits));
+  if (!pss->generate_key(pss, bits, rng, &public_key, &private_key))
+    goto err;
+  silc_rng_get_rn_data(rng, sizeof(data), data, sizeof(data));
+
+  SILC_LOG_DEBUG(("RSASSA-PSS sign"));
+  pss->sign(pss, private_key, data, sizeof(data), TRUE, sha256, rng,
+	    data_cb, NULL);
+  if (!result || result_len != (bits + 7) / 8)
+    goto err;
+  sig = result;
+  sig_len = result_len;
+  result = NULL;
+
+  SILC_LOG_DEBUG(("RSASSA-PSS verify"));
+  success = FALSE;
+  pss->verify(pss, public_key, sig, sig_len, data, sizeof(data), TRUE,
+	      sha256, NULL, verify_cb, NULL);
+  if (!success)
+    goto err;
+
+  SILC_LOG_DEBUG(("RSASSA-PSS verify with wrong hash"));
+  pss->verify(pss, public_key, sig, sig_len, data, sizeof(data), TRUE,
+	      NULL, NULL, verify_cb, NULL);
+  if (success)
+    goto err;
+
+  SILC_LOG_DEBUG(("RSASSA-PSS verify with wrong data"));
+  data[0] ^= 1;
+  pss->verify(pss, public_key, sig, sig_len, data, sizeof(data), TRUE,
+	      sha256, NULL, verify_cb, NULL);
+  if (success)
+    goto err;
+  data[0] ^= 1;
+
+  SILC_LOG_DEBUG(("RSASSA-PKCS1-v1_5 verify of RSASSA-PSS signature"));
+  pkcs1->verify(pkcs1, public_key, sig, sig_len, data, sizeof(data), TRUE,
+		sha256, NULL, verify_cb, NULL);
+  if (success)
+    goto err;
+
+  SILC_LOG_DEBUG(("RSAES-OAEP encrypt"));
+  oaep->encrypt(oaep, public_key, data, sizeof(data), rng, data_cb, NULL);
+  if (!result || result_len != (bits + 7) / 8)
+    goto err;
+  silc_free(sig);
+  sig = result;
+  sig_len = result_len;
+  result = NULL;
+
+  SILC_LOG_DEBUG(("RSAES-OAEP decrypt"));
+  oaep->decrypt(oaep, private_key, sig, sig_len, data_cb, NULL);
+  if (!result || result_len != sizeof(data) ||
+      memcmp(result, data, sizeof(data)))
+    goto err;
+  silc_free(result);
+  result = NULL;
+
+  SILC_LOG_DEBUG(("RSAES-OAEP decrypt modified block"));
+  sig[sig_len - 1] ^= 1;
+  oaep->decrypt(oaep, private_key, sig, sig_len, data_cb, NULL);
+  if (result)
+    goto err;
+
+  ret = TRUE;
+
+ err:
+  silc_free(sig);
+  silc_free(result);
+  result = NULL;
+  if (public_key)
+    pss->public_key_free(pss, public_key);
+  if (private_key)
+    pss->private_key_free(pss, private_key);
+  silc_hash_free(sha256);
+  return ret;
+}
+
+/* Generates multi-prime key, signs, verifies, encrypts and decrypts with
+   it, and exports and imports it with the other prime infos */
+
+static SilcBool test_multi_prime(const char *scheme, SilcUInt32 bits,
+				 SilcRng rng)
+{
+  const SilcPKCSAlgorithm *alg;
+  void *public_key = NULL, *private_key = NULL, *private_key2 = NULL;
+  unsigned char data[32], *sig = NULL, *key = NULL, *key2 = NULL;
+  SilcUInt32 sig_len, key_len, key2_len;
+  SilcHash sha1 = NULL;
+  SilcBool ret = FALSE;
+
+  alg = silc_pkcs_find_algorithm("rsa", scheme);
+  if (!alg)
+    return FALSE;
+  if (!silc_hash_alloc("sha1", &sha1))
+    return FALSE;
+
+  SILC_LOG_DEBUG(("Generate %s RSA keypair, %d bits", scheme, bits));
+  if (!alg->generate_key(alg, bits, rng, &public_key, &private_key))
+    goto err;
+  if (alg->private_key_bitlen(alg, private_key) != bits)
+    goto err;
+  silc_rng_get_rn_data(rng, sizeof(data), data, sizeof(data));
+
+  SILC_LOG_DEBUG(("Sign"));
+  alg->sign(alg, private_key, data, sizeof(data), TRUE, sha1, rng,
+	    data_cb, NULL);
+  if (!result || result_len != bits / 8)
+    goto err;
+  sig = result;
+  sig_len = result_len;
+  result = NULL;
+
+  SILC_LOG_DEBUG(("Verify"));
+  success = FALSE;
+  alg->verify(alg, public_key, sig, sig_len, data, sizeof(data), TRUE,
+	      sha1, NULL, verify_cb, NULL);
+  if (!success)
+    goto err;
+
+  SILC_LOG_DEBUG(("Verify with wrong data"));
+  data[0] ^= 1;
+  alg->verify(alg, public_key, sig, sig_len, data, sizeof(data), TRUE,
+	      sha1, NULL, verify_cb, NULL);
+  if (success)
+    goto err;
+  data[0] ^= 1;
+
+  SILC_LOG_DEBUG(("Encrypt"));
+  alg->encrypt(alg, public_key, data, sizeof(data), rng, data_cb, NULL);
+  if (!result || result_len != bits / 8)
+    goto err;
+  key = result;
+  key_len = result_len;
+  result = NULL;
+
+  SILC_LOG_DEBUG(("Decrypt"));
+  alg->decrypt(alg, private_key, key, key_len, data_cb, NULL);
+  if (!result || result_len != sizeof(data) ||
+      memcmp(result, data, sizeof(data)))
+    goto err;
+  silc_free(result);
+  result = NULL;
+  silc_free(key);
+
+  SILC_LOG_DEBUG(("Export private key"));
+  key = alg->export_private_key(alg, NULL, private_key, &key_len);
+  if (!key)
+    goto err;
+
+  SILC_LOG_DEBUG(("Import private key"));
+  if (alg->import_private_key(alg, key, key_len, &private_key2) != key_len)
+    goto err;
+  key2 = alg->export_private_key(alg, NULL, private_key2, &key2_len);
+  if (!key2 || key2_len != key_len || memcmp(key, key2, key_len))
+    goto err;
+
+  SILC_LOG_DEBUG(("Sign with imported key"));
+  alg->sign(alg, private_key2, data, sizeof(data), TRUE, sha1, rng,
+	    data_cb, NULL);
+  if (!result || result_len != sig_len || memcmp(result, sig, sig_len))
+    goto err;
+
+  ret = TRUE;
+
+ err:
+  silc_free(sig);
+  silc_free(key);
+  silc_free(key2);
+  silc_free(result);
+  result = NULL;
+  if (public_key)
+    alg->public_key_free(alg, public_key);
+  if (private_key)
+    alg->private_key_free(alg, private_key);
+  if (private_key2)
+    alg->private_key_free(alg, private_key2);
+  silc_hash_free(sha1);
+  return ret;
+}
+
+/* Signs data added in pieces to hash context */
+
+static SilcBool test_sign_hash(SilcRng rng)
+{
+  SilcPublicKey public_key = NULL;
+  SilcPrivateKey private_key = NULL;
+  unsigned char data[4096], sig[512], sig2[512];
+  SilcUInt32 sig_len, sig2_len, i;
+  SilcHash sha256 = NULL;
+  SilcBool ret = FALSE;
+
+  if (!silc_hash_alloc("sha256", &sha256))
+    return FALSE;
+
+  SILC_LOG_DEBUG(("Generate SILC RSA keypair"));
+  if (!silc_pkcs_silc_generate_key("rsa", 2048,
+				   "UN=foo, HN=bar, RN=Foo Bar, V=2", rng,
+				   &public_key, &private_key))
+    goto err;
+  silc_rng_get_rn_data(rng, sizeof(data), data, sizeof(data));
+
+  SILC_LOG_DEBUG(("Sign hash"));
+  silc_hash_init(sha256);
+  for (i = 0; i < sizeof(data); i += 512)
+    silc_hash_update(sha256, data + i, 512);
+  if (!silc_pkcs_sign_hash(private_key, sha256, sig, sizeof(sig), &sig_len,
+			   rng))
+    goto err;
+
+  SILC_LOG_DEBUG(("Compare to signature of the data"));
+  if (!silc_pkcs_sign(private_key, data, sizeof(data), sig2, sizeof(sig2),
+		      &sig2_len, TRUE, sha256, rng))
+    goto err;
+  if (sig_len != sig2_len || memcmp(sig, sig2, sig_len))
+    goto err;
+
+  SILC_LOG_DEBUG(("Verify hash"));
+  silc_hash_init(sha256);
+  for (i = 0; i < sizeof(data); i += 1024)
+    silc_hash_update(sha256, data + i, 1024);
+  if (!silc_pkcs_verify_hash(public_key, sig, sig_len, sha256))
+    goto err;
+  if (!silc_pkcs_verify(public_key, sig, sig_len, data, sizeof(data),
+			TRUE, NULL))
+    goto err;
+
+  SILC_LOG_DEBUG(("Verify hash with wrong data"));
+  silc_hash_init(sha256);
+  silc_hash_update(sha256, data, sizeof(data) - 1);
+  if (silc_pkcs_verify_hash(public_key, sig, sig_len, sha256))
+    goto err;
+
+  ret = TRUE;
+
+ err:
+  if (public_key)
+    silc_pkcs_public_key_free(public_key);
+  if (private_key)
+    silc_pkcs_private_key_free(private_key);
+  silc_hash_free(sha256);
+  return ret;
+}
+
+int main(int argc, char **argv)
+{
+  SilcRng rng;
+
+  if (argc > 1 && !strcmp(argv[1], "-d")) {
+    silc_log_debug(TRUE);
+    silc_log_debug_hexdump(TRUE);
+    silc_log_set_debug_string("*pkcs*,*rsa*");
+  }
+
+  silc_crypto_init(NULL);
+
+  rng = silc_rng_alloc();
+  silc_rng_init(rng);
+
+  if (!test_key(1024, rng))
+    goto err;
+  if (!test_key(2048, rng))
+    goto err;
+  if (!test_key(1028, rng))
+    goto err;
+  if (!test_sign_hash(rng))
+    goto err;
+  if (!test_multi_prime("pkcs1-mp3", 4096, rng))
+    goto err;
+  if (!test_multi_prime("pkcs1-mp4", 8192, rng))
+    goto err;
+
+  success = TRUE;
+
+ err:
+  silc_rng_free(rng);
+  SILC_LOG_DEBUG(("Testing was %s", success ? "SUCCESS" : "FAILURE"));
+  fprintf(stderr, "Testing was %s\n", success ? "SUCCESS" : "FAILURE");
+
+  return !success;
+}
@@ -32,6 +32,18 @@ SilcBool silc_mp_sinit(SilcStack stack, SilcMPInt *mp)
   return TRUE;
 }
 
+SilcBool silc_mp_init_size(SilcMPInt *mp, SilcUInt32 bits)
+{
+  mpz_init2(mp, bits);
+  return TRUE;
+}
+
+SilcBool silc_mp_sinit_size(SilcStack stack, SilcMPInt *mp, SilcUInt32 bits)
+{
+  mpz_init2(mp, bits);
+  return TRUE;
+}
+
 void silc_mp_uninit(SilcMPInt *mp)
 {
   mpz_clear(mp);
@@ -200,6 +212,13 @@ SilcBool silc_mp_pow_mod(SilcMPInt *dst, SilcMPInt *mp1, SilcMPInt *exp,
   return TRUE;
 }
 
+SilcBool silc_mp_pow_mod_secret(SilcMPInt *dst, SilcMPInt *mp1,
+				SilcMPInt *exp, SilcMPInt *mod)
+{
+  mpz_powm_sec(dst, mp1, exp, mod);
+  return TRUE;
+}
+
 SilcBool silc_mp_pow_mod_ui(SilcMPInt *dst, SilcMPInt *mp1, SilcUInt32 exp,
 			SilcMPInt *mod)
 {
@@ -207,6 +226,54 @@ SilcBool silc_mp_pow_mod_ui(SilcMPInt *dst, SilcMPInt *mp1, SilcUInt32 exp,
   return TRUE;
 }
 
+/* GMP does not expose the Montgomery values, so the context is just the
+   modulus. */
+
+SilcBool silc_mp_mont_init(SilcMPMont *mont, SilcMPInt *mod)
+{
+  mpz_init_set(mont, mod);
+  return TRUE;
+}
+
+void silc_mp_mont_uninit(SilcMPMont *mont)
+{
+  mpz_clear(mont);
+}
+
+SilcBool silc_mp_pow_mod_mont(SilcMPInt *dst, SilcMPInt *mp1, SilcMPInt *exp,
+			      SilcMPMont *mont)
+{
+  mpz_powm(dst, mp1, exp, mont);
+  return TRUE;
+}
+
+SilcBool silc_mp_pow_mod_mont_secret(SilcMPInt *dst, SilcMPInt *mp1,
+				     SilcMPInt *exp, SilcMPMont *mont)
+{
+  mpz_powm_sec(dst, mp1, exp, mont);
+  return TRUE;
+}
+
+SilcBool silc_mp_mont_to(SilcMPInt *dst, SilcMPInt *src, SilcMPMont *mont)
+{
+  mpz_mod(dst, src, mont);
+  return TRUE;
+}
+
+SilcBool silc_mp_mont_mul(SilcMPInt *dst, SilcMPInt *mp1, SilcMPInt *mp2,
+			  SilcMPMont *mont)
+{
+  mpz_mul(dst, mp1, mp2);
+  mpz_mod(dst, dst, mont);
+  return TRUE;
+}
+
+SilcBool silc_mp_mont_from(SilcMPInt *dst, SilcMPInt *src, SilcMPMont *mont)
+{
+  mpz_set(dst, src);
+  return TRUE;
+}
+
 SilcBool silc_mp_gcd(SilcMPInt *dst, SilcMPInt *mp1, SilcMPInt *mp2)
 {
   mpz_gcd(dst, mp1, mp2);
@@ -257,3 +324,19 @@ SilcBool silc_mp_xor(SilcMPInt *dst, SilcMPInt *mp1, SilcMPInt *mp2)
   mpz_xor(dst, mp1, mp2);
   return TRUE;
 }
+
+void silc_mp_mp2bin_noalloc(SilcMPInt *val, unsigned char *dst,
+			    SilcUInt32 dst_len)
+{
+  SilcUInt32 i;
+
+  for (i = 0; i < dst_len; i++)
+    dst[dst_len - 1 - i] =
+      (unsigned char)(mpz_getlimbn(val, i / sizeof(mp_limb_t)) >>
+		      ((i % sizeof(mp_limb_t)) * 8));
+}
+
+void silc_mp_bin2mp(unsigned char *data, SilcUInt32 len, SilcMPInt *ret)
+{
+  mpz_import(ret, len, 1, 1, 1, 0, data);
+}
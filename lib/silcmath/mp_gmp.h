@@ -23,5 +23,6 @@
 #include <gmp.h>
 
 #define SILC_MP_INT MP_INT
+#define SILC_MP_MONT MP_INT
 
 #endif
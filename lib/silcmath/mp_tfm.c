@@ -42,6 +42,24 @@ SilcBool silc_mp_sinit(SilcStack stack, SilcMPInt *mp)
   return TRUE;
 }
 
+SilcBool silc_mp_init_size(SilcMPInt *mp, SilcUInt32 bits)
+{
+  return silc_mp_sinit_size(NULL, mp, bits);
+}
+
+SilcBool silc_mp_sinit_size(SilcStack stack, SilcMPInt *mp, SilcUInt32 bits)
+{
+  int ret;
+  if (!bits)
+    return silc_mp_sinit(stack, mp);
+  if ((ret = tfm_fp_init_size(stack, mp,
+			      (bits + DIGIT_BIT - 1) / DIGIT_BIT))) {
+    silc_mp_set_errno(ret);
+    return FALSE;
+  }
+  return TRUE;
+}
+
 void silc_mp_uninit(SilcMPInt *mp)
 {
   tfm_fp_zero(mp);
@@ -303,6 +321,17 @@ SilcBool silc_mp_pow_mod(SilcMPInt *dst, SilcMPInt *mp1, SilcMPInt *exp,
   return TRUE;
 }
 
+SilcBool silc_mp_pow_mod_secret(SilcMPInt *dst, SilcMPInt *mp1,
+				SilcMPInt *exp, SilcMPInt *mod)
+{
+  int ret;
+  if ((ret = tfm_fp_exptmod_ct(mp1, exp, mod, dst))) {
+    silc_mp_set_errno(ret);
+    return FALSE;
+  }
+  return TRUE;
+}
+
 SilcBool silc_mp_pow_mod_ui(SilcMPInt *dst, SilcMPInt *mp1, SilcUInt32 exp,
 			    SilcMPInt *mod)
 {
@@ -325,6 +354,74 @@ SilcBool silc_mp_pow_mod_ui(SilcMPInt *dst, SilcMPInt *mp1, SilcUInt32 exp,
   return TRUE;
 }
 
+SilcBool silc_mp_mont_init(SilcMPMont *mont, SilcMPInt *mod)
+{
+  int ret;
+  if ((ret = tfm_fp_mont_init(mont, mod))) {
+    silc_mp_set_errno(ret);
+    return FALSE;
+  }
+  return TRUE;
+}
+
+void silc_mp_mont_uninit(SilcMPMont *mont)
+{
+  tfm_fp_mont_zero(mont);
+}
+
+SilcBool silc_mp_pow_mod_mont(SilcMPInt *dst, SilcMPInt *mp1, SilcMPInt *exp,
+			      SilcMPMont *mont)
+{
+  int ret;
+  if ((ret = tfm_fp_exptmod_mont(mp1, exp, mont, dst))) {
+    silc_mp_set_errno(ret);
+    return FALSE;
+  }
+  return TRUE;
+}
+
+SilcBool silc_mp_pow_mod_mont_secret(SilcMPInt *dst, SilcMPInt *mp1,
+				     SilcMPInt *exp, SilcMPMont *mont)
+{
+  int ret;
+  if ((ret = tfm_fp_exptmod_mont_ct(mp1, exp, mont, dst))) {
+    silc_mp_set_errno(ret);
+    return FALSE;
+  }
+  return TRUE;
+}
+
+SilcBool silc_mp_mont_to(SilcMPInt *dst, SilcMPInt *src, SilcMPMont *mont)
+{
+  int ret;
+  if ((ret = tfm_fp_mont_to(src, mont, dst))) {
+    silc_mp_set_errno(ret);
+    return FALSE;
+  }
+  return TRUE;
+}
+
+SilcBool silc_mp_mont_mul(SilcMPInt *dst, SilcMPInt *mp1, SilcMPInt *mp2,
+			  SilcMPMont *mont)
+{
+  int ret;
+  if ((ret = tfm_fp_mont_mul(mp1, mp2, mont, dst))) {
+    silc_mp_set_errno(ret);
+    return FALSE;
+  }
+  return TRUE;
+}
+
+SilcBool silc_mp_mont_from(SilcMPInt *dst, SilcMPInt *src, SilcMPMont *mont)
+{
+  int ret;
+  if ((ret = tfm_fp_mont_from(src, mont, dst))) {
+    silc_mp_set_errno(ret);
+    return FALSE;
+  }
+  return TRUE;
+}
+
 SilcBool silc_mp_gcd(SilcMPInt *dst, SilcMPInt *mp1, SilcMPInt *mp2)
 {
   int ret;
@@ -401,3 +498,14 @@ SilcBool silc_mp_modinv(SilcMPInt *inv, SilcMPInt *a, SilcMPInt *n)
   }
   return TRUE;
 }
+
+void silc_mp_mp2bin_noalloc(SilcMPInt *val, unsigned char *dst,
+			    SilcUInt32 dst_len)
+{
+  tfm_fp_to_unsigned_bin_n(val, dst, dst_len);
+}
+
+void silc_mp_bin2mp(unsigned char *data, SilcUInt32 len, SilcMPInt *ret)
+{
+  tfm_fp_read_unsigned_bin(ret, data, len);
+}
@@ -23,5 +23,6 @@
 #include "tfm.h"
 
 #define SILC_MP_INT tfm_fp_int
+#define SILC_MP_MONT tfm_fp_mont
 
 #endif /* MP_TFM_H */
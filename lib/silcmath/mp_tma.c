@@ -30,6 +30,16 @@ SilcBool silc_mp_sinit(SilcStack stack, SilcMPInt *mp)
   return tma_mp_init(mp) == MP_OKAY;
 }
 
+SilcBool silc_mp_init_size(SilcMPInt *mp, SilcUInt32 bits)
+{
+  return tma_mp_init_size(mp, (bits + DIGIT_BIT - 1) / DIGIT_BIT) == MP_OKAY;
+}
+
+SilcBool silc_mp_sinit_size(SilcStack stack, SilcMPInt *mp, SilcUInt32 bits)
+{
+  return silc_mp_init_size(mp, bits);
+}
+
 void silc_mp_uninit(SilcMPInt *mp)
 {
   tma_mp_clear(mp);
@@ -198,6 +208,14 @@ SilcBool silc_mp_pow_mod(SilcMPInt *dst, SilcMPInt *mp1, SilcMPInt *exp,
   return TRUE;
 }
 
+/* TMA has no constant time exponentiation */
+
+SilcBool silc_mp_pow_mod_secret(SilcMPInt *dst, SilcMPInt *mp1,
+				SilcMPInt *exp, SilcMPInt *mod)
+{
+  return silc_mp_pow_mod(dst, mp1, exp, mod);
+}
+
 SilcBool silc_mp_pow_mod_ui(SilcMPInt *dst, SilcMPInt *mp1, SilcUInt32 exp,
 			SilcMPInt *mod)
 {
@@ -209,6 +227,53 @@ SilcBool silc_mp_pow_mod_ui(SilcMPInt *dst, SilcMPInt *mp1, SilcUInt32 exp,
   return TRUE;
 }
 
+/* The exponentiation computes the Montgomery values itself, so the
+   context is just the modulus. */
+
+SilcBool silc_mp_mont_init(SilcMPMont *mont, SilcMPInt *mod)
+{
+  if (tma_mp_init_copy(mont, mod) != MP_OKAY)
+    return FALSE;
+  return TRUE;
+}
+
+void silc_mp_mont_uninit(SilcMPMont *mont)
+{
+  tma_mp_clear(mont);
+}
+
+SilcBool silc_mp_pow_mod_mont(SilcMPInt *dst, SilcMPInt *mp1, SilcMPInt *exp,
+			      SilcMPMont *mont)
+{
+  (void)tma_mp_exptmod(mp1, exp, mont, dst);
+  return TRUE;
+}
+
+SilcBool silc_mp_pow_mod_mont_secret(SilcMPInt *dst, SilcMPInt *mp1,
+				     SilcMPInt *exp, SilcMPMont *mont)
+{
+  return silc_mp_pow_mod_mont(dst, mp1, exp, mont);
+}
+
+SilcBool silc_mp_mont_to(SilcMPInt *dst, SilcMPInt *src, SilcMPMont *mont)
+{
+  (void)tma_mp_mod(src, mont, dst);
+  return TRUE;
+}
+
+SilcBool silc_mp_mont_mul(SilcMPInt *dst, SilcMPInt *mp1, SilcMPInt *mp2,
+			  SilcMPMont *mont)
+{
+  (void)tma_mp_mulmod(mp1, mp2, mont, dst);
+  return TRUE;
+}
+
+SilcBool silc_mp_mont_from(SilcMPInt *dst, SilcMPInt *src, SilcMPMont *mont)
+{
+  (void)tma_mp_copy(src, dst);
+  return TRUE;
+}
+
 SilcBool silc_mp_gcd(SilcMPInt *dst, SilcMPInt *mp1, SilcMPInt *mp2)
 {
   (void)tma_mp_gcd(mp1, mp2, dst);
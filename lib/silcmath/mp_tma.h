@@ -23,5 +23,6 @@
 #include "tma.h"
 
 #define SILC_MP_INT tma_mp_int
+#define SILC_MP_MONT tma_mp_int
 
 #endif
@@ -25,12 +25,20 @@
 
 unsigned char *silc_mp_mp2bin(SilcMPInt *val, SilcUInt32 len,
 			      SilcUInt32 *ret_len)
+{
+  return silc_mp_smp2bin(NULL, val, len, ret_len);
+}
+
+/* Same as above but allocates the data from `stack' if it is non-NULL. */
+
+unsigned char *silc_mp_smp2bin(SilcStack stack, SilcMPInt *val,
+			       SilcUInt32 len, SilcUInt32 *ret_len)
 {
   SilcUInt32 size;
   unsigned char *ret;
 
   size = (len ? len : ((silc_mp_sizeinbase(val, 2) + 7) / 8));
-  ret = silc_calloc(size, sizeof(*ret));
+  ret = silc_smalloc(stack, size);
   if (!ret)
     return NULL;
 
@@ -42,8 +50,11 @@ unsigned char *silc_mp_mp2bin(SilcMPInt *val, SilcUInt32 len,
   return ret;
 }
 
+#if !defined(SILC_MP_GMP) && !defined(SILC_DIST_TFM)
 /* Samve as above but does not allocate any memory.  The encoded data is
-   returned into `dst' and it's length to the `ret_len'. */
+   returned into `dst' and it's length to the `ret_len'.  The TFM and GMP
+   implementations read the digits directly, this generic version needs
+   one temporary integer. */
 
 void silc_mp_mp2bin_noalloc(SilcMPInt *val, unsigned char *dst,
 			    SilcUInt32 dst_len)
@@ -77,6 +88,7 @@ void silc_mp_bin2mp(unsigned char *data, SilcUInt32 len, SilcMPInt *ret)
     silc_mp_add_ui(ret, ret, data[i]);
   }
 }
+#endif /* !SILC_MP_GMP && !SILC_DIST_TFM */
 
 /* MP integer encoding with silc_buffer_format. */
 
@@ -89,7 +101,7 @@ int silc_mp_format(SilcStack stack, SilcBuffer buffer,
   int ret;
 
   /* Encode */
-  m = silc_mp_mp2bin(mp, 0, &m_len);
+  m = silc_mp_smp2bin(stack, mp, 0, &m_len);
   if (!m)
     return -1;
 
@@ -98,7 +110,7 @@ int silc_mp_format(SilcStack stack, SilcBuffer buffer,
 			    SILC_STR_DATA(m, m_len),
 			    SILC_STR_END);
 
-  silc_free(m);
+  silc_sfree(stack, m);
 
   return ret;
 }
@@ -0,0 +1,258 @@
+/*
+
+  mpfixed.c
+
+  Author: Pekka Riikonen <priikone@silcnet.org>
+
+  Copyright (C) 2008 Pekka Riikonen
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; version 2 of the License.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+*/
+
+/* Fixed-base modular exponentiation with the Lim-Lee comb method.
+
+   The exponent of at most `exp_bits' bits is split into `width' rows of
+   `span' bits each.  The table has the products of the base raised to
+   2 ^ (i * span) for all 2 ^ `width' combinations of the rows i.  The
+   exponentiation reads one column of bits at a time from all rows, and
+   needs `span' squarings and at most `span' multiplications, instead of
+   `exp_bits' squarings and multiplications of the sliding window
+   exponentiation.  All integers in the table are in the Montgomery
+   representation.
+
+   The exponent is usually secret, so the exponentiation does the same
+   squarings and multiplications for every exponent, also for zero
+   columns, and reads all table entries on each step, selecting the
+   needed one with a mask.  The table is therefore stored as fixed length
+   binary and not as SilcMPInt integers. */
+
+#include "silccrypto.h"
+
+/* Default maximum table size in bytes */
+#define SILC_MP_FIXED_MEMORY 65536
+
+/* Maximum comb width.  Wider comb doubles the table, and the time to
+   read it on each step, but saves only few multiplications. */
+#define SILC_MP_FIXED_MAX_WIDTH 6
+
+/* Returns bit `bit' of the big-endian encoded exponent */
+#define SILC_MP_FIXED_BIT(buf, len, bit) \
+  (((buf)[(len) - 1 - ((bit) >> 3)] >> ((bit) & 7)) & 1)
+
+/* Fixed-base table */
+struct SilcMPFixedBaseStruct {
+  SilcMPMont mont;		/* Montgomery context of modulus */
+  SilcMPInt base;		/* The base */
+  unsigned char *table;		/* Comb table, 2 ^ width entries */
+  SilcUInt32 entry_len;		/* Length of table entry */
+  SilcUInt32 exp_bits;		/* Maximum bits in exponent */
+  SilcUInt16 width;		/* Comb width, rows in exponent */
+  SilcUInt16 span;		/* Bits in each row */
+};
+
+/* Computes the fixed-base table */
+
+SilcMPFixedBase silc_mp_fixed_alloc(SilcMPInt *base, SilcMPInt *mod,
+				    SilcUInt32 exp_bits,
+				    SilcUInt32 max_memory)
+{
+  SilcMPFixedBase fixed;
+  SilcMPInt *table = NULL;
+  SilcUInt32 entry_len, width, i, j, k;
+
+  if (!exp_bits) {
+    silc_set_errno(SILC_ERR_INVALID_ARGUMENT);
+    return NULL;
+  }
+
+  if (!max_memory)
+    max_memory = SILC_MP_FIXED_MEMORY;
+
+  /* Select the widest comb that fits in the memory limit.  The entries
+     are padded to full words for the table scan. */
+  entry_len = (silc_mp_sizeinbase(mod, 2) + 31) / 32 * 4;
+  width = SILC_MP_FIXED_MAX_WIDTH;
+  while (width > 1 &&
+	 (width > exp_bits || (1 << width) * entry_len > max_memory))
+    width--;
+  if (width < 2) {
+    SILC_LOG_DEBUG(("Memory limit %d too small for fixed-base table",
+		    max_memory));
+    silc_set_errno(SILC_ERR_LIMIT);
+    return NULL;
+  }
+
+  fixed = silc_calloc(1, sizeof(*fixed));
+  if (!fixed)
+    return NULL;
+  fixed->width = width;
+  fixed->span = (exp_bits + width - 1) / width;
+  fixed->exp_bits = exp_bits;
+  fixed->entry_len = entry_len;
+
+  SILC_LOG_DEBUG(("Fixed-base table, width %d, span %d", fixed->width,
+		  fixed->span));
+
+  if (!silc_mp_mont_init(&fixed->mont, mod)) {
+    silc_free(fixed);
+    return NULL;
+  }
+  silc_mp_init(&fixed->base);
+
+  /* The table is computed as integers and then encoded */
+  table = silc_calloc(1 << width, sizeof(*table));
+  if (!table)
+    goto err;
+  for (i = 0; i < 1 << width; i++)
+    silc_mp_init(&table[i]);
+
+  if (!silc_mp_set(&fixed->base, base))
+    goto err;
+
+  /* The table[0] is one, used as the initial value of the result */
+  silc_mp_set_ui(&table[0], 1);
+  if (!silc_mp_mont_to(&table[0], &table[0], &fixed->mont))
+    goto err;
+  if (!silc_mp_mont_to(&table[1], base, &fixed->mont))
+    goto err;
+
+  /* table[2 ^ i] = base ^ (2 ^ (i * span)) */
+  for (i = 1; i < width; i++) {
+    if (!silc_mp_set(&table[1 << i], &table[1 << (i - 1)]))
+      goto err;
+    for (k = 0; k < fixed->span; k++)
+      if (!silc_mp_mont_mul(&table[1 << i], &table[1 << i],
+			    &table[1 << i], &fixed->mont))
+	goto err;
+  }
+
+  /* The combinations, each is one of the lower entries times the entry of
+     its lowest bit */
+  for (j = 3; j < 1 << width; j++) {
+    if (!(j & (j - 1)))
+      continue;
+    if (!silc_mp_mont_mul(&table[j], &table[j & (j - 1)],
+			  &table[j & -j], &fixed->mont))
+      goto err;
+  }
+
+  /* The malloc returns memory aligned for words */
+  fixed->table = silc_malloc((1 << width) * entry_len);
+  if (!fixed->table)
+    goto err;
+  for (i = 0; i < 1 << width; i++)
+    silc_mp_mp2bin_noalloc(&table[i], fixed->table + i * entry_len,
+			   entry_len);
+
+  for (i = 0; i < 1 << width; i++)
+    silc_mp_uninit(&table[i]);
+  silc_free(table);
+
+  return fixed;
+
+ err:
+  if (table) {
+    for (i = 0; i < 1 << width; i++)
+      silc_mp_uninit(&table[i]);
+    silc_free(table);
+  }
+  silc_mp_fixed_free(fixed);
+  return NULL;
+}
+
+/* Frees the fixed-base table */
+
+void silc_mp_fixed_free(SilcMPFixedBase fixed)
+{
+  if (!fixed)
+    return;
+
+  silc_free(fixed->table);
+  silc_mp_uninit(&fixed->base);
+  silc_mp_mont_uninit(&fixed->mont);
+  silc_free(fixed);
+}
+
+/* Copies the table entry `idx' to `entry'.  All entries are read so
+   that the memory access pattern does not depend on the `idx'. */
+
+static void silc_mp_fixed_select(SilcMPFixedBase fixed, SilcUInt32 idx,
+				 SilcUInt32 *entry)
+{
+  const SilcUInt32 *t = (const SilcUInt32 *)fixed->table;
+  SilcUInt32 words = fixed->entry_len / 4, i, k, diff, mask;
+
+  memset(entry, 0, fixed->entry_len);
+  for (i = 0; i < 1 << fixed->width; i++, t += words) {
+    diff = i ^ idx;
+    mask = ((diff | -diff) >> 31) - 1;
+    for (k = 0; k < words; k++)
+      entry[k] |= t[k] & mask;
+  }
+}
+
+/* Computes base ^ exp mod n with the fixed-base table */
+
+SilcBool silc_mp_pow_mod_fixed(SilcMPInt *dst, SilcMPInt *exp,
+			       SilcMPFixedBase fixed)
+{
+  SilcMPInt r, e;
+  SilcUInt32 sbuf[(128 + 512) / 4], *entry;
+  unsigned char *buf = (unsigned char *)sbuf;
+  SilcUInt32 len, col, i, idx;
+  SilcBool ret = FALSE;
+
+  if (silc_mp_cmp_ui(exp, 0) < 0 ||
+      silc_mp_sizeinbase(exp, 2) > fixed->exp_bits)
+    return silc_mp_pow_mod_mont_secret(dst, &fixed->base, exp,
+				       &fixed->mont);
+
+  /* The exponent and the selected table entry are in the stack buffer,
+     unless they are very large */
+  len = (fixed->span * fixed->width + 31) / 32 * 4;
+  if (len + fixed->entry_len > sizeof(sbuf)) {
+    buf = silc_malloc(len + fixed->entry_len);
+    if (!buf)
+      return FALSE;
+  }
+  entry = (SilcUInt32 *)(buf + len);
+  silc_mp_mp2bin_noalloc(exp, buf, len);
+
+  silc_mp_init(&r);
+  silc_mp_init(&e);
+  silc_mp_fixed_select(fixed, 0, entry);
+  silc_mp_bin2mp((unsigned char *)entry, fixed->entry_len, &r);
+
+  for (col = fixed->span; col > 0; col--) {
+    if (!silc_mp_mont_mul(&r, &r, &r, &fixed->mont))
+      goto out;
+
+    /* Take the bit of this column from each row.  Zero column multiplies
+       with table[0], which is one. */
+    for (i = 0, idx = 0; i < fixed->width; i++)
+      idx |= SILC_MP_FIXED_BIT(buf, len, i * fixed->span + col - 1) << i;
+
+    silc_mp_fixed_select(fixed, idx, entry);
+    silc_mp_bin2mp((unsigned char *)entry, fixed->entry_len, &e);
+    if (!silc_mp_mont_mul(&r, &r, &e, &fixed->mont))
+      goto out;
+  }
+
+  ret = silc_mp_mont_from(dst, &r, &fixed->mont);
+
+ out:
+  silc_mp_uninit(&r);
+  silc_mp_uninit(&e);
+  memset(buf, 0, len + fixed->entry_len);
+  if (buf != (unsigned char *)sbuf)
+    silc_free(buf);
+  return ret;
+}
@@ -32,6 +32,58 @@
 
 #include "silcrng.h"
 
+/****f* silcmath/SilcMathPrimeProgress
+ *
+ * SYNOPSIS
+ *
+ *    typedef void (*SilcMathPrimeProgress)(SilcUInt32 tested,
+ *                                          void *context);
+ *
+ * DESCRIPTION
+ *
+ *    Progress callback of silc_math_gen_prime_ext.  It is called each
+ *    time a prime candidate has failed the primality test.  The `tested'
+ *    is the number of candidates tested so far.  When the prime is
+ *    searched in many threads this may be called from any of the threads,
+ *    but the calls are never concurrent.
+ *
+ ***/
+typedef void (*SilcMathPrimeProgress)(SilcUInt32 tested, void *context);
+
+/****f* silcmath/silc_math_gen_prime_ext
+ *
+ * SYNOPSIS
+ *
+ *    SilcBool silc_math_gen_prime_ext(SilcMPInt *prime, SilcUInt32 bits,
+ *                                     SilcUInt32 rounds, SilcRng rng,
+ *                                     SilcThreadPool tp, SilcUInt32 threads,
+ *                                     SilcMathPrimeProgress progress,
+ *                                     void *context);
+ *
+ * DESCRIPTION
+ *
+ *    Generates a random prime of `bits' bits and saves it to `prime'.
+ *    The search starts from a random number with the two highest bits
+ *    set and goes through the following odd numbers.  Candidates
+ *    divisible by small primes are removed with a sieve and the rest are
+ *    tested with the Miller-Rabin test of `rounds' rounds.  If `rounds' is
+ *    0 the number of rounds is selected by the size of the prime, giving
+ *    error probability less than 2 ^ -80.  If the `rng' is NULL then
+ *    global RNG is used.
+ *
+ *    If `tp' is non-NULL the search is divided to at most `threads'
+ *    threads taken from the thread pool.  Each thread searches different
+ *    numbers.  The calling thread takes part in the search and this
+ *    function returns when the prime has been found.  The `progress', if
+ *    non-NULL, is called during the search.  Returns FALSE on error.
+ *
+ ***/
+SilcBool silc_math_gen_prime_ext(SilcMPInt *prime, SilcUInt32 bits,
+				 SilcUInt32 rounds, SilcRng rng,
+				 SilcThreadPool tp, SilcUInt32 threads,
+				 SilcMathPrimeProgress progress,
+				 void *context);
+
 /****f* silcmath/silc_math_gen_prime
  *
  * SYNOPSIS
@@ -41,9 +93,9 @@
  *
  * DESCRIPTION
  *
- *    Find appropriate prime. It generates a number by taking random bytes.
- *    It then tests the number that it's not divisible by any of the small
- *    primes and then it performs Fermat's prime test.
+ *    Find appropriate prime.  This is equivalent to calling
+ *    silc_math_gen_prime_ext with default number of Miller-Rabin rounds
+ *    in the calling thread.
  *
  *    If argument verbose is TRUE this will display some status information
  *    about the progress of generation.  If the `rng' is NULL then global
@@ -63,7 +115,9 @@ SilcBool silc_math_gen_prime(SilcMPInt *prime, SilcUInt32 bits,
  * DESCRIPTION
  *
  *    Performs primality testings for given number. Returns TRUE if the
- *    number is probably a prime.
+ *    number is probably a prime.  The number is tested for divisibility
+ *    by small primes and then with the Miller-Rabin test using random
+ *    bases from the global RNG.
  *
  ***/
 SilcBool silc_math_prime_test(SilcMPInt *p);
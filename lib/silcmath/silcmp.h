@@ -60,6 +60,25 @@
 typedef SILC_MP_INT SilcMPInt;
 /***/
 
+/****d* silcmath/SilcMPMont
+ *
+ * NAME
+ *
+ *    typedef SILC_MP_MONT SilcMPMont;
+ *
+ * DESCRIPTION
+ *
+ *    Precomputed Montgomery context of a modulus.  It can be used with
+ *    silc_mp_pow_mod_mont to avoid recomputing the Montgomery values of
+ *    the modulus in each modular exponentiation.  The context is
+ *    initialized with silc_mp_mont_init.  The type is implementation
+ *    specific and is unknown to the application.
+ *
+ * SOURCE
+ */
+typedef SILC_MP_MONT SilcMPMont;
+/***/
+
 /****f* silcmath/silc_mp_init
  *
  * SYNOPSIS
@@ -94,6 +113,40 @@ SilcBool silc_mp_init(SilcMPInt *mp);
  ***/
 SilcBool silc_mp_sinit(SilcStack stack, SilcMPInt *mp);
 
+/****f* silcmath/silc_mp_init_size
+ *
+ * SYNOPSIS
+ *
+ *    SilcBool silc_mp_init_size(SilcMPInt *mp, SilcUInt32 bits);
+ *
+ * DESCRIPTION
+ *
+ *    Same as silc_mp_init but allocates memory for integer of `bits' bits
+ *    immediately.  The integer grows when needed, but setting a value of
+ *    at most `bits' bits does not reallocate it.  This should be used
+ *    when the size is known, for example when decoding a key, so that the
+ *    integer is allocated once and only as large as needed.  Returns
+ *    FALSE on error, TRUE otherwise.
+ *
+ ***/
+SilcBool silc_mp_init_size(SilcMPInt *mp, SilcUInt32 bits);
+
+/****f* silcmath/silc_mp_sinit_size
+ *
+ * SYNOPSIS
+ *
+ *    SilcBool silc_mp_sinit_size(SilcStack stack, SilcMPInt *mp,
+ *                                SilcUInt32 bits);
+ *
+ * DESCRIPTION
+ *
+ *    Same as silc_mp_init_size but allocates the memory from `stack' if it
+ *    is non-NULL.  The silc_mp_uninit must be called to uninitialize the
+ *    integer even when `stack' is non-NULL.
+ *
+ ***/
+SilcBool silc_mp_sinit_size(SilcStack stack, SilcMPInt *mp, SilcUInt32 bits);
+
 /****f* silcmath/silc_mp_uninit
  *
  * SYNOPSIS
@@ -495,10 +548,37 @@ SilcBool silc_mp_pow_ui(SilcMPInt *dst, SilcMPInt *mp1, SilcUInt32 exp);
  *    Compute (`mp1' ** `exp') mod `mod' and save the result to `dst'.
  *    This is equivalent to dst = (mp1 ^ exp) mod mod.
  *
+ *    The computation time depends on the bits of `exp'.  This should be
+ *    used only when `exp' is public, such as the public exponent of RSA
+ *    key.  The silc_mp_pow_mod_secret must be used with secret exponents.
+ *
  ***/
 SilcBool silc_mp_pow_mod(SilcMPInt *dst, SilcMPInt *mp1, SilcMPInt *exp,
 			 SilcMPInt *mod);
 
+/****f* silcmath/silc_mp_pow_mod_secret
+ *
+ * SYNOPSIS
+ *
+ *    SilcBool silc_mp_pow_mod_secret(SilcMPInt *dst, SilcMPInt *mp1,
+ *                                    SilcMPInt *exp, SilcMPInt *mod);
+ *
+ * DESCRIPTION
+ *
+ *    Compute (`mp1' ** `exp') mod `mod' and save the result to `dst'.
+ *    This is equivalent to silc_mp_pow_mod but the sequence of
+ *    multiplications and the memory access do not depend on the bits of
+ *    `exp'.  Only the number of words in `exp' affects the computation
+ *    time.  This must be used when `exp' is secret, such as a private key
+ *    exponent.  This is slower than silc_mp_pow_mod.  The `mod' must be
+ *    odd.
+ *
+ *    With TMA math library this is same as silc_mp_pow_mod.
+ *
+ ***/
+SilcBool silc_mp_pow_mod_secret(SilcMPInt *dst, SilcMPInt *mp1,
+				SilcMPInt *exp, SilcMPInt *mod);
+
 /****f* silcmath/silc_mp_pow_mod_ui
  *
  * SYNOPSIS
@@ -515,6 +595,203 @@ SilcBool silc_mp_pow_mod(SilcMPInt *dst, SilcMPInt *mp1, SilcMPInt *exp,
 SilcBool silc_mp_pow_mod_ui(SilcMPInt *dst, SilcMPInt *mp1, SilcUInt32 exp,
 			    SilcMPInt *mod);
 
+/****f* silcmath/silc_mp_mont_init
+ *
+ * SYNOPSIS
+ *
+ *    SilcBool silc_mp_mont_init(SilcMPMont *mont, SilcMPInt *mod);
+ *
+ * DESCRIPTION
+ *
+ *    Precomputes the Montgomery context `mont' for the modulus `mod'.  The
+ *    modulus must be odd and positive.  The context holds a copy of the
+ *    modulus, so `mod' may be changed or freed after this call.  The
+ *    silc_mp_mont_uninit must be called to uninitialize the context.
+ *    Returns FALSE on error and sets silc_errno.
+ *
+ ***/
+SilcBool silc_mp_mont_init(SilcMPMont *mont, SilcMPInt *mod);
+
+/****f* silcmath/silc_mp_mont_uninit
+ *
+ * SYNOPSIS
+ *
+ *    void silc_mp_mont_uninit(SilcMPMont *mont);
+ *
+ * DESCRIPTION
+ *
+ *    Uninitializes the Montgomery context.
+ *
+ ***/
+void silc_mp_mont_uninit(SilcMPMont *mont);
+
+/****f* silcmath/silc_mp_pow_mod_mont
+ *
+ * SYNOPSIS
+ *
+ *    SilcBool silc_mp_pow_mod_mont(SilcMPInt *dst, SilcMPInt *mp1,
+ *                                  SilcMPInt *exp, SilcMPMont *mont);
+ *
+ * DESCRIPTION
+ *
+ *    Compute (`mp1' ** `exp') mod n and save the result to `dst', where
+ *    n is the modulus of the Montgomery context `mont'.  This is equivalent
+ *    to silc_mp_pow_mod but uses the precomputed context.  This is faster
+ *    when many exponentiations are computed with the same modulus, such as
+ *    with RSA and DSA keys.
+ *
+ *    The computation time depends on the bits of `exp'.  The
+ *    silc_mp_pow_mod_mont_secret must be used with secret exponents.
+ *
+ ***/
+SilcBool silc_mp_pow_mod_mont(SilcMPInt *dst, SilcMPInt *mp1, SilcMPInt *exp,
+			      SilcMPMont *mont);
+
+/****f* silcmath/silc_mp_pow_mod_mont_secret
+ *
+ * SYNOPSIS
+ *
+ *    SilcBool silc_mp_pow_mod_mont_secret(SilcMPInt *dst, SilcMPInt *mp1,
+ *                                         SilcMPInt *exp, SilcMPMont *mont);
+ *
+ * DESCRIPTION
+ *
+ *    Same as silc_mp_pow_mod_secret but uses the precomputed Montgomery
+ *    context `mont'.  This must be used when `exp' is secret.
+ *
+ ***/
+SilcBool silc_mp_pow_mod_mont_secret(SilcMPInt *dst, SilcMPInt *mp1,
+				     SilcMPInt *exp, SilcMPMont *mont);
+
+/****f* silcmath/silc_mp_mont_to
+ *
+ * SYNOPSIS
+ *
+ *    SilcBool silc_mp_mont_to(SilcMPInt *dst, SilcMPInt *src,
+ *                             SilcMPMont *mont);
+ *
+ * DESCRIPTION
+ *
+ *    Converts `src' into the Montgomery representation of the context
+ *    `mont' and saves the result to `dst'.  The integers in Montgomery
+ *    representation can be multiplied with silc_mp_mont_mul and converted
+ *    back with silc_mp_mont_from.  Other operations must not be used with
+ *    them.  The representation is implementation specific; some
+ *    implementations just reduce `src' modulo n.
+ *
+ ***/
+SilcBool silc_mp_mont_to(SilcMPInt *dst, SilcMPInt *src, SilcMPMont *mont);
+
+/****f* silcmath/silc_mp_mont_mul
+ *
+ * SYNOPSIS
+ *
+ *    SilcBool silc_mp_mont_mul(SilcMPInt *dst, SilcMPInt *mp1,
+ *                              SilcMPInt *mp2, SilcMPMont *mont);
+ *
+ * DESCRIPTION
+ *
+ *    Multiplies `mp1' and `mp2', both in the Montgomery representation of
+ *    the context `mont', and saves the product in the same representation
+ *    to `dst'.  Giving the same integer as `mp1' and `mp2' squares it.
+ *
+ ***/
+SilcBool silc_mp_mont_mul(SilcMPInt *dst, SilcMPInt *mp1, SilcMPInt *mp2,
+			  SilcMPMont *mont);
+
+/****f* silcmath/silc_mp_mont_from
+ *
+ * SYNOPSIS
+ *
+ *    SilcBool silc_mp_mont_from(SilcMPInt *dst, SilcMPInt *src,
+ *                               SilcMPMont *mont);
+ *
+ * DESCRIPTION
+ *
+ *    Converts `src' from the Montgomery representation of the context
+ *    `mont' into normal integer and saves the result to `dst'.
+ *
+ ***/
+SilcBool silc_mp_mont_from(SilcMPInt *dst, SilcMPInt *src, SilcMPMont *mont);
+
+/****s* silcmath/SilcMPFixedBase
+ *
+ * NAME
+ *
+ *    typedef struct SilcMPFixedBaseStruct *SilcMPFixedBase;
+ *
+ * DESCRIPTION
+ *
+ *    Precomputed table for fixed-base modular exponentiation.  When the
+ *    base and the modulus stay the same and only the exponent changes, as
+ *    with the DSA generator and the Diffie Hellman group generator, the
+ *    powers of the base can be computed once.  The exponentiation then
+ *    needs only a fraction of the squarings and multiplications of
+ *    silc_mp_pow_mod.  The table is allocated with silc_mp_fixed_alloc and
+ *    used with silc_mp_pow_mod_fixed.  It is not modified by the
+ *    exponentiation and can be shared between threads.
+ *
+ ***/
+typedef struct SilcMPFixedBaseStruct *SilcMPFixedBase;
+
+/****f* silcmath/silc_mp_fixed_alloc
+ *
+ * SYNOPSIS
+ *
+ *    SilcMPFixedBase silc_mp_fixed_alloc(SilcMPInt *base, SilcMPInt *mod,
+ *                                        SilcUInt32 exp_bits,
+ *                                        SilcUInt32 max_memory);
+ *
+ * DESCRIPTION
+ *
+ *    Computes the fixed-base exponentiation table for the base `base' and
+ *    the odd modulus `mod'.  The `exp_bits' is the maximum number of bits
+ *    in the exponents, for example the bit length of the DSA q.  The
+ *    `max_memory' limits the size of the table in bytes.  If it is zero
+ *    the default 64 kilobytes is used.  Larger table makes the
+ *    exponentiation faster.  Returns NULL on error, or if the limit is
+ *    too small for a useful table.  The `base' and `mod' may be changed
+ *    or freed after this call.  The table is freed by calling
+ *    silc_mp_fixed_free.
+ *
+ ***/
+SilcMPFixedBase silc_mp_fixed_alloc(SilcMPInt *base, SilcMPInt *mod,
+				    SilcUInt32 exp_bits,
+				    SilcUInt32 max_memory);
+
+/****f* silcmath/silc_mp_fixed_free
+ *
+ * SYNOPSIS
+ *
+ *    void silc_mp_fixed_free(SilcMPFixedBase fixed);
+ *
+ * DESCRIPTION
+ *
+ *    Frees the fixed-base exponentiation table.
+ *
+ ***/
+void silc_mp_fixed_free(SilcMPFixedBase fixed);
+
+/****f* silcmath/silc_mp_pow_mod_fixed
+ *
+ * SYNOPSIS
+ *
+ *    SilcBool silc_mp_pow_mod_fixed(SilcMPInt *dst, SilcMPInt *exp,
+ *                                   SilcMPFixedBase fixed);
+ *
+ * DESCRIPTION
+ *
+ *    Compute (base ** `exp') mod n and save the result to `dst', where the
+ *    base and the modulus n are the ones given to silc_mp_fixed_alloc.  If
+ *    `exp' is negative or longer than the table was computed for this
+ *    computes the result with silc_mp_pow_mod_mont_secret.  The operations
+ *    and the memory access pattern do not depend on the value of `exp', so
+ *    this may be used with secret exponents.
+ *
+ ***/
+SilcBool silc_mp_pow_mod_fixed(SilcMPInt *dst, SilcMPInt *exp,
+			       SilcMPFixedBase fixed);
+
 /****f* silcmath/silc_mp_modinv
  *
  * SYNOPSIS
@@ -617,6 +894,23 @@ int silc_mp_cmp_ui(SilcMPInt *mp1, SilcUInt32 ui);
 unsigned char *silc_mp_mp2bin(SilcMPInt *val, SilcUInt32 len,
 			      SilcUInt32 *ret_len);
 
+/****f* silcmath/silc_mp_smp2bin
+ *
+ * SYNOPSIS
+ *
+ *    unsigned char *silc_mp_smp2bin(SilcStack stack, SilcMPInt *val,
+ *                                   SilcUInt32 len, SilcUInt32 *ret_len);
+ *
+ * DESCRIPTION
+ *
+ *    Same as silc_mp_mp2bin but allocates the data from `stack'.  If
+ *    `stack' is NULL this is equivalent to silc_mp_mp2bin.  The caller
+ *    frees the data with silc_sfree.
+ *
+ ***/
+unsigned char *silc_mp_smp2bin(SilcStack stack, SilcMPInt *val,
+			       SilcUInt32 len, SilcUInt32 *ret_len);
+
 /****f* silcmath/silc_mp_mp2bin_noalloc
  *
  * SYNOPSIS
@@ -627,7 +921,9 @@ unsigned char *silc_mp_mp2bin(SilcMPInt *val, SilcUInt32 len,
  * DESCRIPTION
  *
  *    Same as silc_mp_mp2bin but does not allocate any memory.  The
- *    encoded data is returned into `dst' of size of `dst_len'.
+ *    encoded data is returned into `dst' of size of `dst_len'.  Exactly
+ *    `dst_len' bytes are written, most significant byte first, and if the
+ *    integer is larger than `dst_len' bytes the high bytes are truncated.
  *
  ***/
 void silc_mp_mp2bin_noalloc(SilcMPInt *val, unsigned char *dst,
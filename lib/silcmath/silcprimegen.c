@@ -185,138 +185,431 @@ static SilcUInt32 primetable[] =
 };
 
 
-/* Find appropriate prime. It generates a number by taking random bytes.
-   It then tests the number that it's not divisible by any of the small
-   primes and then it performs Fermat's prime test. I thank Rieks Joosten
-   (r.joosten@pijnenburg.nl) for such a good help with prime tests.
+/* Odd candidates in one sieve interval */
+#define SILC_MATH_SIEVE_SIZE 4096
+
+/* Maximum number of threads searching for one prime */
+#define SILC_MATH_PRIME_MAX_THREADS 32
+
+typedef struct SilcMathPrimeSearchStruct *SilcMathPrimeSearch;
+
+/* Prime search worker */
+typedef struct {
+  SilcMathPrimeSearch search;
+  SilcUInt32 index;			/* Index of the first interval */
+  unsigned int thread : 1;		/* Worker runs in thread pool */
+} SilcMathPrimeWorker;
+
+/* Prime search context */
+struct SilcMathPrimeSearchStruct {
+  SilcMPInt start;			/* First candidate, odd */
+  SilcMPInt *prime;			/* The found prime */
+  SilcRng rng;
+  SilcMutex lock;
+  SilcCond cond;
+  SilcMathPrimeProgress progress;
+  void *context;
+  SilcUInt32 bits;
+  SilcUInt32 rounds;			/* Miller-Rabin rounds */
+  SilcUInt32 num_primes;		/* Odd primes used in sieve */
+  SilcUInt32 num_workers;
+  SilcUInt32 done;			/* Finished workers */
+  SilcUInt32 tested;			/* Candidates that failed the test */
+  unsigned int found : 1;
+  unsigned int error : 1;
+};
 
-   If argument verbose is TRUE this will display some status information
-   about the progress of generation. */
+/* Returns the number of Miller-Rabin rounds needed to get error
+   probability below 2 ^ -80 for a random candidate of `bits' bits.  The
+   values are from the Handbook of Applied Cryptography, table 4.4. */
 
-SilcBool silc_math_gen_prime(SilcMPInt *prime, SilcUInt32 bits,
-			     SilcBool verbose, SilcRng rng)
+static SilcUInt32 silc_math_prime_rounds(SilcUInt32 bits)
 {
-  unsigned char *numbuf;
-  SilcUInt32 i, b, k;
-  SilcUInt32 *spmods;
-  SilcMPInt r, base, tmp, tmp2, oprime;
-  SilcBool valid = FALSE;
+  if (bits >= 1300)
+    return 2;
+  if (bits >= 850)
+    return 3;
+  if (bits >= 650)
+    return 4;
+  if (bits >= 550)
+    return 5;
+  if (bits >= 450)
+    return 6;
+  if (bits >= 400)
+    return 7;
+  if (bits >= 350)
+    return 8;
+  if (bits >= 300)
+    return 9;
+  if (bits >= 250)
+    return 12;
+  if (bits >= 200)
+    return 15;
+  if (bits >= 150)
+    return 18;
+  return 27;
+}
 
-  silc_mp_init(&r);
-  silc_mp_init(&base);
-  silc_mp_init(&tmp);
-  silc_mp_init(&tmp2);
-  silc_mp_init(&oprime);
+/* Returns random data for the prime search.  The RNG is not thread safe
+   so it is used under the `lock'. */
 
-  silc_mp_set_ui(&base, 2);
+static SilcBool silc_math_prime_random(SilcRng rng, SilcMutex lock,
+				       unsigned char *buf, SilcUInt32 len)
+{
+  SilcBool ret;
+
+  silc_mutex_lock(lock);
+  if (rng)
+    ret = silc_rng_get_rn_data(rng, len, buf, len);
+  else
+    ret = silc_rng_global_get_rn_data(rng, len, buf, len);
+  silc_mutex_unlock(lock);
 
-  SILC_LOG_DEBUG(("Generating new prime"));
+  return ret;
+}
 
-  while (valid == FALSE) {
-    numbuf = silc_malloc((((bits + 7) / 8) + 1) * sizeof(*numbuf));
-    if (!numbuf)
+/* Miller-Rabin test with `rounds' bases.  The first base is 2 and the rest
+   are random.  If random data is not available the small primes are used
+   as bases.  The `n' must be odd.  Returns TRUE if the `n' is probably a
+   prime.  The temporary integers are allocated from `stack' and the random
+   data is read into `buf' if they are non-NULL.  The `buf' must be at
+   least the size of `n' in bytes. */
+
+static SilcBool silc_math_miller_rabin(SilcStack stack, SilcMPInt *n,
+				       SilcUInt32 rounds, SilcRng rng,
+				       SilcMutex lock, unsigned char *buf)
+{
+  SilcMPMont mont;
+  SilcMPInt a, d, y, n1;
+  unsigned char *rbuf = buf;
+  SilcUInt32 len, s, i, j;
+  SilcBool ret = FALSE;
+
+  if (silc_mp_cmp_ui(n, 5) < 0)
+    return silc_mp_cmp_ui(n, 1) > 0;
+
+  len = (silc_mp_sizeinbase(n, 2) + 7) / 8;
+  if (!rbuf) {
+    rbuf = silc_smalloc(stack, len);
+    if (!rbuf)
       return FALSE;
+  }
+  if (!silc_mp_mont_init(&mont, n)) {
+    if (!buf)
+      silc_sfree(stack, rbuf);
+    return FALSE;
+  }
 
-    /* Get random number */
-    if (rng)
-      silc_rng_get_rn_data(rng, (bits / 8), numbuf, (bits / 8));
-    else
-      silc_rng_global_get_rn_data(rng, (bits / 8), numbuf, (bits / 8));
-
-    /* Convert into MP and set the size */
-    silc_mp_bin2mp(numbuf, (bits / 8), prime);
-    silc_mp_mod_2exp(prime, prime, bits);
-
-    /* Empty buffer */
-    memset(numbuf, 0, (bits / 8));
-    silc_free(numbuf);
-
-    /* Set highest bit */
-    silc_mp_set_ui(&tmp, 1);
-    silc_mp_mul_2exp(&tmp, &tmp, bits - 1);
-    silc_mp_or(prime, prime, &tmp);
-
-    /* Number could be even number, so we'll make it odd. */
-    silc_mp_set_ui(&tmp, 1);
-    silc_mp_or(prime, prime, &tmp);
-
-    /* Init modulo table with the prime candidate and the primes
-       in the primetable. */
-    spmods = silc_calloc(1, sizeof(primetable) * sizeof(SilcUInt32));
-    for (i = 0; primetable[i] != 0; i++) {
-      silc_mp_mod_ui(&tmp, prime, primetable[i]);
-      spmods[i] = silc_mp_get_ui(&tmp);
+  silc_mp_sinit(stack, &a);
+  silc_mp_sinit(stack, &d);
+  silc_mp_sinit(stack, &y);
+  silc_mp_sinit(stack, &n1);
+
+  /* n - 1 = d * 2 ^ s, where d is odd */
+  silc_mp_sub_ui(&n1, n, 1);
+  silc_mp_set(&d, &n1);
+  for (s = 0; !(silc_mp_get_ui(&d) & 1); s++)
+    silc_mp_div_2exp(&d, &d, 1);
+
+  for (i = 0; i < rounds; i++) {
+    /* Select base, 2 <= a <= n - 2 */
+    if (i > 0 && silc_math_prime_random(rng, lock, rbuf, len)) {
+      silc_mp_bin2mp(rbuf, len, &a);
+      silc_mp_sub_ui(&y, n, 3);
+      silc_mp_mod(&a, &a, &y);
+      silc_mp_add_ui(&a, &a, 2);
+    } else {
+      silc_mp_set_ui(&a, primetable[i & 255]);
+      if (silc_mp_cmp(&a, &n1) >= 0)
+	continue;
     }
 
-    /* k is added by 2, this way we skip all even numbers (prime is odd). */
-    silc_mp_set(&oprime, prime);
-    for (k = 0;; k += 2) {
-      silc_mp_add_ui(&oprime, prime, k);
-
-      /* See if the prime has a divisor in primetable[].
-       * If it has then it's a composite. We add k to the
-       * original modulo value, k is added by 2 on every roll.
-       * This way we don't have to re-init the whole table if
-       * the number is composite.
-       */
-      for (b = 0; b < i; b++) {
-	silc_mp_set_ui(&tmp2, spmods[b]);
-	silc_mp_add_ui(&tmp2, &tmp2, k);
-	silc_mp_mod_ui(&tmp, &tmp2, primetable[b]);
-
-	/* If mod is 0, the number is composite */
-	if (silc_mp_cmp_ui(&tmp, 0) == 0)
-	  break;
-      }
-      if (b < i)
+    if (!silc_mp_pow_mod_mont_secret(&y, &a, &d, &mont))
+      goto out;
+    if (silc_mp_cmp_ui(&y, 1) == 0 || silc_mp_cmp(&y, &n1) == 0)
+      continue;
+
+    for (j = 1; j < s; j++) {
+      silc_mp_mul(&y, &y, &y);
+      silc_mp_mod(&y, &y, n);
+      if (silc_mp_cmp(&y, &n1) == 0)
+	break;
+      if (silc_mp_cmp_ui(&y, 1) == 0)
+	goto out;
+    }
+
+    /* Composite */
+    if (j >= s)
+      goto out;
+  }
+
+  ret = TRUE;
+
+ out:
+  memset(rbuf, 0, len);
+  if (!buf)
+    silc_sfree(stack, rbuf);
+  silc_mp_uninit(&a);
+  silc_mp_uninit(&d);
+  silc_mp_uninit(&y);
+  silc_mp_uninit(&n1);
+  silc_mp_mont_uninit(&mont);
+  return ret;
+}
+
+/* Called when candidate failed the test.  Returns TRUE if some other
+   worker has already found the prime. */
+
+static SilcBool silc_math_prime_failed(SilcMathPrimeSearch search)
+{
+  SilcBool found;
+
+  silc_mutex_lock(search->lock);
+  search->tested++;
+  if (search->progress)
+    search->progress(search->tested, search->context);
+  found = search->found;
+  silc_mutex_unlock(search->lock);
+
+  return found;
+}
+
+/* Prime search worker.  The candidates are searched from intervals of
+   SILC_MATH_SIEVE_SIZE odd numbers.  Each worker takes every num_workers'th
+   interval starting from interval `index', so the workers never test same
+   candidates.  The residues of the interval modulo the small primes are
+   computed once and then updated with word arithmetic when moving to the
+   next interval.  The sieve marks the candidates divisible by a small
+   prime and the rest are tested with Miller-Rabin.  The memory for the
+   tests is allocated once for the worker. */
+
+static void silc_math_prime_search(SilcSchedule schedule, void *context)
+{
+  SilcMathPrimeWorker *worker = context;
+  SilcMathPrimeSearch search = worker->search;
+  unsigned char sieve[SILC_MATH_SIEVE_SIZE], *buf;
+  SilcUInt32 *mods, step, i, j, p;
+  SilcMPInt base, cand;
+  SilcStack stack;
+
+  step = 2 * SILC_MATH_SIEVE_SIZE * search->num_workers;
+
+  stack = silc_stack_alloc(0, NULL);
+  silc_mp_sinit(stack, &base);
+  silc_mp_sinit(stack, &cand);
+
+  mods = silc_scalloc(stack, search->num_primes, sizeof(*mods));
+  buf = silc_smalloc(stack, (search->bits + 7) / 8);
+  if (!mods || !buf) {
+    silc_mutex_lock(search->lock);
+    search->error = TRUE;
+    silc_mutex_unlock(search->lock);
+    goto out;
+  }
+
+  /* First interval of this worker */
+  silc_mp_set_ui(&base, 2 * SILC_MATH_SIEVE_SIZE);
+  silc_mp_mul_ui(&base, &base, worker->index);
+  silc_mp_add(&base, &base, &search->start);
+  for (i = 0; i < search->num_primes; i++) {
+    silc_mp_mod_ui(&cand, &base, primetable[i + 1]);
+    mods[i] = silc_mp_get_ui(&cand);
+  }
+
+  while (1) {
+    /* The candidate base + 2j is divisible by p when j = -base / 2 mod p */
+    memset(sieve, 0, sizeof(sieve));
+    for (i = 0; i < search->num_primes; i++) {
+      p = primetable[i + 1];
+      for (j = ((p - mods[i]) * ((p + 1) / 2)) % p;
+	   j < SILC_MATH_SIEVE_SIZE; j += p)
+	sieve[j] = 1;
+    }
+
+    for (j = 0; j < SILC_MATH_SIEVE_SIZE; j++) {
+      if (sieve[j])
 	continue;
 
-      /* Passed the quick test. */
+      silc_mp_add_ui(&cand, &base, 2 * j);
+
+      /* Stop if the candidate became too large.  The search will be
+	 restarted from new random number. */
+      if (silc_mp_sizeinbase(&cand, 2) > search->bits)
+	goto out;
 
-      /* Does the prime pass the Fermat's prime test.
-       * r = 2 ^ p mod p, if r == 2, then p is probably a prime.
-       */
-      silc_mp_pow_mod(&r, &base, &oprime, &oprime);
-      if (silc_mp_cmp_ui(&r, 2) != 0) {
-	if (verbose) {
-	  printf(".");
-	  fflush(stdout);
+      if (silc_math_miller_rabin(stack, &cand, search->rounds, search->rng,
+				 search->lock, buf)) {
+	silc_mutex_lock(search->lock);
+	if (!search->found) {
+	  silc_mp_set(search->prime, &cand);
+	  search->found = TRUE;
 	}
-	continue;
+	silc_mutex_unlock(search->lock);
+	goto out;
       }
 
-      /* Passed the Fermat's test. And I don't think
-       * we have to do more tests. If anyone wants to do more
-       * tests, MP library has probability of prime test:
-       *
-       * if (silc_mp_probab_prime_p(prime, 25))
-       *     break;                          found a probable prime
-       *
-       * However, this is very slow.
-       */
-      /* XXX: this could be done if some argument, say strict_primes, is
-	 TRUE when we are willing to spend more time on the prime test and
-	 to get, perhaps, better primes. */
-      silc_mp_set(prime, &oprime);
+      if (silc_math_prime_failed(search))
+	goto out;
+    }
+
+    /* Next interval of this worker */
+    silc_mp_add_ui(&base, &base, step);
+    for (i = 0; i < search->num_primes; i++)
+      mods[i] = (mods[i] + step) % primetable[i + 1];
+  }
+
+ out:
+  if (buf)
+    memset(buf, 0, (search->bits + 7) / 8);
+  silc_sfree(stack, buf);
+  silc_sfree(stack, mods);
+  silc_mp_uninit(&base);
+  silc_mp_uninit(&cand);
+  silc_stack_free(stack);
+
+  silc_mutex_lock(search->lock);
+  search->done++;
+  if (search->cond)
+    silc_cond_signal(search->cond);
+  silc_mutex_unlock(search->lock);
+}
+
+/* Prints the progress of the prime generation */
+
+static void silc_math_prime_verbose(SilcUInt32 tested, void *context)
+{
+  printf(".");
+  fflush(stdout);
+}
+
+/* Find appropriate prime.  The search starts from a random number and
+   goes through the following odd numbers.  The candidates divisible by the
+   small primes are removed with a sieve, and the rest are tested with
+   Miller-Rabin.  The search may be divided to several threads. */
+
+SilcBool silc_math_gen_prime_ext(SilcMPInt *prime, SilcUInt32 bits,
+				 SilcUInt32 rounds, SilcRng rng,
+				 SilcThreadPool tp, SilcUInt32 threads,
+				 SilcMathPrimeProgress progress,
+				 void *context)
+{
+  struct SilcMathPrimeSearchStruct search;
+  SilcMathPrimeWorker workers[SILC_MATH_PRIME_MAX_THREADS];
+  unsigned char *numbuf;
+  SilcUInt32 len, i;
+  SilcMPInt tmp;
+
+  if (bits < 2) {
+    silc_set_errno(SILC_ERR_INVALID_ARGUMENT);
+    return FALSE;
+  }
+
+  memset(&search, 0, sizeof(search));
+  search.prime = prime;
+  search.rng = rng;
+  search.progress = progress;
+  search.context = context;
+  search.bits = bits;
+  search.rounds = rounds ? rounds : silc_math_prime_rounds(bits);
+
+  /* Sieve with the odd primes smaller than the smallest candidate */
+  for (i = 1; primetable[i] != 0; i++)
+    if (bits <= 14 && primetable[i] >= 1 << (bits - 1))
       break;
+  search.num_primes = i - 1;
+
+  if (threads > SILC_MATH_PRIME_MAX_THREADS)
+    threads = SILC_MATH_PRIME_MAX_THREADS;
+  if (!tp || threads < 2)
+    threads = 1;
+  if (threads > 1 && (!silc_mutex_alloc(&search.lock) ||
+		      !silc_cond_alloc(&search.cond))) {
+    if (search.lock)
+      silc_mutex_free(search.lock);
+    search.lock = NULL;
+    threads = 1;
+  }
+  search.num_workers = threads;
+
+  len = (bits + 7) / 8;
+  numbuf = silc_malloc(len);
+  if (!numbuf) {
+    if (search.lock) {
+      silc_cond_free(search.cond);
+      silc_mutex_free(search.lock);
     }
+    return FALSE;
+  }
 
-    /* Check highest bit */
-    silc_mp_div_2exp(&tmp, prime, bits - 1);
-    if (silc_mp_get_ui(&tmp) == 1) {
-      valid = TRUE;
+  silc_mp_init(&search.start);
+  silc_mp_init(&tmp);
+
+  SILC_LOG_DEBUG(("Generating new %d bit prime, %d threads", bits, threads));
+
+  while (!search.found && !search.error) {
+    /* Get random number */
+    if (!silc_math_prime_random(rng, NULL, numbuf, len))
       break;
+
+    /* Convert into MP and set the size, two highest bits and lowest bit.
+       With two highest bits set the product of two primes has exactly
+       twice the bits. */
+    silc_mp_bin2mp(numbuf, len, &search.start);
+    silc_mp_mod_2exp(&search.start, &search.start, bits);
+    silc_mp_set_ui(&tmp, 3);
+    silc_mp_mul_2exp(&tmp, &tmp, bits - 2);
+    if (bits > 2)
+      silc_mp_add_ui(&tmp, &tmp, 1);
+    silc_mp_or(&search.start, &search.start, &tmp);
+
+    /* Run the workers in threads.  The first worker, and any worker that
+       cannot get a thread, runs in this thread. */
+    search.done = 0;
+    for (i = 0; i < threads; i++) {
+      workers[i].search = &search;
+      workers[i].index = i;
+      workers[i].thread = FALSE;
+    }
+    for (i = 1; i < threads; i++)
+      workers[i].thread = silc_thread_pool_run(tp, FALSE, NULL,
+					       silc_math_prime_search,
+					       &workers[i], NULL, NULL);
+    for (i = 0; i < threads; i++)
+      if (!workers[i].thread)
+	silc_math_prime_search(NULL, &workers[i]);
+
+    /* Wait for all workers */
+    if (threads > 1) {
+      silc_mutex_lock(search.lock);
+      while (search.done < threads)
+	silc_cond_wait(search.cond, search.lock);
+      silc_mutex_unlock(search.lock);
     }
   }
 
-  silc_free(spmods);
-  silc_mp_uninit(&r);
-  silc_mp_uninit(&base);
+  memset(numbuf, 0, len);
+  silc_free(numbuf);
+  silc_mp_uninit(&search.start);
   silc_mp_uninit(&tmp);
-  silc_mp_uninit(&tmp2);
-  silc_mp_uninit(&oprime);
+  if (search.lock) {
+    silc_cond_free(search.cond);
+    silc_mutex_free(search.lock);
+  }
 
-  return valid;
+  SILC_LOG_DEBUG(("Tested %d candidates", search.tested));
+
+  return search.found;
+}
+
+/* Find appropriate prime.  If argument verbose is TRUE this will display
+   some status information about the progress of generation. */
+
+SilcBool silc_math_gen_prime(SilcMPInt *prime, SilcUInt32 bits,
+			     SilcBool verbose, SilcRng rng)
+{
+  return silc_math_gen_prime_ext(prime, bits, 0, rng, NULL, 0,
+				 verbose ? silc_math_prime_verbose : NULL,
+				 NULL);
 }
 
 /* Performs primality testings for given number. Returns TRUE if the
@@ -324,43 +617,38 @@ SilcBool silc_math_gen_prime(SilcMPInt *prime, SilcUInt32 bits,
 
 SilcBool silc_math_prime_test(SilcMPInt *p)
 {
-  SilcMPInt r, base, tmp;
-  int i, ret = 0;
-
-  silc_mp_init(&r);
-  silc_mp_init(&tmp);
-  silc_mp_init(&base);
-  silc_mp_set_ui(&base, 2);
+  SilcMPInt tmp;
+  int i;
 
   SILC_LOG_DEBUG(("Testing probability of prime"));
 
+  if (silc_mp_cmp_ui(p, 2) < 0)
+    return FALSE;
+
+  silc_mp_init(&tmp);
+
   /* See if the number is divisible by any of the
      small primes in primetable[]. */
   for (i = 0; primetable[i] != 0; i++) {
+    if (silc_mp_cmp_ui(p, primetable[i]) == 0) {
+      silc_mp_uninit(&tmp);
+      return TRUE;
+    }
+
     silc_mp_mod_ui(&tmp, p, primetable[i]);
 
     /* If mod is 0, the number is composite */
     if (silc_mp_cmp_ui(&tmp, 0) == 0) {
       SILC_LOG_DEBUG(("Number is not prime"));
-      silc_mp_uninit(&r);
       silc_mp_uninit(&tmp);
-      silc_mp_uninit(&base);
       return FALSE;
     }
   }
 
-  /* Does the prime pass the Fermat's prime test.
-   * r = 2 ^ p mod p, if r == 2, then p is probably a prime.
-   */
-  silc_mp_pow_mod(&r, &base, p, p);
-  if (silc_mp_cmp_ui(&r, 2) != 0)
-    ret = -1;
-
-  silc_mp_uninit(&r);
   silc_mp_uninit(&tmp);
-  silc_mp_uninit(&base);
 
-  if (ret) {
+  if (!silc_math_miller_rabin(NULL, p, silc_math_prime_rounds(
+			      silc_mp_sizeinbase(p, 2)), NULL, NULL, NULL)) {
     SILC_LOG_DEBUG(("Number is not prime"));
     return FALSE;
   }
@@ -0,0 +1,226 @@
+/*
+
+  test_mpspeed.c
+
+  Author: Pekka Riikonen <priikone@silcnet.org>
+
+  Copyright (C) 2008 Pekka Riikonen
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; version 2 of the License.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+*/
+
+/* SILC MP API benchmark.  Times the basic operations of the MP backend
+   that the library was compiled with.  One line is printed for each
+   operation and size:
+
+     <backend> <operation> <bits> <rounds> <ops/sec> <cycles/op>
+
+   The cycles/op is 0 if the CPU tick counter was not usable.
+
+   Usage: test_mpspeed [-t <seconds>] [<bits> ...] */
+
+#include "silccrypto.h"
+
+#define MP_MIN_TIME 1.0		/* seconds to run each test (at least) */
+
+#if defined(SILC_MP_GMP)
+#define MP_BACKEND "gmp"
+#elif defined(SILC_DIST_TFM)
+#define MP_BACKEND "tfm"
+#else
+#define MP_BACKEND "tma"
+#endif /* SILC_MP_GMP */
+
+/* Benchmarked operations */
+typedef enum {
+  MP_ADD,
+  MP_MUL,
+  MP_SQR,
+  MP_MOD,
+  MP_POW_MOD,
+  MP_MODINV,
+  MP_GCD,
+} MpOp;
+
+static const char *mp_op_names[] = {
+  "add", "mul", "sqr", "mod", "pow_mod", "modinv", "gcd", NULL
+};
+
+/* Default sizes */
+static const SilcUInt32 mp_bits[] = {
+  512, 1024, 2048, 3072, 4096, 8192, 0
+};
+
+SilcTimerStruct timer;
+SilcRng rng;
+double min_time = MP_MIN_TIME;
+
+/* Sets random `bits' long number to `mp'.  The highest bit is set and the
+   number is odd. */
+
+static void mp_random(SilcMPInt *mp, SilcUInt32 bits)
+{
+  unsigned char buf[8192 / 8];
+  SilcUInt32 len = (bits + 7) / 8;
+  SilcMPInt top;
+
+  silc_rng_get_rn_data(rng, len, buf, len);
+  silc_mp_bin2mp(buf, len, mp);
+  silc_mp_mod_2exp(mp, mp, bits - 1);
+
+  silc_mp_init(&top);
+  silc_mp_set_ui(&top, 1);
+  silc_mp_mul_2exp(&top, &top, bits - 1);
+  silc_mp_add(mp, mp, &top);
+  if (!(silc_mp_get_ui(mp) & 1))
+    silc_mp_add_ui(mp, mp, 1);
+  silc_mp_uninit(&top);
+}
+
+/* Runs `rounds' of operation `op' */
+
+static void mp_run(MpOp op, SilcUInt32 rounds, SilcMPInt *dst,
+		   SilcMPInt *a, SilcMPInt *b, SilcMPInt *n, SilcMPInt *big)
+{
+  SilcUInt32 i;
+
+  switch (op) {
+  case MP_ADD:
+    for (i = 0; i < rounds; i++)
+      silc_mp_add(dst, a, b);
+    break;
+
+  case MP_MUL:
+    for (i = 0; i < rounds; i++)
+      silc_mp_mul(dst, a, b);
+    break;
+
+  case MP_SQR:
+    for (i = 0; i < rounds; i++)
+      silc_mp_mul(dst, a, a);
+    break;
+
+  case MP_MOD:
+    for (i = 0; i < rounds; i++)
+      silc_mp_mod(dst, big, n);
+    break;
+
+  case MP_POW_MOD:
+    for (i = 0; i < rounds; i++)
+      silc_mp_pow_mod(dst, a, b, n);
+    break;
+
+  case MP_MODINV:
+    for (i = 0; i < rounds; i++)
+      silc_mp_modinv(dst, a, n);
+    break;
+
+  case MP_GCD:
+    for (i = 0; i < rounds; i++)
+      silc_mp_gcd(dst, a, b);
+    break;
+  }
+}
+
+/* Benchmarks operation `op' with `bits' sized numbers */
+
+static void mp_bench(MpOp op, SilcUInt32 bits)
+{
+  SilcMPInt dst, a, b, n, big;
+  SilcUInt64 sec, t1, t2;
+  SilcUInt32 usec, rounds = 1;
+  double totsec;
+
+  silc_mp_init(&dst);
+  silc_mp_init(&a);
+  silc_mp_init(&b);
+  silc_mp_init(&n);
+  silc_mp_init(&big);
+
+  /* The operands are smaller than the modulus, the `big' is twice the
+     size of the modulus as after multiplication */
+  mp_random(&n, bits);
+  mp_random(&a, bits - 1);
+  mp_random(&b, bits - 1);
+  silc_mp_mul(&big, &a, &n);
+
+  /* Warm up */
+  mp_run(op, 1, &dst, &a, &b, &n, &big);
+
+ retry:
+  silc_timer_start(&timer);
+  t1 = silc_timer_tick(&timer, FALSE);
+  mp_run(op, rounds, &dst, &a, &b, &n, &big);
+  t2 = silc_timer_tick(&timer, TRUE);
+  silc_timer_stop(&timer);
+
+  silc_timer_value(&timer, &sec, &usec);
+  totsec = (double)sec;
+  totsec += ((double)usec / (double)(1000 * 1000));
+  if (totsec < min_time) {
+    rounds *= 2;
+    goto retry;
+  }
+
+  /* The tick counter may go backwards if we moved to another CPU */
+  if (t2 < t1)
+    t2 = t1;
+
+  printf("%s %s %d %d %.2f %.0f\n", MP_BACKEND, mp_op_names[op], bits,
+	 rounds, (double)rounds / totsec, (double)(t2 - t1) / rounds);
+  fflush(stdout);
+
+  silc_mp_uninit(&dst);
+  silc_mp_uninit(&a);
+  silc_mp_uninit(&b);
+  silc_mp_uninit(&n);
+  silc_mp_uninit(&big);
+}
+
+int main(int argc, char **argv)
+{
+  SilcUInt32 bits[32], num_bits = 0;
+  int i, k;
+
+  silc_runtime_init();
+
+  for (i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "-t") && i + 1 < argc) {
+      min_time = atof(argv[++i]);
+      continue;
+    }
+    if (num_bits >= 32)
+      break;
+    bits[num_bits] = atoi(argv[i]);
+    if (bits[num_bits] < 64 || bits[num_bits] > 8192) {
+      fprintf(stderr, "Bits must be between 64 and 8192\n");
+      exit(1);
+    }
+    num_bits++;
+  }
+  if (!num_bits)
+    for (num_bits = 0; mp_bits[num_bits]; num_bits++)
+      bits[num_bits] = mp_bits[num_bits];
+
+  rng = silc_rng_alloc();
+  silc_rng_init(rng);
+  silc_timer_synchronize(&timer);
+
+  printf("# backend operation bits rounds ops/sec cycles/op\n");
+  for (k = 0; k < num_bits; k++)
+    for (i = 0; mp_op_names[i]; i++)
+      mp_bench(i, bits[k]);
+
+  silc_rng_free(rng);
+  silc_runtime_uninit();
+
+  return 0;
+}
@@ -79,12 +79,175 @@ const char *numor =
 const char *numxor =
 "406442100086368525205432595008864090782598685309019707370392150093114259667017507345870606014161693990793563407656070252325154011";
 
+/* Exptmod known answers, SHA-1 digest of the result in base 16.  The
+   modulus, base and exponent are the `bits' most significant bits of
+   num ^ e, num ^ (e + 1) and num ^ (e + 2), the modulus made odd. */
+const struct {
+  SilcUInt32 bits;
+  SilcUInt32 e;
+  const char *digest;
+} exptmod_kat[] = {
+  { 1024, 5,  "2DDA48A84197225A694515055A36969BA8164A85" },
+  { 2048, 10, "498D7DADA0A8B7934B8C2C21EF1868C0D571C6DF" },
+  { 4096, 20, "A74A56BA36511F9F439359AD02F81EA7E8B74DA8" },
+  { 0, 0, NULL }
+};
+
+/* Sets `dst' to the `bits' most significant bits of `mp' ^ `e' */
+
+static SilcBool test_top_bits(SilcMPInt *dst, SilcMPInt *mp, SilcUInt32 e,
+			      SilcUInt32 bits)
+{
+  if (!silc_mp_pow_ui(dst, mp, e))
+    return FALSE;
+  return silc_mp_div_2exp(dst, dst, silc_mp_sizeinbase(dst, 2) - bits);
+}
+
+/* Compares the digest of `mp' in base 16 to `digest' */
+
+static SilcBool test_digest(SilcHash sha1, SilcMPInt *mp, const char *digest)
+{
+  unsigned char r[1100], hash[20];
+
+  if (!silc_mp_get_str(r, mp, 16))
+    return FALSE;
+  silc_hash_make(sha1, r, strlen(r), hash);
+  silc_data2hex(hash, 20, r, sizeof(r));
+  SILC_LOG_DEBUG(("  digest = %s", r));
+  return !strcmp(r, digest);
+}
+
+/* Runs the exptmod known answer tests with all exponentiation functions */
+
+static SilcBool test_exptmod_kat(SilcHash sha1)
+{
+  SilcMPInt mp, p, g, x, y;
+  SilcMPMont mont;
+  SilcBool ret = FALSE;
+  int i;
+
+  silc_mp_init(&mp);
+  silc_mp_init(&p);
+  silc_mp_init(&g);
+  silc_mp_init(&x);
+  silc_mp_init(&y);
+  silc_mp_set_str(&mp, num, 10);
+
+  for (i = 0; exptmod_kat[i].bits; i++) {
+    SILC_LOG_DEBUG(("Exptmod known answer, %d bits", exptmod_kat[i].bits));
+    if (!test_top_bits(&p, &mp, exptmod_kat[i].e, exptmod_kat[i].bits) ||
+	!test_top_bits(&g, &mp, exptmod_kat[i].e + 1, exptmod_kat[i].bits) ||
+	!test_top_bits(&x, &mp, exptmod_kat[i].e + 2, exptmod_kat[i].bits))
+      goto err;
+    if (!(silc_mp_get_ui(&p) & 1) && !silc_mp_add_ui(&p, &p, 1))
+      goto err;
+
+    if (!silc_mp_pow_mod(&y, &g, &x, &p) ||
+	!test_digest(sha1, &y, exptmod_kat[i].digest))
+      goto err;
+    if (!silc_mp_pow_mod_secret(&y, &g, &x, &p) ||
+	!test_digest(sha1, &y, exptmod_kat[i].digest))
+      goto err;
+
+    if (!silc_mp_mont_init(&mont, &p))
+      goto err;
+    if (!silc_mp_pow_mod_mont(&y, &g, &x, &mont) ||
+	!test_digest(sha1, &y, exptmod_kat[i].digest) ||
+	!silc_mp_pow_mod_mont_secret(&y, &g, &x, &mont) ||
+	!test_digest(sha1, &y, exptmod_kat[i].digest)) {
+      silc_mp_mont_uninit(&mont);
+      goto err;
+    }
+    silc_mp_mont_uninit(&mont);
+  }
+
+  ret = TRUE;
+
+ err:
+  silc_mp_uninit(&mp);
+  silc_mp_uninit(&p);
+  silc_mp_uninit(&g);
+  silc_mp_uninit(&x);
+  silc_mp_uninit(&y);
+  return ret;
+}
+
+/* Primality test known answers.  Carmichael numbers 561, 41041 and the
+   Chernick number with factors 6000307, 12000613 and 18000919 pass the
+   Fermat test to all coprime bases. */
+const struct {
+  const char *num;
+  SilcBool prime;
+} prime_kat[] = {
+  { "2", TRUE },
+  { "3", TRUE },
+  { "4", FALSE },
+  { "97", TRUE },
+  { "561", FALSE },
+  { "8191", TRUE },
+  { "41041", FALSE },
+  { "1296198694153288947529", FALSE },
+  { "170141183460469231731687303715884105727", TRUE },
+  { "340282366920938463463374607431768211457", FALSE },
+  { NULL, FALSE }
+};
+
+/* Tests the primality test and the prime generation */
+
+static SilcBool test_primes(void)
+{
+  SilcThreadPool tp = NULL;
+  SilcRng rng;
+  SilcMPInt mp;
+  SilcBool ret = FALSE;
+  int i;
+
+  rng = silc_rng_alloc();
+  if (!rng)
+    return FALSE;
+  silc_rng_init(rng);
+  silc_mp_init(&mp);
+
+  for (i = 0; prime_kat[i].num; i++) {
+    SILC_LOG_DEBUG(("Prime test %s", prime_kat[i].num));
+    silc_mp_set_str(&mp, prime_kat[i].num, 10);
+    if (silc_math_prime_test(&mp) != prime_kat[i].prime)
+      goto err;
+  }
+
+  for (i = 2; i <= 16; i++) {
+    SILC_LOG_DEBUG(("Generate %d bit prime", i));
+    if (!silc_math_gen_prime(&mp, i, FALSE, rng))
+      goto err;
+    if (silc_mp_sizeinbase(&mp, 2) != i || !silc_math_prime_test(&mp))
+      goto err;
+  }
+
+  SILC_LOG_DEBUG(("Generate 512 bit prime in 4 threads"));
+  tp = silc_thread_pool_alloc(NULL, 1, 3, TRUE);
+  if (!tp)
+    goto err;
+  if (!silc_math_gen_prime_ext(&mp, 512, 0, rng, tp, 4, NULL, NULL))
+    goto err;
+  if (silc_mp_sizeinbase(&mp, 2) != 512 || !silc_math_prime_test(&mp))
+    goto err;
+
+  ret = TRUE;
+
+ err:
+  if (tp)
+    silc_thread_pool_free(tp, TRUE);
+  silc_mp_uninit(&mp);
+  silc_rng_free(rng);
+  return ret;
+}
 
 int main(int argc, char **argv)
 {
   SilcBool success = FALSE;
   unsigned char i[65535], r[65535], hash[20];
   SilcMPInt mp1, mp2, mp3, mp4;
+  SilcMPFixedBase fixed;
   SilcUInt32 ui;
   SilcHash sha1;
 
@@ -268,6 +431,57 @@ int main(int argc, char **argv)
   if (strcmp(i, numexptmod))
     goto err;
 
+  SILC_LOG_DEBUG(("Fixed-base exptmod"));
+  fixed = silc_mp_fixed_alloc(&mp4, &mp3, silc_mp_sizeinbase(&mp4, 2), 0);
+  if (!fixed)
+    goto err;
+  if (!silc_mp_pow_mod_fixed(&mp2, &mp4, fixed))
+    goto err;
+  if (!silc_mp_get_str(i, &mp2, 10))
+    goto err;
+  SILC_LOG_DEBUG(("  = %s", i));
+  if (strcmp(i, numexptmod))
+    goto err;
+  silc_mp_fixed_free(fixed);
+
+  SILC_LOG_DEBUG(("Fixed-base exptmod, small table"));
+  fixed = silc_mp_fixed_alloc(&mp4, &mp3, silc_mp_sizeinbase(&mp4, 2), 512);
+  if (!fixed)
+    goto err;
+  if (!silc_mp_pow_mod_fixed(&mp2, &mp4, fixed))
+    goto err;
+  if (silc_mp_cmp(&mp2, &mp1) != 0)
+    goto err;
+  SILC_LOG_DEBUG(("Fixed-base exptmod, zero exponent"));
+  silc_mp_set_ui(&mp2, 0);
+  if (!silc_mp_pow_mod_fixed(&mp2, &mp2, fixed))
+    goto err;
+  if (silc_mp_cmp_ui(&mp2, 1) != 0)
+    goto err;
+  silc_mp_fixed_free(fixed);
+
+  SILC_LOG_DEBUG(("Secret exptmod"));
+  if (!silc_mp_pow_mod_secret(&mp2, &mp4, &mp4, &mp3))
+    goto err;
+  if (silc_mp_cmp(&mp2, &mp1) != 0)
+    goto err;
+
+#if !defined(SILC_MP_GMP) && defined(SILC_DIST_TFM)
+  /* The vector kernels of TFM are used if the CPU has them */
+  SILC_LOG_DEBUG(("Exptmod known answers, vector kernels %s",
+		  tfm_fp_exptmod_vec_enable(TRUE) ? "used" : "not available"));
+  if (!test_exptmod_kat(sha1))
+    goto err;
+  SILC_LOG_DEBUG(("Exptmod known answers, vector kernels disabled"));
+  tfm_fp_exptmod_vec_enable(FALSE);
+  if (!test_exptmod_kat(sha1))
+    goto err;
+  tfm_fp_exptmod_vec_enable(TRUE);
+#else
+  if (!test_exptmod_kat(sha1))
+    goto err;
+#endif /* !SILC_MP_GMP && SILC_DIST_TFM */
+
   SILC_LOG_DEBUG(("GCD"));
   if (!silc_mp_gcd(&mp2, &mp1, &mp3))
     goto err;
@@ -314,6 +528,9 @@ int main(int argc, char **argv)
     goto err;
 
 
+  if (!test_primes())
+    goto err;
+
   silc_mp_uninit(&mp1);
   silc_mp_uninit(&mp2);
   silc_mp_uninit(&mp3);
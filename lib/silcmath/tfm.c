@@ -754,13 +754,20 @@ int tfm_fp_div_d(tfm_fp_int *a, tfm_fp_digit b, tfm_fp_int *c, tfm_fp_digit *d)
 
 /* y = g**x (mod b)
  * Some restrictions... x must be positive and < b
+ * If mont is non-NULL its precomputed values are used and P is mont->n
  */
-static int _tfm_fp_exptmod(tfm_fp_int * G, tfm_fp_int * X, tfm_fp_int * P, tfm_fp_int * Y)
+static int _tfm_fp_exptmod(tfm_fp_int * G, tfm_fp_int * X, tfm_fp_int * P,
+			   tfm_fp_mont *mont, tfm_fp_int * Y)
 {
   tfm_fp_int   M[64], res;
   tfm_fp_digit buf, mp;
   int      err, bitbuf, bitcpy, bitcnt, mode, digidx, x, y, winsize;
 
+  /* use the vector kernels if the CPU has them */
+  if ((err = tfm_fp_exptmod_vec(G, X, P, 0, Y)) != TFM_FP_VAL) {
+    return err;
+  }
+
   /* find window size */
   x = tfm_fp_count_bits (X);
   if (x <= 21) {
@@ -779,7 +786,9 @@ static int _tfm_fp_exptmod(tfm_fp_int * G, tfm_fp_int * X, tfm_fp_int * P, tfm_f
   memset(M, 0, sizeof(M));
 
   /* now setup montgomery  */
-  if ((err = tfm_fp_montgomery_setup (P, &mp)) != TFM_FP_OKAY) {
+  if (mont) {
+     mp = mont->rho;
+  } else if ((err = tfm_fp_montgomery_setup (P, &mp)) != TFM_FP_OKAY) {
      return err;
   }
 
@@ -795,7 +804,12 @@ static int _tfm_fp_exptmod(tfm_fp_int * G, tfm_fp_int * X, tfm_fp_int * P, tfm_f
    */
 
    /* now we need R mod m */
-   tfm_fp_montgomery_calc_normalization (&res, P);
+   if (mont) {
+     if (tfm_fp_copy(&mont->r, &res))
+       return TFM_FP_MEM;
+   } else {
+     tfm_fp_montgomery_calc_normalization (&res, P);
+   }
 
    /* now set M[1] to G * R mod m */
    if (tfm_fp_cmp_mag(P, G) != TFM_FP_GT) {
@@ -806,8 +820,15 @@ static int _tfm_fp_exptmod(tfm_fp_int * G, tfm_fp_int * X, tfm_fp_int * P, tfm_f
      if (tfm_fp_copy(G, &M[1]))
        return TFM_FP_MEM;
    }
-   if (tfm_fp_mulmod (&M[1], &res, P, &M[1]))
-     return TFM_FP_MEM;
+   if (mont) {
+     /* G * R**2 / R == G * R without division */
+     if (tfm_fp_mul(&M[1], &mont->r2, &M[1]))
+       return TFM_FP_MEM;
+     tfm_fp_montgomery_reduce(&M[1], P, mp);
+   } else {
+     if (tfm_fp_mulmod (&M[1], &res, P, &M[1]))
+       return TFM_FP_MEM;
+   }
 
   /* compute the value at M[1<<(winsize-1)] by squaring M[1] (winsize-1) times */
   if (tfm_fp_copy (&M[1], &M[1 << (winsize - 1)]))
@@ -944,15 +965,321 @@ int tfm_fp_exptmod(tfm_fp_int * G, tfm_fp_int * X, tfm_fp_int * P, tfm_fp_int *
        return err;
      }
      X->sign = TFM_FP_ZPOS;
-     err =  _tfm_fp_exptmod(&tmp, X, P, Y);
+     err =  _tfm_fp_exptmod(&tmp, X, P, NULL, Y);
      if (X != Y) {
        X->sign = TFM_FP_NEG;
      }
      return err;
    } else {
      /* Positive exponent so just exptmod */
-     return _tfm_fp_exptmod(G, X, P, Y);
+     return _tfm_fp_exptmod(G, X, P, NULL, Y);
+   }
+}
+
+/* precomputes the Montgomery context for odd modulus n */
+int tfm_fp_mont_init(tfm_fp_mont *mont, tfm_fp_int *n)
+{
+   tfm_fp_int tmp;
+   int err;
+
+   tfm_fp_init(&mont->n);
+   tfm_fp_init(&mont->r);
+   tfm_fp_init(&mont->r2);
+
+   if (tfm_fp_iszero(n) == TFM_FP_YES || n->sign == TFM_FP_NEG) {
+     return TFM_FP_VAL;
+   }
+   if ((err = tfm_fp_montgomery_setup(n, &mont->rho)) != TFM_FP_OKAY) {
+     return err;
+   }
+
+   /* R mod n and R**2 mod n */
+   if (tfm_fp_copy(n, &mont->n) ||
+       tfm_fp_montgomery_calc_normalization(&mont->r, n) ||
+       tfm_fp_mulmod(&mont->r, &mont->r, n, &mont->r2)) {
+     tfm_fp_mont_zero(mont);
+     return TFM_FP_MEM;
+   }
+
+   /* the multiplication grows its inputs when needed.  Do it now so that
+      the context is not modified when it is shared between threads. */
+   tfm_fp_init(&tmp);
+   err = tfm_fp_mul(&mont->r2, &mont->r2, &tmp);
+   tfm_fp_zero(&tmp);
+   if (err) {
+     tfm_fp_mont_zero(mont);
+     return TFM_FP_MEM;
+   }
+
+   return TFM_FP_OKAY;
+}
+
+void tfm_fp_mont_zero(tfm_fp_mont *mont)
+{
+   tfm_fp_zero(&mont->n);
+   tfm_fp_zero(&mont->r);
+   tfm_fp_zero(&mont->r2);
+   mont->rho = 0;
+}
+
+/* d = a**b (mod n) where n is the modulus of the Montgomery context */
+int tfm_fp_exptmod_mont(tfm_fp_int *G, tfm_fp_int *X, tfm_fp_mont *mont,
+			tfm_fp_int *Y)
+{
+   /* negative exponent needs inversion, no gain from the context */
+   if (X->sign == TFM_FP_NEG) {
+     return tfm_fp_exptmod(G, X, &mont->n, Y);
+   }
+   return _tfm_fp_exptmod(G, X, &mont->n, mont, Y);
+}
+
+/* window size of the constant time exptmod */
+#define TFM_CT_WINSIZE 5
+
+/* returns digit mask of all ones if a == b, and zero otherwise */
+#define TFM_CT_EQ_MASK(a, b)						\
+  ((tfm_fp_digit)0 - (tfm_fp_digit)(((unsigned int)((a) ^ (b)) - 1) >>	\
+				     (sizeof(unsigned int) * CHAR_BIT - 1)))
+
+/* stores a as the entry k of the table.  The table is scattered, digit i
+ * of all entries is stored together. */
+static void tfm_fp_ct_scatter(tfm_fp_digit *tab, tfm_fp_int *a, int k, int nd)
+{
+   int i;
+
+   for (i = 0; i < nd; i++) {
+      tab[(i << TFM_CT_WINSIZE) + k] = i < a->used ? a->dp[i] : 0;
+   }
+}
+
+/* loads the entry k of the table to a.  All entries are read. */
+static int tfm_fp_ct_gather(tfm_fp_int *a, tfm_fp_digit *tab, int k, int nd)
+{
+   tfm_fp_digit d;
+   int i, j;
+
+   if (tfm_fp_grow(a, nd)) {
+      return TFM_FP_MEM;
+   }
+
+   for (i = 0; i < nd; i++) {
+      d = 0;
+      for (j = 0; j < (1 << TFM_CT_WINSIZE); j++) {
+         d |= tab[(i << TFM_CT_WINSIZE) + j] & TFM_CT_EQ_MASK(j, k);
+      }
+      a->dp[i] = d;
+   }
+   /* not clamped, the number of digits must not depend on the entry */
+   a->used = nd;
+   a->sign = TFM_FP_ZPOS;
+   return TFM_FP_OKAY;
+}
+
+/* y = g**x (mod p) for secret x.
+ * The exponent is processed in fixed windows and one multiplication is done
+ * for every window, also for windows of zero bits.  The number of windows
+ * depends only on the number of digits in x, and the table lookup reads all
+ * entries.  The intermediate values are kept at the digit count of p and
+ * the reductions use masked final subtraction, so the time does not depend
+ * on their values.  If mont is non-NULL its precomputed values are used and
+ * P is mont->n
+ */
+static int _tfm_fp_exptmod_ct(tfm_fp_int * G, tfm_fp_int * X, tfm_fp_int * P,
+			      tfm_fp_mont *mont, tfm_fp_int * Y)
+{
+  tfm_fp_int   res, tmp;
+  tfm_fp_digit *tab, mp;
+  SilcStack    stack = NULL;
+  int          err, nd, x, y, win;
+
+  /* use the vector kernels if the CPU has them */
+  if ((err = tfm_fp_exptmod_vec(G, X, P, 1, Y)) != TFM_FP_VAL) {
+    return err;
+  }
+
+  /* now setup montgomery  */
+  if (mont) {
+     mp = mont->rho;
+  } else if ((err = tfm_fp_montgomery_setup (P, &mp)) != TFM_FP_OKAY) {
+     return err;
+  }
+
+  /* the table and the integers hold the digits of the modulus.  they are
+     allocated from the stack of the result if it has one. */
+  nd  = P->used;
+  if (Y->stack)
+    stack = silc_stack_alloc(0, Y->stack);
+  tab = silc_scalloc(stack, nd << TFM_CT_WINSIZE, sizeof(*tab));
+  if (tab == NULL) {
+    silc_stack_free(stack);
+    return TFM_FP_MEM;
+  }
+  err = TFM_FP_MEM;
+  tfm_fp_init(&res);
+  tfm_fp_init(&tmp);
+  if (tfm_fp_init_size(Y->stack, &res, nd * 2 + 1) ||
+      tfm_fp_init_size(Y->stack, &tmp, nd * 2 + 1)) {
+    goto out;
+  }
+
+  /* tab[0] = R mod p, tab[1] = G * R mod p */
+  if (mont) {
+    if (tfm_fp_copy(&mont->r, &res))
+      goto out;
+  } else {
+    tfm_fp_montgomery_calc_normalization (&res, P);
+  }
+  tfm_fp_ct_scatter(tab, &res, 0, nd);
+
+  if (tfm_fp_cmp_mag(P, G) != TFM_FP_GT) {
+    if (tfm_fp_mod(G, P, &tmp))
+      goto out;
+  } else {
+    if (tfm_fp_copy(G, &tmp))
+      goto out;
+  }
+  if (mont) {
+    if (tfm_fp_mul(&tmp, &mont->r2, &tmp))
+      goto out;
+    tfm_fp_montgomery_reduce_ct(&tmp, P, mp);
+  } else {
+    if (tfm_fp_mulmod (&tmp, &res, P, &tmp))
+      goto out;
+  }
+  tfm_fp_ct_scatter(tab, &tmp, 1, nd);
+
+  /* tab[x] = G**x * R mod p */
+  if (tfm_fp_copy(&tmp, &res))
+    goto out;
+  for (x = 2; x < (1 << TFM_CT_WINSIZE); x++) {
+    if (tfm_fp_mul(&res, &tmp, &res))
+      goto out;
+    tfm_fp_montgomery_reduce_ct(&res, P, mp);
+    tfm_fp_ct_scatter(tab, &res, x, nd);
+  }
+
+  /* windows from the most significant digit of x */
+  x = (X->used * DIGIT_BIT - 1) / TFM_CT_WINSIZE * TFM_CT_WINSIZE;
+  for (win = 0, y = TFM_CT_WINSIZE - 1; y >= 0; y--) {
+    win = (win << 1) | (x + y < X->used * DIGIT_BIT ?
+			(X->dp[(x + y) / DIGIT_BIT] >> ((x + y) % DIGIT_BIT)) & 1 : 0);
+  }
+  if (tfm_fp_ct_gather(&res, tab, win, nd))
+    goto out;
+
+  for (x -= TFM_CT_WINSIZE; x >= 0; x -= TFM_CT_WINSIZE) {
+    for (y = 0; y < TFM_CT_WINSIZE; y++) {
+      if (tfm_fp_sqr(&res, &res))
+	goto out;
+      tfm_fp_montgomery_reduce_ct(&res, P, mp);
+    }
+
+    for (win = 0, y = TFM_CT_WINSIZE - 1; y >= 0; y--) {
+      win = (win << 1) | ((X->dp[(x + y) / DIGIT_BIT] >> ((x + y) % DIGIT_BIT)) & 1);
+    }
+    if (tfm_fp_ct_gather(&tmp, tab, win, nd) ||
+	tfm_fp_mul(&res, &tmp, &res))
+      goto out;
+    tfm_fp_montgomery_reduce_ct(&res, P, mp);
+  }
+
+  /* cancel out the factor of R */
+  tfm_fp_montgomery_reduce_ct(&res, P, mp);
+  tfm_fp_clamp(&res);
+
+  tfm_fp_exch (&res, Y);
+  err = TFM_FP_OKAY;
+
+out:
+  memset(tab, 0, (nd << TFM_CT_WINSIZE) * sizeof(*tab));
+  silc_sfree(stack, tab);
+  silc_stack_free(stack);
+  tfm_fp_zero(&res);
+  tfm_fp_zero(&tmp);
+  return err;
+}
+
+int tfm_fp_exptmod_ct(tfm_fp_int * G, tfm_fp_int * X, tfm_fp_int * P,
+		      tfm_fp_int * Y)
+{
+   tfm_fp_int tmp;
+   int    err;
+
+   /* is X negative?  */
+   if (X->sign == TFM_FP_NEG) {
+     /* yes, copy G and invmod it */
+     tfm_fp_init(&tmp);
+     if (tfm_fp_copy(G, &tmp))
+       return TFM_FP_MEM;
+     if ((err = tfm_fp_invmod(&tmp, P, &tmp)) != TFM_FP_OKAY) {
+       tfm_fp_zero(&tmp);
+       return err;
+     }
+     X->sign = TFM_FP_ZPOS;
+     err = _tfm_fp_exptmod_ct(&tmp, X, P, NULL, Y);
+     if (X != Y) {
+       X->sign = TFM_FP_NEG;
+     }
+     tfm_fp_zero(&tmp);
+     return err;
+   }
+
+   return _tfm_fp_exptmod_ct(G, X, P, NULL, Y);
+}
+
+int tfm_fp_exptmod_mont_ct(tfm_fp_int *G, tfm_fp_int *X, tfm_fp_mont *mont,
+			   tfm_fp_int *Y)
+{
+   /* negative exponent needs inversion, no gain from the context */
+   if (X->sign == TFM_FP_NEG) {
+     return tfm_fp_exptmod_ct(G, X, &mont->n, Y);
+   }
+   return _tfm_fp_exptmod_ct(G, X, &mont->n, mont, Y);
+}
+
+/* b = a * R (mod n).  The Montgomery form is reduced in constant time and
+ * keeps the digit count of n, see tfm_fp_montgomery_reduce_ct */
+int tfm_fp_mont_to(tfm_fp_int *a, tfm_fp_mont *mont, tfm_fp_int *b)
+{
+   int err;
+
+   if (a->sign == TFM_FP_NEG || tfm_fp_cmp_mag(a, &mont->n) != TFM_FP_LT) {
+     if ((err = tfm_fp_mod(a, &mont->n, b)) != TFM_FP_OKAY) {
+       return err;
+     }
+     a = b;
+   }
+
+   /* a * R**2 / R == a * R */
+   if (tfm_fp_mul(a, &mont->r2, b)) {
+     return TFM_FP_MEM;
    }
+   return tfm_fp_montgomery_reduce_ct(b, &mont->n, mont->rho);
+}
+
+/* c = a * b / R (mod n) in constant time, the digit count of n is kept */
+int tfm_fp_mont_mul(tfm_fp_int *a, tfm_fp_int *b, tfm_fp_mont *mont,
+		    tfm_fp_int *c)
+{
+   if (a == b) {
+     if (tfm_fp_sqr(a, c)) {
+       return TFM_FP_MEM;
+     }
+   } else if (tfm_fp_mul(a, b, c)) {
+     return TFM_FP_MEM;
+   }
+   return tfm_fp_montgomery_reduce_ct(c, &mont->n, mont->rho);
+}
+
+/* b = a / R (mod n), the result is normal integer */
+int tfm_fp_mont_from(tfm_fp_int *a, tfm_fp_mont *mont, tfm_fp_int *b)
+{
+   if (tfm_fp_copy(a, b) ||
+       tfm_fp_montgomery_reduce_ct(b, &mont->n, mont->rho)) {
+     return TFM_FP_MEM;
+   }
+   tfm_fp_clamp(b);
+   return TFM_FP_OKAY;
 }
 
 /* c = (a, b) */
@@ -1875,8 +2202,11 @@ asm(                                 \
 #include "tfm_fp_mont_small.i"
 #endif
 
-/* computes x/R == x (mod N) via Montgomery Reduction */
-int tfm_fp_montgomery_reduce(tfm_fp_int *a, tfm_fp_int *m, tfm_fp_digit mp)
+/* computes x/R via Montgomery Reduction without the final subtraction.
+ * the result in a has m->used + 1 digits, it is not clamped and it is
+ * less than 2 * m */
+static int tfm_fp_montgomery_reduce_nosub(tfm_fp_int *a, tfm_fp_int *m,
+					  tfm_fp_digit mp)
 {
    tfm_fp_digit *c, C[TFM_FP_SIZE], *ac = NULL, *_c, *tmpm, mu;
    int      oldused, x, y, pa;
@@ -1950,11 +2280,20 @@ int tfm_fp_montgomery_reduce(tfm_fp_int *a, tfm_fp_int *m, tfm_fp_digit mp)
   MONT_FINI;
 
   a->used = pa+1;
-  tfm_fp_clamp(a);
 
   if (ac)
     silc_sfree(a->stack, ac);
 
+  return TFM_FP_OKAY;
+}
+
+/* computes x/R == x (mod N) via Montgomery Reduction */
+int tfm_fp_montgomery_reduce(tfm_fp_int *a, tfm_fp_int *m, tfm_fp_digit mp)
+{
+  if (tfm_fp_montgomery_reduce_nosub(a, m, mp))
+    return TFM_FP_MEM;
+  tfm_fp_clamp(a);
+
   /* if A >= m then A = A - m */
   if (tfm_fp_cmp_mag (a, m) != TFM_FP_LT) {
     if (s_tfm_fp_sub (a, m, a))
@@ -1963,6 +2302,42 @@ int tfm_fp_montgomery_reduce(tfm_fp_int *a, tfm_fp_int *m, tfm_fp_digit mp)
   return TFM_FP_OKAY;
 }
 
+/* computes x/R == x (mod N) via Montgomery Reduction in constant time.
+ * The final subtraction is always computed and its result is selected
+ * with a mask.  The result has m->used digits and it is not clamped. */
+int tfm_fp_montgomery_reduce_ct(tfm_fp_int *a, tfm_fp_int *m,
+				tfm_fp_digit mp)
+{
+  tfm_fp_digit borrow, mask;
+  tfm_fp_word  t;
+  int          x, pa = m->used;
+
+  if (tfm_fp_montgomery_reduce_nosub(a, m, mp))
+    return TFM_FP_MEM;
+
+  /* borrow of A - m over all pa + 1 digits, zero when A >= m */
+  borrow = 0;
+  for (x = 0; x < pa; x++) {
+    t = (tfm_fp_word)a->dp[x] - m->dp[x] - borrow;
+    borrow = (tfm_fp_digit)(t >> DIGIT_BIT) & 1;
+  }
+  t = (tfm_fp_word)a->dp[pa] - borrow;
+  borrow = (tfm_fp_digit)(t >> DIGIT_BIT) & 1;
+
+  /* A = A - (m & mask) */
+  mask = borrow - 1;
+  borrow = 0;
+  for (x = 0; x < pa; x++) {
+    t = (tfm_fp_word)a->dp[x] - (m->dp[x] & mask) - borrow;
+    a->dp[x] = (tfm_fp_digit)t;
+    borrow = (tfm_fp_digit)(t >> DIGIT_BIT) & 1;
+  }
+  a->dp[pa] = 0;
+  a->used = pa;
+  a->sign = TFM_FP_ZPOS;
+  return TFM_FP_OKAY;
+}
+
 /* setups the montgomery reduction */
 int tfm_fp_montgomery_setup(tfm_fp_int *a, tfm_fp_digit *rho)
 {
@@ -2004,6 +2379,13 @@ int tfm_fp_mul(tfm_fp_int *A, tfm_fp_int *B, tfm_fp_int *C)
      y  = MAX(A->used, B->used);
      yy = MIN(A->used, B->used);
 
+    /* the product is zero.  The inputs may not have any digits allocated
+       so the combas cannot be used. */
+    if (yy == 0) {
+       tfm_fp_zeroise(C);
+       return TFM_FP_OKAY;
+    }
+
     /* pick a comba (unrolled 4/8/16/32 x or rolled) based on the size
        of the largest input.  We also want to avoid doing excess mults if the
        inputs are not close to the next power of two.  That is, for example,
@@ -2012,16 +2394,16 @@ int tfm_fp_mul(tfm_fp_int *A, tfm_fp_int *B, tfm_fp_int *C)
 
 #ifdef TFM_SMALL_SET
         if (y <= 16) {
-          /* Grow when needed.  All mul routines expect the space to be there
-             and that all integers are same size. */
+          /* Grow when needed.  The unrolled routines read the full operand
+             size from the inputs and write the double size product. */
           if (C->alloc < 32 + 1)
             if (tfm_fp_grow(C, 32 + 1))
 	      return TFM_FP_MEM;
-          if (A->alloc < 32 + 1)
-            if (tfm_fp_grow(A, 32 + 1))
+          if (A->alloc < y)
+            if (tfm_fp_grow(A, y))
               return TFM_FP_MEM;
-          if (B->alloc < 32 + 1)
-            if (tfm_fp_grow(B, 32 + 1))
+          if (B->alloc < y)
+            if (tfm_fp_grow(B, y))
               return TFM_FP_MEM;
 
            tfm_fp_mul_comba_small(A,B,C);
@@ -2030,16 +2412,16 @@ int tfm_fp_mul(tfm_fp_int *A, tfm_fp_int *B, tfm_fp_int *C)
 #endif
 #if defined(TFM_MUL20)
         if (y <= 20) {
-          /* Grow when needed.  All mul routines expect the space to be there
-             and that all integers are same size. */
+          /* Grow when needed.  The unrolled routines read the full operand
+             size from the inputs and write the double size product. */
           if (C->alloc < 40 + 1)
             if (tfm_fp_grow(C, 40 + 1))
 	      return TFM_FP_MEM;
-          if (A->alloc < 40 + 1)
-            if (tfm_fp_grow(A, 40 + 1))
+          if (A->alloc < 20)
+            if (tfm_fp_grow(A, 20))
               return TFM_FP_MEM;
-          if (B->alloc < 40 + 1)
-            if (tfm_fp_grow(B, 40 + 1))
+          if (B->alloc < 20)
+            if (tfm_fp_grow(B, 20))
               return TFM_FP_MEM;
 
            tfm_fp_mul_comba20(A,B,C);
@@ -2048,16 +2430,16 @@ int tfm_fp_mul(tfm_fp_int *A, tfm_fp_int *B, tfm_fp_int *C)
 #endif
 #if defined(TFM_MUL24)
         if (yy >= 16 && y <= 24) {
-          /* Grow when needed.  All mul routines expect the space to be there
-             and that all integers are same size. */
+          /* Grow when needed.  The unrolled routines read the full operand
+             size from the inputs and write the double size product. */
           if (C->alloc < 48 + 1)
             if (tfm_fp_grow(C, 48 + 1))
 	      return TFM_FP_MEM;
-          if (A->alloc < 48 + 1)
-            if (tfm_fp_grow(A, 48 + 1))
+          if (A->alloc < 24)
+            if (tfm_fp_grow(A, 24))
               return TFM_FP_MEM;
-          if (B->alloc < 48 + 1)
-            if (tfm_fp_grow(B, 48 + 1))
+          if (B->alloc < 24)
+            if (tfm_fp_grow(B, 24))
               return TFM_FP_MEM;
 
            tfm_fp_mul_comba24(A,B,C);
@@ -2066,16 +2448,16 @@ int tfm_fp_mul(tfm_fp_int *A, tfm_fp_int *B, tfm_fp_int *C)
 #endif
 #if defined(TFM_MUL28)
         if (yy >= 20 && y <= 28) {
-          /* Grow when needed.  All mul routines expect the space to be there
-             and that all integers are same size. */
+          /* Grow when needed.  The unrolled routines read the full operand
+             size from the inputs and write the double size product. */
           if (C->alloc < 56 + 1)
             if (tfm_fp_grow(C, 56 + 1))
 	      return TFM_FP_MEM;
-          if (A->alloc < 56 + 1)
-            if (tfm_fp_grow(A, 56 + 1))
+          if (A->alloc < 28)
+            if (tfm_fp_grow(A, 28))
               return TFM_FP_MEM;
-          if (B->alloc < 56 + 1)
-            if (tfm_fp_grow(B, 56 + 1))
+          if (B->alloc < 28)
+            if (tfm_fp_grow(B, 28))
               return TFM_FP_MEM;
 
            tfm_fp_mul_comba28(A,B,C);
@@ -2084,16 +2466,16 @@ int tfm_fp_mul(tfm_fp_int *A, tfm_fp_int *B, tfm_fp_int *C)
 #endif
 #if defined(TFM_MUL32)
         if (yy >= 24 && y <= 32) {
-          /* Grow when needed.  All mul routines expect the space to be there
-             and that all integers are same size. */
+          /* Grow when needed.  The unrolled routines read the full operand
+             size from the inputs and write the double size product. */
           if (C->alloc < 64 + 1)
             if (tfm_fp_grow(C, 64 + 1))
 	      return TFM_FP_MEM;
-          if (A->alloc < 64 + 1)
-            if (tfm_fp_grow(A, 64 + 1))
+          if (A->alloc < 32)
+            if (tfm_fp_grow(A, 32))
               return TFM_FP_MEM;
-          if (B->alloc < 64 + 1)
-            if (tfm_fp_grow(B, 64 + 1))
+          if (B->alloc < 32)
+            if (tfm_fp_grow(B, 32))
               return TFM_FP_MEM;
 
            tfm_fp_mul_comba32(A,B,C);
@@ -2102,16 +2484,16 @@ int tfm_fp_mul(tfm_fp_int *A, tfm_fp_int *B, tfm_fp_int *C)
 #endif
 #if defined(TFM_MUL48)
         if (yy >= 40 && y <= 48) {
-          /* Grow when needed.  All mul routines expect the space to be there
-             and that all integers are same size. */
+          /* Grow when needed.  The unrolled routines read the full operand
+             size from the inputs and write the double size product. */
           if (C->alloc < 96 + 1)
             if (tfm_fp_grow(C, 96 + 1))
 	      return TFM_FP_MEM;
-          if (A->alloc < 96 + 1)
-            if (tfm_fp_grow(A, 96 + 1))
+          if (A->alloc < 48)
+            if (tfm_fp_grow(A, 48))
               return TFM_FP_MEM;
-          if (B->alloc < 96 + 1)
-            if (tfm_fp_grow(B, 96 + 1))
+          if (B->alloc < 48)
+            if (tfm_fp_grow(B, 48))
               return TFM_FP_MEM;
 
            tfm_fp_mul_comba48(A,B,C);
@@ -2120,16 +2502,16 @@ int tfm_fp_mul(tfm_fp_int *A, tfm_fp_int *B, tfm_fp_int *C)
 #endif
 #if defined(TFM_MUL64)
         if (yy >= 56 && y <= 64) {
-          /* Grow when needed.  All mul routines expect the space to be there
-             and that all integers are same size. */
+          /* Grow when needed.  The unrolled routines read the full operand
+             size from the inputs and write the double size product. */
           if (C->alloc < 128 + 1)
             if (tfm_fp_grow(C, 128 + 1))
 	      return TFM_FP_MEM;
-          if (A->alloc < 128 + 1)
-            if (tfm_fp_grow(A, 128 + 1))
+          if (A->alloc < 64)
+            if (tfm_fp_grow(A, 64))
               return TFM_FP_MEM;
-          if (B->alloc < 128 + 1)
-            if (tfm_fp_grow(B, 128 + 1))
+          if (B->alloc < 64)
+            if (tfm_fp_grow(B, 64))
               return TFM_FP_MEM;
 
            tfm_fp_mul_comba64(A,B,C);
@@ -2137,17 +2519,11 @@ int tfm_fp_mul(tfm_fp_int *A, tfm_fp_int *B, tfm_fp_int *C)
         }
 #endif
 
-        /* Grow when needed.  All mul routines expect the space to be there
-           and that all integers are same size. */
+        /* Grow when needed.  The generic routine reads only the used digits
+           of the inputs. */
         if (C->alloc < (y * 2) + 1)
           if (tfm_fp_grow(C, (y * 2) + 1))
             return TFM_FP_MEM;
-        if (A->alloc < (y * 2) + 1)
-          if (tfm_fp_grow(A, (y * 2) + 1))
-            return TFM_FP_MEM;
-        if (B->alloc < (y * 2) + 1)
-          if (tfm_fp_grow(B, (y * 2) + 1))
-            return TFM_FP_MEM;
 
         return tfm_fp_mul_comba(A,B,C);
 }
@@ -5826,57 +6202,22 @@ int tfm_fp_read_radix(tfm_fp_int *a, char *str, int radix)
 
 void tfm_fp_read_unsigned_bin(tfm_fp_int *a, unsigned char *b, int c)
 {
-  if (a->alloc < 2)
-    if (tfm_fp_grow(a, 2))
-      return;
+  int x, n = (c + sizeof(tfm_fp_digit) - 1) / sizeof(tfm_fp_digit);
+
+  /* grow once to the final size and place the bytes directly to the
+     digits, the most significant byte first */
+  if (tfm_fp_grow(a, n))
+    return;
 
   /* zero the int */
   tfm_fp_zeroise(a);
+  if (n)
+    memset(a->dp, 0, n * sizeof(*a->dp));
 
-  /* If we know the endianness of this architecture, and we're using
-     32-bit tfm_fp_digits, we can optimize this */
-#if (defined(ENDIAN_LITTLE) || defined(ENDIAN_BIG)) && !defined(TFM_FP_64BIT)
-  /* But not for both simultaneously */
-#if defined(ENDIAN_LITTLE) && defined(ENDIAN_BIG)
-#error Both ENDIAN_LITTLE and ENDIAN_BIG defined.
-#endif
-  {
-     unsigned char *pd = (unsigned char *)a->dp;
-
-     if ((unsigned)c > (TFM_FP_SIZE * sizeof(tfm_fp_digit))) {
-        int excess = c - (TFM_FP_SIZE * sizeof(tfm_fp_digit));
-        c -= excess;
-        b += excess;
-     }
-     a->used = (c + sizeof(tfm_fp_digit) - 1)/sizeof(tfm_fp_digit);
-     /* read the bytes in */
-#ifdef ENDIAN_BIG
-     {
-       /* Use Duff's device to unroll the loop. */
-       int idx = (c - 1) & ~3;
-       switch (c % 4) {
-       case 0:	do { pd[idx+0] = *b++;
-       case 3:	     pd[idx+1] = *b++;
-       case 2:	     pd[idx+2] = *b++;
-       case 1:	     pd[idx+3] = *b++;
-                     idx -= 4;
-	 	        } while ((c -= 4) > 0);
-       }
-     }
-#else
-     for (c -= 1; c >= 0; c -= 1) {
-       pd[c] = *b++;
-     }
-#endif
-  }
-#else
-  /* read the bytes in */
-  for (; c > 0; c--) {
-     tfm_fp_mul_2d (a, 8, a);
-     a->dp[0] |= *b++;
-     a->used += 1;
-  }
-#endif
+  a->used = n;
+  for (x = 0; x < c; x++)
+    a->dp[x / sizeof(tfm_fp_digit)] |=
+      ((tfm_fp_digit)b[c - 1 - x]) << ((x % sizeof(tfm_fp_digit)) * 8);
   tfm_fp_clamp (a);
 }
 
@@ -5959,6 +6300,9 @@ int tfm_fp_sqr(tfm_fp_int *A, tfm_fp_int *B)
 	  if (B->alloc < 40 + 1)
 	    if (tfm_fp_grow(B, 40 + 1))
 	      return TFM_FP_MEM;
+	  if (A->alloc < 20)
+	    if (tfm_fp_grow(A, 20))
+	      return TFM_FP_MEM;
 
            tfm_fp_sqr_comba20(A,B);
            return TFM_FP_OKAY;
@@ -5969,6 +6313,9 @@ int tfm_fp_sqr(tfm_fp_int *A, tfm_fp_int *B)
 	  if (B->alloc < 48 + 1)
 	    if (tfm_fp_grow(B, 48 + 1))
 	      return TFM_FP_MEM;
+	  if (A->alloc < 24)
+	    if (tfm_fp_grow(A, 24))
+	      return TFM_FP_MEM;
 
            tfm_fp_sqr_comba24(A,B);
            return TFM_FP_OKAY;
@@ -5979,6 +6326,9 @@ int tfm_fp_sqr(tfm_fp_int *A, tfm_fp_int *B)
 	  if (B->alloc < 56 + 1)
 	    if (tfm_fp_grow(B, 56 + 1))
 	      return TFM_FP_MEM;
+	  if (A->alloc < 28)
+	    if (tfm_fp_grow(A, 28))
+	      return TFM_FP_MEM;
 
            tfm_fp_sqr_comba28(A,B);
            return TFM_FP_OKAY;
@@ -5989,6 +6339,9 @@ int tfm_fp_sqr(tfm_fp_int *A, tfm_fp_int *B)
 	  if (B->alloc < 64 + 1)
 	    if (tfm_fp_grow(B, 64 + 1))
 	      return TFM_FP_MEM;
+	  if (A->alloc < 32)
+	    if (tfm_fp_grow(A, 32))
+	      return TFM_FP_MEM;
 
            tfm_fp_sqr_comba32(A,B);
            return TFM_FP_OKAY;
@@ -5999,6 +6352,9 @@ int tfm_fp_sqr(tfm_fp_int *A, tfm_fp_int *B)
 	  if (B->alloc < 96 + 1)
 	    if (tfm_fp_grow(B, 96 + 1))
 	      return TFM_FP_MEM;
+	  if (A->alloc < 48)
+	    if (tfm_fp_grow(A, 48))
+	      return TFM_FP_MEM;
 
            tfm_fp_sqr_comba48(A,B);
            return TFM_FP_OKAY;
@@ -6009,6 +6365,9 @@ int tfm_fp_sqr(tfm_fp_int *A, tfm_fp_int *B)
 	  if (B->alloc < 128 + 1)
 	    if (tfm_fp_grow(B, 128 + 1))
 	      return TFM_FP_MEM;
+	  if (A->alloc < 64)
+	    if (tfm_fp_grow(A, 64))
+	      return TFM_FP_MEM;
 
            tfm_fp_sqr_comba64(A,B);
            return TFM_FP_OKAY;
@@ -10582,18 +10941,21 @@ void tfm_fp_to_signed_bin(tfm_fp_int *a, unsigned char *b)
 
 void tfm_fp_to_unsigned_bin(tfm_fp_int *a, unsigned char *b)
 {
-  int     x;
-  tfm_fp_int  t;
+  tfm_fp_to_unsigned_bin_n(a, b, tfm_fp_unsigned_bin_size(a));
+}
 
-  if (tfm_fp_init_copy(&t, a, a->stack))
-    return;
+/* store the c least significant bytes of a to b, most significant byte
+   first.  if a is shorter the output is padded with zeroes.  reads the
+   digits directly and does not allocate memory. */
+void tfm_fp_to_unsigned_bin_n(tfm_fp_int *a, unsigned char *b, int c)
+{
+  int x, d;
 
-  x = 0;
-  while (tfm_fp_iszero (&t) == TFM_FP_NO) {
-      b[x++] = (unsigned char) (t.dp[0] & 255);
-      tfm_fp_div_2d (&t, 8, &t, NULL);
+  for (x = 0; x < c; x++) {
+    d = x / sizeof(tfm_fp_digit);
+    b[c - 1 - x] = d < (int)a->used ?
+      (unsigned char)(a->dp[d] >> ((x % sizeof(tfm_fp_digit)) * 8)) : 0;
   }
-  tfm_fp_reverse (b, x);
 }
 
 int tfm_fp_toradix(tfm_fp_int *a, char *str, int radix)
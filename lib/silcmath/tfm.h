@@ -17,6 +17,7 @@
 #include <limits.h>
 
 typedef struct tfm_fp_int_struct tfm_fp_int;
+typedef struct tfm_fp_mont_struct tfm_fp_mont;
 
 #include <silccrypto.h>
 
@@ -302,6 +303,9 @@ struct tfm_fp_int_struct {
 int tfm_fp_init_size(SilcStack stack, tfm_fp_int *a, int size);
 void tfm_fp_zero(tfm_fp_int *a);
 
+/* grow a to have at least size digits */
+int tfm_fp_grow(tfm_fp_int *a, int size);
+
 /* zero/even/odd ? */
 #define tfm_fp_iszero(a) (((a)->used == 0) ? TFM_FP_YES : TFM_FP_NO)
 #define tfm_fp_iseven(a) (((a)->used >= 0 && (((a)->dp[0] & 1) == 0)) ? TFM_FP_YES : TFM_FP_NO)
@@ -420,15 +424,60 @@ int tfm_fp_montgomery_calc_normalization(tfm_fp_int *a, tfm_fp_int *b);
 /* computes x/R == x (mod N) via Montgomery Reduction */
 int tfm_fp_montgomery_reduce(tfm_fp_int *a, tfm_fp_int *m, tfm_fp_digit mp);
 
+/* computes x/R == x (mod N) via Montgomery Reduction in constant time, the
+ * result has the digit count of N and is not clamped */
+int tfm_fp_montgomery_reduce_ct(tfm_fp_int *a, tfm_fp_int *m,
+				tfm_fp_digit mp);
+
 /* d = a**b (mod c) */
 int tfm_fp_exptmod(tfm_fp_int *a, tfm_fp_int *b, tfm_fp_int *c, tfm_fp_int *d);
 
+/* d = a**b (mod c) in constant time for secret b */
+int tfm_fp_exptmod_ct(tfm_fp_int *a, tfm_fp_int *b, tfm_fp_int *c,
+		      tfm_fp_int *d);
+
+/* d = a**b (mod c) with AVX2 or AVX-512 IFMA, in constant time if ct is
+   non-zero.  Returns TFM_FP_VAL if the CPU or the modulus is not
+   supported */
+int tfm_fp_exptmod_vec(tfm_fp_int *a, tfm_fp_int *b, tfm_fp_int *c, int ct,
+		       tfm_fp_int *d);
+
+/* enables the vector kernels of tfm_fp_exptmod_vec if enable is non-zero,
+   and disables them otherwise.  Returns non-zero if the kernels are used
+   after the call.  Meant for testing, the kernels are enabled by default */
+int tfm_fp_exptmod_vec_enable(int enable);
+
+/* precomputed Montgomery context of a modulus */
+struct tfm_fp_mont_struct {
+  tfm_fp_int n;			/* modulus */
+  tfm_fp_int r;			/* R mod n */
+  tfm_fp_int r2;		/* R**2 mod n */
+  tfm_fp_digit rho;		/* -1/n mod B */
+};
+
+/* precomputes the Montgomery context for odd modulus n */
+int tfm_fp_mont_init(tfm_fp_mont *mont, tfm_fp_int *n);
+void tfm_fp_mont_zero(tfm_fp_mont *mont);
+
+/* d = a**b (mod n) where n is the modulus of the Montgomery context */
+int tfm_fp_exptmod_mont(tfm_fp_int *a, tfm_fp_int *b, tfm_fp_mont *mont,
+			tfm_fp_int *d);
+int tfm_fp_exptmod_mont_ct(tfm_fp_int *a, tfm_fp_int *b, tfm_fp_mont *mont,
+			   tfm_fp_int *d);
+
+/* b = a * R (mod n), c = a * b / R (mod n), b = a / R (mod n) */
+int tfm_fp_mont_to(tfm_fp_int *a, tfm_fp_mont *mont, tfm_fp_int *b);
+int tfm_fp_mont_mul(tfm_fp_int *a, tfm_fp_int *b, tfm_fp_mont *mont,
+		    tfm_fp_int *c);
+int tfm_fp_mont_from(tfm_fp_int *a, tfm_fp_mont *mont, tfm_fp_int *b);
+
 /* radix conersions */
 int tfm_fp_count_bits(tfm_fp_int *a);
 
 int tfm_fp_unsigned_bin_size(tfm_fp_int *a);
 void tfm_fp_read_unsigned_bin(tfm_fp_int *a, unsigned char *b, int c);
 void tfm_fp_to_unsigned_bin(tfm_fp_int *a, unsigned char *b);
+void tfm_fp_to_unsigned_bin_n(tfm_fp_int *a, unsigned char *b, int c);
 
 int tfm_fp_signed_bin_size(tfm_fp_int *a);
 void tfm_fp_to_signed_bin(tfm_fp_int *a, unsigned char *b);
@@ -0,0 +1,475 @@
+/*
+
+  tfm_vec.c
+
+  Author: Pekka Riikonen <priikone@silcnet.org>
+
+  Copyright (C) 2008 Pekka Riikonen
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; version 2 of the License.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+*/
+
+/* Vectorized Montgomery exponentiation for TFM.
+
+   The operands are split into digits of 29 bits (AVX2) or 52 bits
+   (AVX-512 IFMA), one digit in each 64-bit lane, so that the products of
+   the digits can be accumulated in the lanes without propagating the
+   carries.  The carries are propagated only after several rows of the
+   multiplication.  The multiplication is almost Montgomery multiplication:
+   when the inputs are less than 2n the result is less than 2n, and only
+   the final result is fully reduced.
+
+   The kernels are compiled with the target attribute so the rest of the
+   library does not need the instruction set extensions.  The kernel is
+   selected at run-time by the CPU features. */
+
+#include <tfm.h>
+
+#if defined(TFM_X86_64) && defined(__GNUC__) && !defined(SILC_NO_ASM) && \
+  (__GNUC__ >= 5 || defined(__clang__))
+#define TFM_VEC
+#endif /* TFM_X86_64 && __GNUC__ */
+
+#ifdef TFM_VEC
+
+#include <immintrin.h>
+#include <cpuid.h>
+
+/* Modulus size range where the vector kernels are used */
+#define TFM_VEC_MIN_BITS 1024
+#define TFM_VEC_MAX_BITS 4096
+
+/* Exponentiation window size */
+#define TFM_VEC_WINSIZE 5
+
+/* Zero digits around the operands, the kernels may read past them */
+#define TFM_VEC_PAD 4
+
+/* CPUID and XCR0 feature bits */
+#define TFM_VEC_CPUID_OSXSAVE    (1 << 27)
+#define TFM_VEC_CPUID_AVX2       (1 << 5)
+#define TFM_VEC_CPUID_AVX512F    (1 << 16)
+#define TFM_VEC_CPUID_AVX512IFMA (1 << 21)
+#define TFM_VEC_XCR0_YMM         0x06
+#define TFM_VEC_XCR0_ZMM         0xe6
+
+/* r = a * b / R (mod m), the result is less than 2m.  The b and m must have
+   TFM_VEC_PAD zero digits before and after them.  The `t' is scratch of
+   4 * n + TFM_VEC_PAD digits. */
+typedef void (*tfm_vec_mul_func)(ulong64 *r, const ulong64 *a,
+				 const ulong64 *b, const ulong64 *m,
+				 ulong64 k0, int n, ulong64 *t);
+
+/* Vector kernel */
+typedef struct {
+  tfm_vec_mul_func mul;		/* Multiplication */
+  int bits;			/* Bits in digit */
+  int lanes;			/* Digits in vector */
+} tfm_vec_kernel;
+
+/* Propagates the carries of n digits of t, the last carry is added to
+   t[n] */
+
+static inline void tfm_vec_carry(ulong64 *t, int n, int bits)
+{
+  ulong64 c = 0, mask = ((ulong64)1 << bits) - 1;
+  int i;
+
+  for (i = 0; i < n; i++) {
+    c += t[i];
+    t[i] = c & mask;
+    c >>= bits;
+  }
+  t[n] += c;
+}
+
+/* AVX2 multiplication with 29-bit digits.  Two rows are added at a time,
+   the second row shifted by one digit.  Each pair of rows adds less than
+   2^60 to a digit, so the carries are propagated after every 8 rows.  The
+   b and m are read one digit before and four digits after them. */
+
+__attribute__((target("avx2")))
+static void tfm_vec_mul29(ulong64 *r, const ulong64 *a, const ulong64 *b,
+			  const ulong64 *m, ulong64 k0, int n, ulong64 *t)
+{
+  __m256i a0, a1, y0, y1, x;
+  ulong64 u, v0, v1;
+  int i, j;
+
+  memset(t, 0, (2 * n + TFM_VEC_PAD) * sizeof(*t));
+
+  for (i = 0; i < n; i += 2) {
+    /* y0 = (t + a[i] * b) * -1/m (mod 2^29), and y1 the same for the next
+       row after adding the first row */
+    u = t[i] + a[i] * b[0];
+    v0 = (u * k0) & 0x1fffffff;
+    u = (u + v0 * m[0]) >> 29;
+    u += t[i + 1] + a[i] * b[1] + v0 * m[1] + a[i + 1] * b[0];
+    v1 = (u * k0) & 0x1fffffff;
+
+    a0 = _mm256_set1_epi64x(a[i]);
+    a1 = _mm256_set1_epi64x(a[i + 1]);
+    y0 = _mm256_set1_epi64x(v0);
+    y1 = _mm256_set1_epi64x(v1);
+
+    /* t += a[i] * b + y0 * m + (a[i + 1] * b + y1 * m) * 2^29 */
+    for (j = 0; j <= n; j += 4) {
+      x = _mm256_loadu_si256((__m256i *)(t + i + j));
+      x = _mm256_add_epi64(x, _mm256_mul_epu32(a0,
+		_mm256_loadu_si256((__m256i *)(b + j))));
+      x = _mm256_add_epi64(x, _mm256_mul_epu32(y0,
+		_mm256_loadu_si256((__m256i *)(m + j))));
+      x = _mm256_add_epi64(x, _mm256_mul_epu32(a1,
+		_mm256_loadu_si256((__m256i *)(b + j - 1))));
+      x = _mm256_add_epi64(x, _mm256_mul_epu32(y1,
+		_mm256_loadu_si256((__m256i *)(m + j - 1))));
+      _mm256_storeu_si256((__m256i *)(t + i + j), x);
+    }
+
+    /* The two lowest digits are now zero, move their carries up */
+    t[i + 1] += t[i] >> 29;
+    t[i + 2] += t[i + 1] >> 29;
+
+    if ((i & 7) == 6)
+      tfm_vec_carry(t + i + 2, n, 29);
+  }
+
+  tfm_vec_carry(t + n, n, 29);
+  memcpy(r, t + n, n * sizeof(*r));
+}
+
+/* AVX-512 IFMA multiplication with 52-bit digits.  The low halves of the
+   products are accumulated to t and the high halves to h, where h[k] has
+   the weight of t[k + 1].  Each row adds less than 2^53 to a digit, so the
+   carries are propagated after every 32 rows. */
+
+__attribute__((target("avx512f,avx512ifma")))
+static void tfm_vec_mul52(ulong64 *r, const ulong64 *a, const ulong64 *b,
+			  const ulong64 *m, ulong64 k0, int n, ulong64 *t)
+{
+  __m512i ai, y, x, bj, mj;
+  ulong64 *h = t + 2 * n + 1, y0, c;
+  int i, j;
+
+  memset(t, 0, (4 * n + 2) * sizeof(*t));
+
+  for (i = 0; i < n; i++) {
+    /* y = (t + a[i] * b) * -1/m (mod 2^52) */
+    c = t[i] + (i ? h[i - 1] : 0);
+    y0 = ((c + a[i] * b[0]) * k0) & 0xfffffffffffffULL;
+    ai = _mm512_set1_epi64(a[i]);
+    y = _mm512_set1_epi64(y0);
+
+    /* t += a[i] * b + y * m */
+    for (j = 0; j < n; j += 8) {
+      bj = _mm512_loadu_si512((void *)(b + j));
+      mj = _mm512_loadu_si512((void *)(m + j));
+      x = _mm512_loadu_si512((void *)(t + i + j));
+      x = _mm512_madd52lo_epu64(x, ai, bj);
+      x = _mm512_madd52lo_epu64(x, y, mj);
+      _mm512_storeu_si512((void *)(t + i + j), x);
+      x = _mm512_loadu_si512((void *)(h + i + j));
+      x = _mm512_madd52hi_epu64(x, ai, bj);
+      x = _mm512_madd52hi_epu64(x, y, mj);
+      _mm512_storeu_si512((void *)(h + i + j), x);
+    }
+
+    /* The lowest digit is now zero, move its carry up */
+    t[i + 1] += (t[i] + (i ? h[i - 1] : 0)) >> 52;
+
+    if ((i & 31) == 31) {
+      for (j = i; j < i + n; j++) {
+	t[j + 1] += h[j];
+	h[j] = 0;
+      }
+      tfm_vec_carry(t + i + 1, n, 52);
+    }
+  }
+
+  for (j = n - 1; j < 2 * n - 1; j++)
+    t[j + 1] += h[j];
+  tfm_vec_carry(t + n, n, 52);
+  memcpy(r, t + n, n * sizeof(*r));
+}
+
+static const tfm_vec_kernel tfm_vec_avx2 = { tfm_vec_mul29, 29, 4 };
+static const tfm_vec_kernel tfm_vec_ifma = { tfm_vec_mul52, 52, 8 };
+
+/* Set when the kernels may be used, see tfm_fp_exptmod_vec_enable */
+static int tfm_vec_enabled = 1;
+
+/* Returns the fastest kernel that the CPU and the OS support, or NULL */
+
+static const tfm_vec_kernel *tfm_vec_get_kernel(void)
+{
+  static const tfm_vec_kernel *kernel = NULL;
+  static int checked = 0;
+  unsigned int eax, ebx, ecx, edx, xcr0, xcr0h;
+
+  if (checked)
+    return kernel;
+
+  if (__get_cpuid(1, &eax, &ebx, &ecx, &edx) &&
+      (ecx & TFM_VEC_CPUID_OSXSAVE) && __get_cpuid_max(0, NULL) >= 7) {
+    __asm__ volatile ("xgetbv" : "=a" (xcr0), "=d" (xcr0h) : "c" (0));
+    __cpuid_count(7, 0, eax, ebx, ecx, edx);
+
+    if ((xcr0 & TFM_VEC_XCR0_ZMM) == TFM_VEC_XCR0_ZMM &&
+	(ebx & TFM_VEC_CPUID_AVX512F) && (ebx & TFM_VEC_CPUID_AVX512IFMA))
+      kernel = &tfm_vec_ifma;
+    else if ((xcr0 & TFM_VEC_XCR0_YMM) == TFM_VEC_XCR0_YMM &&
+	     (ebx & TFM_VEC_CPUID_AVX2))
+      kernel = &tfm_vec_avx2;
+  }
+
+  SILC_LOG_DEBUG(("Vector Montgomery kernel: %s", !kernel ? "none" :
+		  kernel == &tfm_vec_ifma ? "AVX-512 IFMA" : "AVX2"));
+
+  checked = 1;
+  return kernel;
+}
+
+/* Converts a to n digits of `bits' bits */
+
+static void tfm_vec_from_fp(ulong64 *d, tfm_fp_int *a, int n, int bits)
+{
+  int i, k, o;
+
+  for (i = 0; i < n; i++) {
+    k = i * bits / DIGIT_BIT;
+    o = i * bits % DIGIT_BIT;
+    d[i] = 0;
+    if (k >= a->used)
+      continue;
+    d[i] = a->dp[k] >> o;
+    if (o + bits > DIGIT_BIT && k + 1 < a->used)
+      d[i] |= a->dp[k + 1] << (DIGIT_BIT - o);
+    d[i] &= ((ulong64)1 << bits) - 1;
+  }
+}
+
+/* Converts n digits of `bits' bits to a */
+
+static int tfm_vec_to_fp(tfm_fp_int *a, ulong64 *d, int n, int bits)
+{
+  int i, k, o, used = (n * bits + DIGIT_BIT - 1) / DIGIT_BIT;
+
+  if (tfm_fp_grow(a, used))
+    return TFM_FP_MEM;
+  memset(a->dp, 0, used * sizeof(*a->dp));
+
+  for (i = 0; i < n; i++) {
+    k = i * bits / DIGIT_BIT;
+    o = i * bits % DIGIT_BIT;
+    a->dp[k] |= d[i] << o;
+    if (o + bits > DIGIT_BIT)
+      a->dp[k + 1] |= d[i] >> (DIGIT_BIT - o);
+  }
+
+  a->used = used;
+  a->sign = TFM_FP_ZPOS;
+  tfm_fp_clamp(a);
+  return TFM_FP_OKAY;
+}
+
+/* r = r - m if r >= m.  The subtraction is always computed and the result
+   is selected with a mask.  The `t' is scratch of n digits. */
+
+static void tfm_vec_reduce(ulong64 *r, const ulong64 *m, ulong64 *t, int n,
+			   int bits)
+{
+  ulong64 borrow = 0, mask, digit = ((ulong64)1 << bits) - 1;
+  int i;
+
+  /* The digits are less than 2**52, negative difference sets the top bit */
+  for (i = 0; i < n; i++) {
+    t[i] = r[i] - m[i] - borrow;
+    borrow = t[i] >> 63;
+    t[i] &= digit;
+  }
+
+  mask = borrow - 1;
+  for (i = 0; i < n; i++)
+    r[i] = (t[i] & mask) | (r[i] & ~mask);
+}
+
+/* Returns `cnt' bits of x starting from bit `pos' */
+
+static int tfm_vec_get_bits(tfm_fp_int *x, int pos, int cnt)
+{
+  int i, k, v = 0;
+
+  for (i = pos + cnt - 1; i >= pos; i--) {
+    k = i / DIGIT_BIT;
+    v <<= 1;
+    if (k < x->used)
+      v |= (x->dp[k] >> (i % DIGIT_BIT)) & 1;
+  }
+
+  return v;
+}
+
+/* Copies the entry `win' of the table M to r.  All entries are read so
+   that the memory access does not depend on `win'.  Both kernels have
+   AVX2. */
+
+__attribute__((target("avx2")))
+static void tfm_vec_gather(ulong64 *r, ulong64 *M, int win, int n, int s)
+{
+  __m256i mask[1 << TFM_VEC_WINSIZE], x, w;
+  int i, k;
+
+  w = _mm256_set1_epi64x(win);
+  for (k = 0; k < 1 << TFM_VEC_WINSIZE; k++)
+    mask[k] = _mm256_cmpeq_epi64(_mm256_set1_epi64x(k), w);
+
+  for (i = 0; i < n; i += 4) {
+    x = _mm256_setzero_si256();
+    for (k = 0; k < 1 << TFM_VEC_WINSIZE; k++)
+      x = _mm256_or_si256(x, _mm256_and_si256(mask[k],
+		_mm256_loadu_si256((__m256i *)(M + k * s + i))));
+    _mm256_storeu_si256((__m256i *)(r + i), x);
+  }
+}
+
+/* y = g**x (mod p) with the vector kernel.  If `ct' is non-zero the
+   multiplications and the table access do not depend on the bits of x.
+   Returns TFM_FP_VAL if the kernel cannot be used. */
+
+int tfm_fp_exptmod_vec(tfm_fp_int *G, tfm_fp_int *X, tfm_fp_int *P, int ct,
+		       tfm_fp_int *Y)
+{
+  const tfm_vec_kernel *k;
+  tfm_fp_int tmp;
+  ulong64 *buf, *m, *g, *r, *w, *t, *M, inv, k0;
+  int bits, n, s, len, i, j, win, err = TFM_FP_MEM;
+
+  bits = tfm_fp_count_bits(P);
+  if (bits < TFM_VEC_MIN_BITS || bits > TFM_VEC_MAX_BITS ||
+      tfm_fp_iseven(P) || P->sign == TFM_FP_NEG ||
+      tfm_fp_iszero(X) || X->sign == TFM_FP_NEG)
+    return TFM_FP_VAL;
+
+  k = tfm_vec_enabled ? tfm_vec_get_kernel() : NULL;
+  if (!k)
+    return TFM_FP_VAL;
+
+  /* R = 2**(n * k->bits) > 4p, n is multiple of the vector length */
+  n = (bits + 2 + k->bits - 1) / k->bits;
+  n = (n + k->lanes - 1) / k->lanes * k->lanes;
+
+  /* Each operand is padded with zero digits */
+  s = n + 2 * TFM_VEC_PAD;
+  len = (4 + (1 << TFM_VEC_WINSIZE)) * s + 4 * n + TFM_VEC_PAD;
+  buf = silc_calloc(len, sizeof(*buf));
+  if (!buf)
+    return TFM_FP_MEM;
+  m = buf + TFM_VEC_PAD;
+  g = m + s;
+  r = g + s;
+  w = r + s;
+  M = w + s;
+  t = M + (1 << TFM_VEC_WINSIZE) * s - TFM_VEC_PAD;
+
+  if (tfm_fp_init_size(Y->stack, &tmp, P->used * 2 + 1))
+    goto out;
+
+  /* -1/p (mod 2**k->bits) */
+  inv = P->dp[0];
+  for (i = 0; i < 5; i++)
+    inv *= 2 - P->dp[0] * inv;
+  k0 = (0 - inv) & (((ulong64)1 << k->bits) - 1);
+  tfm_vec_from_fp(m, P, n, k->bits);
+
+  /* R**2 mod p */
+  if (tfm_fp_2expt(&tmp, 2 * n * k->bits) || tfm_fp_mod(&tmp, P, &tmp))
+    goto out;
+  tfm_vec_from_fp(r, &tmp, n, k->bits);
+
+  /* g mod p */
+  if (tfm_fp_cmp_mag(P, G) != TFM_FP_GT) {
+    if (tfm_fp_mod(G, P, &tmp))
+      goto out;
+  } else {
+    if (tfm_fp_copy(G, &tmp))
+      goto out;
+  }
+  tfm_vec_from_fp(g, &tmp, n, k->bits);
+
+  /* M[x] = g**x * R (mod p) */
+  k->mul(&M[s], g, r, m, k0, n, t);
+  memset(g, 0, n * sizeof(*g));
+  g[0] = 1;
+  k->mul(&M[0], r, g, m, k0, n, t);
+  for (i = 2; i < 1 << TFM_VEC_WINSIZE; i++)
+    k->mul(&M[i * s], &M[(i - 1) * s], &M[s], m, k0, n, t);
+
+  /* Fixed window exponentiation from the most significant window.  In
+     constant time the windows start from the most significant digit and
+     every window is multiplied. */
+  j = ct ? X->used * DIGIT_BIT : tfm_fp_count_bits(X);
+  j = (j - 1) / TFM_VEC_WINSIZE * TFM_VEC_WINSIZE;
+  win = tfm_vec_get_bits(X, j, TFM_VEC_WINSIZE);
+  if (ct)
+    tfm_vec_gather(r, M, win, n, s);
+  else
+    memcpy(r, &M[win * s], n * sizeof(*r));
+  for (j -= TFM_VEC_WINSIZE; j >= 0; j -= TFM_VEC_WINSIZE) {
+    for (i = 0; i < TFM_VEC_WINSIZE; i++)
+      k->mul(r, r, r, m, k0, n, t);
+    win = tfm_vec_get_bits(X, j, TFM_VEC_WINSIZE);
+    if (ct) {
+      tfm_vec_gather(w, M, win, n, s);
+      k->mul(r, r, w, m, k0, n, t);
+    } else if (win) {
+      k->mul(r, r, &M[win * s], m, k0, n, t);
+    }
+  }
+
+  /* Out of Montgomery form, the result is at most p */
+  k->mul(r, r, g, m, k0, n, t);
+  tfm_vec_reduce(r, m, w, n, k->bits);
+  if (tfm_vec_to_fp(&tmp, r, n, k->bits))
+    goto out;
+
+  tfm_fp_exch(&tmp, Y);
+  err = TFM_FP_OKAY;
+
+ out:
+  tfm_fp_zero(&tmp);
+  memset(buf, 0, len * sizeof(*buf));
+  silc_free(buf);
+  return err;
+}
+
+/* Enables or disables the vector kernels.  Returns non-zero if the kernels
+   are used after this. */
+
+int tfm_fp_exptmod_vec_enable(int enable)
+{
+  tfm_vec_enabled = enable;
+  return enable && tfm_vec_get_kernel() != NULL;
+}
+
+#else /* !TFM_VEC */
+
+int tfm_fp_exptmod_vec_enable(int enable)
+{
+  return 0;
+}
+
+int tfm_fp_exptmod_vec(tfm_fp_int *G, tfm_fp_int *X, tfm_fp_int *P, int ct,
+		       tfm_fp_int *Y)
+{
+  return TFM_FP_VAL;
+}
+
+#endif /* TFM_VEC */
@@ -390,14 +390,16 @@ SILC_PKCS_ALG_IMPORT_PUBLIC_KEY(silc_pgp_rsa_import_public_key)
     goto err;
 
   /* Get MP integers */
-  silc_mp_init(&pubkey->n);
-  silc_mp_init(&pubkey->e);
+  silc_mp_init_size(&pubkey->n, n_len * 8);
+  silc_mp_init_size(&pubkey->e, e_len * 8);
   silc_mp_bin2mp(n, n_len, &pubkey->n);
   silc_mp_bin2mp(e, e_len, &pubkey->e);
 
   /* Set key length */
   pubkey->bits = silc_mp_sizeinbase(&pubkey->n, 2);
 
+  silc_rsa_public_key_mont_init(pubkey);
+
   return silc_buffer_headlen(&alg_key);
 
  err:
@@ -518,10 +520,10 @@ SILC_PKCS_ALG_IMPORT_PRIVATE_KEY(silc_pgp_rsa_import_private_key)
     goto err;
 
   /* Get MP integers */
-  silc_mp_init(&privkey->d);
-  silc_mp_init(&privkey->p);
-  silc_mp_init(&privkey->q);
-  silc_mp_init(&privkey->qP);
+  silc_mp_init_size(&privkey->d, d_len * 8);
+  silc_mp_init_size(&privkey->p, p_len * 8);
+  silc_mp_init_size(&privkey->q, q_len * 8);
+  silc_mp_init_size(&privkey->qP, u_len * 8);
   silc_mp_bin2mp(d, d_len, &privkey->d);
   silc_mp_bin2mp(p, p_len, &privkey->p);
   silc_mp_bin2mp(q, q_len, &privkey->q);
@@ -545,6 +547,8 @@ SILC_PKCS_ALG_IMPORT_PRIVATE_KEY(silc_pgp_rsa_import_private_key)
   /* Set key length */
   privkey->bits = silc_mp_sizeinbase(&privkey->n, 2);
 
+  silc_rsa_private_key_mont_init(privkey);
+
   return silc_buffer_headlen(&alg_key);
 
  err:
@@ -561,6 +565,12 @@ SILC_PKCS_ALG_EXPORT_PRIVATE_KEY(silc_pgp_rsa_export_private_key)
   unsigned char *d = NULL, *p = NULL, *q = NULL, *u = NULL, *ret;
   SilcUInt16 d_len, p_len, q_len, u_len;
 
+  /* Multi-prime key cannot be encoded in OpenPGP */
+  if (privkey->num_other) {
+    SILC_LOG_DEBUG(("Cannot export multi-prime RSA key"));
+    return NULL;
+  }
+
   /* In OpenPGP the u is p^-1 mod q, but our RSA implementation uses
      q^-1 mod p (PKCS#1 compliant), thus we reverse p and q to make the
      key correct. */
@@ -683,10 +693,10 @@ SILC_PKCS_ALG_IMPORT_PUBLIC_KEY(silc_pgp_dsa_import_public_key)
     goto err;
 
   /* Get MP integers */
-  silc_mp_init(&pubkey->p);
-  silc_mp_init(&pubkey->q);
-  silc_mp_init(&pubkey->g);
-  silc_mp_init(&pubkey->y);
+  silc_mp_init_size(&pubkey->p, p_len * 8);
+  silc_mp_init_size(&pubkey->q, q_len * 8);
+  silc_mp_init_size(&pubkey->g, g_len * 8);
+  silc_mp_init_size(&pubkey->y, y_len * 8);
   silc_mp_bin2mp(p, p_len, &pubkey->p);
   silc_mp_bin2mp(q, q_len, &pubkey->q);
   silc_mp_bin2mp(g, g_len, &pubkey->g);
@@ -695,6 +705,8 @@ SILC_PKCS_ALG_IMPORT_PUBLIC_KEY(silc_pgp_dsa_import_public_key)
   /* Set key length */
   pubkey->bits = silc_mp_sizeinbase(&pubkey->p, 2);
 
+  silc_dsa_public_key_mont_init(pubkey);
+
   return silc_buffer_headlen(&alg_key);
 
  err:
@@ -745,7 +757,7 @@ SILC_PKCS_ALG_IMPORT_PRIVATE_KEY(silc_pgp_dsa_import_private_key)
     goto err;
 
   /* Get MP integers */
-  silc_mp_init(&privkey->x);
+  silc_mp_init_size(&privkey->x, x_len * 8);
   silc_mp_bin2mp(x, x_len, &privkey->x);
 
   return silc_buffer_headlen(&alg_key);
@@ -253,6 +253,8 @@ SilcBool silc_ssh_generate_key(const char *algorithm,
   if (subject)
     silc_ssh_public_key_add_field(pubkey, "Subject", subject);
 
+  silc_pkcs_public_key_compute_digest(*ret_public_key);
+
   return TRUE;
 }
 
@@ -264,7 +266,7 @@ int silc_ssh_public_key_decode(unsigned char *key, SilcUInt32 key_len,
   SilcSshPublicKey public_key;
   const SilcPKCSAlgorithm *alg;
   SilcBufferStruct keybuf;
-  char *type = NULL;
+  char *type = NULL, name[32];
 
   SILC_LOG_DEBUG(("Parse SSH2 public key"));
 
@@ -308,6 +310,24 @@ int silc_ssh_public_key_decode(unsigned char *key, SilcUInt32 key_len,
     }
     public_key->pkcs = alg;
 
+  } else if (!strncmp(type, "ecdsa-sha2-", 11)) {
+    /* ECDSA public key.  The curve is checked after import. */
+    alg = silc_pkcs_find_algorithm("ecdsa", "ssh");
+    if (!alg) {
+      SILC_LOG_ERROR(("Unsupported SSH2 public key type '%s'", type));
+      goto err;
+    }
+    public_key->pkcs = alg;
+
+  } else if (!strcmp(type, "ssh-ed25519")) {
+    /* Ed25519 public key */
+    alg = silc_pkcs_find_algorithm("ed25519", "ssh");
+    if (!alg) {
+      SILC_LOG_ERROR(("Unsupported SSH2 public key type '%s'", type));
+      goto err;
+    }
+    public_key->pkcs = alg;
+
   } else {
     SILC_LOG_ERROR(("Unsupported SSH2 public key type '%s'", type));
     goto err;
@@ -319,6 +339,17 @@ int silc_ssh_public_key_decode(unsigned char *key, SilcUInt32 key_len,
 			      &public_key->public_key))
     goto err;
 
+  /* The ECDSA key type has the curve name, must match the key */
+  if (!strcmp(alg->name, "ecdsa")) {
+    silc_snprintf(name, sizeof(name), "ecdsa-sha2-nistp%d",
+		  alg->public_key_bitlen(alg, public_key->public_key));
+    if (strcmp(type, name)) {
+      SILC_LOG_ERROR(("SSH2 public key type '%s' does not match key", type));
+      alg->public_key_free(alg, public_key->public_key);
+      goto err;
+    }
+  }
+
   silc_free(type);
 
   *ret_public_key = public_key;
@@ -339,7 +370,7 @@ unsigned char *silc_ssh_public_key_encode(SilcStack stack,
 {
   const SilcPKCSAlgorithm *alg = public_key->pkcs;
   SilcBufferStruct buf;
-  unsigned char *pk = NULL, tmp[16];
+  unsigned char *pk = NULL, tmp[32];
   SilcUInt32 pk_len;
 
   SILC_LOG_DEBUG(("Encode SSH2 public key"));
@@ -349,6 +380,11 @@ unsigned char *silc_ssh_public_key_encode(SilcStack stack,
     silc_snprintf(tmp, sizeof(tmp), "ssh-rsa");
   else if (!strcmp(alg->name, "dsa"))
     silc_snprintf(tmp, sizeof(tmp), "ssh-dss");
+  else if (!strcmp(alg->name, "ecdsa"))
+    silc_snprintf(tmp, sizeof(tmp), "ecdsa-sha2-nistp%d",
+		  alg->public_key_bitlen(alg, public_key->public_key));
+  else if (!strcmp(alg->name, "ed25519"))
+    silc_snprintf(tmp, sizeof(tmp), "ssh-ed25519");
   else
     return NULL;
 
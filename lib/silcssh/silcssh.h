@@ -28,11 +28,13 @@
  * keys.
  *
  * The library supports creation of new SSH2 key pairs, encryption, decryption,
- * signatures and verification.  Both RSA and DSS SSH2 keys are supported.
- * The library supports the standard SSH2 public key file format defined
- * in RFC 4716 and the OpenSSH public key file format.  The private key file
- * format support includes OpenSSH private key files.  The signature format
- * is compliant with the SSH2 protocol.
+ * signatures and verification.  RSA, DSS, ECDSA and Ed25519 SSH2 keys are
+ * supported.  The library supports the standard SSH2 public key file format
+ * defined in RFC 4716 and the OpenSSH public key file format.  The private
+ * key file format support includes OpenSSH private key files.  Ed25519
+ * private keys are in the OpenSSH "openssh-key-v1" format, which is
+ * supported only unencrypted.  The signature format is compliant with the
+ * SSH2 protocol.
  *
  * EXAMPLE
  *
@@ -145,10 +147,12 @@ typedef struct SilcSshPrivateKeyStruct  {
  *
  * DESCRIPTION
  *
- *    Generates new SSH2 key pair.  The `algorithm' is either rsa or dsa.
- *    The `bits_len' specify the key length in bits.  The `subject' is
- *    usually the email address of the user creating the key or some other
- *    similar subject name.  Returns FALSE on error.
+ *    Generates new SSH2 key pair.  The `algorithm' is rsa, dsa, ecdsa or
+ *    ed25519.  The `bits_len' specify the key length in bits.  With ecdsa
+ *    it is either 256 or 384 and selects the curve, and with ed25519 it is
+ *    always 256.  The `subject' is usually
+ *    the email address of the user creating the key or some other similar
+ *    subject name.  Returns FALSE on error.
  *
  * EXAMPLE
  *
@@ -46,4 +46,9 @@ SILC_PKCS_ALG_EXPORT_PUBLIC_KEY(silc_ssh_rsa_export_public_key);
 SILC_PKCS_ALG_IMPORT_PUBLIC_KEY(silc_ssh_dsa_import_public_key);
 SILC_PKCS_ALG_EXPORT_PUBLIC_KEY(silc_ssh_dsa_export_public_key);
 
+SILC_PKCS_ALG_IMPORT_PUBLIC_KEY(silc_ssh_ecdsa_import_public_key);
+SILC_PKCS_ALG_EXPORT_PUBLIC_KEY(silc_ssh_ecdsa_export_public_key);
+SILC_PKCS_ALG_IMPORT_PUBLIC_KEY(silc_ssh_ed25519_import_public_key);
+SILC_PKCS_ALG_EXPORT_PUBLIC_KEY(silc_ssh_ed25519_export_public_key);
+
 #endif /* SILCSSH_PKCS_H */